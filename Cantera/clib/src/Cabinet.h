@@ -13,6 +13,94 @@
 #include "stringUtils.h"
 #include "config.h"
 
+#include "ct_thread.h"
+
+//! Macros for locking a handle table for reading or modification
+#define HANDLE_READ_LOCK(m) Cantera::ReadLock h_lock(m)
+#define HANDLE_WRITE_LOCK(m) Cantera::WriteLock h_lock(m)
+
+/**
+ * Table of pointers indexed by integer handles. Every access to the
+ * table holds its lock, so objects may be added, looked up and
+ * deleted from several threads at once. Lookups hold the lock in
+ * shared mode, so they do not wait on each other; only add(),
+ * release() and clear() hold it exclusively. The lock is held only
+ * while the table itself is read or modified; objects are
+ * constructed and destroyed by the caller outside of the lock, so
+ * threads creating their own objects do not wait on each other.
+ *
+ * Handles are never reused until clear() is called, so that a
+ * deleted handle keeps referring to the sentinel entry 0. clear()
+ * must not be called while other threads are using the table.
+ */
+template<class M>
+class HandleTable {
+public:
+
+    HandleTable() {}
+
+    //! Store a pointer in a new slot, and return its handle.
+    int add(M* ptr) {
+        HANDLE_WRITE_LOCK(m_mutex);
+        m_items.push_back(ptr);
+        return static_cast<int>(m_items.size()) - 1;
+    }
+
+    //! Pointer stored in slot n. No range check.
+    M* operator[](int n) const {
+        HANDLE_READ_LOCK(m_mutex);
+        return m_items[n];
+    }
+
+    //! Pointer stored in slot n. Throws if n is out of range.
+    M* at(int n) const {
+        HANDLE_READ_LOCK(m_mutex);
+        if (n < 0 || n >= static_cast<int>(m_items.size())) {
+            throw Cantera::CanteraError("HandleTable::at",
+                "index out of range "+Cantera::int2str(n));
+        }
+        return m_items[n];
+    }
+
+    /**
+     * Replace the pointer in slot n > 0 with the sentinel in slot 0,
+     * and return the pointer it held. Returns 0 if the slot already
+     * held the sentinel, so that when several threads release the
+     * same handle only one of them receives the pointer to delete.
+     */
+    M* release(int n) {
+        HANDLE_WRITE_LOCK(m_mutex);
+        if (n <= 0 || n >= static_cast<int>(m_items.size())) {
+            throw Cantera::CanteraError("HandleTable::release",
+                "index out of range "+Cantera::int2str(n));
+        }
+        M* old = m_items[n];
+        if (old == m_items[0]) return 0;
+        m_items[n] = m_items[0];
+        return old;
+    }
+
+    //! Number of handles issued.
+    size_t size() const {
+        HANDLE_READ_LOCK(m_mutex);
+        return m_items.size();
+    }
+
+    //! Forget all entries.
+    void clear() { 
+        HANDLE_WRITE_LOCK(m_mutex);
+        m_items.clear();
+    }
+
+private:
+    std::vector<M*> m_items;
+    mutable Cantera::shared_mutex_t m_mutex;
+
+    // not copyable
+    HandleTable(const HandleTable&);
+    HandleTable& operator=(const HandleTable&);
+};
+
 /**
  * Template for classes to hold pointers to objects. The Cabinet<M>
  * class maintains a list of pointers to objects of class M (or of
@@ -59,7 +147,11 @@
  * Cabinet<M>::cabinet() is called to obtain a pointer to the
  * instance. This function calls the constructor on the first call and
  * stores the pointer to this instance. Subsequent calls simply return
- * the already-created pointer.
+ * the already-created pointer, without taking a lock.
+ *
+ * The pointers are held in a HandleTable, so objects may be added,
+ * referenced and deleted from several threads at once when Cantera
+ * is built with THREAD_SAFE_CANTERA. clear() is not thread-safe.
  */
 
 template<class M>
@@ -77,9 +169,8 @@ public:
      * through this function.
      */
     static Cabinet<M>* cabinet(bool canDelete = true) {
-        if (__storage == 0) {
-            __storage = new Cabinet<M>(canDelete);
-        }
+        CT_ONCE_FLAG(created);
+        Cantera::callOnce(created, canDelete ? create : createNoDelete);
         return __storage;
     }
 
@@ -88,12 +179,7 @@ public:
      * Add a new object. The index of the object is returned.  
      */
     int add(M* ptr) {
-        //try {
-        __table.push_back(ptr);
-        return static_cast<int>(__table.size()) - 1;
-        //}
-        //catch (CanteraError) {return -1;}
-        //catch (...) {return -999;}
+        return __table.add(ptr);
     }
 
 
@@ -103,9 +189,8 @@ public:
      */
     int newCopy(int i) {
         try {
-            M* old = __table[i];
-            __table.push_back(new M(*old));
-            return static_cast<int>(__table.size()) - 1;
+            M* old = item(i);
+            return __table.add(new M(*old));
         }
         catch (Cantera::CanteraError) {return -1;}
         catch (...) {return -999;}
@@ -119,8 +204,8 @@ public:
      */
     int assign(int i, int j) {
         try {
-            M* src = __table[j];
-            M* dest = __table[i];
+            M* src = item(j);
+            M* dest = item(i);
             *dest = *src;
             return 0;
         }
@@ -135,7 +220,10 @@ public:
     int clear() {
         int i, n;
         n = static_cast<int>(__table.size());
-        for (i = 1; i < n; i++) {del(i);}
+        for (i = 1; i < n; i++) {
+            M* p = __table.release(i);
+            if (p && _can_delete) delete p;
+        }
         if (_can_delete) delete __table[0];
         __table.clear();
         add(new M);
@@ -150,14 +238,12 @@ public:
      */
     void del(int n) {
         if (n == 0) return;
-        if (__table[n] != __table[0]) {
-            if (_can_delete) delete __table[n];
-            __table[n] = __table[0]; 
-        }
-        else {
+        M* p = __table.release(n);
+        if (p == 0) {
             throw Cantera::CanteraError("Cabinet<M>::del", 
                 "Attempt made to delete an already-deleted object.");
         } 
+        if (_can_delete) delete p;
     }
 
 
@@ -165,12 +251,7 @@ public:
      * Return a pointer to object n.
      */
     M* item(int n) {
-        if (n >= 0 && n < int(__table.size()))
-            return __table[n];
-        else {
-            throw Cantera::CanteraError("item","index out of range"+Cantera::int2str(n));
-            //return __table[0];
-        }
+        return __table.at(n);
     }
 
     /**
@@ -185,6 +266,12 @@ private:
      */
     //    Cabinet(bool canDelete = true) : _can_delete(canDelete) { add(new M); }
 
+    //! Create the instance. Called once by cabinet().
+    static void create() { __storage = new Cabinet<M>(true); }
+
+    //! Create an instance that does not delete its objects.
+    static void createNoDelete() { __storage = new Cabinet<M>(false); }
+
 
     /**
      * Pointer to the single instance of this class.
@@ -192,9 +279,9 @@ private:
     static Cabinet<M>* __storage;
 
     /**
-     * Vector to hold pointers to objects.
+     * Table to hold pointers to objects.
      */
-    std::vector<M*> __table;
+    HandleTable<M> __table;
 
     /**
      * Set to false if 'clear' should not delete the entries.
@@ -28,8 +28,7 @@ Storage::~Storage() { clear(); }
 int Storage::addThermo(thermo_t* th) {
     if (th->index() >= 0)
         return th->index();
-    __thtable.push_back(th);
-    int n = static_cast<int>(__thtable.size()) - 1;
+    int n = __thtable.add(th);
     th->setIndex(n);
     //string id = th->id();
     //if (__thmap.count(id) == 0) {
@@ -50,8 +49,7 @@ int Storage::nThermo() {
 int Storage::addKinetics(Kinetics* kin) {
     if (kin->index() >= 0)
         return kin->index();
-    __ktable.push_back(kin);
-    int n = static_cast<int>(__ktable.size()) - 1;
+    int n = __ktable.add(kin);
     kin->setIndex(n);
     return n;
 }
@@ -59,8 +57,7 @@ int Storage::addKinetics(Kinetics* kin) {
 int Storage::addTransport(Transport* tr) {
     if (tr->index() >= 0)
         return tr->index();
-    __trtable.push_back(tr);
-    int n = static_cast<int>(__trtable.size()) - 1;
+    int n = __trtable.add(tr);
     tr->setIndex(n);
     return n;
 }
@@ -81,48 +78,30 @@ int Storage::addTransport(Transport* tr) {
 int Storage::clear() {
     int i, n;
     n = static_cast<int>(__thtable.size());
-    for (i = 1; i < n; i++) {
-        if (__thtable[i] != __thtable[0]) {
-            delete __thtable[i];
-            __thtable[i] = __thtable[0];
-        }
-    }
+    for (i = 1; i < n; i++) delete __thtable.release(i);
     n = static_cast<int>(__ktable.size());
-    for (i = 1; i < n; i++) {
-        if (__ktable[i] != __ktable[0]) {
-            delete __ktable[i];
-            __ktable[i] = __ktable[0];
-        }
-    }
+    for (i = 1; i < n; i++) delete __ktable.release(i);
     n = static_cast<int>(__trtable.size());
-    for (i = 1; i < n; i++) {
-        if (__trtable[i] != __trtable[0]) {
-            delete __trtable[i];
-            __trtable[i] = __trtable[0];
-        }
-    }
+    for (i = 1; i < n; i++) delete __trtable.release(i);
     return 0;
 }
 
+// The release() calls throw if the index is out of range, and return
+// 0 if the object has already been deleted.
+
 void Storage::deleteKinetics(int n) {
     if (n == 0) return;
-    if (__ktable[n] != __ktable[0])
-        delete __ktable[n];
-    __ktable[n] = __ktable[0];
+    delete __ktable.release(n);
 }
 
 void Storage::deleteThermo(int n) {
     if (n == 0) return;
-    if (n < 0 || n >= (int) __thtable.size())
-        throw CanteraError("deleteThermo","illegal index");
-    __thtable[n] = __thtable[0];
+    __thtable.release(n);
 }
 
 void Storage::deleteTransport(int n) {
     if (n == 0) return;
-    if (__trtable[n] != __trtable[0])
-        delete __trtable[n];
-    __trtable[n] = __trtable[0];
+    delete __trtable.release(n);
 }
 
 Storage* Storage::__storage = 0;
@@ -18,27 +18,31 @@
 
 /**
  * Class to hold pointers to Cantera objects. Only one instance of
- * this class is needed.
+ * this class is needed. The pointers are held in HandleTable
+ * objects, so that thermo, kinetics and transport managers may be
+ * added, used and deleted from several threads at once.
  */
 class Storage {
 public:
     Storage();
     virtual ~Storage();
 
-    // vectors to hold pointers to objects
-    std::vector<Cantera::Kinetics*> __ktable;
-    std::vector<Cantera::thermo_t*> __thtable;
-    std::vector<Cantera::Transport*> __trtable;
+    // tables to hold pointers to objects
+    HandleTable<Cantera::Kinetics> __ktable;
+    HandleTable<Cantera::thermo_t> __thtable;
+    HandleTable<Cantera::Transport> __trtable;
 
     std::map<std::string, int> __thmap;
 
     static Storage* storage() {
-        if (__storage == 0) {
-            __storage = new Storage;
-        }
+        CT_ONCE_FLAG(created);
+        Cantera::callOnce(created, create);
         return __storage;
     }
 
+    //! Create the instance. Called once by storage().
+    static void create() { __storage = new Storage; }
+
 
     int addThermo(Cantera::ThermoPhase* th);
     int addKinetics(Cantera::Kinetics* kin);
@@ -31,6 +31,7 @@
 #include "Cabinet.h"
 #include "InterfaceKinetics.h"
 #include "PureFluidPhase.h"
+#include "ProfileData.h"
 
 
 using namespace std;
@@ -1107,6 +1108,67 @@ extern "C" {
         catch (CanteraError) { return -1; }
     }
 
+    //------------------- Arrays of states ---------------------
+    //
+    // These functions evaluate properties for nstates states,
+    // specified by temperature t[i], pressure p[i] and the mass
+    // fractions y[i*ldy + k]. The loop over states is done here, so
+    // that the handle lookup and the call overhead are paid once per
+    // call rather than once per state. The phase is left in the last
+    // state.
+
+    int DLL_EXPORT th_getEnthalpyCp_mass_TPY(int n, int nstates, 
+        const double* t, const double* p, int ldy, const double* y, 
+        double* h, double* cp) {
+        try {
+            ThermoPhase* thrm = th(n);
+            if (ldy < thrm->nSpecies()) return ERR;
+            for (int i = 0; i < nstates; i++) {
+                thrm->setState_TPY(t[i], p[i], y + i*ldy);
+                h[i] = thrm->enthalpy_mass();
+                cp[i] = thrm->cp_mass();
+            }
+            return 0;
+        }
+        catch (CanteraError) {return -1;}
+    }
+
+    int DLL_EXPORT kin_getNetProductionRates_TPY(int n, int nstates, 
+        const double* t, const double* p, int ldy, const double* y, 
+        int ldw, double* wdot) {
+        try {
+            Kinetics* k = kin(n);
+            ThermoPhase* thrm = &k->thermo();
+            if (ldy < thrm->nSpecies() || ldw < k->nTotalSpecies()) 
+                return ERR;
+            for (int i = 0; i < nstates; i++) {
+                thrm->setState_TPY(t[i], p[i], y + i*ldy);
+                k->getNetProductionRates(wdot + i*ldw);
+            }
+            return 0;
+        }
+        catch (CanteraError) {return -1;}
+    }
+
+    int DLL_EXPORT trans_getMixProperties_TPY(int n, int nstates, 
+        const double* t, const double* p, int ldy, const double* y, 
+        double* visc, double* cond, int ldd, double* d) {
+        try {
+            Transport* tr = trans(n);
+            ThermoPhase* thrm = &tr->thermo();
+            int nsp = thrm->nSpecies();
+            if (ldy < nsp || ldd < nsp) return ERR;
+            for (int i = 0; i < nstates; i++) {
+                thrm->setState_TPY(t[i], p[i], y + i*ldy);
+                visc[i] = tr->viscosity();
+                cond[i] = tr->thermalConductivity();
+                tr->getMixDiffCoeffs(d + i*ldd);
+            }
+            return 0;
+        }
+        catch (CanteraError) {return -1;}
+    }
+
     //-------------------- Functions ---------------------------
 
     int DLL_EXPORT import_phase(int nth, int nxml, char* id) {
@@ -1229,13 +1291,23 @@ extern "C" {
     }
 
     int DLL_EXPORT delKinetics(int n) {
-        Storage::storage()->deleteKinetics(n);
-        return 0;
+        try {
+            Storage::storage()->deleteKinetics(n);
+            return 0;
+        }
+        catch (CanteraError) {
+            return -1;
+        }
     }
 
     int DLL_EXPORT delTransport(int n) {
-        Storage::storage()->deleteTransport(n);
-        return 0;
+        try {
+            Storage::storage()->deleteTransport(n);
+            return 0;
+        }
+        catch (CanteraError) {
+            return -1;
+        }
     }
 
     int DLL_EXPORT buildSolutionFromXML(char* src, int ixml, char* id, 
@@ -1279,5 +1351,20 @@ extern "C" {
         return 0;
     }
 
+    int DLL_EXPORT writeProfileReport(char* fname) {
+        try {
+            Cantera::writeProfileReport(string(fname));
+            return 0;
+        }
+        catch (CanteraError) {
+            return -1;
+        }
+    }
+
+    int DLL_EXPORT resetProfiles() {
+        Cantera::resetProfiles();
+        return 0;
+    }
+
 
 }
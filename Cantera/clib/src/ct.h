@@ -156,6 +156,16 @@ extern "C" {
     EEXXTT int DLL_CPREFIX trans_getMolarFluxes(int n, const double* state1,
         const double* state2, double delta, double* fluxes);
 
+    EEXXTT int DLL_CPREFIX th_getEnthalpyCp_mass_TPY(int n, int nstates,
+        const double* t, const double* p, int ldy, const double* y,
+        double* h, double* cp);
+    EEXXTT int DLL_CPREFIX kin_getNetProductionRates_TPY(int n, int nstates,
+        const double* t, const double* p, int ldy, const double* y,
+        int ldw, double* wdot);
+    EEXXTT int DLL_CPREFIX trans_getMixProperties_TPY(int n, int nstates,
+        const double* t, const double* p, int ldy, const double* y,
+        double* visc, double* cond, int ldd, double* d);
+
     EEXXTT int DLL_CPREFIX import_phase(int nth, int nxml, char* id);
     EEXXTT int DLL_CPREFIX import_kinetics(int nxml, char* id, 
         int nphases, int* ith, int nkin);
@@ -178,6 +188,8 @@ extern "C" {
     EEXXTT int DLL_CPREFIX ck_to_cti(char* in_file, char* db_file,
         char* tr_file, char* id_tag, int debug, int validate);
     EEXXTT int DLL_CPREFIX writelogfile(char* logfile);
+    EEXXTT int DLL_CPREFIX writeProfileReport(char* fname);
+    EEXXTT int DLL_CPREFIX resetProfiles();
 }
 
 #endif
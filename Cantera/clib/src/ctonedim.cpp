@@ -21,6 +21,7 @@
 #include "Sim1D.h"
 #include "StFlow.h"
 #include "Inlet1D.h"
+#include "MultiNewton.h"
 #include "DenseMatrix.h"
 
 
@@ -534,6 +535,14 @@ extern "C" {
         catch (CanteraError) { return -1; }
     }
 
+    int DLL_EXPORT sim1D_remesh(int i, int dom, int npts, int loglevel) {
+        try {
+            _sim1D(i)->remesh(dom, npts, loglevel);
+            return 0;
+        }
+        catch (CanteraError) { return -1; }
+    }
+
     int DLL_EXPORT sim1D_setRefineCriteria(int i, int dom, double ratio,
         double slope, double curve, double prune) {
         try {
@@ -610,6 +619,57 @@ extern "C" {
         catch (CanteraError) { return -1; }
     }
 
+    int DLL_EXPORT sim1D_setBlockTridiagonal(int i, int flag) {
+        try {
+            _sim1D(i)->setBlockTridiagonal(flag != 0);
+            return 0;
+        }
+        catch (CanteraError) { return -1; }
+    }
+
+    int DLL_EXPORT sim1D_setNewtonKrylov(int i, int flag, int kdim,
+        int maxit, double etamax, int gaussSeidel) {
+        try {
+            _sim1D(i)->newton().setKrylovOptions(kdim, maxit, etamax,
+                gaussSeidel != 0);
+            _sim1D(i)->setNewtonKrylov(flag != 0);
+            return 0;
+        }
+        catch (CanteraError) { return -1; }
+    }
+
+    int DLL_EXPORT sim1D_setTransportJacAge(int i, int age) {
+        try {
+            _sim1D(i)->setTransportJacAge(age);
+            return 0;
+        }
+        catch (CanteraError) { return -1; }
+    }
+
+    int DLL_EXPORT sim1D_setProfiling(int i, int flag) {
+        try {
+            _sim1D(i)->profile().enable(flag != 0);
+            return 0;
+        }
+        catch (CanteraError) { return -1; }
+    }
+
+    int DLL_EXPORT sim1D_resetProfile(int i) {
+        try {
+            _sim1D(i)->profile().reset();
+            return 0;
+        }
+        catch (CanteraError) { return -1; }
+    }
+
+    int DLL_EXPORT sim1D_writeProfile(int i, char* fname) {
+        try {
+            _sim1D(i)->profile().save(fname);
+            return 0;
+        }
+        catch (CanteraError) { return -1; }
+    }
+
     int DLL_EXPORT sim1D_timeStepFactor(int i, double tfactor) {
         try {
             _sim1D(i)->setTimeStepFactor(tfactor);
@@ -659,4 +719,74 @@ extern "C" {
         catch (CanteraError) { return -1; }
     }
 
+    int DLL_EXPORT sim1D_setContinuationOptions(int i, double ds,
+        double dsmin, double dsmax, int secant, int maxiter) {
+        try {
+            _sim1D(i)->setContinuationOptions(ds, dsmin, dsmax,
+                secant != 0, maxiter);
+            return 0;
+        }
+        catch (CanteraError) { return -1; }
+    }
+
+    /**
+     * Take one continuation step. The parameter is specified by
+     * ptype: 0 = mass flux of boundary dom (if dom2 >= 0, the mass
+     * flux of boundary dom2 is changed in proportion), 1 =
+     * temperature of boundary dom, 2 = pressure in flow domain dom,
+     * 3 = fixed temperature of flow domain dom.
+     */
+    int DLL_EXPORT sim1D_continuationStep(int i, int ptype, int dom,
+        int dom2, double direction, int loglevel) {
+        try {
+            Sim1D* sim = _sim1D(i);
+            switch (ptype) {
+            case 0: {
+                MdotParameter p(*_bdry(dom), (dom2 >= 0 ? _bdry(dom2) : 0));
+                return sim->continuationStep(p, direction, loglevel);
+            }
+            case 1: {
+                BoundaryTemperatureParameter p(*_bdry(dom));
+                return sim->continuationStep(p, direction, loglevel);
+            }
+            case 2: {
+                PressureParameter p(*_stflow(dom));
+                return sim->continuationStep(p, direction, loglevel);
+            }
+            case 3: {
+                FixedTemperatureParameter p(*_stflow(dom));
+                return sim->continuationStep(p, direction, loglevel);
+            }
+            default:
+                throw CanteraError("sim1D_continuationStep",
+                    "unknown parameter type "+int2str(ptype));
+            }
+        }
+        catch (CanteraError) { return -1; }
+    }
+
+    /**
+     * Take one continuation step in the composition of inlet dom,
+     * which is a mixture of streams with mass fractions y0 and y1.
+     */
+    int DLL_EXPORT sim1D_mixtureContinuationStep(int i, int dom,
+        int nsp, double* y0, double* y1, double direction, int loglevel) {
+        try {
+            Inlet1D* inlet = dynamic_cast<Inlet1D*>(_domain(dom));
+            if (!inlet)
+                throw CanteraError("sim1D_mixtureContinuationStep",
+                    "domain "+int2str(dom)+" is not an inlet");
+            InletMixtureParameter p(*inlet, nsp, y0, y1);
+            return _sim1D(i)->continuationStep(p, direction, loglevel);
+        }
+        catch (CanteraError) { return -1; }
+    }
+
+    double DLL_EXPORT sim1D_continuationStepSize(int i) {
+        try {
+            return _sim1D(i)->continuationStepSize();
+        }
+        catch (CanteraError) { return DERR; }
+    }
+
 }
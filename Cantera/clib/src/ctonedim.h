@@ -79,6 +79,7 @@ extern "C" {
     EEXXTT int DLL_CPREFIX sim1D_getInitialSoln(int i);
     EEXXTT int DLL_CPREFIX sim1D_solve(int i, int loglevel, int refine_grid);
     EEXXTT int DLL_CPREFIX sim1D_refine(int i, int loglevel);
+    EEXXTT int DLL_CPREFIX sim1D_remesh(int i, int dom, int npts, int loglevel);
     EEXXTT int DLL_CPREFIX sim1D_setRefineCriteria(int i, int dom, double ratio,
         double slope, double curve, double prune);
     EEXXTT int DLL_CPREFIX sim1D_save(int i, char* fname, char* id, 
@@ -91,12 +92,26 @@ extern "C" {
         int icomp, int localPoint);
     EEXXTT int DLL_CPREFIX sim1D_eval(int i, double rdt, int count);
     EEXXTT int DLL_CPREFIX sim1D_setMaxJacAge(int i, int ss_age, int ts_age);
+    EEXXTT int DLL_CPREFIX sim1D_setBlockTridiagonal(int i, int flag);
+    EEXXTT int DLL_CPREFIX sim1D_setNewtonKrylov(int i, int flag, int kdim,
+        int maxit, double etamax, int gaussSeidel);
+    EEXXTT int DLL_CPREFIX sim1D_setTransportJacAge(int i, int age);
+    EEXXTT int DLL_CPREFIX sim1D_setProfiling(int i, int flag);
+    EEXXTT int DLL_CPREFIX sim1D_resetProfile(int i);
+    EEXXTT int DLL_CPREFIX sim1D_writeProfile(int i, char* fname);
     EEXXTT int DLL_CPREFIX sim1D_timeStepFactor(int i, double tfactor);
     EEXXTT int DLL_CPREFIX sim1D_setTimeStepLimits(int i, double tsmin, double tsmax);
     EEXXTT int DLL_CPREFIX sim1D_setFixedTemperature(int i, double temp);
     EEXXTT int DLL_CPREFIX sim1D_evalSSJacobian(int i);
     EEXXTT double DLL_CPREFIX sim1D_jacobian(int i, int m, int n);
     EEXXTT int DLL_CPREFIX sim1D_size(int i);
+    EEXXTT int DLL_CPREFIX sim1D_setContinuationOptions(int i, double ds,
+        double dsmin, double dsmax, int secant, int maxiter);
+    EEXXTT int DLL_CPREFIX sim1D_continuationStep(int i, int ptype, int dom,
+        int dom2, double direction, int loglevel);
+    EEXXTT int DLL_CPREFIX sim1D_mixtureContinuationStep(int i, int dom,
+        int nsp, double* y0, double* y1, double direction, int loglevel);
+    EEXXTT double DLL_CPREFIX sim1D_continuationStepSize(int i);
 }
 
 
@@ -11,5 +11,6 @@
 #include "kernel/GasKinetics.h"
 #include "kernel/KineticsFactory.h"
 #include "kernel/importKinetics.h"
+#include "kernel/MechanismReducer.h"
 
 #endif
@@ -125,6 +125,10 @@ MODULE CANTERA
      MODULE PROCEDURE ctthermo_getElementName
   END INTERFACE getElementName
 
+  INTERFACE getEnthalpyCp_mass_TPY
+     MODULE PROCEDURE ctthermo_getEnthalpyCp_mass_TPY
+  END INTERFACE getEnthalpyCp_mass_TPY
+
   INTERFACE getEnthalpies_RT
      MODULE PROCEDURE ctthermo_getEnthalpies_RT
   END INTERFACE getEnthalpies_RT
@@ -149,6 +153,10 @@ MODULE CANTERA
      MODULE PROCEDURE ctrans_getMixDiffCoeffs
   END INTERFACE getMixDiffCoeffs
 
+  INTERFACE getMixProperties_TPY
+     MODULE PROCEDURE ctrans_getMixProperties_TPY
+  END INTERFACE getMixProperties_TPY
+
   INTERFACE getMoleFractions
      MODULE PROCEDURE ctthermo_getMoleFractions
   END INTERFACE getMoleFractions
@@ -163,6 +171,7 @@ MODULE CANTERA
 
   INTERFACE getNetProductionRates
      MODULE PROCEDURE ctkin_getNetProductionRates
+     MODULE PROCEDURE ctkin_getNetProductionRates_TPY
   END INTERFACE getNetProductionRates
 
   INTERFACE getNetRatesOfProgress
@@ -200,4 +200,18 @@ module cantera_kinetics
       self%err = kin_advancecoverages(self%kin_id, tstep)
     end subroutine ctkin_advancecoverages
 
+    subroutine ctkin_getNetProductionRates_TPY(self, nstates, t, p, y, wdot)
+      implicit none
+      type(phase_t), intent(inout) :: self
+      integer, intent(in) :: nstates
+      double precision, intent(in) :: t(nstates)
+      double precision, intent(in) :: p(nstates)
+      double precision, intent(in) :: y(self%nsp,nstates)
+      double precision, intent(out) :: wdot(*)
+      integer :: nkin
+      nkin = kin_ntotalspecies(self%kin_id)
+      self%err = kin_getnetproductionrates_tpy(self%kin_id, nstates, t, p, &
+           self%nsp, y, nkin, wdot)
+    end subroutine ctkin_getnetproductionrates_tpy
+
 end module cantera_kinetics
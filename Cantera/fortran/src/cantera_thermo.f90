@@ -457,4 +457,17 @@ contains
       self%err = th_getcp_r(self%thermo_id, lenm, cp_r)
     end subroutine ctthermo_getcp_r
 
+    subroutine ctthermo_getEnthalpyCp_mass_TPY(self, nstates, t, p, y, h, cp)
+      implicit none
+      type(phase_t), intent(inout) :: self
+      integer, intent(in) :: nstates
+      double precision, intent(in) :: t(nstates)
+      double precision, intent(in) :: p(nstates)
+      double precision, intent(in) :: y(self%nsp,nstates)
+      double precision, intent(out) :: h(nstates)
+      double precision, intent(out) :: cp(nstates)
+      self%err = th_getenthalpycp_mass_tpy(self%thermo_id, nstates, t, p, &
+           self%nsp, y, h, cp)
+    end subroutine ctthermo_getenthalpycp_mass_tpy
+
 end module cantera_thermo
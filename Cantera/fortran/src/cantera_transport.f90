@@ -71,4 +71,18 @@ contains
       self%err = trans_setParameters(self%tran_id, type, k, d)
     end subroutine ctrans_setParameters
 
+    subroutine ctrans_getMixProperties_TPY(self, nstates, t, p, y, visc, cond, d)
+      implicit none
+      type(phase_t), intent(inout) :: self
+      integer, intent(in) :: nstates
+      double precision, intent(in) :: t(nstates)
+      double precision, intent(in) :: p(nstates)
+      double precision, intent(in) :: y(self%nsp,nstates)
+      double precision, intent(out) :: visc(nstates)
+      double precision, intent(out) :: cond(nstates)
+      double precision, intent(out) :: d(self%nsp,nstates)
+      self%err = trans_getMixProperties_TPY(self%tran_id, nstates, t, p, &
+           self%nsp, y, visc, cond, self%nsp, d)
+    end subroutine ctrans_getMixProperties_TPY
+
 end module cantera_transport
@@ -436,6 +436,28 @@ extern "C" {
         return 0;
     }
 
+    // Specific enthalpy and cp for nstates states, given as T(i), P(i)
+    // and mass fractions Y(1:nsp, i), with Y dimensioned Y(ldy, *).
+    // The phase is left in the last state.
+    status_t DLL_EXPORT th_getenthalpycp_mass_tpy_(const integer* n, 
+        integer* nstates, doublereal* t, doublereal* p, integer* ldy, 
+        doublereal* y, doublereal* h, doublereal* cp) {
+        try {
+            thermo_t* thrm = _fth(n);
+            if (*ldy < thrm->nSpecies()) {
+                throw CanteraError("th_getenthalpycp_mass_tpy",
+                    "leading dimension of y is too small");
+            }
+            for (int i = 0; i < *nstates; i++) {
+                thrm->setState_TPY(t[i], p[i], y + i * *ldy);
+                h[i] = thrm->enthalpy_mass();
+                cp[i] = thrm->cp_mass();
+            }
+            return 0;
+        }
+        catch (CanteraError) {handleError(); return -1;}
+    }
+
 
     //-------------- Kinetics ------------------//
 
@@ -637,6 +659,28 @@ extern "C" {
         catch (CanteraError) {handleError(); return -1;}
     }
 
+    // Net production rates for nstates states of the first phase,
+    // given as T(i), P(i) and Y(1:nsp, i). The rates are returned in
+    // wdot(1:nsp, i), with wdot dimensioned wdot(ldw, *).
+    status_t DLL_EXPORT kin_getnetproductionrates_tpy_(const integer* n, 
+        integer* nstates, doublereal* t, doublereal* p, integer* ldy, 
+        doublereal* y, integer* ldw, doublereal* wdot) {
+        try {
+            Kinetics* k = _fkin(n);
+            thermo_t* thrm = &k->thermo();
+            if (*ldy < thrm->nSpecies() || *ldw < k->nTotalSpecies()) {
+                throw CanteraError("kin_getnetproductionrates_tpy",
+                    "leading dimension of y or wdot is too small");
+            }
+            for (int i = 0; i < *nstates; i++) {
+                thrm->setState_TPY(t[i], p[i], y + i * *ldy);
+                k->getNetProductionRates(wdot + i * *ldw);
+            }
+            return 0;
+        }
+        catch (CanteraError) {handleError(); return -1;}
+    }
+
     //------------------- Transport ---------------------------
 
     integer DLL_EXPORT newtransport_(char* model,  
@@ -685,6 +729,32 @@ extern "C" {
         catch (CanteraError) { handleError(); return -1; }
     }
 
+    // Viscosity, thermal conductivity and mixture-averaged diffusion
+    // coefficients d(1:nsp, i) for nstates states given as T(i), P(i)
+    // and Y(1:nsp, i).
+    status_t DLL_EXPORT trans_getmixproperties_tpy_(const integer* n, 
+        integer* nstates, doublereal* t, doublereal* p, integer* ldy, 
+        doublereal* y, doublereal* visc, doublereal* cond, integer* ldd, 
+        doublereal* d) {
+        try {
+            Transport* tr = _ftrans(n);
+            thermo_t* thrm = &tr->thermo();
+            int nsp = thrm->nSpecies();
+            if (*ldy < nsp || *ldd < nsp) {
+                throw CanteraError("trans_getmixproperties_tpy",
+                    "leading dimension of y or d is too small");
+            }
+            for (int i = 0; i < *nstates; i++) {
+                thrm->setState_TPY(t[i], p[i], y + i * *ldy);
+                visc[i] = tr->viscosity();
+                cond[i] = tr->thermalConductivity();
+                tr->getMixDiffCoeffs(d + i * *ldd);
+            }
+            return 0;
+        }
+        catch (CanteraError) { handleError(); return -1; }
+    }
+
     //-------------------- Functions ---------------------------
 
 //     status_t DLL_EXPORT import_phase_(const integer* nth, const integer* nxml, char* id, ftnlen lenid) {
@@ -249,6 +249,17 @@ interface
         double precision, intent(out) :: cp_r(*)
     end function th_getcp_r
 
+    integer function th_getenthalpycp_mass_tpy(n, nstates, t, p, ldy, y, h, cp)
+        integer, intent(in) :: n
+        integer, intent(in) :: nstates
+        double precision, intent(in) :: t(*)
+        double precision, intent(in) :: p(*)
+        integer, intent(in) :: ldy
+        double precision, intent(in) :: y(ldy,*)
+        double precision, intent(out) :: h(*)
+        double precision, intent(out) :: cp(*)
+    end function th_getenthalpycp_mass_tpy
+
     integer function newkineticsfromxml(mxml, iphase, neighbor1, neighbor2, neighbor3, neighbor4)
         integer, intent(in) :: mxml
         integer, intent(in) :: iphase
@@ -369,6 +380,17 @@ interface
         double precision, intent(in) :: tstep
     end function kin_advancecoverages
 
+    integer function kin_getnetproductionrates_tpy(n, nstates, t, p, ldy, y, ldw, wdot)
+        integer, intent(in) :: n
+        integer, intent(in) :: nstates
+        double precision, intent(in) :: t(*)
+        double precision, intent(in) :: p(*)
+        integer, intent(in) :: ldy
+        double precision, intent(in) :: y(ldy,*)
+        integer, intent(in) :: ldw
+        double precision, intent(out) :: wdot(ldw,*)
+    end function kin_getnetproductionrates_tpy
+
     integer function newtransport(model, ith, loglevel)
         character*(*), intent(in) :: model
         integer, intent(in) :: ith
@@ -412,6 +434,19 @@ interface
         double precision, intent(in) :: d(*)
     end function trans_setParameters
 
+    integer function trans_getMixProperties_TPY(n, nstates, t, p, ldy, y, visc, cond, ldd, d)
+        integer, intent(in) :: n
+        integer, intent(in) :: nstates
+        double precision, intent(in) :: t(*)
+        double precision, intent(in) :: p(*)
+        integer, intent(in) :: ldy
+        double precision, intent(in) :: y(ldy,*)
+        double precision, intent(out) :: visc(*)
+        double precision, intent(out) :: cond(*)
+        integer, intent(in) :: ldd
+        double precision, intent(out) :: d(ldd,*)
+    end function trans_getMixProperties_TPY
+
     integer function ctphase_report(nth, buf, show_thermo)
         integer, intent(in) :: nth
         character*(*), intent(out) :: buf
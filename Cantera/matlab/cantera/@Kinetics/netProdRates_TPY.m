@@ -0,0 +1,15 @@
+function wdot = netProdRates_TPY(a, t, p, y)
+% NETPRODRATES_TPY  Net chemical production rates for many states.
+%
+%    wdot = netProdRates_TPY(a, t, p, y)
+%
+%        Returns an nSpecies x N matrix whose columns are the net
+%        production rates of all species for the N states with
+%        temperatures t(n), pressures p(n), and mass fractions
+%        y(:,n). The loop over states is carried out in the
+%        Cantera kernel. On return the phase is left in the last
+%        state.
+%
+%    See also: netProdRates
+%
+wdot = kinetics_get(a.id,43,t,p,y);
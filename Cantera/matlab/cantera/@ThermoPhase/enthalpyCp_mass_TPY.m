@@ -0,0 +1,14 @@
+function [h, cp] = enthalpyCp_mass_TPY(a, t, p, y)
+% ENTHALPYCP_MASS_TPY - Specific enthalpy [J/kg] and specific heat at
+% constant pressure [J/kg-K] for many states.
+%
+%    [h, cp] = enthalpyCp_mass_TPY(a, t, p, y)
+%
+%        Returns row vectors of the enthalpy and cp of the N states
+%        with temperatures t(n), pressures p(n), and mass fractions
+%        y(:,n). The loop over states is carried out in the Cantera
+%        kernel. On return the phase is left in the last state.
+%
+v = thermo_get(a.tp_id,50,t,p,y);
+h = v(1,:);
+cp = v(2,:);
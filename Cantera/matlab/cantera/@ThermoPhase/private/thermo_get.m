@@ -1,8 +1,10 @@
-function i = thermo_get(n, job, a, b) 
+function i = thermo_get(n, job, a, b, c) 
 if nargin == 2
   i = ctmethods(20,n, job);
 elseif nargin == 3
   i = ctmethods(20,n, job,a);
-else
+elseif nargin == 4
   i = ctmethods(20, n, job, a, b);
+else
+  i = ctmethods(20, n, job, a, b, c);
 end
\ No newline at end of file
@@ -0,0 +1,19 @@
+function [visc, cond, d] = mixProperties_TPY(a, t, p, y)
+%MIXPROPERTIES_TPY  Transport properties for many states.
+%
+%    [visc, cond, d] = mixProperties_TPY(gas, t, p, y)
+%
+%    returns row vectors of the viscosity (Pa-s) and thermal
+%    conductivity (W/m-K), and an nSpecies x N matrix of the
+%    mixture-averaged diffusion coefficients (m^2/s), for the N
+%    states with temperatures t(n), pressures p(n), and mass
+%    fractions y(:,n). The loop over states is carried out in the
+%    Cantera kernel. The transport manager must have been created
+%    with the 'Mix' option.
+%
+%    See also: mixDiffCoeffs
+%
+v = trans_get(a.id, 41, nSpecies(a.th), t, p, y);
+visc = v(1,:);
+cond = v(2,:);
+d = v(3:end,:);
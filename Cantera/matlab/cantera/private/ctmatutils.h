@@ -18,6 +18,25 @@ inline double getDouble(A* mxhndl) {
     return double(mxGetScalar(mxhndl));
 }
 
+// Get the arrays of temperatures, pressures and mass fractions for a
+// set of states from prhs[i], prhs[i+1] and prhs[i+2]. T and P must
+// have nstates elements, and Y must be an nsp x nstates matrix, so
+// that the mass fractions of each state are contiguous. Returns
+// nstates.
+inline int getStates(const mxArray* prhs[], int i, int nsp,
+    double*& t, double*& p, double*& y) {
+    int nstates = mxGetNumberOfElements(prhs[i]);
+    if (mxGetNumberOfElements(prhs[i+1]) != nstates 
+        || int(mxGetM(prhs[i+2])) != nsp 
+        || int(mxGetN(prhs[i+2])) != nstates) {
+        mexErrMsgTxt("T and P must have N elements, and Y must be nSpecies x N");
+    }
+    t = mxGetPr(prhs[i]);
+    p = mxGetPr(prhs[i+1]);
+    y = mxGetPr(prhs[i+2]);
+    return nstates;
+}
+
 inline char* getString(const mxArray* p) {
     char* input_buf = 0;
     int status;
@@ -31,6 +31,28 @@ void kineticsmethods( int nlhs, mxArray *plhs[],
         return;
     }
 
+    // properties for arrays of states
+    else if (job >= 40 && job < 50) {
+        checkNArgs(6, nrhs);
+        kin = getInt(prhs[1]);
+        int nsp = kin_nSpecies(kin);
+        double *t, *p, *y;
+        int nstates = getStates(prhs, 3, nsp, t, p, y);
+        plhs[0] = mxCreateNumericMatrix(nsp,nstates,mxDOUBLE_CLASS,mxREAL);
+        double *h = mxGetPr(plhs[0]);
+        int ok = -10;
+        switch (job) {
+        case 43:
+            ok = kin_getNetProductionRates_TPY(kin, nstates, t, p, 
+                nsp, y, nsp, h); 
+            break;
+        default:
+            ;
+        }
+        if (ok < 0)
+            mexErrMsgTxt("error computing production rates");
+    }
+
     // methods
     else if (job > 0) {
         int isp = 1;
@@ -197,6 +197,26 @@ static void thermoget( int nlhs, mxArray *plhs[],
             }
         }
 
+        // properties for arrays of states
+        else if (job == 50) {
+            int nsp = th_nSpecies(n);
+            double *t, *p, *y;
+            int nstates = getStates(prhs, 3, nsp, t, p, y);
+            plhs[0] = mxCreateNumericMatrix(2,nstates,
+                mxDOUBLE_CLASS,mxREAL);
+            double *h = mxGetPr(plhs[0]);
+            double* cp = new double[nstates];
+            int iok = th_getEnthalpyCp_mass_TPY(n, nstates, t, p, nsp, y, 
+                h, cp);
+            // return h in row 1, cp in row 2
+            for (int i = nstates - 1; i >= 0; i--) {
+                h[2*i] = h[i];
+                h[2*i+1] = cp[i];
+            }
+            delete[] cp;
+            if (iok < 0) reportError();
+        }
+
         else {
             mexErrMsgTxt("unknown attribute");
         }
@@ -100,6 +100,31 @@ void reportError();
             h = mxGetPr(plhs[0]);
             *h = double(iok);
         }
+        // properties for arrays of states
+        else if (job == 41) {
+            nsp = getInt(prhs[3]);
+            double *t, *p, *y;
+            int nstates = getStates(prhs, 4, nsp, t, p, y);
+            double* visc = new double[nstates];
+            double* cond = new double[nstates];
+            double* d = new double[nsp*nstates];
+            iok = trans_getMixProperties_TPY(n, nstates, t, p, nsp, y, 
+                visc, cond, nsp, d);
+            // one column per state: viscosity, conductivity, then the
+            // diffusion coefficients
+            plhs[0] = mxCreateNumericMatrix(nsp+2,nstates,
+                mxDOUBLE_CLASS,mxREAL);
+            h = mxGetPr(plhs[0]);
+            for (int i = 0; i < nstates; i++) {
+                h[i*(nsp+2)] = visc[i];
+                h[i*(nsp+2)+1] = cond[i];
+                for (int k = 0; k < nsp; k++) 
+                    h[i*(nsp+2)+2+k] = d[i*nsp+k];
+            }
+            delete[] visc;
+            delete[] cond;
+            delete[] d;
+        }
         else {
             mexErrMsgTxt("unknown Transport method");
         }
@@ -200,17 +200,17 @@ class Kinetics:
                 nu[k,i] = _cantera.kin_pstoichcoeff(self.ckin,k,i)
         return nu
     
-    def fwdRatesOfProgress(self):
+    def fwdRatesOfProgress(self, out = None):
         """Forward rates of progress of the reactions."""
-        return _cantera.kin_getarray(self.ckin,10)
+        return _cantera.kin_getarray(self.ckin,10,out)
 
-    def revRatesOfProgress(self):
+    def revRatesOfProgress(self, out = None):
         """Reverse rates of progress of the reactions."""
-        return _cantera.kin_getarray(self.ckin,20)
+        return _cantera.kin_getarray(self.ckin,20,out)
 
-    def netRatesOfProgress(self):
+    def netRatesOfProgress(self, out = None):
         """Net rates of progress of the reactions."""
-        return _cantera.kin_getarray(self.ckin,30)
+        return _cantera.kin_getarray(self.ckin,30,out)
 
     def equilibriumConstants(self):
         """Equilibrium constants in concentration units for all reactions."""
@@ -231,8 +231,8 @@ class Kinetics:
         else:
             return _cantera.kin_getarray(self.ckin,36)
         
-    def creationRates(self, phase = None):
-        c = _cantera.kin_getarray(self.ckin,50)
+    def creationRates(self, phase = None, out = None):
+        c = _cantera.kin_getarray(self.ckin,50,out)
         if phase:
             kp = phase.thermophase()
             if self._phnum.has_key(kp):
@@ -244,8 +244,8 @@ class Kinetics:
             return c                
                 
 
-    def destructionRates(self, phase = None):
-        d = _cantera.kin_getarray(self.ckin,60)
+    def destructionRates(self, phase = None, out = None):
+        d = _cantera.kin_getarray(self.ckin,60,out)
         if phase:
             kp = phase.thermophase()            
             if self._phnum.has_key(kp):
@@ -257,8 +257,8 @@ class Kinetics:
             return d
 
     
-    def netProductionRates(self, phase = None):
-        w = _cantera.kin_getarray(self.ckin,70)        
+    def netProductionRates(self, phase = None, out = None):
+        w = _cantera.kin_getarray(self.ckin,70,out)
         if phase:
             kp = phase.thermophase()            
             if self._phnum.has_key(kp):
@@ -269,6 +269,31 @@ class Kinetics:
         else:
             return w
         
+    # used in the 'ratesForStates' method
+    _ratemap = {'fwdRatesOfProgress':10, 'revRatesOfProgress':20,
+                'netRatesOfProgress':30, 'creationRates':50,
+                'destructionRates':60, 'netProductionRates':70}
+
+    def ratesForStates(self, name, t, p, y, out = None):
+        """Evaluate rates for many states of the first phase.
+
+        'name' is the name of a rate method, such as
+        'netProductionRates' or 'netRatesOfProgress'. The states are
+        specified by arrays of temperatures 't' and pressures 'p' of
+        length N, and an (N, nSpecies) array of mass fractions 'y'.
+        Returns an (N, nSpecies) or (N, nReactions) array; if 'out'
+        is supplied, it must be a contiguous array of doubles of this
+        shape, and the results are written into it. The loop over
+        states is carried out in C++, and the state of the phase is
+        unchanged on return.
+        >>> wdot = gas.ratesForStates('netProductionRates', t, p, y)
+        """
+        try:
+            job = self._ratemap[name]
+        except KeyError:
+            raise CanteraError('unknown rate: '+name)
+        return _cantera.kin_getarray_states(self.ckin, job, t, p, y, out)
+
     def sourceTerms(self):
         return _cantera.kin_getarray(self.ckin,80)        
 
@@ -570,6 +570,19 @@ class Stack:
         """Refine the grid, adding points where solution is not
         adequately resolved."""
         return _cantera.sim1D_refine(self._hndl, loglevel)
+
+    def remesh(self, domain = None, npoints = -1, loglevel = 1):
+        """Replace the grid with one on which the arclength of the
+        solution is equidistributed, and interpolate the solution
+        onto it, preserving the integral of each component.
+        domain -- domain object. If omitted, all domains with more
+                  than one point are remeshed.
+        npoints -- number of points in the new grid. If negative, the
+                  number of points is not changed.
+        """
+        idom = -1
+        if domain: idom = domain.index()
+        return _cantera.sim1D_remesh(self._hndl, idom, npoints, loglevel)
     
     def setRefineCriteria(self, domain = None, ratio = 10.0, slope = 0.8,
                           curve = 0.8, prune = 0.05):
@@ -586,9 +599,11 @@ class Stack:
                   curvature.
         prune --  if the slope or curve criteria are satisfied to the level of
                   'prune', the grid point is assumed not to be needed and is
-                  removed. Set prune significantly smaller than
-                  'slope' and 'curve'. Set to zero to disable pruning
-                  the grid.
+                  removed. The criteria are checked on the interval that
+                  results when the point is removed, so points removed are
+                  not added back by the next refinement. Set prune
+                  significantly smaller than 1. Set to zero to disable
+                  pruning the grid.
                   
         >>> s.setRefineCriteria(d, ratio = 5.0, slope = 0.2, curve = 0.3,
         ...                     prune = 0.03)
@@ -674,6 +689,66 @@ class Stack:
         """
         return _cantera.sim1D_setMaxJacAge(self._hndl, ss_age, ts_age)
     
+    def setBlockTridiagonal(self, flag = 1):
+        """Select how the Jacobian is stored and factored.
+        If flag is true, the Jacobian is stored as a block-tridiagonal
+        matrix with one block per grid point. This uses less memory
+        and is usually faster for mechanisms with many species. If
+        false (the default), it is stored as a banded matrix.
+        """
+        return _cantera.sim1D_setBlockTridiagonal(self._hndl, flag)
+
+    def setNewtonKrylov(self, flag = 1, kdim = 30, maxit = 200,
+                        etamax = 1.0e-6, gaussSeidel = 1):
+        """Select how Newton steps are computed.
+        If flag is true, each step is computed by GMRES, using
+        differences of the residual function in place of products
+        with the Jacobian, and blocks of the Jacobian as a
+        preconditioner. The Jacobian is not factored. If false (the
+        default), the factored Jacobian is used.
+        kdim   -- dimension of the Krylov subspace before restarting
+        maxit  -- maximum number of GMRES iterations per step
+        etamax -- maximum ratio of the final to initial residual
+                  norms of the linear system
+        gaussSeidel -- if true, use a symmetric block Gauss-Seidel
+                  preconditioner; otherwise, use block Jacobi
+        """
+        return _cantera.sim1D_setNewtonKrylov(self._hndl, flag, kdim,
+                                              maxit, etamax, gaussSeidel)
+
+    def setTransportJacAge(self, age):
+        """Reuse the transport and convection terms of the Jacobian
+        for up to 'age' Newton iterations. Until then, when the
+        Jacobian is re-evaluated, only the terms due to the chemical
+        production rates are updated. If age <= 0 (the default), the
+        Jacobian is always evaluated in full.
+        """
+        return _cantera.sim1D_setTransportJacAge(self._hndl, age)
+
+    def setProfiling(self, flag = 1):
+        """Enable or disable timing of the phases of the solver
+        (Newton iteration, damping, Jacobian evaluation,
+        factorization, linear solves, residual evaluation, and the
+        thermodynamic, transport, diffusive flux and kinetics updates
+        in flow domains). Times and call counts accumulate until
+        resetProfile is called."""
+        return _cantera.sim1D_setProfiling(self._hndl, flag)
+
+    def resetProfile(self):
+        """Set all solver timers and counters to zero."""
+        return _cantera.sim1D_resetProfile(self._hndl)
+
+    def writeProfile(self, file = 'profile.json'):
+        """Write the solver timers and counters to a file, in CSV
+        format if the file name ends in '.csv', and in JSON format
+        otherwise.
+
+        >>> s.setProfiling()
+        >>> s.solve()
+        >>> s.writeProfile('flame_profile.csv')
+        """
+        return _cantera.sim1D_writeProfile(self._hndl, file)
+    
     def timeStepFactor(self, tfactor):
         """Set the factor by which the time step will be increased
         after a successful step, or decreased after an unsuccessful one.
@@ -690,6 +765,66 @@ class Stack:
         """This is a temporary fix."""
         _cantera.sim1D_setFixedTemperature(self._hndl, temp)
         
+    def setContinuationOptions(self, ds = 0.05, dsmin = 1.0e-5,
+                               dsmax = 0.5, secant = 1, maxiter = 10):
+        """Set options for continuation. The step length ds is
+        measured in a scaled norm in which ds = 0.1 corresponds to
+        an RMS change in the solution and the parameter of about 10%.
+        If secant is true, the secant predictor is used once two
+        solutions on a branch are known; otherwise the tangent
+        predictor is always used."""
+        return _cantera.sim1D_setContinuationOptions(self._hndl, ds,
+                                                     dsmin, dsmax, secant,
+                                                     maxiter)
+
+    def continuationStep(self, param, domain, direction = 1,
+                         loglevel = 0, other = None):
+        """Take one step of pseudo-arclength continuation, beginning
+        with the current solution, which must be converged. The
+        parameter is one of
+
+        'mdot'   -- mass flux of boundary domain. If boundary 'other'
+                    is specified, its mass flux is changed in proportion,
+                    which varies the strain rate of a counterflow flame.
+        'T'      -- temperature of boundary domain
+        'P'      -- pressure in flow domain
+        'Tfixed' -- fixed temperature of flow domain
+
+        The first step on a branch increases the parameter if
+        direction is positive; subsequent steps continue along the
+        branch, and pass through turning points. Returns the number of
+        corrector iterations.
+
+        >>> for n in range(40):
+        ...     s.continuationStep('mdot', fuel_inlet, other = ox_inlet)
+        ...     tmax.append(max(s.profile(flow, 'T')))
+        """
+        types = {'mdot':0, 'T':1, 'P':2, 'Tfixed':3}
+        if other:
+            ohndl = other.domain_hndl()
+        else:
+            ohndl = -1
+        return _cantera.sim1D_continuationStep(self._hndl, types[param],
+                                               domain.domain_hndl(), ohndl,
+                                               direction, loglevel)
+
+    def mixtureContinuationStep(self, inlet, y0, y1, direction = 1,
+                                loglevel = 0):
+        """Take one continuation step in the composition of an inlet,
+        which is a mixture of streams with mass fractions y0 and y1.
+        The parameter is the mass fraction of stream y1 in the mixture.
+        """
+        return _cantera.sim1D_mixtureContinuationStep(self._hndl,
+                                                      inlet.domain_hndl(),
+                                                      asarray(y0),
+                                                      asarray(y1),
+                                                      direction, loglevel)
+
+    def continuationStepSize(self):
+        """The step length that will be used for the next
+        continuation step."""
+        return _cantera.sim1D_continuationStepSize(self._hndl)
+        
 def clearDomains():
     """Clear all domains."""
     _cantera.domain_clear()
@@ -122,15 +122,18 @@ class Phase:
         """Array of species molar masses [kg/kmol]."""
         return self.molarMasses(species)
 
-    def moleFractions(self, species = None):
+    def moleFractions(self, species = None, out = None):
         """Species mole fraction array.
         If optional argument 'species'
         is supplied, then only the values for the selected species are
-        returned.
+        returned. If 'out' is supplied, it must be a contiguous array
+        of doubles of length nSpecies(), and the mole fractions are
+        written into it instead of into a newly-allocated array.
         >>> x1 = ph.moleFractions()   # all species
         >>> x2 = ph.moleFractions(['OH', 'CH3'. 'O2'])
+        >>> ph.moleFractions(out = x1)
         """
-        x = _cantera.phase_getarray(self._phase_id,20)
+        x = _cantera.phase_getarray(self._phase_id,20,out)
         return self.selectSpecies(x, species)
 
     def moleFraction(self, species):
@@ -143,15 +146,16 @@ class Phase:
         return _cantera.phase_molefraction(self._phase_id,k)    
 
 
-    def massFractions(self, species = None):
+    def massFractions(self, species = None, out = None):
         """Species mass fraction array.
         If optional argument 'species'
         is supplied, then only the values for the selected species are
-        returned.
+        returned. If 'out' is supplied, the mass fractions are written
+        into it, as for moleFractions.
         >>> y1 = ph.massFractions()   # all species
         >>> y2 = ph.massFractions(['OH', 'CH3'. 'O2'])
         """
-        y = _cantera.phase_getarray(self._phase_id,21)
+        y = _cantera.phase_getarray(self._phase_id,21,out)
         return self.selectSpecies(y, species)
 
 
@@ -26,6 +26,12 @@ class ThermoPhase(Phase):
     @see Solution, Interface
     """
 
+    # used in the 'propertyForStates' method
+    _fpmap = {'enthalpy_mole':1, 'intEnergy_mole':2, 'entropy_mole':3,
+              'gibbs_mole':4, 'cp_mole':5, 'cv_mole':6,
+              'enthalpy_mass':8, 'intEnergy_mass':9, 'entropy_mass':10,
+              'gibbs_mass':11, 'cp_mass':12, 'cv_mass':13}
+
     # used in the 'equilibrate' method
     _equilmap = {'TP':104,'TV':100,'HP':101,'SP':102,'SV':107,'UV':105,
                   'PT':104,'VT':100,'PH':101,'PS':102,'VS':107,'VU':105}
@@ -139,6 +145,26 @@ class ThermoPhase(Phase):
         """Electric potential [V]."""
         return _cantera.thermo_getfp(self._phase_id,25)
     
+    def propertyForStates(self, name, t, p, y, out = None):
+        """Evaluate a thermodynamic property for many states.
+
+        'name' is the name of a scalar property method, such as
+        'enthalpy_mass' or 'cp_mass'. The states are specified by
+        arrays of temperatures 't' and pressures 'p' of length N, and
+        an (N, nSpecies) array of mass fractions 'y'. The loop over
+        states is carried out in C++, and the state of the phase is
+        unchanged on return. If 'out' is supplied, it must be a
+        contiguous array of doubles of length N, and the results are
+        written into it.
+        >>> h = gas.propertyForStates('enthalpy_mass', t, p, y)
+        """
+        try:
+            job = self._fpmap[name]
+        except KeyError:
+            raise CanteraError('unknown property: '+name)
+        return _cantera.thermo_getfp_states(self._phase_id, job,
+                                            t, p, y, out)
+
     def chemPotentials(self, species = []):
         """Species chemical potentials.
         
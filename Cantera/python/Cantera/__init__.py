@@ -52,6 +52,18 @@ def addDirectory(dir):
 def writeLogFile(file):
     return _cantera.ct_writelogfile(file)
 
+def writeProfileReport(file):
+    """Write the profiling data of all kinetics, thermodynamic property
+    and transport managers and reactor networks to a file, in CSV
+    format if the name ends in '.csv' and in JSON format otherwise.
+    The report is empty unless Cantera was configured with
+    PROFILING='y'."""
+    return _cantera.ct_writeProfileReport(file)
+
+def resetProfiles():
+    """Set all profiling counters and timers to zero."""
+    return _cantera.ct_resetProfiles()
+
 
 def reset():
     """Release all cached Cantera data. Equivalent to
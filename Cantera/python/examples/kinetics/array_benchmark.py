@@ -0,0 +1,63 @@
+# Compare the cost of evaluating net production rates for many states
+# one state at a time, reusing an output array, and with the
+# vectorized 'ratesForStates' method, which loops over states in C++.
+
+from Cantera import *
+from Cantera.num import zeros
+import time
+
+def timeit(f, nrep):
+    t0 = time.time()
+    for n in range(nrep):
+        f()
+    return (time.time() - t0)/nrep
+
+def benchmark(gas, nstates = 1000, nrep = 5):
+
+    nsp = gas.nSpecies()
+
+    # a set of states spanning a range of temperatures
+    gas.set(T = 1000.0, P = OneAtm, X = 'CH4:1, O2:2, N2:7.52')
+    t = zeros(nstates,'d')
+    p = zeros(nstates,'d') + OneAtm
+    y = zeros((nstates, nsp),'d')
+    for n in range(nstates):
+        t[n] = 1000.0 + n*1000.0/nstates
+        y[n,:] = gas.massFractions()
+
+    wdot = zeros((nstates, nsp),'d')
+    buf = zeros(nsp,'d')
+        
+    def loop_alloc():
+        for n in range(nstates):
+            gas.setState_TPY(t[n], p[n], y[n,:])
+            wdot[n,:] = gas.netProductionRates()
+
+    def loop_inplace():
+        for n in range(nstates):
+            gas.setState_TPY(t[n], p[n], y[n,:])
+            gas.netProductionRates(out = buf)
+            wdot[n,:] = buf
+
+    def vectorized():
+        gas.ratesForStates('netProductionRates', t, p, y, out = wdot)
+
+    t1 = timeit(loop_alloc, nrep)
+    t2 = timeit(loop_inplace, nrep)
+    t3 = timeit(vectorized, nrep)
+
+    print '%s: %d species, %d states' % (gas.name(), nsp, nstates)
+    print '   Python loop, new arrays:      %10.4g s  (%6.2f us/state)' % (t1, 1.e6*t1/nstates)
+    print '   Python loop, output array:    %10.4g s  (%6.2f us/state)' % (t2, 1.e6*t2/nstates)
+    print '   ratesForStates:               %10.4g s  (%6.2f us/state)' % (t3, 1.e6*t3/nstates)
+    print '   speedup of ratesForStates:    %10.2f' % (t1/t3,)
+
+if __name__ == "__main__":
+    import sys
+    if len(sys.argv) == 2:
+        gas = importPhase(sys.argv[1])
+    elif len(sys.argv) > 2:
+        gas = importPhase(sys.argv[1], sys.argv[2])
+    else:
+        gas = GRI30()
+    benchmark(gas)
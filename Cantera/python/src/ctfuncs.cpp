@@ -93,6 +93,25 @@ ct_writelogfile(PyObject *self, PyObject *args)
     return Py_BuildValue("i",iok); 
 }
 
+static PyObject *
+ct_writeProfileReport(PyObject *self, PyObject *args)
+{
+    int iok;
+    char *fname;
+    if (!PyArg_ParseTuple(args, "s:writeProfileReport", &fname))
+        return NULL;
+    iok = writeProfileReport(fname);
+    if (iok == -1) { return reportCanteraError();}
+    return Py_BuildValue("i",iok); 
+}
+
+static PyObject *
+ct_resetProfiles(PyObject *self, PyObject *args)
+{
+    int iok = resetProfiles();
+    return Py_BuildValue("i",iok); 
+}
+
 
 
 
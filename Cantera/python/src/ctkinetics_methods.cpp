@@ -152,30 +152,18 @@ kin_advanceCoverages(PyObject *self, PyObject *args) {
     return Py_BuildValue("i",0);        
 }
 
-static PyObject*
-kin_getarray(PyObject *self, PyObject *args)
-{
-    int kin;
-    int job;
-    
-    if (!PyArg_ParseTuple(args, "ii:kin_getarray", &kin, &job)) 
-        return NULL;
+// length of the array returned for kin_getarray job 'job'
+static int kin_arraylen(int kin, int job) {
+    if (job < 45 || job >= 90) return kin_nReactions(kin);
+    else return kin_nSpecies(kin);
+}
 
-    // array attributes
+// fill xd with the array attribute 'job' of kinetics manager 'kin'
+static int kin_fillarray(int kin, int job, double* xd)
+{
     int iok = -22;
     int nrxns = kin_nReactions(kin);
     int nsp = kin_nSpecies(kin);
-    int ix;
-    if (job < 45 || job >= 90) ix = nrxns; else ix = nsp;
- 
-#ifdef HAS_NUMPY
-    npy_intp nix = ix;
-    PyArrayObject* x = (PyArrayObject*)PyArray_SimpleNew(1, &nix, PyArray_DOUBLE);
-#else
-    PyArrayObject* x = 
-        (PyArrayObject*)PyArray_FromDims(1, &ix, PyArray_DOUBLE);
-#endif
-    double* xd = (double*)x->data;
 
     switch (job) {
     case 10:
@@ -234,11 +222,80 @@ kin_getarray(PyObject *self, PyObject *args)
     default:
         ;
     }
+    return iok;
+}
+
+// Array attributes. If the optional third argument is a contiguous
+// array of doubles of the right length, the values are written into
+// it and it is returned; otherwise a new array is allocated.
+static PyObject*
+kin_getarray(PyObject *self, PyObject *args)
+{
+    int kin;
+    int job;
+    PyObject* out = 0;
+    
+    if (!PyArg_ParseTuple(args, "ii|O:kin_getarray", &kin, &job, &out)) 
+        return NULL;
+
+    PyArrayObject* x = outputArray(out, kin_arraylen(kin, job));
+    if (!x) return NULL;
+    int iok = kin_fillarray(kin, job, (double*)x->data);
+    if (iok >= 0) {
+        return PyArray_Return(x);
+    }
+    else {
+        Py_DECREF(x);
+        return reportError(iok);
+    }
+}
+
+// Array attributes for N states of the first phase. The states are
+// given as arrays of temperatures (N), pressures (N) and mass
+// fractions (N, nSpecies); the result is an (N, len) array, written
+// into the optional last argument if supplied. The loop over states
+// runs here rather than in Python, and the phase state is restored
+// on return.
+static PyObject*
+kin_getarray_states(PyObject *self, PyObject *args)
+{
+    int kin;
+    int job;
+    PyObject *tobj, *pobj, *yobj, *out = 0;
+    
+    if (!PyArg_ParseTuple(args, "iiOOO|O:kin_getarray_states", &kin, &job,
+            &tobj, &pobj, &yobj, &out)) 
+        return NULL;
+
+    int th = kin_phase(kin, 0);
+    int nsp = phase_nSpecies(th);
+    PyArrayObject *t, *p, *y;
+    int n = stateArrays(tobj, pobj, yobj, nsp, t, p, y);
+    if (n < 0) return NULL;
+
+    int len = kin_arraylen(kin, job);
+    PyArrayObject* x = outputArray(out, n, len);
+    int iok = 0;
+    if (x) {
+        PhaseStateSaver saved(th);
+        double* xd = (double*)x->data;
+        for (int i = 0; i < n && iok >= 0; i++) {
+            iok = setPhaseState(th, i, nsp, (double*)t->data,
+                (double*)p->data, (double*)y->data);
+            if (iok >= 0) iok = kin_fillarray(kin, job, xd + i*len);
+        }
+    }
+    Py_DECREF(t);
+    Py_DECREF(p);
+    Py_DECREF(y);
+    if (!x) return NULL;
     if (iok >= 0) {
         return PyArray_Return(x);
     }
-    else 
+    else {
+        Py_DECREF(x);
         return reportError(iok);
+    }
 }
 
 
@@ -801,6 +801,21 @@ py_sim1D_refine(PyObject *self, PyObject *args)
 }
 
 
+static PyObject *
+py_sim1D_remesh(PyObject *self, PyObject *args)
+{
+    int _val;
+    int i, dom, npts, loglevel;
+    if (!PyArg_ParseTuple(args, "iiii:sim1D_remesh", &i, &dom, &npts, 
+            &loglevel)) 
+        return NULL;
+        
+    _val = sim1D_remesh(i, dom, npts, loglevel); 
+    if (int(_val) == -1) return reportCanteraError();
+    return Py_BuildValue("i",_val);
+}
+
+
 static PyObject *
 py_sim1D_setRefineCriteria(PyObject *self, PyObject *args)
 {
@@ -961,6 +976,100 @@ py_sim1D_setMaxJacAge(PyObject *self, PyObject *args)
 }
 
 
+static PyObject *
+py_sim1D_setBlockTridiagonal(PyObject *self, PyObject *args)
+{
+    int _val;
+    int i;
+    int flag;
+    if (!PyArg_ParseTuple(args, "ii:sim1D_setBlockTridiagonal", &i, &flag)) 
+        return NULL;
+        
+    _val = sim1D_setBlockTridiagonal(i,flag); 
+    if (int(_val) == -1) return reportCanteraError();
+    return Py_BuildValue("i",_val);
+}
+
+
+static PyObject *
+py_sim1D_setNewtonKrylov(PyObject *self, PyObject *args)
+{
+    int _val;
+    int i;
+    int flag;
+    int kdim;
+    int maxit;
+    double etamax;
+    int gaussSeidel;
+    if (!PyArg_ParseTuple(args, "iiiidi:sim1D_setNewtonKrylov", &i, &flag,
+            &kdim, &maxit, &etamax, &gaussSeidel)) 
+        return NULL;
+        
+    _val = sim1D_setNewtonKrylov(i,flag,kdim,maxit,etamax,gaussSeidel); 
+    if (int(_val) == -1) return reportCanteraError();
+    return Py_BuildValue("i",_val);
+}
+
+
+static PyObject *
+py_sim1D_setTransportJacAge(PyObject *self, PyObject *args)
+{
+    int _val;
+    int i;
+    int age;
+    if (!PyArg_ParseTuple(args, "ii:sim1D_setTransportJacAge", &i, &age)) 
+        return NULL;
+        
+    _val = sim1D_setTransportJacAge(i,age); 
+    if (int(_val) == -1) return reportCanteraError();
+    return Py_BuildValue("i",_val);
+}
+
+
+static PyObject *
+py_sim1D_setProfiling(PyObject *self, PyObject *args)
+{
+    int _val;
+    int i;
+    int flag;
+    if (!PyArg_ParseTuple(args, "ii:sim1D_setProfiling", &i, &flag)) 
+        return NULL;
+        
+    _val = sim1D_setProfiling(i,flag); 
+    if (int(_val) == -1) return reportCanteraError();
+    return Py_BuildValue("i",_val);
+}
+
+
+static PyObject *
+py_sim1D_resetProfile(PyObject *self, PyObject *args)
+{
+    int _val;
+    int i;
+    if (!PyArg_ParseTuple(args, "i:sim1D_resetProfile", &i)) 
+        return NULL;
+        
+    _val = sim1D_resetProfile(i); 
+    if (int(_val) == -1) return reportCanteraError();
+    return Py_BuildValue("i",_val);
+}
+
+
+static PyObject *
+py_sim1D_writeProfile(PyObject *self, PyObject *args)
+{
+    int _val;
+    int i;
+    char* fname;
+    if (!PyArg_ParseTuple(args, "is:sim1D_writeProfile", &i, &fname)) 
+        return NULL;
+        
+    _val = sim1D_writeProfile(i,fname); 
+    if (int(_val) == -1) return reportCanteraError();
+    return Py_BuildValue("i",_val);
+}
+
+
 static PyObject *
 py_sim1D_timeStepFactor(PyObject *self, PyObject *args)
 {
@@ -1005,3 +1114,84 @@ py_sim1D_setFixedTemperature(PyObject *self, PyObject *args)
     return Py_BuildValue("i",_val);
 }
 
+
+
+static PyObject *
+py_sim1D_setContinuationOptions(PyObject *self, PyObject *args)
+{
+    int _val;
+    int i;
+    double ds, dsmin, dsmax;
+    int secant, maxiter;
+    if (!PyArg_ParseTuple(args, "idddii:sim1D_setContinuationOptions", &i, 
+            &ds, &dsmin, &dsmax, &secant, &maxiter)) 
+        return NULL;
+    _val = sim1D_setContinuationOptions(i,ds,dsmin,dsmax,secant,maxiter); 
+    if (int(_val) == -1) return reportCanteraError();
+    return Py_BuildValue("i",_val);
+}
+
+
+static PyObject *
+py_sim1D_continuationStep(PyObject *self, PyObject *args)
+{
+    int _val;
+    int i, ptype, dom, dom2, loglevel;
+    double direction;
+    if (!PyArg_ParseTuple(args, "iiiidi:sim1D_continuationStep", &i, 
+            &ptype, &dom, &dom2, &direction, &loglevel)) 
+        return NULL;
+    _val = sim1D_continuationStep(i,ptype,dom,dom2,direction,loglevel); 
+    if (int(_val) == -1) return reportCanteraError();
+    return Py_BuildValue("i",_val);
+}
+
+
+static PyObject *
+py_sim1D_mixtureContinuationStep(PyObject *self, PyObject *args)
+{
+    int _val;
+    int i, dom, loglevel;
+    PyObject* y0;
+    PyObject* y1;
+    double direction;
+    if (!PyArg_ParseTuple(args, "iiOOdi:sim1D_mixtureContinuationStep", &i, 
+            &dom, &y0, &y1, &direction, &loglevel)) 
+        return NULL;
+
+    PyArrayObject* y0_array = (PyArrayObject*)
+      PyArray_ContiguousFromObject(y0, PyArray_DOUBLE, 1, 1);
+    double* y0_data = (double*)(y0_array->data);
+    int y0_len = y0_array->dimensions[0];
+
+    PyArrayObject* y1_array = (PyArrayObject*)
+      PyArray_ContiguousFromObject(y1, PyArray_DOUBLE, 1, 1);
+    double* y1_data = (double*)(y1_array->data);
+    int y1_len = y1_array->dimensions[0];
+
+    if (y0_len != y1_len) {
+        Py_DECREF(y0_array);
+        Py_DECREF(y1_array); 
+        PyErr_SetString(PyExc_ValueError, "arrays must have the same length");
+        return NULL;
+    }
+    _val = sim1D_mixtureContinuationStep(i,dom,y0_len,y0_data,y1_data,
+        direction,loglevel);
+    Py_DECREF(y0_array);
+    Py_DECREF(y1_array); 
+    if (int(_val) == -1) return reportCanteraError();
+    return Py_BuildValue("i",_val);
+}
+
+
+static PyObject *
+py_sim1D_continuationStepSize(PyObject *self, PyObject *args)
+{
+    double _val;
+    int i;
+    if (!PyArg_ParseTuple(args, "i:sim1D_continuationStepSize", &i)) 
+        return NULL;
+    _val = sim1D_continuationStepSize(i); 
+    if (_val == DERR) return reportCanteraError();
+    return Py_BuildValue("d",_val);
+}
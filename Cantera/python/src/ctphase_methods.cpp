@@ -112,13 +112,17 @@ py_report(PyObject *self, PyObject *args) {
 }
 
 
+// Array attributes. If the optional third argument is a contiguous
+// array of doubles of the right length, the values are written into
+// it and it is returned; otherwise a new array is allocated.
 static PyObject*
 phase_getarray(PyObject *self, PyObject *args)
 {
     int ph;
     int job;
+    PyObject* out = 0;
     
-    if (!PyArg_ParseTuple(args, "ii:phase_getarray", &ph, &job)) 
+    if (!PyArg_ParseTuple(args, "ii|O:phase_getarray", &ph, &job, &out)) 
         return NULL;
 
     // array attributes
@@ -128,13 +132,8 @@ phase_getarray(PyObject *self, PyObject *args)
     if (job > 10) {
 
         int nsp = phase_nSpecies(ph);
-#ifdef HAS_NUMPY
-        npy_intp nnn = nsp;
-        x = (PyArrayObject*)PyArray_SimpleNew(1,  &nnn, PyArray_DOUBLE);
-        Py_INCREF(x);
-#else
-        x = (PyArrayObject*)PyArray_FromDims(1, &nsp, PyArray_DOUBLE);
-#endif
+        x = outputArray(out, nsp);
+        if (!x) return NULL;
         xd = (double*)x->data;
         switch (job) {
         case 20:
@@ -153,12 +152,8 @@ phase_getarray(PyObject *self, PyObject *args)
     else {
 
         int nel = phase_nElements(ph);
-#ifdef HAS_NUMPY
-        npy_intp nnn = nel;
-        x = (PyArrayObject*)PyArray_SimpleNew(1, &nnn, PyArray_DOUBLE);
-#else
-        x = (PyArrayObject*)PyArray_FromDims(1, &nel, PyArray_DOUBLE);
-#endif
+        x = outputArray(out, nel);
+        if (!x) return NULL;
         xd = (double*)x->data;
         switch (job) {
         case 1:
@@ -173,6 +168,7 @@ phase_getarray(PyObject *self, PyObject *args)
         return PyArray_Return(x);
     }
     else {
+        Py_DECREF(x);
         PyErr_SetString(ErrorObject,"Unknown array attribute");
         return NULL;
     }
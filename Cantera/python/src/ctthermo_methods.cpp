@@ -60,10 +60,59 @@ thermo_import(PyObject *self, PyObject *args) {
 }
 
 
+// floating-point attribute 'job' of phase 'th'. Sets ok to false if
+// job is not a known attribute.
+static double thermo_fp(int th, int job, bool& ok)
+{
+    double vv = -999.999;
+    ok = true;
+    switch (job) {
+    case 1:
+        vv = th_enthalpy_mole(th); break; 
+    case 2:
+        vv = th_intEnergy_mole(th); break;
+    case 3:
+        vv = th_entropy_mole(th); break;
+    case 4:
+        vv = th_gibbs_mole(th); break;
+    case 5:
+        vv = th_cp_mole(th); break;
+    case 6:
+        vv = th_cv_mole(th); break;
+    case 7:
+        vv = th_pressure(th); break;
+    case 8:
+        vv = th_enthalpy_mass(th); break; 
+    case 9:
+        vv = th_intEnergy_mass(th); break;
+    case 10:
+        vv = th_entropy_mass(th); break;
+    case 11:
+        vv = th_gibbs_mass(th); break;
+    case 12:
+        vv = th_cp_mass(th); break;
+    case 13:
+        vv = th_cv_mass(th); break;
+    case 25:
+        vv = th_electricPotential(th); break;
+    case 50:
+        vv = th_critTemperature(th); break;
+    case 51:
+        vv = th_critPressure(th); break;
+    case 52:
+        vv = th_critDensity(th); break;
+    case 53:
+        vv = th_vaporFraction(th); break;
+
+    default:
+        ok = false;
+    }
+    return vv;
+}
+
 static PyObject*
 thermo_getfp(PyObject *self, PyObject *args)
 {
-    double vv = -999.999;
     bool ok = true;
     int th;
     int job;
@@ -71,64 +120,70 @@ thermo_getfp(PyObject *self, PyObject *args)
     if (!PyArg_ParseTuple(args, "ii:thermo_getfp", &th, &job)) 
         return NULL;
 
-    // try {
-
-        // floating-point attributes
-        switch (job) {
-        case 1:
-            vv = th_enthalpy_mole(th); break; 
-        case 2:
-            vv = th_intEnergy_mole(th); break;
-        case 3:
-            vv = th_entropy_mole(th); break;
-        case 4:
-            vv = th_gibbs_mole(th); break;
-        case 5:
-            vv = th_cp_mole(th); break;
-        case 6:
-            vv = th_cv_mole(th); break;
-        case 7:
-            vv = th_pressure(th); break;
-        case 8:
-            vv = th_enthalpy_mass(th); break; 
-        case 9:
-            vv = th_intEnergy_mass(th); break;
-        case 10:
-            vv = th_entropy_mass(th); break;
-        case 11:
-            vv = th_gibbs_mass(th); break;
-        case 12:
-            vv = th_cp_mass(th); break;
-        case 13:
-            vv = th_cv_mass(th); break;
-        case 25:
-            vv = th_electricPotential(th); break;
-        case 50:
-            vv = th_critTemperature(th); break;
-        case 51:
-            vv = th_critPressure(th); break;
-        case 52:
-            vv = th_critDensity(th); break;
-        case 53:
-            vv = th_vaporFraction(th); break;
-
-        default:
-            ok = false;
+    double vv = thermo_fp(th, job, ok);
+    if (ok) {
+        if (vv == -999.999) {
+            return reportCanteraError();
         }
-        if (ok) {
-            if (vv == -999.999) {
-                return reportCanteraError();
-            }
-            return Py_BuildValue("d",vv);        
-        }
-        else {
-            PyErr_SetString(ErrorObject,"Unknown floating-point attribute");
-            return NULL;
+        return Py_BuildValue("d",vv);        
+    }
+    else {
+        PyErr_SetString(ErrorObject,"Unknown floating-point attribute");
+        return NULL;
+    }
+}
+
+// Floating-point attribute 'job' for N states. The states are given
+// as arrays of temperatures (N), pressures (N) and mass fractions
+// (N, nSpecies); the result is an array of length N, written into the
+// optional last argument if supplied. The phase state is restored on
+// return.
+static PyObject*
+thermo_getfp_states(PyObject *self, PyObject *args)
+{
+    int th;
+    int job;
+    PyObject *tobj, *pobj, *yobj, *out = 0;
+    
+    if (!PyArg_ParseTuple(args, "iiOOO|O:thermo_getfp_states", &th, &job,
+            &tobj, &pobj, &yobj, &out)) 
+        return NULL;
+
+    int nsp = th_nSpecies(th);
+    PyArrayObject *t, *p, *y;
+    int n = stateArrays(tobj, pobj, yobj, nsp, t, p, y);
+    if (n < 0) return NULL;
+
+    PyArrayObject* x = outputArray(out, n);
+    bool ok = true;
+    int iok = 0;
+    double vv = 0.0;
+    if (x) {
+        PhaseStateSaver saved(th);
+        double* xd = (double*)x->data;
+        for (int i = 0; i < n; i++) {
+            iok = setPhaseState(th, i, nsp, (double*)t->data,
+                (double*)p->data, (double*)y->data);
+            if (iok < 0) break;
+            vv = thermo_fp(th, job, ok);
+            if (!ok || vv == -999.999) break;
+            xd[i] = vv;
         }
-        //}
-        //catch (CanteraError) {
-        // return reportCanteraError();
-        //}
+    }
+    Py_DECREF(t);
+    Py_DECREF(p);
+    Py_DECREF(y);
+    if (!x) return NULL;
+    if (!ok) {
+        Py_DECREF(x);
+        PyErr_SetString(ErrorObject,"Unknown floating-point attribute");
+        return NULL;
+    }
+    else if (iok < 0 || vv == -999.999) {
+        Py_DECREF(x);
+        return reportError(-1);
+    }
+    return PyArray_Return(x);
 }
 
 static PyObject*
@@ -178,13 +233,17 @@ thermo_setfp(PyObject *self, PyObject *args)
 }
 
 
+// Array attributes. If the optional third argument is a contiguous
+// array of doubles of the right length, the values are written into
+// it and it is returned; otherwise a new array is allocated.
 static PyObject*
 thermo_getarray(PyObject *self, PyObject *args)
 {
     int th;
     int job;
+    PyObject* out = 0;
 
-    if (!PyArg_ParseTuple(args, "ii:thermo_getarray", &th, &job)) 
+    if (!PyArg_ParseTuple(args, "ii|O:thermo_getarray", &th, &job, &out)) 
         return NULL;
 
     int nsp = th_nSpecies(th);
@@ -194,15 +253,8 @@ thermo_getarray(PyObject *self, PyObject *args)
     // array attributes
     int iok = -22;
 
-#ifdef HAS_NUMPY
-    npy_intp nnn = xlen;
-    PyArrayObject* x = 
-        (PyArrayObject*)PyArray_SimpleNew(1, &nnn, PyArray_DOUBLE);
-    Py_INCREF(x);
-#else
-    PyArrayObject* x = 
-        (PyArrayObject*)PyArray_FromDims(1, &xlen, PyArray_DOUBLE);
-#endif
+    PyArrayObject* x = outputArray(out, xlen);
+    if (!x) return NULL;
     double* xd = (double*)x->data;
     switch (job) {
     case 20:
@@ -227,7 +279,8 @@ thermo_getarray(PyObject *self, PyObject *args)
     if (iok >= 0) {
         return PyArray_Return(x);
     }
-    else if (iok == -1) return reportCanteraError();
+    Py_DECREF(x);
+    if (iok == -1) return reportCanteraError();
     else {
         PyErr_SetString(ErrorObject,"Unknown array attribute");
         return NULL;
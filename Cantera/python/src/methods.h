@@ -30,6 +30,7 @@ static PyMethodDef ct_methods[] = {
     {"thermo_getfp", thermo_getfp,  METH_VARARGS},
     {"thermo_setfp", thermo_setfp,  METH_VARARGS},
     {"thermo_getarray", thermo_getarray,  METH_VARARGS},
+    {"thermo_getfp_states", thermo_getfp_states,  METH_VARARGS},
     {"thermo_equil", thermo_equil,  METH_VARARGS},
     {"thermo_import_xml", thermo_import,  METH_VARARGS},
 
@@ -70,6 +71,7 @@ static PyMethodDef ct_methods[] = {
     {"kin_setMultiplier", kin_setMultiplier,  METH_VARARGS},
     {"kin_speciesIndex", kin_speciesIndex,  METH_VARARGS},
     {"kin_getarray", kin_getarray,  METH_VARARGS},
+    {"kin_getarray_states", kin_getarray_states,  METH_VARARGS},
     {"kin_getstring", kin_getstring,  METH_VARARGS},
     {"kin_phase", kin_phase,  METH_VARARGS},
     {"kin_advanceCoverages", kin_advanceCoverages,  METH_VARARGS},
@@ -91,6 +93,8 @@ static PyMethodDef ct_methods[] = {
     {"ct_refcnt", ct_refcnt,  METH_VARARGS},
     {"ct_ck2cti", ct_ck2cti,  METH_VARARGS},
     {"ct_writelogfile", ct_writelogfile,  METH_VARARGS},
+    {"ct_writeProfileReport", ct_writeProfileReport,  METH_VARARGS},
+    {"ct_resetProfiles", ct_resetProfiles,  METH_VARARGS},
     //{"readlog", ct_readlog,  METH_VARARGS},
     //{"buildSolutionFromXML", ct_buildSolutionFromXML, METH_VARARGS},
 
@@ -145,6 +149,7 @@ static PyMethodDef ct_methods[] = {
     {"sim1D_getInitialSoln", py_sim1D_getInitialSoln, METH_VARARGS},
     {"sim1D_solve", py_sim1D_solve, METH_VARARGS},
     {"sim1D_refine", py_sim1D_refine, METH_VARARGS},
+    {"sim1D_remesh", py_sim1D_remesh, METH_VARARGS},
     {"sim1D_setRefineCriteria", py_sim1D_setRefineCriteria, METH_VARARGS},
     {"sim1D_save", py_sim1D_save, METH_VARARGS},
     {"sim1D_restore", py_sim1D_restore, METH_VARARGS},
@@ -154,9 +159,19 @@ static PyMethodDef ct_methods[] = {
     {"sim1D_workValue", py_sim1D_workValue, METH_VARARGS},
     {"sim1D_eval", py_sim1D_eval, METH_VARARGS},
     {"sim1D_setMaxJacAge", py_sim1D_setMaxJacAge, METH_VARARGS},
+    {"sim1D_setBlockTridiagonal", py_sim1D_setBlockTridiagonal, METH_VARARGS},
+    {"sim1D_setNewtonKrylov", py_sim1D_setNewtonKrylov, METH_VARARGS},
+    {"sim1D_setTransportJacAge", py_sim1D_setTransportJacAge, METH_VARARGS},
+    {"sim1D_setProfiling", py_sim1D_setProfiling, METH_VARARGS},
+    {"sim1D_resetProfile", py_sim1D_resetProfile, METH_VARARGS},
+    {"sim1D_writeProfile", py_sim1D_writeProfile, METH_VARARGS},
     {"sim1D_timeStepFactor", py_sim1D_timeStepFactor, METH_VARARGS},
     {"sim1D_setTimeStepLimits", py_sim1D_setTimeStepLimits, METH_VARARGS},
     {"sim1D_setFixedTemperature", py_sim1D_setFixedTemperature, METH_VARARGS},
+    {"sim1D_setContinuationOptions", py_sim1D_setContinuationOptions, METH_VARARGS},
+    {"sim1D_continuationStep", py_sim1D_continuationStep, METH_VARARGS},
+    {"sim1D_mixtureContinuationStep", py_sim1D_mixtureContinuationStep, METH_VARARGS},
+    {"sim1D_continuationStepSize", py_sim1D_continuationStepSize, METH_VARARGS},
 
     {"surf_setsitedensity", py_surf_setsitedensity,  METH_VARARGS},
     {"surf_sitedensity", py_surf_sitedensity,  METH_VARARGS},
@@ -2,6 +2,7 @@
 #define CTPY_UTILS
 
 #include "Python.h"
+#include <vector>
 
 static PyObject* reportCanteraError() {
     char* buf = 0;
@@ -22,5 +23,96 @@ static PyObject* reportError(int n) {
     return NULL;
 }
 
+// Return a contiguous 1D or 2D double array to receive output. If
+// 'out' is NULL or None, a new (n0) or (n0, n1) array is allocated;
+// otherwise 'out' must be a contiguous array of doubles with n0*n1
+// elements, and it is returned (with a new reference) so that the
+// caller's buffer is filled in place without allocating or copying.
+// Pass n1 = 0 for a 1D array.
+static PyArrayObject* outputArray(PyObject* out, int n0, int n1 = 0) {
+    if (out == 0 || out == Py_None) {
+        int nd = (n1 > 0 ? 2 : 1);
+#ifdef HAS_NUMPY
+        npy_intp dims[2];
+        dims[0] = n0;
+        dims[1] = n1;
+        return (PyArrayObject*)PyArray_SimpleNew(nd, dims, PyArray_DOUBLE);
+#else
+        int dims[2];
+        dims[0] = n0;
+        dims[1] = n1;
+        return (PyArrayObject*)PyArray_FromDims(nd, dims, PyArray_DOUBLE);
+#endif
+    }
+    if (!PyArray_Check(out)) {
+        PyErr_SetString(ErrorObject,"output argument must be an array");
+        return NULL;
+    }
+    PyArrayObject* x = (PyArrayObject*)out;
+    int n = (n1 > 0 ? n0*n1 : n0);
+    if (x->descr->type_num != PyArray_DOUBLE || !PyArray_ISCONTIGUOUS(x)
+        || PyArray_Size(out) != n) {
+        PyErr_SetString(ErrorObject,
+            "output array must be a contiguous array of doubles "
+            "of the correct size");
+        return NULL;
+    }
+    Py_INCREF(out);
+    return x;
+}
+
+// Convert a sequence of (T, P, Y) states to contiguous double arrays,
+// copying only if the inputs are not already contiguous double
+// arrays. On success, returns the number of states; on failure,
+// returns -1 with the Python error set and all references released.
+static int stateArrays(PyObject* tobj, PyObject* pobj, PyObject* yobj,
+    int nsp, PyArrayObject*& t, PyArrayObject*& p, PyArrayObject*& y) {
+    t = (PyArrayObject*)PyArray_ContiguousFromObject(tobj, PyArray_DOUBLE, 1, 1);
+    p = (PyArrayObject*)PyArray_ContiguousFromObject(pobj, PyArray_DOUBLE, 1, 1);
+    y = (PyArrayObject*)PyArray_ContiguousFromObject(yobj, PyArray_DOUBLE, 2, 2);
+    if (t && p && y) {
+        int n = t->dimensions[0];
+        if (p->dimensions[0] == n && y->dimensions[0] == n 
+            && y->dimensions[1] == nsp) return n;
+        PyErr_SetString(ErrorObject,
+            "state arrays must have shapes (N,), (N,) and (N, nSpecies)");
+    }
+    Py_XDECREF(t);
+    Py_XDECREF(p);
+    Py_XDECREF(y);
+    return -1;
+}
+
+// Saves the temperature, density and composition of a phase on
+// construction and restores them on destruction, so that functions
+// that loop over many states leave the phase as they found it.
+class PhaseStateSaver {
+public:
+    PhaseStateSaver(int th) : m_th(th), m_y(phase_nSpecies(th)) {
+        m_t = phase_temperature(th);
+        m_rho = phase_density(th);
+        phase_getMassFractions(th, m_y.size(), &m_y[0]);
+    }
+    ~PhaseStateSaver() {
+        phase_setTemperature(m_th, m_t);
+        phase_setMassFractions(m_th, m_y.size(), &m_y[0], 0);
+        phase_setDensity(m_th, m_rho);
+    }
+private:
+    int m_th;
+    double m_t, m_rho;
+    std::vector<double> m_y;
+};
+
+// Set the state of phase 'th' to the i'th of a set of (T, P, Y)
+// states.
+static int setPhaseState(int th, int i, int nsp, const double* t,
+    const double* p, const double* y) {
+    int iok = phase_setTemperature(th, t[i]);
+    if (iok >= 0) iok = phase_setMassFractions(th, nsp, 
+                        (double*)(y + i*nsp), 1);
+    if (iok >= 0) iok = th_setPressure(th, p[i]);
+    return iok;
+}
 
 #endif
@@ -7,9 +7,7 @@
 
 #include <vector>
 
-#if defined(THREAD_SAFE_CANTERA)
-#include <boost/thread/mutex.hpp>
-#endif
+#include "ct_thread.h"
 
 namespace Cantera {
 
@@ -0,0 +1,207 @@
+/**
+ * @file ProfileData.cpp
+ *
+ * Counters, timers and cache statistics for profiling.
+ */
+
+/*
+ * Copyright 2002 California Institute of Technology
+ */
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#pragma warning(disable:4503)
+#endif
+
+#include <fstream>
+#include <cstdio>
+#include <algorithm>
+
+#include "ProfileData.h"
+#include "ctexceptions.h"
+#include "stringUtils.h"
+#include "ct_thread.h"
+
+using namespace std;
+
+namespace Cantera {
+
+    /**
+     * The registered ProfileData objects. The list and its mutex are
+     * never deleted, so that objects with static storage duration
+     * may unregister themselves after the end of main.
+     */
+    static vector<ProfileData*>& profileList() {
+        static vector<ProfileData*>* list = new vector<ProfileData*>;
+        return *list;
+    }
+
+    static mutex_t& profileMutex() {
+        static mutex_t* m = new mutex_t;
+        return *m;
+    }
+
+    static void registerProfile(ProfileData* p) {
+        ScopedLock lock(profileMutex());
+        profileList().push_back(p);
+    }
+
+    static void unregisterProfile(ProfileData* p) {
+        ScopedLock lock(profileMutex());
+        vector<ProfileData*>& list = profileList();
+        vector<ProfileData*>::iterator i = find(list.begin(), list.end(), p);
+        if (i != list.end()) list.erase(i);
+    }
+
+    static string ull2str(unsigned long long n) {
+        char buf[32];
+        sprintf(buf, "%llu", n);
+        return string(buf);
+    }
+
+    static const char* type_names[3] = {"counter", "timer", "cache"};
+
+    doublereal profileTicksPerSecond() {
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+        static doublereal rate = 0.0;
+        ScopedLock lock(profileMutex());
+        if (rate == 0.0) {
+            clock_t c0 = clock(), c1;
+            while ((c1 = clock()) == c0) {}
+            unsigned long long t0 = profileTicks();
+            clock_t c2;
+            while ((c2 = clock()) - c1 < CLOCKS_PER_SEC/100) {}
+            unsigned long long t1 = profileTicks();
+            rate = (t1 - t0)*doublereal(CLOCKS_PER_SEC)/(c2 - c1);
+        }
+        return rate;
+#else
+        return doublereal(CLOCKS_PER_SEC);
+#endif
+    }
+
+    ProfileData::ProfileData(string owner) : m_owner(owner),
+                                             m_registered(false) {}
+
+    ProfileData::ProfileData(const ProfileData& right) 
+        : m_registered(false) {
+        *this = right;
+    }
+
+    ProfileData& ProfileData::operator=(const ProfileData& right) {
+        if (&right == this) return *this;
+        m_owner = right.m_owner;
+        m_names = right.m_names;
+        m_types = right.m_types;
+        m_n1.resize(m_names.size());
+        m_n2.resize(m_names.size());
+        m_start.resize(m_names.size());
+        reset();
+        if (!m_registered && nEntries() > 0) {
+            registerProfile(this);
+            m_registered = true;
+        }
+        return *this;
+    }
+
+    ProfileData::~ProfileData() {
+        if (m_registered) unregisterProfile(this);
+    }
+
+    int ProfileData::addEntry(string name, EntryType type) {
+        if (!m_registered) {
+            registerProfile(this);
+            m_registered = true;
+        }
+        m_names.push_back(name);
+        m_types.push_back(type);
+        m_n1.push_back(0);
+        m_n2.push_back(0);
+        m_start.push_back(0);
+        return nEntries() - 1;
+    }
+
+    void ProfileData::reset() {
+        fill(m_n1.begin(), m_n1.end(), 0);
+        fill(m_n2.begin(), m_n2.end(), 0);
+    }
+
+    /**
+     * Counters are written as {"name": ..., "type": "counter",
+     * "count": n}, timers with members "calls" and "ticks", and
+     * caches with members "hits" and "misses".
+     */
+    string ProfileData::toJSON() const {
+        string s = "{\"owner\": \"" + m_owner + "\", \"entries\": [";
+        for (int i = 0; i < nEntries(); i++) {
+            s += (i > 0 ? ",\n    " : "\n    ");
+            s += "{\"name\": \"" + m_names[i] + "\", \"type\": \""
+                + type_names[m_types[i]] + "\", ";
+            if (m_types[i] == Counter)
+                s += "\"count\": " + ull2str(m_n1[i]) + "}";
+            else if (m_types[i] == Timer)
+                s += "\"calls\": " + ull2str(m_n1[i]) + ", \"ticks\": "
+                    + ull2str(m_n2[i]) + "}";
+            else
+                s += "\"hits\": " + ull2str(m_n1[i]) + ", \"misses\": "
+                    + ull2str(m_n2[i]) + "}";
+        }
+        s += "]}";
+        return s;
+    }
+
+    /**
+     * Each row contains the owner, the name and kind of the entry,
+     * and its two values (see value and value2).
+     */
+    string ProfileData::toCSV() const {
+        string s = "";
+        for (int i = 0; i < nEntries(); i++) {
+            s += m_owner + "," + m_names[i] + "," + type_names[m_types[i]]
+                + "," + ull2str(m_n1[i]) + "," + ull2str(m_n2[i]) + "\n";
+        }
+        return s;
+    }
+
+    int nProfiles() {
+        ScopedLock lock(profileMutex());
+        return static_cast<int>(profileList().size());
+    }
+
+    string profileReport(bool csv) {
+        ScopedLock lock(profileMutex());
+        const vector<ProfileData*>& list = profileList();
+        int n = static_cast<int>(list.size());
+        string s;
+        if (csv) {
+            s = "owner,name,type,value,value2\n";
+            for (int i = 0; i < n; i++) s += list[i]->toCSV();
+        }
+        else {
+            s = "[";
+            for (int i = 0; i < n; i++) {
+                s += (i > 0 ? ",\n  " : "\n  ");
+                s += list[i]->toJSON();
+            }
+            s += "\n]\n";
+        }
+        return s;
+    }
+
+    void writeProfileReport(string fname) {
+        string::size_type n = fname.size();
+        bool csv = (n > 4 && fname.substr(n - 4) == ".csv");
+        string s = profileReport(csv);
+        ofstream f(fname.c_str());
+        if (!f)
+            throw CanteraError("writeProfileReport",
+                "could not open file "+fname);
+        f << s;
+    }
+
+    void resetProfiles() {
+        ScopedLock lock(profileMutex());
+        vector<ProfileData*>& list = profileList();
+        for (size_t i = 0; i < list.size(); i++) list[i]->reset();
+    }
+}
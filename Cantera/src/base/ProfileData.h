@@ -0,0 +1,228 @@
+/**
+ * @file ProfileData.h
+ *
+ * Counters, timers and cache statistics for profiling the
+ * computationally intensive methods of %Cantera objects.
+ *
+ * Profiling is selected at compile time. If CANTERA_PROFILING is
+ * defined in config.h (configure option PROFILING='y'), kinetics
+ * managers, thermodynamic property managers, transport managers and
+ * reactor networks each own a ProfileData object, in which their
+ * methods record the number of calls, the elapsed processor cycles,
+ * and the hits and misses of their property caches. Otherwise, the
+ * CT_PROFILE macros used to record them expand to nothing, and the
+ * objects carry no profiling data, so that there is no cost at all.
+ *
+ * Each ProfileData object registers itself in a global list when its
+ * first entry is added, and removes itself when it is destroyed, so
+ * that objects without entries do not appear in reports. The
+ * function profileReport returns the data for all registered objects
+ * in JSON or CSV format. The timers of the one-dimensional solver
+ * (class SolverProfile) are kept in a ProfileData object as well,
+ * and are reported in the same way once they are enabled.
+ */
+
+/*
+ * Copyright 2002 California Institute of Technology
+ */
+
+#ifndef CT_PROFILEDATA_H
+#define CT_PROFILEDATA_H
+
+#include <string>
+#include <vector>
+#include <time.h>
+
+#include "ct_defs.h"
+
+namespace Cantera {
+
+    /**
+     * The processor time stamp counter, where it is available (x86
+     * processors with GCC-compatible compilers), or the processor
+     * clock otherwise. Only differences between values are
+     * meaningful.
+     */
+    inline unsigned long long profileTicks() {
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+        unsigned int lo, hi;
+        __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+        return (static_cast<unsigned long long>(hi) << 32) | lo;
+#else
+        return static_cast<unsigned long long>(clock());
+#endif
+    }
+
+    /**
+     * The number of ticks of profileTicks per second. Where the time
+     * stamp counter is used, its rate is measured against the
+     * processor clock on the first call, which takes about 10 ms.
+     */
+    doublereal profileTicksPerSecond();
+
+    /**
+     * Counters, timers and cache statistics belonging to one object.
+     * Entries are added by name, and are then referred to by the index
+     * returned when they were added. Three kinds of entry are
+     * supported:
+     *
+     *  - counters, which count events;
+     *  - timers, which record the number of calls and the total
+     *    number of ticks (see profileTicks) between startTimer and
+     *    stopTimer;
+     *  - caches, which record the number of hits and misses.
+     *
+     * Copies of a ProfileData object have the same entries, with all
+     * values set to zero, and are registered separately if they have
+     * any entries.
+     */
+    class ProfileData {
+
+    public:
+
+        /// Kinds of entries
+        enum EntryType { Counter, Timer, Cache };
+
+        /**
+         * Constructor.
+         * @param owner  a description of the owner, used to label
+         *               its data in reports
+         */
+        ProfileData(std::string owner = "");
+        ProfileData(const ProfileData& right);
+        ProfileData& operator=(const ProfileData& right);
+        virtual ~ProfileData();
+
+        /// Set the description of the owner.
+        void setOwner(std::string owner) { m_owner = owner; }
+
+        /// The description of the owner.
+        std::string owner() const { return m_owner; }
+
+        /// Add a counter, and return its index.
+        int addCounter(std::string name) { return addEntry(name, Counter); }
+
+        /// Add a timer, and return its index.
+        int addTimer(std::string name) { return addEntry(name, Timer); }
+
+        /// Add cache statistics, and return their index.
+        int addCache(std::string name) { return addEntry(name, Cache); }
+
+        /// Number of entries.
+        int nEntries() const { return static_cast<int>(m_names.size()); }
+
+        /// Name of entry i.
+        std::string name(int i) const { return m_names[i]; }
+
+        /// Kind of entry i.
+        EntryType type(int i) const { return m_types[i]; }
+
+        /// Add n to counter i.
+        void count(int i, int n = 1) { m_n1[i] += n; }
+
+        /// Start timer i.
+        void startTimer(int i) { m_start[i] = profileTicks(); }
+
+        /// Stop timer i, and add the ticks since startTimer.
+        void stopTimer(int i) {
+            m_n2[i] += profileTicks() - m_start[i];
+            m_n1[i]++;
+        }
+
+        /// Record a hit of cache i.
+        void hit(int i) { m_n1[i]++; }
+
+        /// Record a miss of cache i.
+        void miss(int i) { m_n2[i]++; }
+
+        /**
+         * The count of a counter, the number of calls of a timer, or
+         * the number of hits of a cache.
+         */
+        unsigned long long value(int i) const { return m_n1[i]; }
+
+        /**
+         * The total number of ticks of a timer, or the number of
+         * misses of a cache. Zero for counters.
+         */
+        unsigned long long value2(int i) const { return m_n2[i]; }
+
+        /// Set all values to zero.
+        void reset();
+
+        /// The data of this object, as a JSON object.
+        std::string toJSON() const;
+
+        /// The data of this object, as CSV rows.
+        std::string toCSV() const;
+
+    protected:
+
+        int addEntry(std::string name, EntryType type);
+
+        std::string m_owner;
+        bool m_registered;
+        std::vector<std::string> m_names;
+        std::vector<EntryType> m_types;
+        std::vector<unsigned long long> m_n1, m_n2, m_start;
+    };
+
+    /**
+     * Runs a timer of a ProfileData object for the lifetime of the
+     * object.
+     */
+    class ProfileTimer {
+    public:
+        ProfileTimer(ProfileData& p, int i) : m_prof(p), m_index(i) {
+            m_prof.startTimer(i);
+        }
+        ~ProfileTimer() { m_prof.stopTimer(m_index); }
+    private:
+        ProfileData& m_prof;
+        int m_index;
+    };
+
+    /// Number of registered ProfileData objects.
+    int nProfiles();
+
+    /**
+     * The data of all registered objects, in JSON format (an array
+     * with one object per ProfileData object), or if csv is true, in
+     * CSV format (one row per entry).
+     */
+    std::string profileReport(bool csv = false);
+
+    /**
+     * Write the data of all registered objects to file fname, in CSV
+     * format if the name has extension '.csv', and in JSON format
+     * otherwise.
+     */
+    void writeProfileReport(std::string fname);
+
+    /// Set the values of all registered objects to zero.
+    void resetProfiles();
+
+}
+
+/**
+ * @name Profiling macros
+ *
+ * These macros are used to record profiling data for an object with
+ * a ProfileData member. They expand to nothing unless %Cantera is
+ * compiled with CANTERA_PROFILING defined.
+ */
+//@{
+#ifdef CANTERA_PROFILING
+#define CT_PROFILE_COUNT(prof, i) (prof).count(i)
+#define CT_PROFILE_TIMER(prof, i) Cantera::ProfileTimer _ct_timer_(prof, i)
+#define CT_PROFILE_HIT(prof, i) (prof).hit(i)
+#define CT_PROFILE_MISS(prof, i) (prof).miss(i)
+#else
+#define CT_PROFILE_COUNT(prof, i)
+#define CT_PROFILE_TIMER(prof, i)
+#define CT_PROFILE_HIT(prof, i)
+#define CT_PROFILE_MISS(prof, i)
+#endif
+//@}
+
+#endif
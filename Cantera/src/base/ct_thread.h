@@ -0,0 +1,234 @@
+/**
+ *  @file ct_thread.h
+ *  Mutex and lock classes used to make the global state of %Cantera
+ *  safe to use from several threads (see \ref globalData).
+ *
+ *  If %Cantera is built with THREAD_SAFE_CANTERA defined (the
+ *  default), the classes here wrap the locking primitives of the
+ *  standard library when compiled as C++11 or later, and the native
+ *  primitives of the platform (POSIX threads or Win32) otherwise, so
+ *  that no external library is needed. If THREAD_SAFE_CANTERA is not
+ *  defined, all locking operations are empty inline functions.
+ */
+#ifndef CT_THREAD_H
+#define CT_THREAD_H
+
+#include "ct_defs.h"
+
+#if defined(THREAD_SAFE_CANTERA)
+#if __cplusplus >= 201103L
+#define CT_STD_THREADS
+#include <mutex>
+#include <thread>
+#if __cplusplus >= 201402L
+#define CT_STD_SHARED_MUTEX
+#include <shared_mutex>
+#endif
+#endif
+#if defined(WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+#endif
+
+namespace Cantera {
+
+  //! Mutual exclusion lock.
+  /*!
+   *  Only one thread may hold the lock at a time. Use class
+   *  ScopedLock to hold it for the duration of a block.
+   */
+  class mutex_t {
+  public:
+#if defined(THREAD_SAFE_CANTERA)
+#if defined(CT_STD_THREADS)
+    mutex_t() {}
+    void lock() { m_mutex.lock(); }
+    void unlock() { m_mutex.unlock(); }
+  private:
+    std::mutex m_mutex;
+#elif defined(WIN32)
+    mutex_t() { InitializeCriticalSection(&m_mutex); }
+    ~mutex_t() { DeleteCriticalSection(&m_mutex); }
+    void lock() { EnterCriticalSection(&m_mutex); }
+    void unlock() { LeaveCriticalSection(&m_mutex); }
+  private:
+    CRITICAL_SECTION m_mutex;
+#else
+    mutex_t() { pthread_mutex_init(&m_mutex, 0); }
+    ~mutex_t() { pthread_mutex_destroy(&m_mutex); }
+    void lock() { pthread_mutex_lock(&m_mutex); }
+    void unlock() { pthread_mutex_unlock(&m_mutex); }
+  private:
+    pthread_mutex_t m_mutex;
+#endif
+    mutex_t(const mutex_t&);
+    mutex_t& operator=(const mutex_t&);
+#else
+    mutex_t() {}
+    void lock() {}
+    void unlock() {}
+#endif
+  };
+
+  //! Reader/writer lock.
+  /*!
+   *  Any number of threads may hold the lock in shared mode
+   *  (readers), or one thread may hold it in exclusive mode
+   *  (writer). Use classes ReadLock and WriteLock to hold it for the
+   *  duration of a block. With a C++11 compiler that does not
+   *  provide std::shared_timed_mutex, shared locks are exclusive.
+   */
+  class shared_mutex_t {
+  public:
+#if defined(THREAD_SAFE_CANTERA)
+#if defined(CT_STD_SHARED_MUTEX)
+    shared_mutex_t() {}
+    void lock() { m_mutex.lock(); }
+    void unlock() { m_mutex.unlock(); }
+    void lock_shared() { m_mutex.lock_shared(); }
+    void unlock_shared() { m_mutex.unlock_shared(); }
+  private:
+    std::shared_timed_mutex m_mutex;
+#elif defined(CT_STD_THREADS)
+    shared_mutex_t() {}
+    void lock() { m_mutex.lock(); }
+    void unlock() { m_mutex.unlock(); }
+    void lock_shared() { m_mutex.lock(); }
+    void unlock_shared() { m_mutex.unlock(); }
+  private:
+    std::mutex m_mutex;
+#elif defined(WIN32)
+    shared_mutex_t() { InitializeSRWLock(&m_lock); }
+    void lock() { AcquireSRWLockExclusive(&m_lock); }
+    void unlock() { ReleaseSRWLockExclusive(&m_lock); }
+    void lock_shared() { AcquireSRWLockShared(&m_lock); }
+    void unlock_shared() { ReleaseSRWLockShared(&m_lock); }
+  private:
+    SRWLOCK m_lock;
+#else
+    shared_mutex_t() { pthread_rwlock_init(&m_lock, 0); }
+    ~shared_mutex_t() { pthread_rwlock_destroy(&m_lock); }
+    void lock() { pthread_rwlock_wrlock(&m_lock); }
+    void unlock() { pthread_rwlock_unlock(&m_lock); }
+    void lock_shared() { pthread_rwlock_rdlock(&m_lock); }
+    void unlock_shared() { pthread_rwlock_unlock(&m_lock); }
+  private:
+    pthread_rwlock_t m_lock;
+#endif
+    shared_mutex_t(const shared_mutex_t&);
+    shared_mutex_t& operator=(const shared_mutex_t&);
+#else
+    shared_mutex_t() {}
+    void lock() {}
+    void unlock() {}
+    void lock_shared() {}
+    void unlock_shared() {}
+#endif
+  };
+
+  //! Holds a mutex_t for the lifetime of the object.
+  class ScopedLock {
+  public:
+    explicit ScopedLock(mutex_t& m) : m_mutex(m) { m_mutex.lock(); }
+    ~ScopedLock() { m_mutex.unlock(); }
+  private:
+    mutex_t& m_mutex;
+    ScopedLock(const ScopedLock&);
+    ScopedLock& operator=(const ScopedLock&);
+  };
+
+  //! Holds a shared_mutex_t in shared (read) mode for the lifetime
+  //! of the object.
+  class ReadLock {
+  public:
+    explicit ReadLock(shared_mutex_t& m) : m_mutex(m) { m_mutex.lock_shared(); }
+    ~ReadLock() { m_mutex.unlock_shared(); }
+  private:
+    shared_mutex_t& m_mutex;
+    ReadLock(const ReadLock&);
+    ReadLock& operator=(const ReadLock&);
+  };
+
+  //! Holds a shared_mutex_t in exclusive (write) mode for the
+  //! lifetime of the object.
+  class WriteLock {
+  public:
+    explicit WriteLock(shared_mutex_t& m) : m_mutex(m) { m_mutex.lock(); }
+    ~WriteLock() { m_mutex.unlock(); }
+  private:
+    shared_mutex_t& m_mutex;
+    WriteLock(const WriteLock&);
+    WriteLock& operator=(const WriteLock&);
+  };
+
+  //! @name One-time initialization
+  /*!
+   *  callOnce(flag, f) calls f() the first time it is called with a
+   *  given flag; threads calling it concurrently wait until f() has
+   *  returned, and later calls return at once without taking a
+   *  lock. Declare the flag with CT_ONCE_FLAG(name), as a static
+   *  local or namespace-scope variable. The flag is initialized
+   *  statically, so it may be used while other static objects are
+   *  constructed.
+   */
+  //@{
+#if defined(THREAD_SAFE_CANTERA)
+#if defined(CT_STD_THREADS)
+  typedef std::once_flag once_flag_t;
+#define CT_ONCE_FLAG(name) static Cantera::once_flag_t name
+  inline void callOnce(once_flag_t& flag, void (*f)()) {
+    std::call_once(flag, f);
+  }
+#elif defined(WIN32)
+  typedef INIT_ONCE once_flag_t;
+#define CT_ONCE_FLAG(name) \
+  static Cantera::once_flag_t name = INIT_ONCE_STATIC_INIT
+  inline BOOL CALLBACK callOnceFunc(PINIT_ONCE, PVOID f, PVOID*) {
+    ((void (*)()) f)();
+    return TRUE;
+  }
+  inline void callOnce(once_flag_t& flag, void (*f)()) {
+    InitOnceExecuteOnce(&flag, callOnceFunc, (PVOID) f, 0);
+  }
+#else
+  typedef pthread_once_t once_flag_t;
+#define CT_ONCE_FLAG(name) \
+  static Cantera::once_flag_t name = PTHREAD_ONCE_INIT
+  inline void callOnce(once_flag_t& flag, void (*f)()) {
+    pthread_once(&flag, f);
+  }
+#endif
+#else
+  typedef bool once_flag_t;
+#define CT_ONCE_FLAG(name) static Cantera::once_flag_t name = false
+  inline void callOnce(once_flag_t& flag, void (*f)()) {
+    if (!flag) {
+      flag = true;
+      f();
+    }
+  }
+#endif
+  //@}
+
+#if defined(THREAD_SAFE_CANTERA)
+  //! Identifier of a thread, usable as a std::map key
+#if defined(CT_STD_THREADS)
+  typedef std::thread::id cthreadId_t;
+  inline cthreadId_t getThisThreadId() { return std::this_thread::get_id(); }
+#elif defined(WIN32)
+  typedef DWORD cthreadId_t;
+  inline cthreadId_t getThisThreadId() { return GetCurrentThreadId(); }
+#else
+  typedef pthread_t cthreadId_t;
+  inline cthreadId_t getThisThreadId() { return pthread_self(); }
+#endif
+#endif
+
+}
+
+#endif
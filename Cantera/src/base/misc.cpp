@@ -47,93 +47,39 @@ using namespace std;
 // the Application class is the only internal object
 // that is single instance with static data.  Synchronize access to those data
 // structures.
-// Using macros to avoid polluting code with alot of ifdef's
+// Using macros to avoid polluting code with alot of ifdef's.
+// When THREAD_SAFE_CANTERA is not defined, the lock classes in
+// ct_thread.h do nothing.
 
-#ifdef THREAD_SAFE_CANTERA
-
-#include <boost/shared_ptr.hpp>
-#include <boost/thread/mutex.hpp>
-static boost::mutex  dir_mutex;  // For input directory access
-static boost::mutex  msg_mutex;  // For access to string messages
-static boost::mutex  app_mutex;  // Application state including creating singleton
-//static boost::mutex  log_mutex;  // Logger pointer
-static boost::mutex  xml_mutex;  // XML file storage
+#include "ct_thread.h"
 
-//! Macro for locking input directory access
-#define DIR_LOCK() boost::mutex::scoped_lock   d_lock(dir_mutex)
+namespace Cantera {
+  static shared_mutex_t dir_mutex;  // For input directory access
+  static shared_mutex_t msg_mutex;  // For the map of thread messages
+  static mutex_t  app_mutex;  // Application state including creating singleton
+  static shared_mutex_t xml_mutex;  // XML file storage
+}
 
-//! Macro for locking access to string messages
-#define MSG_LOCK() boost::mutex::scoped_lock   m_lock(msg_mutex)
+//! Macro for locking input directory access for reading
+#define DIR_READ_LOCK() Cantera::ReadLock d_lock(Cantera::dir_mutex)
 
-//! Macro for locking creating singletons in the application state
-#define APP_LOCK() boost::mutex::scoped_lock   a_lock(app_mutex)
+//! Macro for locking input directory access for writing
+#define DIR_LOCK() Cantera::WriteLock d_lock(Cantera::dir_mutex)
 
-//! Macro for locking XML file writing
-#define XML_LOCK() boost::mutex::scoped_lock   x_lock(xml_mutex)
+//! Macro for locking the thread message map for lookups
+#define MSG_READ_LOCK() Cantera::ReadLock m_lock(Cantera::msg_mutex)
 
-   #ifdef WITH_HTML_LOGS
-      //static boost::mutex  html_mutex; // html logs
-      //#define HTML_LOCK() boost::mutex::scoped_lock   h_lock(html_mutex)
-   #endif
+//! Macro for locking the thread message map for insertions and removals
+#define MSG_LOCK() Cantera::WriteLock m_lock(Cantera::msg_mutex)
 
-   #if defined(BOOST_HAS_WINTHREADS)
-      #include <windows.h>
-      typedef unsigned int cthreadId_t ;
-      class thread_equal 
-      {
-      public:
-         bool operator()(cthreadId_t L, cthreadId_t R)
-         {
-            return L == R ;
-         }
-      } ;
-      cthreadId_t getThisThreadId()
-      {
-         return ::GetCurrentThreadId() ;
-      }
-   #elif defined(BOOST_HAS_PTHREADS)
-
-      typedef pthread_t cthreadId_t ;
-      class thread_equal 
-      {
-      public:
-         bool operator()(cthreadId_t L, cthreadId_t R)
-         {
-            return pthread_equal(L, R) ;
-         }
-      } ;
-      cthreadId_t getThisThreadId()
-      {
-         return pthread_self() ;
-      }
-   #elif defined(BOOST_HAS_MPTASKS)
-      typedef MPTaskID  cthreadId_t ;
-      class thread_equal 
-      {
-      public:
-         bool operator()(cthreadId_t L, cthreadId_t R)
-         {
-            return L == R ;
-         }
-      } ;
-      cthreadId_t getThisThreadId()
-      {
-         return MPCurrentTaskID() ;
-      }
-   #endif
-
-#else
-   #define DIR_LOCK() 
-   #define MSG_LOCK() 
-   #define APP_LOCK() 
-   //#define LOG_LOCK() 
-   #define XML_LOCK() 
+//! Macro for locking creating singletons in the application state
+#define APP_LOCK() Cantera::ScopedLock a_lock(Cantera::app_mutex)
 
-   #ifdef WITH_HTML_LOGS
-      //#define HTML_LOCK() 
-   #endif
+//! Macro for locking the XML file cache for lookups
+#define XML_READ_LOCK() Cantera::ReadLock x_lock(Cantera::xml_mutex)
 
-#endif
+//! Macro for locking the XML file cache for reading and storing a file
+#define XML_LOCK() Cantera::WriteLock x_lock(Cantera::xml_mutex)
 
 namespace Cantera {
 
@@ -484,14 +430,18 @@ namespace Cantera {
     } ;
     
 #ifdef THREAD_SAFE_CANTERA
-      //! Typedef for thread specific messages
-      typedef boost::shared_ptr< Messages >   pMessages_t ;
-
-      //! Typedef for map between a thread and the message
-      typedef std::map< cthreadId_t, pMessages_t > threadMsgMap_t ;
+      //! Typedef for map between a thread and its messages
+      typedef std::map< cthreadId_t, Messages* > threadMsgMap_t ;
 
       //! Class that stores thread messages for each thread, and retrieves them
       //! based on the thread id.
+      /*!
+       * Each thread has its own stack of error messages and its own
+       * logger. Lookups of an existing entry take a shared lock, so
+       * threads that are writing log or error messages do not wait
+       * on each other; only the first call from a new thread takes
+       * the exclusive lock to insert its entry.
+       */
       class ThreadMessages
       {
       public:
@@ -499,6 +449,15 @@ namespace Cantera {
 	ThreadMessages()
 	{
 	}
+
+	//! Destructor deletes the messages of all threads
+	~ThreadMessages()
+	{
+	  threadMsgMap_t::iterator iter ;
+	  for (iter = m_threadMsgMap.begin(); iter != m_threadMsgMap.end(); ++iter) {
+	    delete iter->second ;
+	  }
+	}
 	
 	//! Provide a pointer deferencing overloaded operator
 	/*!
@@ -506,16 +465,20 @@ namespace Cantera {
 	 */
 	Messages* operator->()
 	{
-	  MSG_LOCK() ;
 	  cthreadId_t curId = getThisThreadId() ;
-	  threadMsgMap_t::iterator iter = m_threadMsgMap.find( curId ) ;
-	  if ( iter != m_threadMsgMap.end() )
-            {
-	      return (iter->second.get()) ;
-            }
-	  pMessages_t pMsgs( new Messages() ) ;
-	  m_threadMsgMap.insert( std::pair< cthreadId_t, pMessages_t >( curId, pMsgs ) ) ;
-	  return pMsgs.get() ;
+	  {
+	    MSG_READ_LOCK() ;
+	    threadMsgMap_t::iterator iter = m_threadMsgMap.find( curId ) ;
+	    if ( iter != m_threadMsgMap.end() ) {
+	      return iter->second ;
+	    }
+	  }
+	  MSG_LOCK() ;
+	  Messages*& pMsgs = m_threadMsgMap[curId] ;
+	  if (!pMsgs) {
+	    pMsgs = new Messages() ;
+	  }
+	  return pMsgs ;
 	}
 
 	//! Remove a local thread message
@@ -524,6 +487,7 @@ namespace Cantera {
 	  cthreadId_t curId = getThisThreadId() ;
 	  threadMsgMap_t::iterator iter = m_threadMsgMap.find( curId ) ;
 	  if ( iter != m_threadMsgMap.end() ) {
+	    delete iter->second ;
 	    m_threadMsgMap.erase( iter ) ;
 	  }
 	}
@@ -968,7 +932,7 @@ protected:
      */
     Unit* Unit::s_u = 0;
       #if defined(THREAD_SAFE_CANTERA)
-        boost::mutex Unit::units_mutex ;
+        mutex_t Unit::units_mutex ;
       #endif
 
 
@@ -1002,7 +966,6 @@ protected:
     }
 
     XML_Node* Application::get_XML_File(std::string file, int debug) {
-        XML_LOCK();
 		std::string path = "";
         /*
         try {
@@ -1036,87 +999,94 @@ protected:
         replace_if( path.begin(), path.end(), bind2nd( equal_to<char>(), '\\'), '/' ) ; 
 #endif
 
+        /*
+         * Check whether or not the file is XML. If not, it will
+         * be first processed with the preprocessor. We determine
+         * whether it is an XML file by looking at the file extension.
+         */
         string ff = path;
-        if (xmlfiles.find(path) 
-            == xmlfiles.end()) {
+        string::size_type idot = path.rfind('.');
+        string ext;
+        if (idot != string::npos) {
+            ext = path.substr(idot, path.size());
+        } else {
+            ext = "";
+            idot = path.size();
+        }
+        bool isXML = (ext == ".xml" || ext == ".ctml");
+        if (!isXML) {
             /*
-             * Check whether or not the file is XML. If not, it will
-             * be first processed with the preprocessor. We determine
-             * whether it is an XML file by looking at the file extension.
+             * We will assume that we are trying to open a cti file.
+             * First, determine the name of the xml file, ff, derived from
+             * the cti file.
+             * In all cases, we will write the xml file to the current
+             * directory.
              */
-            string::size_type idot = path.rfind('.');
-            string ext;
-            if (idot != string::npos) {
-                ext = path.substr(idot, path.size());
-            } else {
-                ext = "";
-                idot = path.size();
+            string::size_type islash = path.rfind('/');
+            if (islash != string::npos) 
+                ff = string("./")+path.substr(islash+1,idot-islash - 1) + ".xml";
+            else {
+                ff = string("./")+path.substr(0,idot) + ".xml";
             }
-            if (ext != ".xml" && ext != ".ctml") {
-                /*
-                 * We will assume that we are trying to open a cti file.
-                 * First, determine the name of the xml file, ff, derived from
-                 * the cti file.
-                 * In all cases, we will write the xml file to the current
-                 * directory.
-                 */
-                string::size_type islash = path.rfind('/');
-                if (islash != string::npos) 
-                    ff = string("./")+path.substr(islash+1,idot-islash - 1) + ".xml";
-                else {
-                    ff = string("./")+path.substr(0,idot) + ".xml";
-                }
 #ifdef DEBUG_PATHS
-                cout << "get_XML_File(): Expected location of xml file = "
-                     << ff << endl;
+            cout << "get_XML_File(): Expected location of xml file = "
+                 << ff << endl;
 #endif
-                /*
-                 * Do a search of the existing XML trees to determine if we have
-                 * already processed this file. If we have, return a pointer to
-                 * the processed xml tree.
-                 */
-                if (xmlfiles.find(ff) != xmlfiles.end()) {
+        }
+
+        /*
+         * Do a search of the existing XML trees to determine if we have
+         * already processed this file. If we have, return a pointer to
+         * the processed xml tree. Only a shared lock is needed for
+         * this, so threads importing the same file at the same time
+         * do not wait on each other.
+         */
+        {
+            XML_READ_LOCK();
+            map<string, XML_Node*>::const_iterator pos = xmlfiles.find(ff);
+            if (pos != xmlfiles.end()) {
 #ifdef DEBUG_PATHS
-                    cout << "get_XML_File(): File, " << ff << ", was previously read."
-                         << " Retrieving the storred xml tree." << endl;
+                cout << "get_XML_File(): File, " << ff << ", was previously read."
+                     << " Retrieving the storred xml tree." << endl;
 #endif
-                    return xmlfiles[ff];      
-                }
-                /*
-                 * Ok, we didn't find the processed XML tree. Do the conversion
-                 * to xml, possibly overwriting the file, ff, in the process.
-                 */
-                ctml::ct2ctml(path.c_str(),debug);
-            }
-            else {
-                ff = path;
+                return pos->second;
             }
+        }
+
+        /*
+         * The file has not been read. Take the exclusive lock, and
+         * check again, since another thread may have read the file
+         * while this one was waiting for the lock.
+         */
+        XML_LOCK();
+        map<string, XML_Node*>::const_iterator pos = xmlfiles.find(ff);
+        if (pos != xmlfiles.end()) {
+            return pos->second;
+        }
+        if (!isXML) {
             /*
-             * Take the XML file ff, open it, and process it, creating an
-             * XML tree, and then adding an entry in the map. We will store
-             * the absolute pathname as the key for this map.
+             * Do the conversion to xml, possibly overwriting the file,
+             * ff, in the process.
              */
-            ifstream s(ff.c_str());
-
-            XML_Node* x = new XML_Node("doc");
-            if (s) {
-                x->build(s);
-                x->lock();
-                xmlfiles[ff] = x;
-            }
-            else {
-                string estring = "cannot open "+ff+" for reading.";
-                estring += "Note, this error indicates a possible configuration problem."; 
-                throw CanteraError("get_XML_File", estring);
-            }
+            ctml::ct2ctml(path.c_str(),debug);
         }
 
         /*
-         * Return the XML node pointer. At this point, we are sure that the
-         * lookup operation in the return statement will return a valid
-         * pointer. 
+         * Take the XML file ff, open it, and process it, creating an
+         * XML tree, and then adding an entry in the map. We will store
+         * the absolute pathname as the key for this map.
          */
-        return xmlfiles[ff];
+        ifstream s(ff.c_str());
+        if (!s) {
+            string estring = "cannot open "+ff+" for reading.";
+            estring += "Note, this error indicates a possible configuration problem."; 
+            throw CanteraError("get_XML_File", estring);
+        }
+        XML_Node* x = new XML_Node("doc");
+        x->build(s);
+        x->lock();
+        xmlfiles[ff] = x;
+        return x;
     }
 
   // Close an XML File 
@@ -1138,8 +1108,8 @@ protected:
       for(; b != e; ++b) {
 	b->second->unlock();
 	delete b->second;
-	xmlfiles.erase(b->first);
       }
+      xmlfiles.clear();
     }
     else if (xmlfiles.find(file) != xmlfiles.end()) {
       xmlfiles[file]->unlock();
@@ -1440,7 +1410,7 @@ protected:
   }
   
   std::string Application::findInputFile(std::string name) {
-    DIR_LOCK() ;
+    DIR_READ_LOCK() ;
     string::size_type islash = name.find('/');
     string::size_type ibslash = name.find('\\');
     string inname;
@@ -19,9 +19,7 @@
 
 #include <string>
 
-#if defined(THREAD_SAFE_CANTERA)
-#include <boost/thread/mutex.hpp>
-#endif
+#include "ct_thread.h"
 
 namespace Cantera {
 
@@ -36,7 +34,7 @@ namespace Cantera {
         //! Initialize the static Unit class.
         static Unit* units() {
 #if defined(THREAD_SAFE_CANTERA)
-            boost::mutex::scoped_lock   lock(units_mutex) ;
+            ScopedLock   lock(units_mutex) ;
 #endif
             if (!s_u) s_u = new Unit;
             return s_u;
@@ -48,7 +46,7 @@ namespace Cantera {
          */
         static void deleteUnit() {
 #if defined(THREAD_SAFE_CANTERA)
-            boost::mutex::scoped_lock   lock(units_mutex) ;
+            ScopedLock   lock(units_mutex) ;
 #endif
             if (s_u) {
                 delete s_u;
@@ -170,7 +168,7 @@ namespace Cantera {
 
 #if defined(THREAD_SAFE_CANTERA)
         //! Decl for static locker for Units singelton 
-        static boost::mutex units_mutex;
+        static mutex_t units_mutex;
 #endif
 
          //! Units class constructor, containing the default mappings between
@@ -763,6 +763,11 @@ namespace Cantera {
     return m_attribs;
   }
 
+  // Returns the attributes of the current node
+  const std::map<std::string,std::string>& XML_Node::attribsConst() const { 
+    return m_attribs;
+  }
+
   // Set the line number 
   /*
    *  @param n   the member data m_linenum is set to n
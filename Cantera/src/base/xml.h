@@ -387,6 +387,9 @@ namespace Cantera {
      */
     void clear();
 
+    //! Returns the attributes of the current node
+    const std::map<std::string,std::string>& attribsConst() const;
+
   private:
     //! Returns a changeable value of the attributes map for the current node
     /*!
@@ -24,7 +24,7 @@ namespace Cantera {
 
   FalloffFactory* FalloffFactory::s_factory = 0;
 #if defined(THREAD_SAFE_CANTERA)
-  boost::mutex FalloffFactory::falloff_mutex ;
+  mutex_t FalloffFactory::falloff_mutex ;
 #endif
 
     
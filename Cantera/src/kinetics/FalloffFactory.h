@@ -19,9 +19,7 @@
 #include "reaction_defs.h"
 #include "FactoryBase.h"
 
-#if defined(THREAD_SAFE_CANTERA)
-#include <boost/thread/mutex.hpp>
-#endif
+#include "ct_thread.h"
 
 namespace Cantera {
 
@@ -122,7 +120,7 @@ namespace Cantera {
      */  
     static FalloffFactory* factory() { 
 #if defined(THREAD_SAFE_CANTERA)
-      boost::mutex::scoped_lock   lock(falloff_mutex) ;
+      ScopedLock   lock(falloff_mutex) ;
 #endif
       if (!s_factory) s_factory = new FalloffFactory;
       return s_factory;
@@ -130,7 +128,7 @@ namespace Cantera {
 
     virtual void deleteFactory() {
 #if defined(THREAD_SAFE_CANTERA)
-      boost::mutex::scoped_lock   lock(falloff_mutex) ;
+      ScopedLock   lock(falloff_mutex) ;
 #endif
       if (s_factory) {
 	delete s_factory;
@@ -172,7 +170,7 @@ namespace Cantera {
 
 #if defined(THREAD_SAFE_CANTERA)
     //!  Mutex for use when calling the factory
-    static boost::mutex falloff_mutex ;
+    static mutex_t falloff_mutex ;
 #endif
   };
 
@@ -29,6 +29,11 @@ using namespace std;
 
 namespace Cantera {
 
+#ifdef CANTERA_PROFILING
+    /// indices of the profiling data entries of GasKinetics
+    enum { prof_rop, prof_rates_T, prof_rates_C, prof_cache_T,
+           prof_cache_rop };
+#endif
 
     /**
      * Construct an empty reaction mechanism.
@@ -46,6 +51,14 @@ namespace Cantera {
         m_kdata = new GasKineticsData;
         m_kdata->m_temp = 0.0;
         m_rxnstoich = new ReactionStoichMgr;
+#ifdef CANTERA_PROFILING
+        m_profile.setOwner("GasKinetics");
+        m_profile.addTimer("updateROP");
+        m_profile.addTimer("update_rates_T");
+        m_profile.addTimer("update_rates_C");
+        m_profile.addCache("rates_T");
+        m_profile.addCache("ROP");
+#endif
     }
 
     GasKinetics::
@@ -63,7 +76,14 @@ namespace Cantera {
 
     void GasKinetics::
     _update_rates_T() {
+        CT_PROFILE_TIMER(m_profile, prof_rates_T);
         doublereal T = thermo().temperature();
+#ifdef CANTERA_PROFILING
+        // the rates are recomputed even if T is unchanged; count
+        // how often this happens
+        if (T == m_kdata->m_temp) CT_PROFILE_HIT(m_profile, prof_cache_T);
+        else CT_PROFILE_MISS(m_profile, prof_cache_T);
+#endif
         m_kdata->m_logStandConc = log(thermo().standardConcentration()); 
         //if (fabs(T - m_kdata->m_temp) > 0.0) { 
         doublereal logT = log(T);
@@ -84,6 +104,7 @@ namespace Cantera {
      */         
     void GasKinetics::
     _update_rates_C() {
+        CT_PROFILE_TIMER(m_profile, prof_rates_C);
         thermo().getActivityConcentrations(&m_conc[0]);
         doublereal ctot = thermo().molarDensity();
         m_3b_concm.update(m_conc, ctot, &m_kdata->concm_3b_values[0]);
@@ -329,10 +350,15 @@ namespace Cantera {
 
     void GasKinetics::updateROP() {
 
+        CT_PROFILE_TIMER(m_profile, prof_rop);
         _update_rates_T();
         _update_rates_C();
 
-        if (m_kdata->m_ROP_ok) return;
+        if (m_kdata->m_ROP_ok) {
+            CT_PROFILE_HIT(m_profile, prof_cache_rop);
+            return;
+        }
+        CT_PROFILE_MISS(m_profile, prof_cache_rop);
 
         const vector_fp& rf = m_kdata->m_rfn;
         const vector_fp& m_rkc = m_kdata->m_rkcn;
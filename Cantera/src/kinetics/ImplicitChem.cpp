@@ -17,12 +17,18 @@
 
 #include "ImplicitChem.h"
 #include "Integrator.h"
+#include "sort.h"
+#include "stringUtils.h"
+
+using namespace std;
 
 namespace Cantera {
 
     ImplicitChem::ImplicitChem(Kinetics& kin, ThermoPhase& therm) 
         : FuncEval(), m_kin(&kin), m_thermo(&therm), m_integ(0),
-          m_atol(1.e-15), m_rtol(1.e-7), m_maxstep(0.0), m_energy(false)
+          m_atol(1.e-15), m_rtol(1.e-7), m_maxstep(0.0), m_energy(false),
+          m_constVolume(false), m_init(false), m_ncells(0),
+          m_nevals_last(0), m_nevals_max(0), m_nevals_total(0)
     {
         m_integ = newIntegrator("CVODE"); //CVodeInt;
         //m_mix = &kin.phase();
@@ -34,6 +40,7 @@ namespace Cantera {
         m_integ->setProblemType(DENSE + NOJAC);
         m_integ->setIterator(Newton_Iter);
         m_nsp = m_thermo->nSpecies();
+        m_work.resize(m_nsp);
     }
 
     // overloaded method of FuncEval. Called by the integrator to
@@ -41,7 +48,12 @@ namespace Cantera {
     void ImplicitChem::getInitialConditions(doublereal t0, size_t leny, doublereal * y) 
     {
         m_thermo->getMassFractions(y);
-        m_h0 = m_thermo->enthalpy_mass();
+        if (m_constVolume) {
+            m_h0 = m_thermo->intEnergy_mass();
+        }
+        else {
+            m_h0 = m_thermo->enthalpy_mass();
+        }
         m_rho = m_thermo->density();
         m_press = m_thermo->pressure();
     }
@@ -54,21 +66,36 @@ namespace Cantera {
         m_integ->setTolerances(m_rtol, m_atol);
         //        m_integ->setMaxStep(m_maxstep);
         m_integ->initialize(t0, *this);
+        m_init = true;
     }
 
     
     void ImplicitChem::updateState(doublereal* y) {
         m_thermo->setMassFractions(y);
+        if (m_constVolume) {
+            m_thermo->setDensity(m_rho);
+        }
+        else {
+            m_thermo->setPressure(m_press);
+        }
         if (m_energy) {
             doublereal delta, temp = m_thermo->temperature();
             do {
-                delta = -(m_thermo->enthalpy_mass() - m_h0)/m_thermo->cp_mass();
-                temp += delta;
-                m_thermo->setTemperature(temp);
+                if (m_constVolume) {
+                    delta = -(m_thermo->intEnergy_mass() - m_h0)
+                            /m_thermo->cv_mass();
+                    temp += delta;
+                    m_thermo->setTemperature(temp);
+                }
+                else {
+                    delta = -(m_thermo->enthalpy_mass() - m_h0)
+                            /m_thermo->cp_mass();
+                    temp += delta;
+                    m_thermo->setState_TP(temp, m_press);
+                }
             }
             while (fabs(delta) > 1.e-7);
         }
-        m_thermo->setPressure(m_press);
     }
 
     /**
@@ -78,12 +105,105 @@ namespace Cantera {
         doublereal* ydot, doublereal* p) 
     {
         updateState(y);   // synchronize the mixture state with y
-        m_thermo->setPressure(m_press);
         m_kin->getNetProductionRates(ydot);   // "omega dot"
+        doublereal rho = m_thermo->density();
         int k;
         for (k = 0; k < m_nsp; k++) {
-            ydot[k] *= m_wt[k]/m_rho;
+            ydot[k] *= m_wt[k]/rho;
+        }
+    }
+
+    int ImplicitChem::integrateCell(doublereal dt) {
+        if (m_init) {
+            m_integ->reinitialize(0.0, *this);
+        }
+        else {
+            initialize(0.0);
+        }
+        m_integ->setMaxStepSize(dt);
+        m_integ->integrate(dt);
+        updateState(m_integ->solution());
+
+        m_nevals_last = m_integ->nEvals();
+        m_nevals_total += m_nevals_last;
+        m_nevals_max = max(m_nevals_max, m_nevals_last);
+        m_ncells++;
+        return m_nevals_last;
+    }
+
+    void ImplicitChem::integrateCells(int ncells, doublereal* T, 
+        doublereal* P, doublereal* Y, doublereal dt, doublereal* work,
+        const int* order)
+    {
+        int i, n, nevals;
+        for (i = 0; i < ncells; i++) {
+            n = (order ? order[i] : i);
+            m_thermo->setState_TPY(T[n], P[n], Y + n*m_nsp);
+            nevals = integrateCell(dt);
+            T[n] = m_thermo->temperature();
+            P[n] = m_thermo->pressure();
+            m_thermo->getMassFractions(Y + n*m_nsp);
+            if (work) work[n] = nevals;
+        }
+    }
+
+    doublereal ImplicitChem::estimateStiffness(doublereal dt) {
+        m_kin->getDestructionRates(DATA_PTR(m_work));
+        doublereal c, rmax = 0.0;
+        doublereal ctot = m_thermo->molarDensity();
+        int k;
+        for (k = 0; k < m_nsp; k++) {
+            c = m_thermo->moleFraction(k) * ctot;
+            // ignore trace species, which are destroyed as fast as
+            // they are formed and do not set the integrator step
+            if (c > m_atol * ctot) {
+                rmax = max(rmax, m_work[k]/c);
+            }
+        }
+        return rmax * dt;
+    }
+
+    void ImplicitChem::estimateWork(int ncells, const doublereal* T, 
+        const doublereal* P, const doublereal* Y, doublereal dt, 
+        doublereal* work)
+    {
+        for (int n = 0; n < ncells; n++) {
+            m_thermo->setState_TPY(T[n], P[n], Y + n*m_nsp);
+            work[n] = estimateStiffness(dt);
+        }
+    }
+
+    void ImplicitChem::sortCellsByWork(int ncells, const doublereal* work,
+        int* order)
+    {
+        vector_fp x(ncells);
+        vector_int y(ncells);
+        for (int n = 0; n < ncells; n++) {
+            x[n] = -work[n];
+            y[n] = n;
+        }
+        heapsort(x, y);
+        copy(y.begin(), y.end(), order);
+    }
+
+    void ImplicitChem::clearStats() {
+        m_ncells = 0;
+        m_nevals_last = 0;
+        m_nevals_max = 0;
+        m_nevals_total = 0;
+    }
+
+    void ImplicitChem::writeStats() {
+        writelog("\nImplicitChem statistics:\n");
+        writelog("   cells advanced:          " + int2str(m_ncells) + "\n");
+        writelog("   function evaluations:    " + int2str(m_nevals_total) 
+            + "\n");
+        if (m_ncells > 0) {
+            writelog("   mean evaluations / cell: " 
+                + fp2str(double(m_nevals_total)/m_ncells) + "\n");
         }
+        writelog("   max evaluations / cell:  " + int2str(m_nevals_max) 
+            + "\n");
     }
 
 }
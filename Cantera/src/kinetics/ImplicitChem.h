@@ -29,6 +29,19 @@ namespace Cantera {
      * \f[
      * \dot Y_k = \frac{\omega_k}{\rho}
      * \f]
+     *
+     * If the energy equation is enabled (adiabatic()), the
+     * temperature is found at each evaluation by holding either the
+     * specific enthalpy and pressure (the default) or the specific
+     * internal energy and density (setConstantVolume()) at their
+     * initial values.
+     *
+     * The object is intended to be reused for many independent
+     * states, as in operator-split chemistry for a CFD code. The
+     * integrator memory is allocated on the first call to
+     * integrateCell() and only reinitialized thereafter, and the
+     * number of function evaluations needed for each cell is
+     * recorded.
      */
     class ImplicitChem : public FuncEval {
 
@@ -60,6 +73,22 @@ namespace Cantera {
             m_energy = false;
         }
 
+        //! Hold the density constant instead of the pressure.
+        /*!
+         * With the energy equation enabled, the specific internal
+         * energy is held constant instead of the specific enthalpy.
+         */
+        void setConstantVolume(bool cv = true) {
+            m_constVolume = cv;
+        }
+
+        //! Set the relative and absolute integration tolerances.
+        void setTolerances(doublereal rtol, doublereal atol) {
+            m_rtol = rtol;
+            m_atol = atol;
+            m_init = false;
+        }
+
         /**
          * Integrate from t0 to t1. The integrator is reinitialized
          * first.
@@ -67,7 +96,6 @@ namespace Cantera {
         void integrate(doublereal t0, doublereal t1) {
             m_integ->reinitialize(t0, *this);
             m_integ->setMaxStepSize(t1 - t0);
-            m_rho = m_thermo->density();
             m_integ->integrate(t1);
             updateState(m_integ->solution());
         }
@@ -81,6 +109,90 @@ namespace Cantera {
             updateState(m_integ->solution());
         }
 
+        //! Advance the current state of the phase by time dt.
+        /*!
+         * The integrator is initialized on the first call and
+         * reinitialized on all later ones, so that no memory is
+         * allocated per cell.
+         *
+         * @param dt  Time step (s)
+         * @return    Number of function evaluations used.
+         */
+        int integrateCell(doublereal dt);
+
+        //! Advance a set of independent states by time dt.
+        /*!
+         * On input, T, P and Y hold the temperature, pressure and
+         * mass fractions of each of the ncells states. Y is stored
+         * cell by cell, with nSpecies() entries per cell. On return
+         * they hold the states at the end of the step. For a
+         * constant-volume integration, P is updated; otherwise it is
+         * unchanged.
+         *
+         * @param ncells  Number of states
+         * @param T       Temperatures (K). Length ncells.
+         * @param P       Pressures (Pa). Length ncells.
+         * @param Y       Mass fractions. Length ncells*nSpecies().
+         * @param dt      Time step (s)
+         * @param work    If nonzero, on return holds the number of
+         *                function evaluations used by each cell.
+         *                This is a good stiffness estimate to pass to
+         *                sortCellsByWork() on the next step.
+         * @param order   If nonzero, the cells are processed in the
+         *                order order[0], order[1], ..., as produced
+         *                by sortCellsByWork().
+         */
+        void integrateCells(int ncells, doublereal* T, doublereal* P,
+            doublereal* Y, doublereal dt, doublereal* work = 0,
+            const int* order = 0);
+
+        //! Estimate of the stiffness of the current state over time dt.
+        /*!
+         * This is dt divided by the shortest species destruction
+         * time scale, \f$ \max_k(\dot d_k / C_k) \Delta t \f$.
+         * It is cheap (one rate evaluation) and can be used to
+         * order cells for load balancing when no work history from
+         * integrateCells() is available.
+         */
+        doublereal estimateStiffness(doublereal dt);
+
+        //! Fill work with estimateStiffness() for each of ncells states.
+        /*!
+         * The arguments T, P and Y have the same layout as in
+         * integrateCells(). The state of the phase is changed.
+         */
+        void estimateWork(int ncells, const doublereal* T,
+            const doublereal* P, const doublereal* Y, doublereal dt,
+            doublereal* work);
+
+        //! Order cells by decreasing estimated work.
+        /*!
+         * A load-balancing hook: on return, order holds the cell
+         * indices sorted so that the most expensive cells come
+         * first. Dealing these out round-robin, or to the next free
+         * worker, balances the chemistry cost across processes.
+         */
+        static void sortCellsByWork(int ncells, const doublereal* work,
+            int* order);
+
+        //! Number of cells advanced since the last call to clearStats()
+        int nCells() const { return m_ncells; }
+
+        //! Function evaluations used by the last cell
+        int nEvalsLast() const { return m_nevals_last; }
+
+        //! Largest number of function evaluations used by one cell
+        int nEvalsMax() const { return m_nevals_max; }
+
+        //! Total function evaluations since the last call to clearStats()
+        int nEvalsTotal() const { return m_nevals_total; }
+
+        //! Reset the work statistics.
+        void clearStats();
+
+        //! Write a summary of the work statistics to the log.
+        void writeStats();
+
         // overloaded methods of class FuncEval
         virtual int neq() { return m_nsp; }
 	virtual void eval(doublereal t, doublereal* y, doublereal* ydot,
@@ -107,8 +219,17 @@ namespace Cantera {
         array_fp m_wt;
         doublereal m_rho;
         bool m_energy;
-        doublereal m_h0;
+        bool m_constVolume;
+        bool m_init;                 // true once m_integ is initialized
+        doublereal m_h0;             // initial enthalpy or internal energy
         doublereal m_press;
+        vector_fp m_work;
+
+        // work statistics
+        int m_ncells;
+        int m_nevals_last;
+        int m_nevals_max;
+        int m_nevals_total;
 
     private:
 
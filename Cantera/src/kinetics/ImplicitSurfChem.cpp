@@ -44,6 +44,8 @@ namespace Cantera {
     m_surfSpeciesStart(-1),
     m_surfSolver(0),
     m_commonTempPressForPhases(true),
+    m_analyticSurfJac(true),
+    m_maxSurfJacAge(1),
     m_ioFlag(0)
   {
     m_nsurf = static_cast<int>(k.size());
@@ -295,6 +297,8 @@ namespace Cantera {
     }
 
     m_surfSolver->m_ioflag = m_ioFlag; 
+    m_surfSolver->setAnalyticJacobian(m_analyticSurfJac);
+    m_surfSolver->setJacobianReuse(m_maxSurfJacAge);
 
     // Save the current solution
     copy(m_concSpecies.begin(), m_concSpecies.end(), m_concSpeciesSave.begin());
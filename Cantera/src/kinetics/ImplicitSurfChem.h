@@ -231,6 +231,21 @@ namespace Cantera {
       m_ioFlag = ioFlag;
     }
 
+    //! Set the Jacobian options of the pseudo steady state solver
+    /*!
+     *  @param analytic  If true (default), use the analytic derivatives
+     *                   of the net production rates supplied by the
+     *                   InterfaceKinetics objects. If false, evaluate
+     *                   the Jacobian by finite differences.
+     *  @param maxAge    Maximum number of Newton iterations over which
+     *                   a factored Jacobian is reused. The default of 1
+     *                   reevaluates the Jacobian at every iteration.
+     */
+    void setSurfSolverJacobian(bool analytic, int maxAge = 1) {
+      m_analyticSurfJac = analytic;
+      m_maxSurfJacAge = maxAge;
+    }
+
   protected:
         
    
@@ -331,6 +346,12 @@ namespace Cantera {
     //! is imposed
     bool m_commonTempPressForPhases;
 
+    //! Use the analytic Jacobian in the pseudo steady state solver
+    bool m_analyticSurfJac;
+
+    //! Maximum age of a factored Jacobian in the pseudo steady state solver
+    int m_maxSurfJacAge;
+
     //! We make the solveSS class a friend because we need
     //! to access all of the above information directly.
     //! Adding the members into the class is also a possibility.
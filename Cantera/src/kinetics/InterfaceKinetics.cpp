@@ -25,6 +25,11 @@ using namespace std;
 
 namespace Cantera {
 
+#ifdef CANTERA_PROFILING
+  /// indices of the profiling data entries of InterfaceKinetics
+  enum { prof_rates_T, prof_cache_T, prof_cache_cov };
+#endif
+
   //====================================================================================================================
   /*
    * Construct an empty InterfaceKinetics reaction mechanism.
@@ -61,6 +66,12 @@ namespace Cantera {
     if (thermo != 0) addPhase(*thermo);
     m_kdata = new InterfaceKineticsData;
     m_kdata->m_temp = 0.0;
+#ifdef CANTERA_PROFILING
+    m_profile.setOwner("InterfaceKinetics");
+    m_profile.addTimer("update_rates_T");
+    m_profile.addCache("rates_T");
+    m_profile.addCache("coverages");
+#endif
   }
   //====================================================================================================================
   /*
@@ -149,10 +160,26 @@ namespace Cantera {
     m_nrev                 = right.m_nrev;
     m_rrxn                 = right.m_rrxn;
     m_prxn                 = right.m_prxn;
+    m_fwdOrderSpecies      = right.m_fwdOrderSpecies;
+    m_fwdOrder             = right.m_fwdOrder;
+    m_revOrderSpecies      = right.m_revOrderSpecies;
+    m_revOrder             = right.m_revOrder;
+    m_dropnet_dc           = right.m_dropnet_dc;
+    m_coverages            = right.m_coverages;
+    m_logCoverages         = right.m_logCoverages;
+    m_covRate              = right.m_covRate;
+    m_covStart             = right.m_covStart;
+    m_covSpecies           = right.m_covSpecies;
+    m_covA                 = right.m_covA;
+    m_covE                 = right.m_covE;
+    m_covM                 = right.m_covM;
     m_rxneqn               = right.m_rxneqn;
     *m_kdata               = *right.m_kdata;  // needs to be developed
     m_mu0                  = right.m_mu0;
     m_phi                  = right.m_phi;
+    m_phaseT               = right.m_phaseT;
+    m_phaseP               = right.m_phaseP;
+    m_phaseSiteDens        = right.m_phaseSiteDens;
     m_pot                  = right.m_pot;
     m_rwork                = right.m_rwork;
     m_E                    = right.m_E;
@@ -236,14 +263,40 @@ namespace Cantera {
    *       updateKc();
    */
   void InterfaceKinetics::_update_rates_T() {
+    CT_PROFILE_TIMER(m_profile, prof_rates_T);
     _update_rates_phi();
     if (m_has_coverage_dependence) {
-      m_surf->getCoverages(DATA_PTR(m_conc));
-      m_rates.update_C(DATA_PTR(m_conc));
-      m_redo_rates = true;
+      _update_rates_coverages();
+    }
+    /*
+     * The equilibrium constants, and the exchange current density
+     * formulation, depend on the standard states of all of the phases
+     */
+    int np = nPhases();
+    if ((int) m_phaseT.size() != np) {
+      m_phaseT.assign(np, -1.0);
+      m_phaseP.assign(np, -1.0);
+      m_phaseSiteDens.assign(np, -1.0);
+    }
+    for (int n = 0; n < np; n++) {
+      thermo_t& tp = thermo(n);
+      doublereal n0 = 0.0;
+      if (tp.eosType() == cSurf || tp.eosType() == cEdge) {
+	n0 = ((SurfPhase&) tp).siteDensity();
+      }
+      if (tp.temperature() != m_phaseT[n] || tp.pressure() != m_phaseP[n]
+	  || n0 != m_phaseSiteDens[n]) {
+	m_phaseT[n] = tp.temperature();
+	m_phaseP[n] = tp.pressure();
+	m_phaseSiteDens[n] = n0;
+	m_redo_rates = true;
+      }
     }
     doublereal T = thermo(surfacePhaseIndex()).temperature();
-    m_redo_rates = true;
+#ifdef CANTERA_PROFILING
+    if (T != m_kdata->m_temp || m_redo_rates) CT_PROFILE_MISS(m_profile, prof_cache_T);
+    else CT_PROFILE_HIT(m_profile, prof_cache_T);
+#endif
     if (T != m_kdata->m_temp || m_redo_rates) {
       m_kdata->m_logtemp = log(T);
       m_rates.update(T, m_kdata->m_logtemp, DATA_PTR(m_kdata->m_rfn));
@@ -260,6 +313,53 @@ namespace Cantera {
     }
   }
   //====================================================================================================================
+  /*
+   * The coverage dependence is evaluated as one sparse matrix-vector
+   * product over the coverages and their logarithms, so that each
+   * logarithm is evaluated only once per species.
+   */
+  void InterfaceKinetics::_update_rates_coverages() {
+    int nsp = m_surf->nSpecies();
+    if ((int) m_coverages.size() != nsp) {
+      m_coverages.assign(nsp, -1.0);
+      m_logCoverages.resize(nsp, 0.0);
+    }
+    doublereal* theta = DATA_PTR(m_conc);
+    m_surf->getCoverages(theta);
+    int k;
+    for (k = 0; k < nsp; k++) {
+      if (theta[k] != m_coverages[k]) break;
+    }
+    if (k == nsp) {
+      CT_PROFILE_HIT(m_profile, prof_cache_cov);
+      return;
+    }
+    CT_PROFILE_MISS(m_profile, prof_cache_cov);
+    for (k = 0; k < nsp; k++) {
+      m_coverages[k] = theta[k];
+      m_logCoverages[k] = log(fmaxx(theta[k], Tiny));
+    }
+
+    int nrows = m_covRate.size();
+    doublereal acov, ecov, mcov, th;
+    for (int i = 0; i < nrows; i++) {
+      acov = 0.0;
+      ecov = 0.0;
+      mcov = 0.0;
+      for (int n = m_covStart[i]; n < m_covStart[i+1]; n++) {
+	k = m_covSpecies[n];
+	th = m_coverages[k];
+	acov += m_covA[n] * th;
+	ecov += m_covE[n] * th;
+	if (m_covM[n] != 0.0) {
+	  mcov += m_covM[n] * m_logCoverages[k];
+	}
+      }
+      m_rates.rateCoeff(m_covRate[i]).setCoverageTerms(acov, ecov, mcov);
+    }
+    m_redo_rates = true;
+  }
+  //====================================================================================================================
   void InterfaceKinetics::_update_rates_phi() {
     int np = nPhases();
     for (int n = 0; n < np; n++) {
@@ -497,6 +597,126 @@ namespace Cantera {
 				      net);
   }
 
+  /*
+   * Value of c raised to the power order, as used in the rate of
+   * progress expressions
+   */
+  static doublereal concPower(doublereal c, doublereal order) {
+    if (order == 1.0) return c;
+    if (c > 0.0 || order == (doublereal) int(order)) {
+      return pow(c, order);
+    }
+    return 0.0;
+  }
+
+  /*
+   * Derivative of the product of the concentrations of the species k[]
+   * raised to the powers order[] with respect to the mth factor
+   */
+  static doublereal concProductDeriv(const vector_int& k, const vector_fp& order,
+				     int m, const doublereal* c) {
+    doublereal om = order[m];
+    doublereal cm = c[k[m]];
+    doublereal d;
+    if (om == 0.0) {
+      return 0.0;
+    } else if (om == 1.0) {
+      d = 1.0;
+    } else if (cm > 0.0 || om == (doublereal) int(om)) {
+      d = om * pow(cm, om - 1.0);
+    } else {
+      return 0.0;
+    }
+    int nk = k.size();
+    for (int l = 0; l < nk; l++) {
+      if (l != m && order[l] != 0.0) {
+	d *= concPower(c[k[l]], order[l]);
+      }
+    }
+    return d;
+  }
+
+  // Return the derivatives of the species net production rates
+  // with respect to the concentrations of the species in a surface or
+  // edge phase
+  /*
+   *  The derivative of the rate of progress of each reaction is formed
+   *  by differentiating the concentration products in m_fwdOrderSpecies
+   *  and m_revOrderSpecies, and adding the contribution from the coverage
+   *  dependence of the rate constant. The resulting columns are then
+   *  mapped onto the species using the stoichiometric coefficient manager,
+   *  exactly as the rates of progress are in getNetProductionRates().
+   */
+  void InterfaceKinetics::getNetProductionRatesJacobian(int n, doublereal* jac) {
+    thermo_t& tp = thermo(n);
+    if (tp.eosType() != cSurf && tp.eosType() != cEdge) {
+      throw CanteraError("InterfaceKinetics::getNetProductionRatesJacobian",
+			 "phase " + tp.id() + " is not a surface or edge phase");
+    }
+    updateROP();
+
+    int nsp = tp.nSpecies();
+    int kstart = m_start[n];
+    int i, j, m, nk;
+    m_dropnet_dc.resize(m_ii * nsp);
+    std::fill(m_dropnet_dc.begin(), m_dropnet_dc.end(), 0.0);
+
+    const vector_fp& rf = m_kdata->m_rfn;
+    const vector_fp& rkc = m_kdata->m_rkcn;
+    const doublereal* c = DATA_PTR(m_conc);
+    doublereal kf;
+    for (i = 0; i < m_ii; i++) {
+      kf = rf[i] * m_perturb[i];
+      const vector_int& kr = m_fwdOrderSpecies[i];
+      nk = kr.size();
+      for (m = 0; m < nk; m++) {
+	j = kr[m] - kstart;
+	if (j >= 0 && j < nsp) {
+	  m_dropnet_dc[m_ii * j + i] += kf * concProductDeriv(kr, m_fwdOrder[i], m, c);
+	}
+      }
+      const vector_int& kp = m_revOrderSpecies[i];
+      nk = kp.size();
+      for (m = 0; m < nk; m++) {
+	j = kp[m] - kstart;
+	if (j >= 0 && j < nsp) {
+	  m_dropnet_dc[m_ii * j + i] -=
+	    kf * rkc[i] * concProductDeriv(kp, m_revOrder[i], m, c);
+	}
+      }
+    }
+
+    /*
+     * The coverage dependent rate constants multiply both the forward
+     * and the reverse rates of progress, so that
+     *   d(ropnet)/d(C_j) += ropnet * dln(k)/d(theta_j) * size_j / n0
+     */
+    if (m_has_coverage_dependence && &tp == m_surf) {
+      const array_fp& ropnet = m_kdata->m_ropnet;
+      doublereal recipT = 1.0 / tp.temperature();
+      doublereal rn0 = 1.0 / m_surf->siteDensity();
+      doublereal dlnk, th;
+      int nrows = m_covRate.size();
+      for (int irow = 0; irow < nrows; irow++) {
+	i = m_rates.reactionNumber(m_covRate[irow]);
+	for (m = m_covStart[irow]; m < m_covStart[irow+1]; m++) {
+	  j = m_covSpecies[m];
+	  th = m_coverages[j];
+	  dlnk = m_covA[m] - m_covE[m] * recipT;
+	  if (m_covM[m] != 0.0 && th > Tiny) {
+	    dlnk += m_covM[m] / th;
+	  }
+	  m_dropnet_dc[m_ii * j + i] += ropnet[i] * dlnk * m_surf->size(j) * rn0;
+	}
+      }
+    }
+
+    for (j = 0; j < nsp; j++) {
+      m_rxnstoich.getNetProductionRates(m_kk, DATA_PTR(m_dropnet_dc) + m_ii * j,
+					jac + m_kk * j);
+    }
+  }
+
   //====================================================================================================================
   // Apply corrections for interfacial charge transfer reactions
   /*
@@ -985,6 +1205,21 @@ namespace Cantera {
     }
     //    iloc = m_rates.install(reactionNumber(), r.rateCoeffType, rp.size(), DATA_PTR(rp));
     iloc = m_rates.install(reactionNumber(), ARRHENIUS_REACTION_RATECOEFF_TYPE, rp.size(), DATA_PTR(rp));
+    /*
+     * add the coverage dependence as a row of the sparse coverage
+     * dependence matrix
+     */
+    if (ncov > 3 && iloc >= 0) {
+      if (m_covStart.empty()) m_covStart.push_back(0);
+      m_covRate.push_back(iloc);
+      for (int m = 0; m + 3 < ncov; m += 4) {
+	m_covSpecies.push_back(int(r.cov[m]));
+	m_covA.push_back(r.cov[m+1]);
+	m_covM.push_back(r.cov[m+2]);
+	m_covE.push_back(r.cov[m+3]);
+      }
+      m_covStart.push_back(m_covSpecies.size());
+    }
     // store activation energy
     m_E.push_back(r.rateCoeffParameters[2]);
 
@@ -1122,6 +1357,21 @@ namespace Cantera {
      * progress.
      */
     m_rxnstoich.add(reactionNumber(), r);
+    /*
+     * Store the reaction orders used in the rate of progress expressions,
+     * so that they can be differentiated. These are the orders used by
+     * the stoichiometric coefficient manager above; the reverse rate of
+     * progress only contributes for reversible reactions.
+     */
+    m_fwdOrderSpecies.push_back(r.reactants);
+    m_fwdOrder.push_back(r.rorder);
+    if (r.reversible) {
+      m_revOrderSpecies.push_back(r.products);
+      m_revOrder.push_back(r.porder);
+    } else {
+      m_revOrderSpecies.push_back(vector_int());
+      m_revOrder.push_back(vector_fp());
+    }
     /*
      * register reaction in lists of reversible and irreversible rxns.
      */
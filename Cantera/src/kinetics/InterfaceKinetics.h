@@ -293,7 +293,43 @@ namespace Cantera {
      *             units kmol m-d s-1, where d is dimension.
      */
     virtual void getNetProductionRates(doublereal* net);
-      
+
+    //! Returns true if getNetProductionRatesJacobian() may be used
+    /*!
+     *  The analytic derivatives assume that the rates of progress
+     *  are smooth functions of the concentrations. This is not the case
+     *  when the rates of progress are being modified to account for
+     *  phases which don't exist.
+     */
+    bool hasAnalyticJacobian() const {
+      return (m_phaseExistsCheck == 0);
+    }
+
+    //! Return the derivatives of the species net production rates
+    //! with respect to the concentrations of the species in a surface
+    //! or edge phase
+    /*!
+     *  The derivatives are evaluated analytically from the mass action
+     *  rate expressions, including the dependence of the rate constants of
+     *  SurfaceArrhenius reactions on the coverages of the reaction phase
+     *  of this kinetics object (the edge phase of an EdgeKinetics object). The rate constants of the reverse
+     *  reactions share the coverage dependence of the forward rate
+     *  constants, as the equilibrium constants of an ideal surface phase
+     *  don't depend on the coverages.
+     *
+     *  @param n    Phase index of a surface or edge phase in this
+     *              kinetics object.
+     *              The activity concentrations of the phase must be equal
+     *              to its concentrations.
+     *  @param jac  Output column-ordered matrix. jac[m_kk*j + k]
+     *              contains the derivative of the net production rate
+     *              of kinetic species k with respect to the concentration
+     *              of the jth species in phase n.
+     *              length = m_kk * thermo(n).nSpecies()
+     *              units = 1/s
+     */
+    void getNetProductionRatesJacobian(int n, doublereal* jac);
+
     //@}
     /**
      * @name Reaction Mechanism Informational Query Routines
@@ -439,6 +475,15 @@ namespace Cantera {
 
     void _update_rates_phi();
     void _update_rates_C();
+
+    //! Update the coverage dependent parts of the rate constants
+    /*!
+     *  The coverage dependencies of all rate constants are evaluated
+     *  together from the sparse matrix m_covA, m_covE, m_covM, and are
+     *  only reevaluated when the coverages have changed. If they have,
+     *  m_redo_rates is set to true.
+     */
+    void _update_rates_coverages();
       
     //! Advance the surface coverages in time
     /*!
@@ -611,6 +656,72 @@ namespace Cantera {
      */
     mutable std::vector<std::map<int, doublereal> >     m_prxn;
 
+    //! Species appearing in the forward rate of progress of each reaction
+    /*!
+     *  m_fwdOrderSpecies[i] lists the kinetic species indices of the
+     *  concentrations multiplying the forward rate constant of reaction i,
+     *  and m_fwdOrder[i] the corresponding reaction orders. These are
+     *  used to differentiate the rates of progress.
+     *  Length = m_ii
+     */
+    std::vector<vector_int> m_fwdOrderSpecies;
+
+    //! Reaction orders of the species in m_fwdOrderSpecies
+    std::vector<vector_fp> m_fwdOrder;
+
+    //! Species appearing in the reverse rate of progress of each reaction
+    /*!
+     *  This is empty for irreversible reactions.
+     *  Length = m_ii
+     */
+    std::vector<vector_int> m_revOrderSpecies;
+
+    //! Reaction orders of the species in m_revOrderSpecies
+    std::vector<vector_fp> m_revOrder;
+
+    //! Work array of derivatives of the net rates of progress
+    /*!
+     *  Column-ordered, m_ii rows.
+     */
+    vector_fp m_dropnet_dc;
+
+    //! Coverages of the surface phase last used to evaluate the
+    //! coverage dependence of the rate constants
+    vector_fp m_coverages;
+
+    //! Logarithms of m_coverages, bounded below by log(Tiny)
+    vector_fp m_logCoverages;
+
+    //! Rate coefficient calculators with coverage dependent rate constants
+    /*!
+     *  The coverage dependence parameters are stored as a sparse matrix
+     *  with one row for each calculator listed here. The entries of
+     *  row i are found at positions m_covStart[i] to m_covStart[i+1]-1
+     *  of m_covSpecies, m_covA, m_covE and m_covM. 
+     *
+     *  The exponent of rate constant i is modified by
+     *     sum_k  (a_ik - E_ik/T) theta_k  +  m_ik ln(theta_k)
+     */
+    vector_int m_covRate;
+
+    //! Start of each row of the coverage dependence matrix
+    /*!
+     *  Length = m_covRate.size() + 1
+     */
+    vector_int m_covStart;
+
+    //! Surface species index of each coverage dependence entry
+    vector_int m_covSpecies;
+
+    //! Coverage dependence of the preexponential factor, a
+    vector_fp m_covA;
+
+    //! Coverage dependence of the activation energy, E/R (Kelvin)
+    vector_fp m_covE;
+
+    //! Coverage dependence of the preexponential order, m
+    vector_fp m_covM;
+
     //! String expression for each rxn
     /*!
      * Vector of strings of length m_ii, the number of 
@@ -663,6 +774,26 @@ namespace Cantera {
      */
     vector_fp m_phi;
 
+    //! Temperatures of the phases at the last rate constant evaluation
+    vector_fp m_phaseT;
+
+    //! Pressures of the phases at the last rate constant evaluation
+    /*!
+     *  The standard chemical potentials and standard concentrations
+     *  which determine the equilibrium constants may depend on the
+     *  temperatures and pressures of all phases.
+     */
+    vector_fp m_phaseP;
+
+    //! Site densities of the surface and edge phases at the last rate
+    //! constant evaluation
+    /*!
+     *  The standard concentrations of these phases are proportional to
+     *  their site densities, which can be changed without changing
+     *  their temperatures or pressures. Zero for other phases.
+     */
+    vector_fp m_phaseSiteDens;
+
     //! Vector of potential energies due to Voltages
     /*!
      *  Length is the number of species in kinetics mech. It's
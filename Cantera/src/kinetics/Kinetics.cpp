@@ -92,6 +92,9 @@ namespace Cantera {
     m_rxnphase          = right.m_rxnphase;
     m_mindim            = right.m_mindim;
     m_dummygroups       = right.m_dummygroups;
+#ifdef CANTERA_PROFILING
+    m_profile           = right.m_profile;
+#endif
 
     return *this;
   }
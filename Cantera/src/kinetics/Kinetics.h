@@ -16,6 +16,7 @@
 #include "ctexceptions.h"
 #include "ThermoPhase.h"
 #include "mix_defs.h"
+#include "ProfileData.h"
 
 namespace Cantera {
 
@@ -898,6 +899,11 @@ namespace Cantera {
      */
     void setIndex(int index) { m_index = index; }
 
+#ifdef CANTERA_PROFILING
+    //! Profiling data for this kinetics manager
+    ProfileData& profileData() { return m_profile; }
+#endif
+
 
   protected:
 
@@ -990,6 +996,11 @@ namespace Cantera {
     /// number of spatial dimensions of lowest-dimensional phase.
     int m_mindim;
 
+#ifdef CANTERA_PROFILING
+    //! Counters, timers and cache statistics of the rate evaluation
+    ProfileData m_profile;
+#endif
+
   private:
 
     //! Vector of group lists
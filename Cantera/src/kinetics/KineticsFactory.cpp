@@ -30,7 +30,7 @@ namespace Cantera {
 
     KineticsFactory* KineticsFactory::s_factory = 0;
       #if defined(THREAD_SAFE_CANTERA)
-        boost::mutex KineticsFactory::kinetics_mutex ;
+        mutex_t KineticsFactory::kinetics_mutex ;
       #endif
 
     static int ntypes = 6;
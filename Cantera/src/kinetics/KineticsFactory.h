@@ -18,9 +18,7 @@
 #include "xml.h"
 #include "FactoryBase.h"
 
-#if defined(THREAD_SAFE_CANTERA)
-#include <boost/thread/mutex.hpp>
-#endif
+#include "ct_thread.h"
 
 namespace Cantera {
 
@@ -44,7 +42,7 @@ namespace Cantera {
 
         static KineticsFactory* factory() {
             #if defined(THREAD_SAFE_CANTERA)
-               boost::mutex::scoped_lock   lock(kinetics_mutex) ;
+               ScopedLock   lock(kinetics_mutex) ;
             #endif
             if (!s_factory) s_factory = new KineticsFactory;
             return s_factory;
@@ -57,7 +55,7 @@ namespace Cantera {
 
         virtual void deleteFactory() {
              #if defined(THREAD_SAFE_CANTERA)
-               boost::mutex::scoped_lock   lock(kinetics_mutex) ;
+               ScopedLock   lock(kinetics_mutex) ;
             #endif
           if ( s_factory ) {
                delete s_factory ;
@@ -78,7 +76,7 @@ namespace Cantera {
         static KineticsFactory* s_factory;
         KineticsFactory(){}
       #if defined(THREAD_SAFE_CANTERA)
-        static boost::mutex kinetics_mutex ;
+        static mutex_t kinetics_mutex ;
       #endif
     };
 
@@ -0,0 +1,422 @@
+/**
+ *  @file MechanismReducer.cpp
+ *
+ *  Skeletal mechanism reduction by the directed relation graph
+ *  methods DRG and DRGEP.
+ */
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#pragma warning(disable:4503)
+#endif
+
+#include "MechanismReducer.h"
+#include "ThermoPhase.h"
+#include "ThermoFactory.h"
+#include "KineticsFactory.h"
+#include "ctml.h"
+
+#include <set>
+#include <queue>
+#include <fstream>
+#include <algorithm>
+
+using namespace ctml;
+using namespace std;
+
+namespace Cantera {
+
+    MechanismReducer::MechanismReducer(Kinetics& kin, reduction_t method) :
+        m_kin(&kin),
+        m_method(method),
+        m_ns(kin.nTotalSpecies()),
+        m_nr(kin.nReactions()),
+        m_nsamples(0)
+    {
+        if (kin.nPhases() != 1) {
+            throw CanteraError("MechanismReducer",
+                "only homogeneous mechanisms can be reduced");
+        }
+        m_importance.resize(m_ns, 0.0);
+
+        // species taking part in each reaction, with their net
+        // stoichiometric coefficients
+        int i, k, a, b, n;
+        vector<set<int> > neighbors(m_ns);
+        m_rstart.resize(m_nr + 1);
+        m_rstart[0] = 0;
+        for (i = 0; i < m_nr; i++) {
+            set<int> sp;
+            const vector_int& r = kin.reactants(i);
+            const vector_int& p = kin.products(i);
+            sp.insert(r.begin(), r.end());
+            sp.insert(p.begin(), p.end());
+            for (set<int>::iterator s = sp.begin(); s != sp.end(); ++s) {
+                k = *s;
+                m_rsp.push_back(k);
+                m_rnu.push_back(kin.productStoichCoeff(k, i)
+                    - kin.reactantStoichCoeff(k, i));
+                for (set<int>::iterator t = sp.begin(); t != sp.end(); ++t) {
+                    if (*t != k) neighbors[k].insert(*t);
+                }
+            }
+            m_rstart[i+1] = m_rsp.size();
+        }
+
+        // graph edges, grouped by starting species
+        m_estart.resize(m_ns + 1);
+        m_estart[0] = 0;
+        for (k = 0; k < m_ns; k++) {
+            m_eto.insert(m_eto.end(), neighbors[k].begin(), neighbors[k].end());
+            m_estart[k+1] = m_eto.size();
+        }
+
+        // the edge for each ordered pair of species in each reaction
+        m_pstart.resize(m_nr);
+        for (i = 0; i < m_nr; i++) {
+            m_pstart[i] = m_pairEdge.size();
+            n = m_rstart[i+1] - m_rstart[i];
+            for (a = 0; a < n; a++) {
+                int ka = m_rsp[m_rstart[i] + a];
+                for (b = 0; b < n; b++) {
+                    int kb = m_rsp[m_rstart[i] + b];
+                    if (kb == ka) {
+                        m_pairEdge.push_back(-1);
+                    }
+                    else {
+                        vector_int::iterator e = lower_bound(
+                            m_eto.begin() + m_estart[ka],
+                            m_eto.begin() + m_estart[ka+1], kb);
+                        m_pairEdge.push_back(e - m_eto.begin());
+                    }
+                }
+            }
+        }
+
+        m_ropnet.resize(m_nr);
+        m_num.resize(m_eto.size());
+        m_prod.resize(m_ns);
+        m_dest.resize(m_ns);
+        m_value.resize(m_ns);
+    }
+
+    void MechanismReducer::addTarget(string name) {
+        int k = m_kin->kineticsSpeciesIndex(name);
+        if (k < 0) {
+            throw CanteraError("MechanismReducer::addTarget",
+                "unknown species "+name);
+        }
+        if (find(m_targets.begin(), m_targets.end(), k) == m_targets.end()) {
+            m_targets.push_back(k);
+        }
+    }
+
+    void MechanismReducer::addSample() {
+        m_kin->getNetRatesOfProgress(DATA_PTR(m_ropnet));
+        updateImportance(DATA_PTR(m_ropnet));
+    }
+
+    void MechanismReducer::addSample(const doublereal* ropnet) {
+        updateImportance(ropnet);
+    }
+
+    void MechanismReducer::clearSamples() {
+        m_nsamples = 0;
+        fill(m_importance.begin(), m_importance.end(), 0.0);
+    }
+
+    /**
+     * Compute the interaction coefficients for one state, then the
+     * importance of each species relative to the targets by a
+     * best-first search: since the path value never increases along
+     * a path, the species are finalized in order of decreasing value,
+     * as in Dijkstra's shortest path algorithm.
+     */
+    void MechanismReducer::updateImportance(const doublereal* ropnet) {
+        if (m_targets.empty()) {
+            throw CanteraError("MechanismReducer::addSample",
+                "no target species");
+        }
+        int i, k, a, b, n, e;
+        doublereal c;
+        fill(m_num.begin(), m_num.end(), 0.0);
+        fill(m_prod.begin(), m_prod.end(), 0.0);
+        fill(m_dest.begin(), m_dest.end(), 0.0);
+
+        for (i = 0; i < m_nr; i++) {
+            if (ropnet[i] == 0.0) continue;
+            n = m_rstart[i+1] - m_rstart[i];
+            const int* sp = DATA_PTR(m_rsp) + m_rstart[i];
+            const doublereal* nu = DATA_PTR(m_rnu) + m_rstart[i];
+            const int* edge = DATA_PTR(m_pairEdge) + m_pstart[i];
+            for (a = 0; a < n; a++) {
+                c = nu[a]*ropnet[i];
+                if (c == 0.0) continue;
+                k = sp[a];
+                if (m_method == DRG) {
+                    c = fabs(c);
+                    m_prod[k] += c;
+                }
+                else if (c > 0.0) m_prod[k] += c;
+                else m_dest[k] -= c;
+                for (b = 0; b < n; b++) {
+                    if (b != a) m_num[edge[a*n + b]] += c;
+                }
+            }
+        }
+
+        // interaction coefficients. For DRG, m_prod holds the sum of
+        // the absolute contributions.
+        for (k = 0; k < m_ns; k++) {
+            doublereal den = (m_method == DRG ? m_prod[k]
+                : fmaxx(m_prod[k], m_dest[k]));
+            for (e = m_estart[k]; e < m_estart[k+1]; e++) {
+                m_num[e] = (den > 0.0 ? fabs(m_num[e])/den : 0.0);
+            }
+        }
+
+        fill(m_value.begin(), m_value.end(), 0.0);
+        priority_queue<pair<doublereal, int> > q;
+        int nt = m_targets.size();
+        for (n = 0; n < nt; n++) {
+            m_value[m_targets[n]] = 1.0;
+            q.push(make_pair(1.0, m_targets[n]));
+        }
+        doublereal v, w;
+        while (!q.empty()) {
+            v = q.top().first;
+            k = q.top().second;
+            q.pop();
+            if (v < m_value[k]) continue;
+            for (e = m_estart[k]; e < m_estart[k+1]; e++) {
+                w = (m_method == DRG ? fminn(v, m_num[e]) : v*m_num[e]);
+                if (w > m_value[m_eto[e]]) {
+                    m_value[m_eto[e]] = w;
+                    q.push(make_pair(w, m_eto[e]));
+                }
+            }
+        }
+
+        for (k = 0; k < m_ns; k++) {
+            if (m_value[k] > m_importance[k]) m_importance[k] = m_value[k];
+        }
+        m_nsamples++;
+    }
+
+    void MechanismReducer::getSpecies(doublereal eps,
+        vector_int& species) const {
+        species.clear();
+        for (int k = 0; k < m_ns; k++) {
+            if (m_importance[k] > eps ||
+                find(m_targets.begin(), m_targets.end(), k) != m_targets.end()) {
+                species.push_back(k);
+            }
+        }
+    }
+
+    void MechanismReducer::getReactions(const vector_int& species,
+        vector_int& rxns) const {
+        vector<bool> keep(m_ns, false);
+        int n, ns = species.size();
+        for (n = 0; n < ns; n++) keep[species[n]] = true;
+        rxns.clear();
+        for (int i = 0; i < m_nr; i++) {
+            for (n = m_rstart[i]; n < m_rstart[i+1]; n++) {
+                if (!keep[m_rsp[n]]) break;
+            }
+            if (n == m_rstart[i+1]) rxns.push_back(i);
+        }
+    }
+
+    doublereal MechanismReducer::findThreshold(ReductionErrorTest& test,
+        doublereal tol, vector_int& species) {
+
+        // candidate thresholds: the distinct importance values of the
+        // species that can be removed. Threshold j removes all species
+        // with importance up to and including eps[j].
+        vector_fp eps;
+        for (int k = 0; k < m_ns; k++) {
+            if (m_importance[k] > 0.0 &&
+                find(m_targets.begin(), m_targets.end(), k) == m_targets.end()) {
+                eps.push_back(m_importance[k]);
+            }
+        }
+        sort(eps.begin(), eps.end());
+        eps.erase(unique(eps.begin(), eps.end()), eps.end());
+
+        // bisection for the last acceptable threshold; a threshold of
+        // zero removes only the species that are never reached
+        int lo = -1, hi = eps.size(), mid;
+        while (hi - lo > 1) {
+            mid = (lo + hi)/2;
+            getSpecies(eps[mid], species);
+            if (test.error(species) <= tol) lo = mid;
+            else hi = mid;
+        }
+        doublereal threshold = (lo < 0 ? 0.0 : eps[lo]);
+        getSpecies(threshold, species);
+        return threshold;
+    }
+
+    /*
+     * Return true if all species in a composition string such as
+     * "H:1 O2:1" are retained.
+     */
+    static bool allRetained(const XML_Node& comp, const set<string>& names) {
+        vector<string> key, val;
+        getPairs(comp, key, val);
+        int n = key.size();
+        for (int j = 0; j < n; j++) {
+            if (names.find(key[j]) == names.end()) return false;
+        }
+        return true;
+    }
+
+    /*
+     * Drop the removed species from a composition string.
+     */
+    static void pruneComposition(XML_Node& comp, const set<string>& names) {
+        vector<string> key, val;
+        getPairs(comp, key, val);
+        int n = key.size();
+        string s = "";
+        for (int j = 0; j < n; j++) {
+            if (names.find(key[j]) != names.end()) {
+                s += (s == "" ? "" : "  ") + key[j] + ":" + val[j];
+            }
+        }
+        comp.addValue(s);
+    }
+
+    void MechanismReducer::writeSkeletalMechanism(const XML_Node& phase,
+        const vector_int& species, XML_Node& root) const {
+        int n, j;
+        set<string> names;
+        int ns = species.size();
+        for (n = 0; n < ns; n++) {
+            names.insert(m_kin->kineticsSpeciesName(species[n]));
+        }
+
+        root.setName("ctml");
+        XML_Node& ph = root.addChild("phase");
+        phase.copy(&ph);
+
+        // species data. Each speciesArray of the skeletal phase gets
+        // its own speciesData element, holding the retained species
+        // from the data source of the original array.
+        vector<XML_Node*> sarrays;
+        ph.getChildren("speciesArray", sarrays);
+        int na = sarrays.size();
+        for (n = 0; n < na; n++) {
+            XML_Node& sa = *sarrays[n];
+            const XML_Node* db = get_XML_Node(sa["datasrc"], &phase.root());
+            if (!db) {
+                throw CanteraError("MechanismReducer::writeSkeletalMechanism",
+                    "could not find species data "+sa["datasrc"]);
+            }
+            string id = "species_data" + (n > 0 ? "_"+int2str(n) : "");
+            XML_Node& sd = root.addChild("speciesData");
+            sd.addAttribute("id", id);
+
+            vector<string> spnames;
+            getStringArray(sa, spnames);
+            vector<XML_Node*> allsp;
+            db->getChildren("species", allsp);
+            map<string, XML_Node*> spnodes;
+            for (j = 0; j < static_cast<int>(allsp.size()); j++) {
+                spnodes[(*allsp[j])["name"]] = allsp[j];
+            }
+            // 'all' declares every species of the data source, as in
+            // ThermoFactory
+            if (spnames.size() == 1 && spnames[0] == "all") {
+                spnames.resize(allsp.size());
+                for (j = 0; j < static_cast<int>(allsp.size()); j++) {
+                    spnames[j] = (*allsp[j])["name"];
+                }
+            }
+            string list = "";
+            int nsp = spnames.size();
+            for (j = 0; j < nsp; j++) {
+                if (names.find(spnames[j]) == names.end()) continue;
+                list += " " + spnames[j];
+                map<string, XML_Node*>::iterator s = spnodes.find(spnames[j]);
+                if (s != spnodes.end()) s->second->copy(&sd.addChild("species"));
+            }
+            sa.addValue(list + " ");
+            sa.addAttribute("datasrc", "#"+id);
+        }
+
+        // reaction data, for the reactions among the retained species
+        vector<XML_Node*> rarrays;
+        ph.getChildren("reactionArray", rarrays);
+        na = rarrays.size();
+        for (n = 0; n < na; n++) {
+            XML_Node& ra = *rarrays[n];
+            const XML_Node* db = get_XML_Node(ra["datasrc"], &phase.root());
+            if (!db) {
+                throw CanteraError("MechanismReducer::writeSkeletalMechanism",
+                    "could not find reaction data "+ra["datasrc"]);
+            }
+            string id = "reaction_data" + (n > 0 ? "_"+int2str(n) : "");
+            XML_Node& rd = root.addChild("reactionData");
+            rd.addAttribute("id", id);
+
+            vector<XML_Node*> allrxns;
+            db->getChildren("reaction", allrxns);
+            int nrxns = allrxns.size();
+            for (j = 0; j < nrxns; j++) {
+                const XML_Node& r = *allrxns[j];
+                if (!allRetained(r.child("reactants"), names) ||
+                    !allRetained(r.child("products"), names)) continue;
+                XML_Node& rnew = rd.addChild("reaction");
+                r.copy(&rnew);
+                if (rnew.hasChild("rateCoeff")) {
+                    XML_Node& rc = rnew.child("rateCoeff");
+                    if (rc.hasChild("efficiencies")) {
+                        pruneComposition(rc.child("efficiencies"), names);
+                    }
+                }
+            }
+            ra.addAttribute("datasrc", "#"+id);
+        }
+
+        if (ph.hasChild("state")) {
+            XML_Node& st = ph.child("state");
+            if (st.hasChild("moleFractions"))
+                pruneComposition(st.child("moleFractions"), names);
+            if (st.hasChild("massFractions"))
+                pruneComposition(st.child("massFractions"), names);
+        }
+
+        // the GRI30 kinetics manager is hard-coded for the full mechanism
+        if (ph.hasChild("kinetics")) {
+            XML_Node& kin = ph.child("kinetics");
+            if (kin["model"] == "GRI30") kin.addAttribute("model", "GasKinetics");
+        }
+    }
+
+    void MechanismReducer::writeSkeletalMechanism(const XML_Node& phase,
+        const vector_int& species, string file) const {
+        XML_Node root("ctml");
+        writeSkeletalMechanism(phase, species, root);
+        ofstream f(file.c_str());
+        if (!f) {
+            throw CanteraError("MechanismReducer::writeSkeletalMechanism",
+                "could not open file "+file);
+        }
+        root.writeHeader(f);
+        root.write(f);
+    }
+
+    void newSkeletalMechanism(XML_Node& root, ThermoPhase*& th,
+        Kinetics*& kin) {
+        XML_Node* ph = root.findByName("phase");
+        if (!ph) {
+            throw CanteraError("newSkeletalMechanism", "no phase element");
+        }
+        th = newPhase(*ph);
+        vector<ThermoPhase*> phases(1, th);
+        kin = newKineticsMgr(*ph, phases);
+    }
+
+}
@@ -0,0 +1,195 @@
+/**
+ *  @file MechanismReducer.h
+ *
+ *  Skeletal mechanism reduction by the directed relation graph
+ *  methods DRG and DRGEP.
+ */
+
+#ifndef CT_MECHREDUCER_H
+#define CT_MECHREDUCER_H
+
+#include "ct_defs.h"
+#include "Kinetics.h"
+#include "xml.h"
+
+namespace Cantera {
+
+    enum reduction_t { DRG, DRGEP };
+
+    /**
+     * Measures the error of a skeletal mechanism. Derived classes
+     * typically build the skeletal mechanism for the given species
+     * with MechanismReducer::writeSkeletalMechanism() and
+     * newSkeletalMechanism(), recompute a quantity of interest such
+     * as an ignition delay or a flame speed, and return its relative
+     * deviation from the detailed mechanism.
+     */
+    class ReductionErrorTest {
+    public:
+        ReductionErrorTest() {}
+        virtual ~ReductionErrorTest() {}
+
+        /// Error of the skeletal mechanism that retains the species
+        /// with the listed kinetics species indices.
+        virtual doublereal error(const vector_int& species) = 0;
+    };
+
+    /**
+     * Reduces a homogeneous reaction mechanism to a skeletal one by
+     * removing the species that are not needed to compute the rates
+     * of a set of target species.
+     *
+     * The species are the nodes of a directed graph. The edge from A
+     * to B is weighted by the coefficient \f$ r_{AB} \f$, which
+     * measures the error introduced in the production rate of A by
+     * removing B. With DRG (Lu and Law, 2005)
+     * \f[
+     *   r_{AB} = \frac{\sum_i |\nu_{A,i}\omega_i \delta_{B,i}|}
+     *                 {\sum_i |\nu_{A,i}\omega_i|},
+     * \f]
+     * and the importance of a species is the largest, over all paths
+     * from a target, of the smallest coefficient along the path. With
+     * DRGEP (Pepiot-Desjardins and Pitsch, 2008)
+     * \f[
+     *   r_{AB} = \frac{|\sum_i \nu_{A,i}\omega_i \delta_{B,i}|}
+     *                 {\max(P_A, C_A)},
+     * \f]
+     * where \f$ P_A \f$ and \f$ C_A \f$ are the production and
+     * consumption rates of A, and the importance is the largest
+     * product of the coefficients along a path. Here \f$ \omega_i \f$
+     * is the net rate of progress of reaction i and \f$ \delta_{B,i}
+     * \f$ is one if B is a reactant or a product of reaction i.
+     *
+     * The importance of each species is the maximum over a set of
+     * sampled states, added with addSample(), typically taken along
+     * ignition histories computed with ReactorNet and at the grid
+     * points of Sim1D flame solutions. For a threshold
+     * \f$ \epsilon \f$, the skeletal mechanism contains the targets,
+     * the species with importance greater than \f$ \epsilon \f$, and
+     * the reactions among them. findThreshold() chooses the largest
+     * threshold for which a user-supplied error measure stays within
+     * a tolerance.
+     *
+     * @ingroup kineticsmgr
+     */
+    class MechanismReducer {
+
+    public:
+
+        /// Constructor. The kinetics manager must have one phase.
+        MechanismReducer(Kinetics& kin, reduction_t method = DRGEP);
+
+        /// Destructor.
+        virtual ~MechanismReducer() {}
+
+        reduction_t method() const { return m_method; }
+
+        /// Add a target species. Targets are always retained.
+        void addTarget(std::string name);
+
+        /// Target species indices
+        const vector_int& targets() const { return m_targets; }
+
+        /**
+         * Add the current state of the phase to the samples, and
+         * update the importance of every species.
+         */
+        void addSample();
+
+        /**
+         * Add a sample given the net rates of progress, for example
+         * ones stored during an earlier simulation.
+         */
+        void addSample(const doublereal* ropnet);
+
+        /// Number of samples added so far
+        int nSamples() const { return m_nsamples; }
+
+        /// Forget all samples, but not the targets.
+        void clearSamples();
+
+        /// Importance of species k, the maximum over all samples.
+        doublereal importance(int k) const { return m_importance[k]; }
+
+        /// Species retained for threshold eps, in increasing order.
+        void getSpecies(doublereal eps, vector_int& species) const;
+
+        /**
+         * Reactions whose reactants and products all belong to
+         * \c species. These are the reactions of the skeletal
+         * mechanism.
+         */
+        void getReactions(const vector_int& species, vector_int& rxns) const;
+
+        /**
+         * Find the largest threshold for which test.error() does not
+         * exceed \c tol, by bisection over the distinct importance
+         * values. The error is assumed to increase with the threshold.
+         * The species retained are returned in \c species.
+         */
+        doublereal findThreshold(ReductionErrorTest& test, doublereal tol,
+            vector_int& species);
+
+        /**
+         * Write the skeletal mechanism for the listed species as a
+         * CTML tree under \c root. \c phase is the phase element of
+         * the detailed mechanism, still part of the document that
+         * holds its species and reaction data. The species and
+         * reaction data of the skeletal mechanism are copied from
+         * that document; third-body efficiencies and initial mole or
+         * mass fractions of removed species are dropped, and the
+         * hard-coded GRI30 kinetics model is replaced by GasKinetics.
+         */
+        void writeSkeletalMechanism(const XML_Node& phase,
+            const vector_int& species, XML_Node& root) const;
+
+        /// Write the skeletal mechanism to a CTML file.
+        void writeSkeletalMechanism(const XML_Node& phase,
+            const vector_int& species, std::string file) const;
+
+    protected:
+
+        void updateImportance(const doublereal* ropnet);
+
+        Kinetics* m_kin;
+        reduction_t m_method;
+        int m_ns, m_nr;
+        int m_nsamples;
+        vector_int m_targets;
+        vector_fp m_importance;
+
+        //! Species participating in each reaction, and their net
+        //! stoichiometric coefficients (CSR storage by reaction)
+        vector_int m_rstart;
+        vector_int m_rsp;
+        vector_fp m_rnu;
+
+        //! Edges of the graph (CSR storage by starting species)
+        vector_int m_estart;
+        vector_int m_eto;
+
+        //! For reaction i, the edge from its a-th to its b-th species
+        //! is m_pairEdge[m_pstart[i] + a*n + b], with n the number of
+        //! species in the reaction.
+        vector_int m_pstart;
+        vector_int m_pairEdge;
+
+        // work arrays
+        vector_fp m_ropnet;
+        vector_fp m_num;
+        vector_fp m_prod;
+        vector_fp m_dest;
+        vector_fp m_value;
+    };
+
+    /**
+     * Create the phase and kinetics manager of a skeletal mechanism
+     * written by MechanismReducer::writeSkeletalMechanism(). The
+     * caller owns the returned objects.
+     */
+    void newSkeletalMechanism(XML_Node& root, ThermoPhase*& th,
+        Kinetics*& kin);
+
+}
+
+#endif
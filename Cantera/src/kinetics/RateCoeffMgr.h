@@ -74,6 +74,18 @@ namespace Cantera {
          */  
         const R& rateCoeff(int loc) const { return m_rates[loc]; }
 
+        /**
+         * Return a writable reference to the nth rate coefficient
+         * calculator.
+         */
+        R& rateCoeff(int loc) { return m_rates[loc]; }
+
+        /**
+         * Return the reaction number of the nth rate coefficient
+         * calculator.
+         */
+        int reactionNumber(int loc) const { return m_rxn[loc]; }
+
         /**
          * Update the concentration-dependent parts of the rate
          * coefficient, if any. Used by class SurfaceArrhenius to
@@ -833,6 +833,7 @@ namespace Cantera {
         }
 
         findGroups(logfile, kin);
+        findTransfers(kin);
         return 1;
     }
 
@@ -854,37 +855,155 @@ namespace Cantera {
     }
 
 
+    void ReactionPathBuilder::findTransfers(Kinetics& s) {
+        int i, m, n, nr, np, kr, kp, kkr, kkp;
+        doublereal f;
+        bool noRule;
+
+        m_fwdlabel.resize(m_nr);
+        m_revlabel.resize(m_nr);
+        for (i = 0; i < m_nr; i++) {
+            nr = m_reac[i].size();
+            np = m_prod[i].size();
+            m_fwdlabel[i].resize(nr);
+            m_revlabel[i].resize(np);
+            for (kr = 0; kr < nr; kr++) 
+                m_fwdlabel[i][kr] = reactionLabel(i, kr, nr, m_reac[i], s);
+            for (kp = 0; kp < np; kp++) 
+                m_revlabel[i][kp] = reactionLabel(i, kp, np, m_prod[i], s);
+        }
+
+        m_transfers.clear();
+        m_transfers.resize(m_nel);
+        m_pathFrom.clear();
+        m_pathFrom.resize(m_nel);
+        m_pathTo.clear();
+        m_pathTo.resize(m_nel);
+        m_pathStart.clear();
+        m_pathStart.resize(m_nel);
+        m_pathCol.clear();
+        m_pathCol.resize(m_nel);
+        m_pathCoeff.clear();
+        m_pathCoeff.resize(m_nel);
+
+        Transfer t;
+        for (m = 0; m < m_nel; m++) {
+            vector<Transfer>& tr = m_transfers[m];
+            for (i = 0; i < m_nr; i++) {
+                if (m_elatoms(m, i) <= 0) continue;
+                nr = m_reac[i].size();
+                np = m_prod[i].size();
+                for (kr = 0; kr < nr; kr++) {
+                    kkr = m_reac[i][kr];
+                    for (kp = 0; kp < np; kp++) {
+                        kkp = m_prod[i][kp];
+                        if (kkr == kkp || m_atoms(kkr,m) <= 0 
+                            || m_atoms(kkp,m) <= 0) continue;
+
+                        // if neither species contains the full number
+                        // of atoms of element m in the reaction, the
+                        // rules found by findGroups determine which
+                        // reactant was the source of the m-atoms in
+                        // the product. Otherwise, the number of atoms
+                        // transferred follows directly.
+                        noRule = false;
+                        if ( (m_atoms(kkp,m) < m_elatoms(m, i)) && 
+                            (m_atoms(kkr,m) < m_elatoms(m, i)) ) {
+                            f = 0.0;
+                            map<int, map<int, map<int, Group> > >::const_iterator 
+                                gi = m_transfer.find(i);
+                            if (gi == m_transfer.end() || gi->second.empty()) {
+                                noRule = true;
+                            }
+                            else {
+                                map<int, map<int, Group> >::const_iterator
+                                    gr = gi->second.find(kkr);
+                                if (gr != gi->second.end()) {
+                                    map<int, Group>::const_iterator 
+                                        gp = gr->second.find(kkp);
+                                    if (gp != gr->second.end() && gp->second.valid())
+                                        f = gp->second.nAtoms(m);
+                                }
+                            }
+                        }
+                        else {
+                            f = m_atoms(kkp,m) * m_atoms(kkr,m) / m_elatoms(m, i);
+                        }
+                        t.rxn = i;
+                        t.kr = kkr;
+                        t.kp = kkp;
+                        t.lr = kr;
+                        t.lp = kp;
+                        t.atoms = f;
+                        t.noRule = noRule;
+                        tr.push_back(t);
+                    }
+                }
+            }
+
+            // collect the transfers into one row per directed species
+            // pair, with the forward and reverse contributions of each
+            // reaction in separate columns
+            map<pair<int, int>, int> pathIndex;
+            map<pair<int, int>, int>::iterator pi;
+            vector<vector_int> cols;
+            vector<vector_fp> coeffs;
+            int nt = tr.size();
+            for (n = 0; n < nt; n++) {
+                if (tr[n].atoms == 0.0) continue;
+                for (int dir = 0; dir < 2; dir++) {
+                    pair<int, int> ends = (dir == 0 ? 
+                        make_pair(tr[n].kr, tr[n].kp) :
+                        make_pair(tr[n].kp, tr[n].kr));
+                    int row;
+                    pi = pathIndex.find(ends);
+                    if (pi == pathIndex.end()) {
+                        row = cols.size();
+                        pathIndex[ends] = row;
+                        m_pathFrom[m].push_back(ends.first);
+                        m_pathTo[m].push_back(ends.second);
+                        cols.push_back(vector_int());
+                        coeffs.push_back(vector_fp());
+                    }
+                    else row = pi->second;
+                    cols[row].push_back(dir*m_nr + tr[n].rxn);
+                    coeffs[row].push_back(tr[n].atoms);
+                }
+            }
+            int npaths = cols.size();
+            m_pathStart[m].resize(npaths + 1);
+            m_pathStart[m][0] = 0;
+            for (n = 0; n < npaths; n++) {
+                m_pathCol[m].insert(m_pathCol[m].end(), 
+                    cols[n].begin(), cols[n].end());
+                m_pathCoeff[m].insert(m_pathCoeff[m].end(), 
+                    coeffs[n].begin(), coeffs[n].end());
+                m_pathStart[m][n+1] = m_pathCol[m].size();
+            }
+        }
+    }
+
+
     int ReactionPathBuilder::build(Kinetics& s, 
         string element, ostream& output, ReactionPathDiagram& r, bool quiet) 
     {    
-        int i, nr, np, kr, kp, kkr, kkp;
-        doublereal f, ropf, ropr, fwd, rev;
-        string fwdlabel, revlabel;
+        int i, kkr, kkp;
+        doublereal fwd, rev;
         map<int, int> warn;
 
         doublereal threshold = 0.0;
         bool fwd_incl, rev_incl, force_incl;
 
-        //        const Kinetics::thermo_t& ph = s.thermo();
-        int m = m_enamemap[element]-1; //ph.elementIndex(element);
+        int m = m_enamemap[element]-1;
 
         r.element = element;
         if (m < 0) return -1;
         
-        //int k;
         int kk = s.nTotalSpecies();
 
         s.getFwdRatesOfProgress(DATA_PTR(m_ropf));
         s.getRevRatesOfProgress(DATA_PTR(m_ropr));
 
-        //ph.getMoleFractions(m_x.begin());
-
-        //doublereal sum = 0.0;
-        //for (k = 0; k < kk; k++) {
-        //    sum += m_x[k] * ph.nAtoms(k,m);
-        //}
-        //sum *= ph.molarDensity();
-
         // species explicitly included or excluded
         vector<string>& in_nodes = r.included();
         vector<string>& out_nodes = r.excluded();
@@ -898,116 +1017,101 @@ namespace Cantera {
         for (int ne = 0; ne < nout; ne++) 
             status[s.kineticsSpeciesIndex(out_nodes[ne])] = -1;
 
-        for (i = 0; i < m_nr; i++) 
+        // loop over the pairs of species that exchange atoms of
+        // element m, skipping those not allowed to appear in the diagram
+        const vector<Transfer>& tr = m_transfers[m];
+        int nt = static_cast<int>(tr.size());
+        for (int n = 0; n < nt; n++) 
         {
-            ropf = m_ropf[i];
-            ropr = m_ropr[i];
-
-            // loop over reactions involving element m
-            if (m_elatoms(m, i) > 0) 
-            {
-                nr = m_reac[i].size();
-                np = m_prod[i].size();
-
-                for (kr = 0; kr < nr; kr++) 
-                {
-                    kkr = m_reac[i][kr];
-                    int l;
-
-                    fwdlabel = reactionLabel(i, kr, nr, m_reac[i], s);
- 
-                    for (kp = 0; kp < np; kp++) 
-                    {
-                        kkp = m_prod[i][kp];
-                        revlabel = "";
-                        for (l = 0; l < np; l++) {
-                            if (l != kp) 
-                                revlabel += " + "+ s.kineticsSpeciesName(m_prod[i][l]);
-                        }
-                        if (s.reactionType(i) == THREE_BODY_RXN)
-                            revlabel += " + M "; 
-                        else if (s.reactionType(i) == FALLOFF_RXN)
-                            revlabel += " (+ M)"; 
-
-
-                        // calculate the flow only for pairs that are
-                        // not the same species, both contain atoms of 
-                        // element m, and both are allowed to appear in
-                        // the diagram
-
-                        if ((kkr != kkp) && (m_atoms(kkr,m) > 0 
-                            &&  m_atoms(kkp,m) > 0)
-                            && status[kkr] >= 0 && status[kkp] >= 0) 
-                        {
+            const Transfer& t = tr[n];
+            kkr = t.kr;
+            kkp = t.kp;
+            if (status[kkr] < 0 || status[kkp] < 0) continue;
+            i = t.rxn;
+
+            if (t.noRule) {
+                if (!warn[i]) {
+                    if (!quiet) {
+                        output << endl;
+                        output << "*************** REACTION IGNORED ***************" << endl; 
+                        output << "Warning: no rule to determine partitioning of " << element
+                               << endl << " in reaction " << s.reactionString(i) << "." << endl 
+                               << "*************** REACTION IGNORED **************" << endl;
+                        output << endl;
+                        warn[i] = 1;
+                    }
+                }                                    
+                continue;
+            }
 
-                            // if neither species contains the full
-                            // number of atoms of element m in the
-                            // reaction, then we must consider the
-                            // type of reaction to determine which
-                            // reactant species was the source of a
-                            // given m-atom in the product
- 
-                            if ( (m_atoms(kkp,m) < m_elatoms(m, i)) && 
-                                (m_atoms(kkr,m) < m_elatoms(m, i)) ) 
-                            {
-                                map<int, map<int, Group> >& g = m_transfer[i];
-                                if (g.empty()) {
-                                    if (!warn[i]) {
-                                        if (!quiet) {
-                                            output << endl;
-                                            output << "*************** REACTION IGNORED ***************" << endl; 
-                                            output << "Warning: no rule to determine partitioning of " << element
-                                                   << endl << " in reaction " << s.reactionString(i) << "." << endl 
-                                                   << "*************** REACTION IGNORED **************" << endl;
-                                            output << endl;
-                                            warn[i] = 1;
-                                        }
-                                    }                                    
-                                    f = 0.0;
-                                }
-                                else {
-                                    if (!g[kkr][kkp]) f = 0.0;
-                                    else f = g[kkr][kkp].nAtoms(m);
-                                }
-                            }
+            fwd = m_ropf[i]*t.atoms;
+            rev = m_ropr[i]*t.atoms;
+            force_incl = ((status[kkr] == 1) || (status[kkp] == 1));
 
-                            // no ambiguity about where the m-atoms come
-                            // from or go to. Either all reactant m atoms
-                            // end up in one product, or only one reactant 
-                            // contains all the m-atoms. In either case,
-                            // the number of atoms transferred is given by
-                            // the same expression.
+            fwd_incl = ((fwd > threshold) || 
+                (fwd > 0.0 && force_incl));
+            rev_incl = ((rev > threshold) || 
+                (rev > 0.0 && force_incl));
+            if (fwd_incl || rev_incl) 
+            {
+                if (!r.hasNode(kkr)) {
+                    r.addNode(kkr, s.kineticsSpeciesName(kkr), m_x[kkr]);
+                }
+                if (!r.hasNode(kkp)) {
+                    r.addNode(kkp, s.kineticsSpeciesName(kkp), m_x[kkp]);
+                }
+            }
+            if (fwd_incl) {
+                r.linkNodes(kkr, kkp, i, fwd, m_fwdlabel[i][t.lr]);
+            }
+            if (rev_incl) {
+                r.linkNodes(kkp, kkr, -i, rev, m_revlabel[i][t.lp]);
+            }		
+        }
+        return 1;
+    }
 
-                            else {
-                                f = m_atoms(kkp,m) * m_atoms(kkr,m) / m_elatoms(m, i);
-                            }
+    int ReactionPathBuilder::nFluxPaths(string element) const {
+        map<string, int>::const_iterator e = m_enamemap.find(element);
+        if (e == m_enamemap.end()) return -1;
+        return static_cast<int>(m_pathFrom[e->second-1].size());
+    }
 
-                            fwd = ropf*f;
-                            rev = ropr*f;
-                            force_incl = ((status[kkr] == 1) || (status[kkp] == 1));
+    void ReactionPathBuilder::getFluxPath(string element, int n, 
+        int& kFrom, int& kTo) const {
+        int np = nFluxPaths(element);
+        if (n < 0 || n >= np) {
+            throw CanteraError("ReactionPathBuilder::getFluxPath",
+                "no path "+int2str(n)+" for element "+element);
+        }
+        int m = m_enamemap.find(element)->second - 1;
+        kFrom = m_pathFrom[m][n];
+        kTo = m_pathTo[m][n];
+    }
 
-                            fwd_incl = ((fwd > threshold) || 
-                                (fwd > 0.0 && force_incl));
-                            rev_incl = ((rev > threshold) || 
-                                (rev > 0.0 && force_incl));
-                            if (fwd_incl || rev_incl) 
-                            {
-                                if (!r.hasNode(kkr)) {
-                                    r.addNode(kkr, s.kineticsSpeciesName(kkr), m_x[kkr]);
-                                }
-                                if (!r.hasNode(kkp)) {
-                                    r.addNode(kkp, s.kineticsSpeciesName(kkp), m_x[kkp]);
-                                }
-                            }
-                            if (fwd_incl) {
-                                r.linkNodes(kkr, kkp, i, fwd, fwdlabel);
-                            }
-                            if (rev_incl) {
-                                r.linkNodes(kkp, kkr, -i, rev, revlabel);
-                            }		
-                        }
-                    }
+    int ReactionPathBuilder::getPathFluxes(string element, int nStates, 
+        const doublereal* ropf, const doublereal* ropr, 
+        doublereal* flux) const {
+        int np = nFluxPaths(element);
+        if (np < 0) return -1;
+        if (np == 0) return 1;
+        int m = m_enamemap.find(element)->second - 1;
+        const int* start = DATA_PTR(m_pathStart[m]);
+        const int* col = DATA_PTR(m_pathCol[m]);
+        const doublereal* coeff = DATA_PTR(m_pathCoeff[m]);
+        int c, n, j;
+        doublereal sum;
+        for (j = 0; j < nStates; j++) {
+            const doublereal* rf = ropf + j*m_nr;
+            const doublereal* rr = ropr + j*m_nr;
+            doublereal* fj = flux + j*np;
+            for (n = 0; n < np; n++) {
+                sum = 0.0;
+                for (c = start[n]; c < start[n+1]; c++) {
+                    sum += coeff[c]*(col[c] < m_nr ? rf[col[c]] 
+                        : rr[col[c] - m_nr]);
                 }
+                fj[n] = sum;
             }
         }
         return 1;
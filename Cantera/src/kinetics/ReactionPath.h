@@ -252,9 +252,61 @@ namespace Cantera {
  
         void writeGroup(std::ostream& out, const Group& g);
 
+        /**
+         * @name Batch flux analysis
+         *
+         * The number of atoms of each element carried from a reactant
+         * to a product in each reaction depends only on the mechanism,
+         * and is computed once by init(). The one-way flux along every
+         * path is then a sparse linear function of the forward and
+         * reverse rates of progress, so the fluxes for a whole time
+         * history can be evaluated without building a diagram for
+         * each state. Species inclusion and exclusion lists are not
+         * applied here.
+         */
+        //@{
+
+        /// Number of one-way paths that can carry \c element, or -1
+        /// if the element is unknown.
+        int nFluxPaths(std::string element) const;
+
+        /// Species at the start and the end of path \c n of \c element.
+        void getFluxPath(std::string element, int n,
+            int& kFrom, int& kTo) const;
+
+        /**
+         * One-way fluxes of \c element along each path for \c nStates
+         * sets of rates of progress. The rates for state j start at
+         * ropf[j*nReactions] and ropr[j*nReactions], and the flux along
+         * path n is returned in flux[j*nFluxPaths(element) + n]; it
+         * equals ReactionPathDiagram::flow() for the same path in a
+         * diagram built with zero threshold. This method does not
+         * modify the builder, so separate ranges of states may be
+         * processed concurrently from several threads. Returns -1 if
+         * the element is unknown.
+         */
+        int getPathFluxes(std::string element, int nStates,
+            const doublereal* ropf, const doublereal* ropr,
+            doublereal* flux) const;
+        //@}
+
     protected:
         void findElements(Kinetics& kin);
 
+        //! Tabulate the element transfers and reaction labels used by
+        //! build() and getPathFluxes().
+        void findTransfers(Kinetics& kin);
+
+        //! Atoms of one element moved from reactant kr to product kp in
+        //! reaction rxn. lr and lp are the positions of the two species
+        //! in m_reac[rxn] and m_prod[rxn]. If noRule is true, the
+        //! partitioning is ambiguous and the reaction is ignored.
+        struct Transfer {
+            int rxn, kr, kp, lr, lp;
+            doublereal atoms;
+            bool noRule;
+        };
+
         int m_nr;
         int m_ns;
         int m_nel;
@@ -272,6 +324,26 @@ namespace Cantera {
         std::vector<bool> m_determinate;
         Array2D m_atoms;
         std::map<std::string,int> m_enamemap;
+
+        //! Element transfers for each element, in the order in which
+        //! build() links the nodes
+        std::vector<std::vector<Transfer> > m_transfers;
+
+        //! Edge labels for each reaction: m_fwdlabel[i][l] lists the
+        //! reactants of reaction i other than the l-th, and
+        //! m_revlabel[i][l] the products other than the l-th.
+        std::vector<std::vector<std::string> > m_fwdlabel;
+        std::vector<std::vector<std::string> > m_revlabel;
+
+        //! Sparse (CSR) path flux matrices, one per element. Row n is
+        //! the path from m_pathFrom[m][n] to m_pathTo[m][n]; column i <
+        //! m_nr refers to the forward rate of reaction i, and column
+        //! m_nr + i to its reverse rate.
+        std::vector<vector_int> m_pathFrom;
+        std::vector<vector_int> m_pathTo;
+        std::vector<vector_int> m_pathStart;
+        std::vector<vector_int> m_pathCol;
+        std::vector<vector_fp> m_pathCoeff;
     };
 
 }
@@ -289,6 +289,21 @@ namespace Cantera {
       return m_E + m_ecov;
     }
 
+    //! Set the coverage dependent terms of the rate constant directly
+    /*!
+     *  This is an alternative to update_C() for managers which evaluate
+     *  the coverage dependence of all of their rate constants at once.
+     *
+     *  @param acov  sum of a_k theta_k
+     *  @param ecov  sum of E_k theta_k  (Kelvin)
+     *  @param mcov  sum of m_k ln(theta_k)
+     */
+    void setCoverageTerms(doublereal acov, doublereal ecov, doublereal mcov) {
+      m_acov = acov;
+      m_ecov = ecov;
+      m_mcov = mcov;
+    }
+
     static bool alwaysComputeRate() { return true;}
 
   protected:
@@ -562,7 +562,8 @@ namespace Cantera {
 	    chigh = coeff;
 	  else clow = coeff;
 	}
-	if (rdata.reactionType == SURFACE_RXN) {
+	if (rdata.reactionType == SURFACE_RXN ||
+	    rdata.reactionType == EDGE_RXN) {
 	  getCoverageDependence(c, 
 				kin.thermo(kin.surfacePhaseIndex()), rdata);
 	}
@@ -72,6 +72,8 @@ namespace Cantera {
         m_rtol(1.0E-4),
         m_maxstep(1000),
         m_maxTotSpecies(0),
+        m_analyticJac(true),
+        m_maxJacAge(1),
         m_ioflag(0)
     {
  
@@ -195,6 +197,12 @@ namespace Cantera {
         for (int k = 0; k < dim1; k++) {
             m_JacCol[k] = m_Jac.ptrColumn(k);
         }
+
+        int maxSurfSpecies = 1;
+        for (isp = 0; isp < m_numSurfPhases; isp++) {
+            maxSurfSpecies = MAX(maxSurfSpecies, m_nSpeciesSurfPhase[isp]);
+        }
+        m_dwdotdc.resize(m_maxTotSpecies * maxSurfSpecies, 0.0);
     }
 
     // Empty destructor
@@ -234,6 +242,15 @@ namespace Cantera {
         doublereal t_real = 0.0, update_norm = 1.0E6;
 
         bool do_time = false, not_converged = true;
+        /*
+         *  Age of the factored Jacobian in m_Jac, and the time stepping
+         *  parameters and residual norm with which it was formed
+         */
+        int jacAge = m_maxJacAge;
+        bool jacDoTime = false;
+        doublereal jacDeltaT = 0.0;
+        doublereal resid_norm_old = 0.0;
+        bool newJac;
 
 #ifdef DEBUG_SOLVESP
 #ifdef DEBUG_SOLVESP_TIME
@@ -360,11 +377,26 @@ namespace Cantera {
             deltaT = 1.0/inv_t;
  
             /*
-             * Call the routine to numerically evaluation the jacobian
-             * and residual for the current iteration.
+             * Decide whether the factored Jacobian from a previous
+             * iteration may be reused. The weights are calculated from
+             * the unfactored Jacobian, and the rows of the sum conditions
+             * move with the largest species, so the Jacobian is always
+             * reevaluated on those iterations.
              */
-            resjac_eval(m_JacCol, DATA_PTR(m_resid), DATA_PTR(m_CSolnSP), 
-                DATA_PTR(m_CSolnSPOld), do_time, deltaT);
+            newJac = (jacAge >= m_maxJacAge || iter%4 == 1 || iter%5 == 4 ||
+                      do_time != jacDoTime || deltaT != jacDeltaT);
+
+            if (newJac) {
+                /*
+                 * Call the routine to evaluate the jacobian
+                 * and residual for the current iteration.
+                 */
+                resjac_eval(m_JacCol, DATA_PTR(m_resid), DATA_PTR(m_CSolnSP), 
+                    DATA_PTR(m_CSolnSPOld), do_time, deltaT);
+            } else {
+                fun_eval(DATA_PTR(m_resid), DATA_PTR(m_CSolnSP),
+                    DATA_PTR(m_CSolnSPOld), do_time, deltaT);
+            }
 
             /*
              * Calculate the weights. Make sure the calculation is carried
@@ -381,6 +413,17 @@ namespace Cantera {
             resid_norm = calcWeightedNorm(DATA_PTR(m_wtResid), 
                 DATA_PTR(m_resid), m_neq);
 
+            /*
+             *    A stale Jacobian which fails to decrease the residual
+             *    is replaced.
+             */
+            if (!newJac && resid_norm > resid_norm_old) {
+                resjac_eval(m_JacCol, DATA_PTR(m_resid), DATA_PTR(m_CSolnSP), 
+                    DATA_PTR(m_CSolnSPOld), do_time, deltaT);
+                newJac = true;
+            }
+            resid_norm_old = resid_norm;
+
 #ifdef DEBUG_SOLVESP
             if (m_ioflag > 1) {
                 printIterationHeader(m_ioflag, damp, inv_t, t_real, iter, do_time);
@@ -397,7 +440,13 @@ namespace Cantera {
              */
             // (void) dgetrf_(&m_neq, &m_neq, m_JacCol[0], &m_neq, 
             //	     DATA_PTR(m_ipiv), &info);
-            ct_dgetrf(m_neq, m_neq, m_JacCol[0], m_neq, DATA_PTR(m_ipiv), info);
+            if (newJac) {
+                ct_dgetrf(m_neq, m_neq, m_JacCol[0], m_neq, DATA_PTR(m_ipiv), info);
+                jacAge = 0;
+                jacDoTime = do_time;
+                jacDeltaT = deltaT;
+            }
+            jacAge++;
             if (info==0) {
                 ct_dgetrs(ctlapack::NoTranspose, m_neq, nrhs, m_JacCol[0], 
                     m_neq, DATA_PTR(m_ipiv), DATA_PTR(m_resid), m_neq,
@@ -755,6 +804,10 @@ namespace Cantera {
          * Calculate the residual
          */
         fun_eval(resid, CSoln, CSolnOld, do_time, deltaT);
+        if (useAnalyticJacobian()) {
+            analyticJac_eval(JacCol, do_time, deltaT);
+            return;
+        }
         /*
          * Now we will look over the columns perturbing each unknown.
          */
@@ -795,6 +848,89 @@ namespace Cantera {
         }
     }
 
+    /*
+     * The bulk deposition residuals are nonlinear functions of the
+     * production rates, so they are always differenced numerically.
+     */
+    bool solveSP::useAnalyticJacobian() const {
+        if (!m_analyticJac || m_bulkFunc == BULK_DEPOSITION) {
+            return false;
+        }
+        for (int isp = 0; isp < m_numSurfPhases; isp++) {
+            if (!m_objects[isp]->hasAnalyticJacobian()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*
+     * Assemble the Jacobian of the residual formed in fun_eval() from the
+     * derivatives of the net production rates of each InterfaceKinetics
+     * object with respect to the concentrations of each surface phase it
+     * contains.
+     *
+     * @internal
+     *   This routine uses the m_dwdotdc vector
+     *   as temporary internal storage.
+     */
+    void solveSP::analyticJac_eval(std::vector<doublereal *> &JacCol,
+        const bool do_time, const doublereal deltaT)
+    {
+        int isp, jsp, ip, k, kCol, nsp, nspCol, kins, kinsCol, kstart, 
+            kspecial, nKinSpecies;
+        doublereal *col_j;
+        for (kCol = 0; kCol < m_neq; kCol++) {
+            col_j = JacCol[kCol];
+            for (k = 0; k < m_neq; k++) {
+                col_j[k] = 0.0;
+            }
+        }
+
+        for (isp = 0; isp < m_numSurfPhases; isp++) {
+            nsp = m_nSpeciesSurfPhase[isp];
+            InterfaceKinetics *kinPtr = m_objects[isp];
+            int surfIndex = kinPtr->surfacePhaseIndex();
+            kstart = kinPtr->kineticsSpeciesIndex(0, surfIndex);
+            nKinSpecies = kinPtr->nTotalSpecies();
+            kins = m_eqnIndexStartSolnPhase[isp];
+            /*
+             * Blocks of the residuals of this phase with respect to the
+             * species of each surface phase in the kinetics object
+             */
+            for (jsp = 0; jsp < m_numSurfPhases; jsp++) {
+                ThermoPhase *tpCol = m_ptrsSurfPhase[jsp];
+                for (ip = 0; ip < kinPtr->nPhases(); ip++) {
+                    if (&(kinPtr->thermo(ip)) == tpCol) break;
+                }
+                if (ip == kinPtr->nPhases()) continue;
+                nspCol = m_nSpeciesSurfPhase[jsp];
+                kinsCol = m_eqnIndexStartSolnPhase[jsp];
+                kinPtr->getNetProductionRatesJacobian(ip, DATA_PTR(m_dwdotdc));
+                for (kCol = 0; kCol < nspCol; kCol++) {
+                    col_j = JacCol[kinsCol + kCol];
+                    for (k = 0; k < nsp; k++) {
+                        col_j[kins + k] = - m_dwdotdc[nKinSpecies * kCol + kstart + k];
+                    }
+                }
+            }
+            if (do_time) {
+                for (k = 0; k < nsp; k++) {
+                    JacCol[kins + k][kins + k] += 1.0 / deltaT;
+                }
+            }
+            /*
+             * The residual of the largest species is the site sum condition
+             */
+            kspecial = kins + m_spSurfLarge[isp];
+            for (kCol = 0; kCol < m_neq; kCol++) {
+                JacCol[kCol][kspecial] = 0.0;
+            }
+            for (k = 0; k < nsp; k++) {
+                JacCol[kins + k][kspecial] = -1.0;
+            }
+        }
+    }
 
 #define APPROACH 0.80
 
@@ -252,6 +252,32 @@ namespace Cantera {
     int solveSurfProb(int ifunc, doublereal time_scale, doublereal TKelvin, 
 		      doublereal PGas, doublereal reltol, doublereal abstol);
 
+    //! Choose how the Jacobian of the surface problem is evaluated
+    /*!
+     *  @param flag  If true (the default), the Jacobian is assembled from
+     *               the analytic derivatives of the net production rates
+     *               supplied by the InterfaceKinetics objects, when these
+     *               are available. If false, it is always evaluated by
+     *               finite differences.
+     */
+    void setAnalyticJacobian(bool flag) {
+      m_analyticJac = flag;
+    }
+
+    //! Set the maximum number of Newton iterations over which a
+    //! factored Jacobian is reused
+    /*!
+     *  A reused Jacobian is discarded early if the residual norm grows,
+     *  if the time step changes, or when the weights or the
+     *  largest surface species are reevaluated.
+     *
+     *  @param maxAge  Maximum age of the Jacobian. The default of 1
+     *                 reevaluates the Jacobian at every iteration.
+     */
+    void setJacobianReuse(int maxAge) {
+      m_maxJacAge = (maxAge < 1) ? 1 : maxAge;
+    }
+
   private:
 
     //! Printing routine that gets called at the start of every
@@ -418,6 +444,24 @@ namespace Cantera {
 		     doublereal *CSolnSP, 
 		     const doublereal *CSolnSPOld,  const bool do_time, 
 		     const doublereal deltaT);
+
+    //! Returns true if the analytic Jacobian can be used for the problem
+    bool useAnalyticJacobian() const;
+
+    //! Evaluate the Jacobian from the analytic derivatives of the 
+    //! net production rates
+    /*!
+     *  The state of the InterfaceKinetics objects must correspond to the
+     *  current solution vector, i.e., fun_eval() must have been
+     *  called with the current solution vector.
+     *
+     *  @param JacCol  Vector of pointers to the tops of columns of the
+     *                 Jacobian to be evalulated.
+     *  @param do_time Calculate a time dependent Jacobian
+     *  @param deltaT  Delta time for time dependent problem. 
+     */
+    void analyticJac_eval(std::vector<doublereal *>& JacCol,
+			  const bool do_time, const doublereal deltaT);
     
     //!   Pointer to the manager of the implicit surface chemistry
     //!   problem
@@ -678,6 +722,21 @@ namespace Cantera {
      */
     Array2D m_Jac;
 
+    //! Use the analytic Jacobian, when it is available
+    bool m_analyticJac;
+
+    //! Maximum number of iterations over which a factored Jacobian
+    //! is reused
+    int m_maxJacAge;
+
+    //! Temporary vector holding the derivatives of the net production
+    //! rates of one kinetics object wrt the species of a surface phase
+    /*!
+     *  length m_maxTotSpecies times the maximum number of species
+     *  in a surface phase
+     */
+    vector_fp m_dwdotdc;
+
 
   public:
     int m_ioflag;
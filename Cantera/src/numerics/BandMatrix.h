@@ -25,6 +25,11 @@ namespace Cantera {
 
     /**
      *  A class for banded matrices.
+     *
+     *  The methods that access the elements, factor the matrix and
+     *  solve with it are virtual, so that a derived class that stores
+     *  the matrix differently (see MultiJac) is used correctly through
+     *  a reference to BandMatrix.
      */
     class BandMatrix {
 
@@ -44,7 +49,7 @@ namespace Cantera {
 
         void resize(int n, int kl, int ku, doublereal v = 0.0);
 
-        void bfill(doublereal v) {
+        virtual void bfill(doublereal v) {
           std::fill(data.begin(), data.end(), v);
             m_factored = false;
         }
@@ -60,7 +65,7 @@ namespace Cantera {
         /// Return a reference to element (i,j). Since this method may
         /// alter the element value, it may need to be refactored, so
         /// the flag m_factored is set to false.
-        doublereal& value( int i, int j) {
+        virtual doublereal& value( int i, int j) {
             m_factored = false;
             if (i < j - m_ku || i > j + m_kl) {
                 m_zero = 0.0;
@@ -71,7 +76,7 @@ namespace Cantera {
 
         /// Return the value of element (i,j). This method does not
         /// alter the array.
-        doublereal value( int i, int j) const {
+        virtual doublereal value( int i, int j) const {
             if (i < j - m_ku || i > j + m_kl) return 0.0;
             return data[index(i,j)];
         }
@@ -111,28 +116,28 @@ namespace Cantera {
         vector_int& ipiv() { return m_ipiv; }
 
         /// Multiply A*b and write result to prod.
-        void mult(const double* b, double* prod) const;
+        virtual void mult(const double* b, double* prod) const;
 
         /// Multiply b*A and write result to prod.
-        void leftMult(const double* b, double* prod) const;
+        virtual void leftMult(const double* b, double* prod) const;
 
-        int factor();
+        virtual int factor();
 
         //void solve(const vector_fp& b, vector_fp& x);
 
-        int solve(int n, const doublereal* b, doublereal* x);
-        int solve(int n, doublereal* b);
+        virtual int solve(int n, const doublereal* b, doublereal* x);
+        virtual int solve(int n, doublereal* b);
 
-        vector_fp::iterator begin() {
+        virtual vector_fp::iterator begin() {
             m_factored = false;
             return data.begin();
         }
-        vector_fp::iterator end() {
+        virtual vector_fp::iterator end() {
             m_factored = false;
             return data.end();
         }
-        vector_fp::const_iterator begin() const { return data.begin(); }
-        vector_fp::const_iterator end() const { return data.end(); }
+        virtual vector_fp::const_iterator begin() const { return data.begin(); }
+        virtual vector_fp::const_iterator end() const { return data.end(); }
 
     protected:
         vector_fp data;
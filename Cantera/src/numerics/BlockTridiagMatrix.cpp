@@ -0,0 +1,298 @@
+/**
+ *  @file BlockTridiagMatrix.cpp
+ *
+ *  Block-tridiagonal matrices.
+ */
+
+// Copyright 2001  California Institute of Technology
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#pragma warning(disable:4503)
+#endif
+
+#include "BlockTridiagMatrix.h"
+#include "ctlapack.h"
+#include "utilities.h"
+#include "ctexceptions.h"
+
+using namespace std;
+
+namespace Cantera {
+
+
+    /// Default constructor.
+    BlockTridiagMatrix::BlockTridiagMatrix() : m_factored(false),
+        m_n(0), m_nb(0), m_zero(0.0) {
+    }
+
+
+    BlockTridiagMatrix::BlockTridiagMatrix(const vector_int& blockSizes)
+        : m_factored(false), m_n(0), m_nb(0), m_zero(0.0) {
+        resize(blockSizes);
+    }
+
+
+    /**
+     * Set up the storage for blocks of the given sizes. The
+     * diagonal block b is m_nv[b] x m_nv[b], the lower block in
+     * block row b is m_nv[b] x m_nv[b-1], and the upper block is
+     * m_nv[b] x m_nv[b+1]. All blocks are stored in column-major
+     * order. 
+     *
+     * The factorization of column block b is stored as a panel of
+     * m_nv[b] + m_nv[b+1] rows and m_nv[b] columns, holding the
+     * multipliers and the diagonal block of U, followed by the
+     * m_nv[b] rows of U in column blocks b+1 and b+2.
+     */
+    void BlockTridiagMatrix::resize(const vector_int& blockSizes) {
+        m_nv = blockSizes;
+        m_nb = static_cast<int>(m_nv.size());
+        m_start.resize(m_nb);
+        m_diag.resize(m_nb);
+        m_lower.resize(m_nb);
+        m_upper.resize(m_nb);
+        m_lupanel.resize(m_nb);
+        m_luupper.resize(m_nb);
+        int b, nv, n1, n2, loc = 0, luloc = 0, mxwork = 0;
+        m_n = 0;
+        for (b = 0; b < m_nb; b++) {
+            nv = m_nv[b];
+            n1 = (b < m_nb - 1 ? m_nv[b+1] : 0);
+            n2 = (b < m_nb - 2 ? m_nv[b+2] : 0);
+            m_start[b] = m_n;
+            m_n += nv;
+            m_diag[b] = loc;
+            loc += nv*nv;
+            m_lower[b] = loc;
+            if (b > 0) loc += nv*m_nv[b-1];
+            m_upper[b] = loc;
+            loc += nv*n1;
+
+            m_lupanel[b] = luloc;
+            luloc += (nv + n1)*nv;
+            m_luupper[b] = luloc;
+            luloc += nv*(n1 + n2);
+            mxwork = std::max(mxwork, (nv + n1)*(nv + n1 + n2));
+        }
+        m_blk.resize(m_n);
+        for (b = 0; b < m_nb; b++) {
+            for (int i = m_start[b]; i < m_start[b] + m_nv[b]; i++)
+                m_blk[i] = b;
+        }
+        m_data.resize(loc);
+        m_ludata.resize(luloc);
+        m_ipiv.resize(m_n);
+        m_work.resize(mxwork);
+        m_carry.resize(mxwork);
+        bfill(0.0);
+    }
+
+
+    /**
+     * Multiply A*b and write result to \c prod.
+     */
+    void BlockTridiagMatrix::mult(const doublereal* b, doublereal* prod) const {
+        int k, nv;
+        for (k = 0; k < m_nb; k++) {
+            nv = m_nv[k];
+            if (nv == 0) continue;
+            doublereal* p = prod + m_start[k];
+            ct_dgemv(ctlapack::ColMajor, ctlapack::NoTranspose, nv, nv,
+                1.0, DATA_PTR(m_data) + m_diag[k], nv, b + m_start[k], 1,
+                0.0, p, 1);
+            if (k > 0 && m_nv[k-1] > 0)
+                ct_dgemv(ctlapack::ColMajor, ctlapack::NoTranspose, nv,
+                    m_nv[k-1], 1.0, DATA_PTR(m_data) + m_lower[k], nv,
+                    b + m_start[k-1], 1, 1.0, p, 1);
+            if (k < m_nb - 1 && m_nv[k+1] > 0)
+                ct_dgemv(ctlapack::ColMajor, ctlapack::NoTranspose, nv,
+                    m_nv[k+1], 1.0, DATA_PTR(m_data) + m_upper[k], nv,
+                    b + m_start[k+1], 1, 1.0, p, 1);
+        }
+    }
+
+
+    /**
+     * Block LU decomposition with partial pivoting. Step k works on
+     * the rows of blocks k and k+1 and the columns of blocks k, k+1
+     * and k+2, which hold all of the nonzero elements of column
+     * block k that remain after step k-1. The rows of block k have
+     * been modified by step k-1; the rows of block k+1 are
+     * original. The first column block is factored with DGETRF,
+     * the row interchanges are applied to the rest, and the rows of
+     * block k+1 are updated, to be used in the next step.
+     */
+    int BlockTridiagMatrix::factor() {
+        int k, i, j, c, p, nk, n1, n2, m, ncol, info = 0;
+        bool carry = false;
+        doublereal* w = DATA_PTR(m_work);
+        for (k = 0; k < m_nb; k++) {
+            nk = m_nv[k];
+            n1 = (k < m_nb - 1 ? m_nv[k+1] : 0);
+            n2 = (k < m_nb - 2 ? m_nv[k+2] : 0);
+            if (nk == 0) {
+                carry = false;
+                continue;
+            }
+            m = nk + n1;
+            ncol = nk + n1 + n2;
+            fill(w, w + m*ncol, 0.0);
+
+            // rows of block k
+            if (carry) {
+                for (c = 0; c < nk + n1; c++)
+                    for (i = 0; i < nk; i++)
+                        w[i + c*m] = m_carry[i + c*nk];
+            }
+            else {
+                for (c = 0; c < nk; c++)
+                    for (i = 0; i < nk; i++)
+                        w[i + c*m] = m_data[m_diag[k] + i + c*nk];
+                for (c = 0; c < n1; c++)
+                    for (i = 0; i < nk; i++)
+                        w[i + (nk + c)*m] = m_data[m_upper[k] + i + c*nk];
+            }
+
+            // rows of block k+1
+            if (n1 > 0) {
+                for (c = 0; c < nk; c++)
+                    for (i = 0; i < n1; i++)
+                        w[nk + i + c*m] = m_data[m_lower[k+1] + i + c*n1];
+                for (c = 0; c < n1; c++)
+                    for (i = 0; i < n1; i++)
+                        w[nk + i + (nk + c)*m] = 
+                            m_data[m_diag[k+1] + i + c*n1];
+                for (c = 0; c < n2; c++)
+                    for (i = 0; i < n1; i++)
+                        w[nk + i + (nk + n1 + c)*m] = 
+                            m_data[m_upper[k+1] + i + c*n1];
+            }
+
+            integer* piv = DATA_PTR(m_ipiv) + m_start[k];
+            ct_dgetrf(m, nk, w, m, piv, info);
+            if (info != 0) {
+                m_factored = false;
+                if (info > 0) info += m_start[k];
+                ofstream fout("blocktridiag.csv");
+                fout << *this << endl;
+                fout.close();
+                return info;
+            }
+
+            if (ncol > nk) {
+                // apply the row interchanges to the remaining columns
+                for (i = 0; i < nk; i++) {
+                    p = piv[i] - 1;
+                    if (p != i) {
+                        for (c = nk; c < ncol; c++)
+                            std::swap(w[i + c*m], w[p + c*m]);
+                    }
+                }
+
+                // rows of U to the right of the diagonal block
+                for (c = nk; c < ncol; c++) {
+                    for (j = 0; j < nk; j++) {
+                        doublereal v = w[j + c*m];
+                        if (v != 0.0) {
+                            for (i = j + 1; i < nk; i++)
+                                w[i + c*m] -= w[i + j*m]*v;
+                        }
+                    }
+                }
+
+                // update the rows of block k+1
+                if (n1 > 0)
+                    ct_dgemm(ctlapack::ColMajor, ctlapack::NoTranspose,
+                        ctlapack::NoTranspose, n1, ncol - nk, nk, -1.0, 
+                        w + nk, m, w + nk*m, m, 1.0, w + nk + nk*m, m);
+            }
+
+            // save the factors, and the rows of block k+1 for the
+            // next step
+            copy(w, w + m*nk, m_ludata.begin() + m_lupanel[k]);
+            doublereal* u = DATA_PTR(m_ludata) + m_luupper[k];
+            for (c = nk; c < ncol; c++)
+                for (i = 0; i < nk; i++)
+                    u[i + (c - nk)*nk] = w[i + c*m];
+            for (c = nk; c < ncol; c++)
+                for (i = 0; i < n1; i++)
+                    m_carry[i + (c - nk)*n1] = w[nk + i + c*m];
+            carry = (n1 > 0);
+        }
+        m_factored = true;
+        return 0;
+    }
+
+
+    int BlockTridiagMatrix::solve(int n, const doublereal* b, doublereal* x) {
+        copy(b, b+n, x);
+        return solve(n, x);
+    }
+
+
+    /**
+     * Solve using the factors computed by factor(). The rows of
+     * blocks k and k+1 are adjacent in b, so the forward elimination
+     * for column block k works on one contiguous segment.
+     */
+    int BlockTridiagMatrix::solve(int n, doublereal* b) {
+        int info = 0;
+        if (!m_factored) info = factor();
+        if (info != 0) return info;
+        int k, i, j, p, nk, n1, n2, m;
+        doublereal v;
+        for (k = 0; k < m_nb; k++) {
+            nk = m_nv[k];
+            if (nk == 0) continue;
+            m = nk + (k < m_nb - 1 ? m_nv[k+1] : 0);
+            doublereal* y = b + m_start[k];
+            const integer* piv = DATA_PTR(m_ipiv) + m_start[k];
+            const doublereal* lu = DATA_PTR(m_ludata) + m_lupanel[k];
+            for (i = 0; i < nk; i++) {
+                p = piv[i] - 1;
+                if (p != i) std::swap(y[i], y[p]);
+            }
+            for (j = 0; j < nk; j++) {
+                v = y[j];
+                if (v != 0.0) {
+                    for (i = j + 1; i < m; i++)
+                        y[i] -= lu[i + j*m]*v;
+                }
+            }
+        }
+        for (k = m_nb - 1; k >= 0; k--) {
+            nk = m_nv[k];
+            if (nk == 0) continue;
+            n1 = (k < m_nb - 1 ? m_nv[k+1] : 0);
+            n2 = (k < m_nb - 2 ? m_nv[k+2] : 0);
+            m = nk + n1;
+            doublereal* x = b + m_start[k];
+            const doublereal* lu = DATA_PTR(m_ludata) + m_lupanel[k];
+            if (n1 + n2 > 0)
+                ct_dgemv(ctlapack::ColMajor, ctlapack::NoTranspose, nk,
+                    n1 + n2, -1.0, DATA_PTR(m_ludata) + m_luupper[k], nk,
+                    x + nk, 1, 1.0, x, 1);
+            for (j = nk - 1; j >= 0; j--) {
+                x[j] /= lu[j + j*m];
+                v = x[j];
+                for (i = 0; i < j; i++)
+                    x[i] -= lu[i + j*m]*v;
+            }
+        }
+        return info;
+    }
+
+    ostream& operator<<(ostream& s, const BlockTridiagMatrix& m) {
+        int nr = m.nRows();
+        int nc = m.nColumns();
+        int i,j;
+        for (i = 0; i < nr; i++) {
+            for (j = 0; j < nc; j++) {
+                s << m(i,j) << ", ";
+            }
+            s << endl;
+        }
+        return s;
+    }
+}
@@ -0,0 +1,181 @@
+/**
+ *  @file BlockTridiagMatrix.h
+ *
+ *  Block-tridiagonal matrices.
+ */
+
+/*
+ *  $Author: hkmoffa $
+ *  $Revision: 368 $
+ *  $Date: 2010-01-03 18:46:26 -0600 (Sun, 03 Jan 2010) $
+ */
+
+// Copyright 2001  California Institute of Technology
+
+
+#ifndef CT_BLOCKTRIDIAGMATRIX_H
+#define CT_BLOCKTRIDIAGMATRIX_H
+
+#include "ct_defs.h"
+#include "ctlapack.h"
+#include "ctexceptions.h"
+
+namespace Cantera {
+
+    /**
+     *  A class for block-tridiagonal matrices.
+     *
+     *  The rows and columns are divided into consecutive blocks,
+     *  which may have different sizes. Only the diagonal blocks
+     *  and the blocks immediately to their left and right are
+     *  stored; all other elements are zero. This is the structure
+     *  of the Jacobian of a three-point finite-difference
+     *  discretization, with one block per grid point.
+     *
+     *  The matrix is factored by block Gaussian elimination. At
+     *  each step, the columns of one block are factored with LAPACK
+     *  routine DGETRF, with partial pivoting over the rows of the
+     *  current block and of the next one. This is the same pivoting
+     *  that a banded LU factorization would do, so diagonal blocks
+     *  need not be nonsingular; row interchanges add at most one
+     *  block of fill to the right of each upper block. Compared to
+     *  a BandMatrix with the same sparsity, no storage or work is
+     *  spent on the zeros in the band outside of the blocks.
+     */
+    class BlockTridiagMatrix {
+
+    public:
+
+        BlockTridiagMatrix();
+
+        /**
+         * Constructor.
+         * @param blockSizes  number of rows (and columns) in each
+         *                    block, from first to last.
+         */
+        BlockTridiagMatrix(const vector_int& blockSizes);
+
+        /// Destructor. Does nothing.
+        virtual ~BlockTridiagMatrix(){}
+
+        /// Change the block structure. All elements are set to zero.
+        void resize(const vector_int& blockSizes);
+
+        /// Set all stored elements to v.
+        void bfill(doublereal v = 0.0) {
+            std::fill(m_data.begin(), m_data.end(), v);
+            m_factored = false;
+        }
+
+        doublereal& operator()( int i, int j) {
+            return value(i,j);
+        }
+
+        doublereal operator() ( int i, int j) const {
+            return value(i,j);
+        }
+
+        /// Return a reference to element (i,j). Since this method may
+        /// alter the element value, the matrix may need to be
+        /// refactored, so the flag m_factored is set to false.
+        /// Elements outside the stored blocks return a reference to a
+        /// dummy zero value.
+        doublereal& value( int i, int j) {
+            m_factored = false;
+            int k = index(i,j);
+            if (k < 0) {
+                m_zero = 0.0;
+                return m_zero;
+            }
+            return m_data[k];
+        }
+
+        /// Return the value of element (i,j). This method does not
+        /// alter the array.
+        doublereal value( int i, int j) const {
+            int k = index(i,j);
+            if (k < 0) return 0.0;
+            return m_data[k];
+        }
+
+        /// Return the location in the internal 1D array of element
+        /// (i,j), or -1 if (i,j) is not within the stored blocks.
+        int index(int i, int j) const {
+            int bi = m_blk[i], bj = m_blk[j];
+            int r = i - m_start[bi];
+            int c = j - m_start[bj];
+            if (bj == bi) return m_diag[bi] + r + c*m_nv[bi];
+            else if (bj == bi - 1) return m_lower[bi] + r + c*m_nv[bi];
+            else if (bj == bi + 1) return m_upper[bi] + r + c*m_nv[bi];
+            return -1;
+        }
+
+        /// Number of rows
+        int nRows() const { return m_n; }
+
+        /// Number of columns
+        int nColumns() const { return m_n; }
+
+        /// Number of blocks
+        int nBlocks() const { return m_nb; }
+
+        /// Number of rows in block b
+        int blockSize(int b) const { return m_nv[b]; }
+
+        /// Index of the first row of block b
+        int blockStart(int b) const { return m_start[b]; }
+
+        /// Bytes used to store the matrix and its factorization
+        size_t memory() const {
+            return sizeof(doublereal)*(m_data.size() + m_ludata.size())
+                + sizeof(int)*m_ipiv.size();
+        }
+
+        /// Multiply A*b and write result to prod.
+        void mult(const doublereal* b, doublereal* prod) const;
+
+        /**
+         * Factor the matrix. Returns zero if successful. If the
+         * matrix is singular, returns one plus the global index of
+         * the column with a zero pivot, following the convention of
+         * LAPACK routines DGETRF and DGBTRF.
+         */
+        int factor();
+
+        /// True if the matrix has been factored since it was last
+        /// modified.
+        bool factored() const { return m_factored; }
+
+        int solve(int n, const doublereal* b, doublereal* x);
+        int solve(int n, doublereal* b);
+
+    protected:
+        vector_fp m_data;
+        vector_fp m_ludata;
+        bool m_factored;
+
+        int m_n, m_nb;
+        doublereal m_zero;
+
+        /// size of each block
+        vector_int m_nv;
+        /// first row of each block
+        vector_int m_start;
+        /// block containing each row
+        vector_int m_blk;
+        /// locations of the diagonal, lower and upper blocks in m_data
+        vector_int m_diag, m_lower, m_upper;
+        /// locations of the factored column panels (the multipliers
+        /// and the diagonal block of U), and of the blocks of U to the
+        /// right of the diagonal, in m_ludata
+        vector_int m_lupanel, m_luupper;
+        vector_int m_ipiv;
+        /// work space for factor()
+        vector_fp m_work, m_carry;
+    };
+
+    std::ostream& operator<<(std::ostream& s, const BlockTridiagMatrix& m);
+
+}
+
+#endif
@@ -266,22 +266,8 @@ namespace Cantera {
 
     if (result != 0) throw CVodeErr("CVReInit failed.");
 
-    if (m_type == DENSE + NOJAC) {
-      CVDense(m_cvode_mem, NULL, NULL);
-    }
-    else if (m_type == DENSE + JAC) {
-      CVDense(m_cvode_mem, cvode_jac, NULL);
-    }
-    else if (m_type == DIAG) {
-      CVDiag(m_cvode_mem);
-    }
-    else if (m_type == GMRES) {
-      CVSpgmr(m_cvode_mem, NONE, MODIFIED_GS, 0, 0.0,
-	      NULL, NULL, NULL);
-    }
-    else {
-      throw CVodeErr("unsupported option");
-    }
+    // the linear solver attached in initialize() stays attached,
+    // and its memory is reused
   }
 
   void CVodeInt::integrate(double tout)
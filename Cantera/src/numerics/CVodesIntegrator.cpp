@@ -431,26 +431,8 @@ namespace Cantera {
     }
 #endif
 
-    if (m_type == DENSE + NOJAC) {
-      long int N = m_neq;
-      CVDense(m_cvode_mem, N);
-    }
-    else if (m_type == DIAG) {
-      CVDiag(m_cvode_mem);
-    }
-    else if (m_type == BAND + NOJAC) {
-      long int N = m_neq;
-      long int nu = m_mupper;
-      long int nl = m_mlower;
-      CVBand(m_cvode_mem, N, nu, nl);
-    }
-    else if (m_type == GMRES) {
-      CVSpgmr(m_cvode_mem, PREC_NONE, 0);
-    }
-    else {
-      throw CVodesErr("unsupported option");
-    }
-
+    // the linear solver attached in initialize() stays attached,
+    // and its memory is reused
 
     // set options
     if (m_maxord > 0)
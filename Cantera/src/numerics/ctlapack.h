@@ -25,6 +25,7 @@
 #ifndef LAPACK_FTN_TRAILING_UNDERSCORE
 
 #define _DGEMV_   dgemv
+#define _DGEMM_   dgemm
 #define _DGETRF_  dgetrf
 #define _DGETRS_  dgetrs
 #define _DGETRI_  dgetri
@@ -38,6 +39,7 @@
 #else
 
 #define _DGEMV_   dgemv_
+#define _DGEMM_   dgemm_
 #define _DGETRF_  dgetrf_
 #define _DGETRS_  dgetrs_
 #define _DGETRI_  dgetri_
@@ -82,6 +84,21 @@ extern "C" {
         const integer* incY);
 #endif
 
+#ifdef LAPACK_FTN_STRING_LEN_AT_END
+    int _DGEMM_(const char* transa, const char* transb,
+        const integer* m, const integer* n, const integer* k,
+        const doublereal* alpha, const doublereal* a, const integer* lda,
+        const doublereal* b, const integer* ldb, const doublereal* beta,
+        doublereal* c, const integer* ldc, ftnlen tasize, ftnlen tbsize);
+#else
+    int _DGEMM_(const char* transa, ftnlen tasize, 
+        const char* transb, ftnlen tbsize,
+        const integer* m, const integer* n, const integer* k,
+        const doublereal* alpha, const doublereal* a, const integer* lda,
+        const doublereal* b, const integer* ldb, const doublereal* beta,
+        doublereal* c, const integer* ldc);
+#endif
+
     int _DGETRF_(const integer* m, const integer* n, 
         doublereal* a, integer* lda, integer* ipiv, 
         integer* info);
@@ -166,6 +183,38 @@ namespace Cantera {
     }
         
 
+    inline void ct_dgemm(ctlapack::storage_t storage, 
+        ctlapack::transpose_t transA, ctlapack::transpose_t transB,
+        int m, int n, int k, doublereal alpha, const doublereal* a, 
+        int lda, const doublereal* b, int ldb, doublereal beta, 
+        doublereal* c, int ldc) 
+    {
+#ifdef USE_CBLAS
+        cblas_dgemm(cblasOrder[storage], cblasTrans[transA], 
+            cblasTrans[transB], m, n, k, alpha, a, lda, b, ldb, 
+            beta, c, ldc);
+#else
+        integer f_m = m, f_n = n, f_k = k, f_lda = lda, f_ldb = ldb, 
+            f_ldc = ldc;
+        doublereal f_alpha = alpha, f_beta = beta;
+        ftnlen trsize = 1;
+#ifdef NO_FTN_STRING_LEN_AT_END
+        _DGEMM_(&no_yes[transA], &no_yes[transB], &f_m, &f_n, &f_k, 
+            &f_alpha, a, &f_lda, b, &f_ldb, &f_beta, c, &f_ldc);
+#else
+#ifdef LAPACK_FTN_STRING_LEN_AT_END
+        _DGEMM_(&no_yes[transA], &no_yes[transB], &f_m, &f_n, &f_k, 
+            &f_alpha, a, &f_lda, b, &f_ldb, &f_beta, c, &f_ldc, 
+            trsize, trsize);
+#else
+        _DGEMM_(&no_yes[transA], trsize, &no_yes[transB], trsize, 
+            &f_m, &f_n, &f_k, &f_alpha, a, &f_lda, b, &f_ldb, 
+            &f_beta, c, &f_ldc);
+#endif 
+#endif
+#endif
+    }
+
     inline void ct_dgbsv(int n, int kl, int ku, int nrhs,  
         doublereal* a, int lda, integer* ipiv, doublereal* b, int ldb, 
         int& info) {
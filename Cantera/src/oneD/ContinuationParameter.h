@@ -0,0 +1,168 @@
+/**
+ * @file ContinuationParameter.h
+ *
+ * Parameters that may be varied in a continuation calculation with
+ * Sim1D::continuation.
+ */
+
+/*
+ * Copyright 2002 California Institute of Technology
+ */
+
+#ifndef CT_CONTINUATIONPARAMETER_H
+#define CT_CONTINUATIONPARAMETER_H
+
+#include "Inlet1D.h"
+#include "StFlow.h"
+
+namespace Cantera {
+
+    /**
+     * Base class for continuation parameters. A continuation
+     * parameter is a scalar that enters the residual equations but
+     * is not part of the solution vector, such as the mass flux at
+     * an inlet or the pressure. Derived classes provide methods to
+     * get and set its value.
+     *
+     * Method setValue is called many times during a continuation
+     * step, and only changes the stored value; in particular, it does
+     * not force the Jacobian to be re-evaluated.
+     */
+    class ContinuationParameter {
+    public:
+        ContinuationParameter() {}
+        virtual ~ContinuationParameter() {}
+
+        /// Current value of the parameter.
+        virtual doublereal value() const = 0;
+
+        /// Set the value of the parameter.
+        virtual void setValue(doublereal v) = 0;
+
+        /// A string identifying the parameter and the domain it
+        /// belongs to.
+        virtual std::string name() const = 0;
+    };
+
+
+    /**
+     * The mass flux at an inlet [kg/m^2/s]. If a second inlet is
+     * specified, its mass flux is changed in proportion, keeping the
+     * ratio of the two mass fluxes at its initial value. For a
+     * counterflow flame, this varies the strain rate.
+     */
+    class MdotParameter : public ContinuationParameter {
+    public:
+        MdotParameter(Bdry1D& inlet, Bdry1D* other = 0)
+            : m_inlet(&inlet), m_other(other), m_ratio(0.0) {
+            if (m_other && m_inlet->mdot() != 0.0)
+                m_ratio = m_other->mdot()/m_inlet->mdot();
+        }
+        virtual doublereal value() const { return m_inlet->mdot(); }
+        virtual void setValue(doublereal v) {
+            m_inlet->setMdot(v);
+            if (m_other) m_other->setMdot(m_ratio*v);
+        }
+        virtual std::string name() const { return m_inlet->id() + ":mdot"; }
+    protected:
+        Bdry1D* m_inlet;
+        Bdry1D* m_other;
+        doublereal m_ratio;
+    };
+
+
+    /**
+     * The temperature at a boundary [K].
+     */
+    class BoundaryTemperatureParameter : public ContinuationParameter {
+    public:
+        BoundaryTemperatureParameter(Bdry1D& bdry) : m_bdry(&bdry) {}
+        virtual doublereal value() const { return m_bdry->temperature(); }
+        virtual void setValue(doublereal v) { m_bdry->setTemperature(v); }
+        virtual std::string name() const {
+            return m_bdry->id() + ":temperature";
+        }
+    protected:
+        Bdry1D* m_bdry;
+    };
+
+
+    /**
+     * The pressure in a flow domain [Pa].
+     */
+    class PressureParameter : public ContinuationParameter {
+    public:
+        PressureParameter(StFlow& flow) : m_flow(&flow) {}
+        virtual doublereal value() const { return m_flow->pressure(); }
+        virtual void setValue(doublereal v) { m_flow->setPressure(v); }
+        virtual std::string name() const { return m_flow->id() + ":pressure"; }
+    protected:
+        StFlow* m_flow;
+    };
+
+
+    /**
+     * The temperature imposed at the fixed-temperature point of a
+     * freely-propagating flame [K]. @see Sim1D::setFixedTemperature
+     */
+    class FixedTemperatureParameter : public ContinuationParameter {
+    public:
+        FixedTemperatureParameter(Domain1D& flow) : m_flow(&flow) {}
+        virtual doublereal value() const { return m_flow->m_tfixed; }
+        virtual void setValue(doublereal v) { m_flow->m_tfixed = v; }
+        virtual std::string name() const {
+            return m_flow->id() + ":fixed temperature";
+        }
+    protected:
+        Domain1D* m_flow;
+    };
+
+
+    /**
+     * The composition of an inlet stream, given as a mixture of two
+     * streams with mass fractions y0 and y1. The parameter is the
+     * mass fraction of stream 1 in the mixture (the mixture fraction,
+     * if stream 1 is the fuel and stream 0 the oxidizer), so
+     * the inlet mass fractions are (1 - z)*y0 + z*y1. Since the
+     * equivalence ratio is a monotonic function of z, this can be
+     * used to compute the response of a flame to changes in the
+     * equivalence ratio. The initial value is the mixture fraction
+     * closest to the current inlet composition.
+     */
+    class InletMixtureParameter : public ContinuationParameter {
+    public:
+        InletMixtureParameter(Inlet1D& inlet, int nsp, const doublereal* y0,
+            const doublereal* y1) : m_inlet(&inlet), m_z(0.0),
+                                    m_y0(y0, y0 + nsp), m_y1(y1, y1 + nsp),
+                                    m_y(nsp, 0.0) {
+            // find the current mixture fraction from the inlet mass
+            // fractions, by least squares
+            doublereal num = 0.0, den = 0.0, dy;
+            for (int k = 0; k < nsp; k++) {
+                dy = m_y1[k] - m_y0[k];
+                num += dy*(inlet.massFraction(k) - m_y0[k]);
+                den += dy*dy;
+            }
+            if (den > 0.0) m_z = num/den;
+        }
+        virtual doublereal value() const { return m_z; }
+        virtual void setValue(doublereal z) {
+            m_z = z;
+            int nsp = static_cast<int>(m_y.size());
+            for (int k = 0; k < nsp; k++) {
+                m_y[k] = (1.0 - z)*m_y0[k] + z*m_y1[k];
+            }
+            m_inlet->setMassFractions(DATA_PTR(m_y));
+        }
+        virtual std::string name() const {
+            return m_inlet->id() + ":mixture fraction";
+        }
+    protected:
+        Inlet1D* m_inlet;
+        doublereal m_z;
+        vector_fp m_y0, m_y1, m_y;
+    };
+
+}
+
+#endif
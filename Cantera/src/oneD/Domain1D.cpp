@@ -4,11 +4,16 @@
  */
 
 #include "Domain1D.h"
+#include "OneDim.h"
 
 using namespace std;
 
 namespace Cantera {
 
+    SolverProfile* Domain1D::profile() {
+        return (m_container ? &m_container->profile() : 0);
+    }
+
     void Domain1D::
     setTolerances(int nr, const doublereal* rtol, 
         int na, const doublereal* atol, int ts) {
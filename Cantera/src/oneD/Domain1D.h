@@ -17,6 +17,7 @@
 #include "stringUtils.h"
 #include "ctexceptions.h"
 #include "refine.h"
+#include "SolverProfile.h"
 
 
 namespace Cantera {
@@ -84,6 +85,13 @@ namespace Cantera {
          */
         const OneDim& container() const { return *m_container; }
 
+        /**
+         * The profile of the solver of the container, or a null
+         * pointer if this domain has not been installed in a
+         * container.
+         */
+        SolverProfile* profile();
+
         /**
          * Specify the container object for this domain, and the
          * position of this domain in the list.
@@ -287,6 +295,31 @@ namespace Cantera {
         virtual void eval(int j, doublereal* x, doublereal* r,
             integer* mask, doublereal rdt=0.0);
 
+        /**
+         * Evaluate the Jacobian of the local source terms at point j
+         * (for example, the chemical production rates), i.e., of the
+         * terms in the residual equations at point j that depend only
+         * on the solution at point j. The Jacobian is evaluated by
+         * finite differences, perturbing each component x_n by atol +
+         * rtol*|x_n|, and is written to jac in column-major order
+         * with leading dimension nComponents(). Transport and other
+         * properties are not updated. The base class method does
+         * nothing and returns false, signifying that the Jacobian of
+         * the residual equations at this point must be evaluated in
+         * full. See MultiJac::setTransportAge.
+         *
+         * @param x     global solution vector. Components at point j
+         *              are perturbed, but restored on return.
+         * @param j     local grid point
+         * @param rtol  relative perturbation
+         * @param atol  absolute perturbation
+         * @param jac   output array of size nComponents()^2
+         */
+        virtual bool evalSourceJacobian(doublereal* x, int j, 
+            doublereal rtol, doublereal atol, doublereal* jac) {
+            return false;
+        }
+
         virtual doublereal residual(doublereal* x, int n, int j) {
             throw CanteraError("Domain1D::residual","residual function must be overloaded in derived class "+id());
         }
@@ -157,6 +157,13 @@ namespace Cantera {
 
         virtual void setMoleFractions(std::string xin);
         virtual void setMoleFractions(doublereal* xin);
+
+        /// Set the inlet mass fractions. Unlike setMoleFractions, this
+        /// method does not force the Jacobian to be re-evaluated.
+        void setMassFractions(const doublereal* yin) {
+            std::copy(yin, yin + m_nsp, m_yin.begin());
+        }
+
         virtual doublereal massFraction(int k) {return m_yin[k];}
         virtual std::string componentName(int n) const;
         virtual void init();
@@ -25,12 +25,25 @@ using namespace std;
 
 namespace Cantera {
 
-    MultiJac::MultiJac(OneDim& r) 
-        : BandMatrix(r.size(),r.bandwidth(),r.bandwidth())
+    MultiJac::MultiJac(OneDim& r, bool blockTridiag) 
+        : BandMatrix((blockTridiag ? 0 : r.size()),
+            r.bandwidth(), r.bandwidth()),
+          m_blocktri(blockTridiag)
     {
         m_size = r.size();
         m_points = r.points();
+        if (m_blocktri) {
+            vector_int nv(m_points);
+            for (int j = 0; j < m_points; j++) nv[j] = r.nVars(j);
+            m_block.resize(nv);
+        }
         m_resid = &r;
+        m_maxTransAge = 0;
+        m_transAge = 0;
+        m_rest_ok = false;
+        m_partial = false;
+        m_rest_rdt = 0.0;
+        m_nsrc = 0;
         m_r1.resize(m_size);
         m_ssdiag.resize(m_size);
         m_mask.resize(m_size);
@@ -63,50 +76,141 @@ namespace Cantera {
      */ 
         void MultiJac::eval(doublereal* x0, doublereal* resid0, doublereal rdt)
     {
+        ScopedPhase sp(&m_resid->profile(), phase_jacobian);
         m_nevals++;
         clock_t t0 = clock();
-        bfill(0.0);
+        m_transAge += m_age;
+        if (m_maxTransAge > 0 && m_rest_ok && m_transAge < m_maxTransAge
+            && rdt == m_rest_rdt) {
+            evalSources(x0, resid0, rdt);
+            m_partial = true;
+            m_nsrc++;
+        }
+        else {
+            bfill(0.0);
 
-        int n, m, ipt=0, i, j, nv, mv, iloc;
-        doublereal rdx, dx, xsave;
+            for (int j = 0; j < m_points; j++) {
+                evalPoint(j, x0, resid0, rdt);
+            }
+            if (m_maxTransAge > 0) storeTransport(x0, rdt);
+            m_transAge = 0;
+            m_partial = false;
+        }
 
-        for (j = 0; j < m_points; j++) {
-            nv = m_resid->nVars(j);
-            for (n = 0; n < nv; n++) {
+        for (int n = 0; n < m_size; n++) {
+            m_ssdiag[n] = value(n,n);
+        }
+
+        m_elapsed += double(clock() - t0)/CLOCKS_PER_SEC;
+        m_age = 0;
+    }
+
+    /**
+     * Evaluate the columns of the Jacobian for the components at
+     * global point j by finite differences.
+     */
+    void MultiJac::evalPoint(int j, doublereal* x0, doublereal* resid0, 
+        doublereal rdt) {
+        int n, m, i, mv, iloc;
+        doublereal rdx, dx, xsave;
+        int nv = m_resid->nVars(j);
+        int ipt = m_resid->loc(j);
+        for (n = 0; n < nv; n++) {
                 
-                // perturb x(n)
-                xsave = x0[ipt];
-                dx = m_atol + fabs(xsave)*m_rtol;
-                x0[ipt] = xsave + dx;
-                dx = x0[ipt] - xsave;
-                rdx = 1.0/dx;
-
-                // calculate perturbed residual
-                m_resid->eval(j, x0, DATA_PTR(m_r1), rdt, 0);
-
-                // compute nth column of Jacobian
-                for (i = j - 1; i <= j+1; i++) {
-                    if (i >= 0 && i < m_points) {
-                        mv = m_resid->nVars(i);
-                        iloc = m_resid->loc(i);
-                        for (m = 0; m < mv; m++) {
-                            value(m+iloc,ipt) = (m_r1[m+iloc] 
-                                - resid0[m+iloc])*rdx;
-                        }
+            // perturb x(n)
+            xsave = x0[ipt];
+            dx = m_atol + fabs(xsave)*m_rtol;
+            x0[ipt] = xsave + dx;
+            dx = x0[ipt] - xsave;
+            rdx = 1.0/dx;
+
+            // calculate perturbed residual
+            m_resid->eval(j, x0, DATA_PTR(m_r1), rdt, 0);
+
+            // compute nth column of Jacobian
+            for (i = j - 1; i <= j+1; i++) {
+                if (i >= 0 && i < m_points) {
+                    mv = m_resid->nVars(i);
+                    iloc = m_resid->loc(i);
+                    for (m = 0; m < mv; m++) {
+                        value(m+iloc,ipt) = (m_r1[m+iloc] 
+                            - resid0[m+iloc])*rdx;
                     }
                 }
-                x0[ipt] = xsave;
-                ipt++;
             }
+            x0[ipt] = xsave;
+            ipt++;
+        }
+    }
 
+    /**
+     * After a full evaluation, store the diagonal block at each point
+     * less the Jacobian of the source terms at that point.
+     */
+    void MultiJac::storeTransport(doublereal* x0, doublereal rdt) {
+        int j, n, nv, iloc, sz = 0;
+        m_restloc.resize(m_points);
+        m_hassrc.resize(m_points);
+        for (j = 0; j < m_points; j++) {
+            nv = m_resid->nVars(j);
+            m_restloc[j] = sz;
+            sz += nv*nv;
+        }
+        m_rest.resize(sz);
+        for (j = 0; j < m_points; j++) {
+            nv = m_resid->nVars(j);
+            iloc = m_resid->loc(j);
+            Domain1D* d = m_resid->pointDomain(iloc);
+            m_src.resize(nv*nv);
+            doublereal* src = DATA_PTR(m_src);
+            m_hassrc[j] = (d->evalSourceJacobian(x0, j - d->firstPoint(),
+                               m_rtol, m_atol, src) ? 1 : 0);
+            if (!m_hassrc[j]) continue;
+            doublereal* b = DATA_PTR(m_rest) + m_restloc[j];
+            for (n = 0; n < nv*nv; n++) 
+                b[n] = value(iloc + n % nv, iloc + n / nv) - src[n];
         }
+        m_rest_ok = true;
+        m_rest_rdt = rdt;
+    }
 
-        for (n = 0; n < m_size; n++) {
-            m_ssdiag[n] = value(n,n);
+    /**
+     * Update the Jacobian for a new solution x0 by re-evaluating only
+     * the source terms at each point where they are available, and
+     * evaluating the columns for other points in full.
+     */
+    void MultiJac::evalSources(doublereal* x0, doublereal* resid0, 
+        doublereal rdt) {
+        int j, n, nv, iloc;
+        for (j = 0; j < m_points; j++) {
+            if (!m_hassrc[j]) {
+                evalPoint(j, x0, resid0, rdt);
+                continue;
+            }
+            nv = m_resid->nVars(j);
+            iloc = m_resid->loc(j);
+            Domain1D* d = m_resid->pointDomain(iloc);
+            m_src.resize(nv*nv);
+            doublereal* src = DATA_PTR(m_src);
+            d->evalSourceJacobian(x0, j - d->firstPoint(), 
+                m_rtol, m_atol, src);
+            const doublereal* b = DATA_PTR(m_rest) + m_restloc[j];
+            for (n = 0; n < nv*nv; n++) 
+                value(iloc + n % nv, iloc + n / nv) = b[n] + src[n];
         }
+    }
 
-        m_elapsed += double(clock() - t0)/CLOCKS_PER_SEC;
-        m_age = 0;
+    void MultiJac::checkBanded(string method) const {
+        if (m_blocktri) {
+            throw CanteraError("MultiJac::"+method,
+                "not available for a block-tridiagonal Jacobian");
+        }
+    }
+
+    size_t MultiJac::memory() const {
+        if (m_blocktri) return m_block.memory();
+        return sizeof(doublereal)*(data.size() + ludata.size())
+            + sizeof(int)*m_ipiv.size();
     }
 
 } // namespace
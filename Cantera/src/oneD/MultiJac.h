@@ -16,6 +16,7 @@
 #define CT_MULTIJAC_H
 
 #include "BandMatrix.h"
+#include "BlockTridiagMatrix.h"
 #include "OneDim.h"
 #include "time.h"
 
@@ -26,6 +27,26 @@ namespace Cantera {
      * defined by a residual function supplied by an instance of class
      * 'OneDim.' The residual function may consist of several linked
      * 1D domains, with different variables in each domain.
+     *
+     * The Jacobian is block-tridiagonal, with one block for each
+     * global grid point. By default it is stored and factored as a
+     * banded matrix. If constructed with blockTridiag = true, it is
+     * instead stored as a BlockTridiagMatrix, which needs less
+     * memory and is faster to factor for problems with many
+     * variables per point. In this mode the storage inherited from
+     * BandMatrix is empty. The virtual methods that access elements,
+     * factor the matrix and solve with it use the block-tridiagonal
+     * matrix instead, also when called through a BandMatrix
+     * reference; begin(), end() and leftMult(), which require the
+     * band storage, throw an exception.
+     *
+     * Optionally (see setTransportAge), most re-evaluations may update
+     * only the part of the Jacobian that depends on the local source
+     * terms (for example, the chemical production rates), which is
+     * supplied by each domain through method
+     * Domain1D::evalSourceJacobian. The rest of the Jacobian,
+     * including the blocks coupling neighboring points, is kept from
+     * the last full evaluation.
      */
     class MultiJac : public BandMatrix {
 
@@ -34,7 +55,7 @@ namespace Cantera {
         /** 
          * Constructor.
          */
-        MultiJac(OneDim& r);
+        MultiJac(OneDim& r, bool blockTridiag = false);
 
         /// Destructor. Does nothing.
         virtual ~MultiJac(){}
@@ -57,6 +78,30 @@ namespace Cantera {
         /// Number of Jacobian evaluations.
         int nEvals() const { return m_nevals; }
 
+        /// Number of Jacobian evaluations that updated only the
+        /// source terms.
+        int nSourceEvals() const { return m_nsrc; }
+
+        /**
+         * Set the number of Newton iterations for which the transport
+         * and convection terms of the Jacobian may be reused. Until
+         * this many iterations have been taken since the last full
+         * evaluation, calls to eval update only the source terms at
+         * each point where the domain supplies their Jacobian, and
+         * evaluate the columns of the other points in full. If n <= 0
+         * (the default), the Jacobian is always evaluated in full.
+         */
+        void setTransportAge(int n) { 
+            m_maxTransAge = n; 
+            m_rest_ok = false;
+        }
+
+        /// True if the last evaluation updated only the source terms.
+        bool sourceOnly() const { return m_partial; }
+
+        /// Require the next evaluation to be a full one.
+        void invalidateTransport() { m_rest_ok = false; }
+
         /**
          * Number of times 'incrementAge' has been called since the
          * last evaluation
@@ -77,8 +122,96 @@ namespace Cantera {
 
         void incrementDiagonal(int j, doublereal d);
 
+        /// True if the Jacobian is stored as a block-tridiagonal matrix.
+        bool blockTridiagonal() const { return m_blocktri; }
+
+        /// Return a reference to element (i,j).
+        virtual doublereal& value(int i, int j) {
+            if (m_blocktri) return m_block.value(i,j);
+            return BandMatrix::value(i,j);
+        }
+
+        /// Return the value of element (i,j).
+        virtual doublereal value(int i, int j) const {
+            if (m_blocktri) return m_block.value(i,j);
+            return BandMatrix::value(i,j);
+        }
+
+        /// Value of element (i,j), which must be within the stored
+        /// blocks or band.
+        doublereal _value(int i, int j) const {
+            if (m_blocktri) return m_block.value(i,j);
+            return BandMatrix::_value(i,j);
+        }
+
+        virtual void bfill(doublereal v) {
+            if (m_blocktri) m_block.bfill(v);
+            else BandMatrix::bfill(v);
+        }
+
+        virtual void mult(const doublereal* b, doublereal* prod) const {
+            if (m_blocktri) m_block.mult(b, prod);
+            else BandMatrix::mult(b, prod);
+        }
+
+        virtual void leftMult(const doublereal* b, doublereal* prod) const {
+            checkBanded("leftMult");
+            BandMatrix::leftMult(b, prod);
+        }
+
+        virtual vector_fp::iterator begin() {
+            checkBanded("begin");
+            return BandMatrix::begin();
+        }
+        virtual vector_fp::iterator end() {
+            checkBanded("end");
+            return BandMatrix::end();
+        }
+        virtual vector_fp::const_iterator begin() const {
+            checkBanded("begin");
+            return BandMatrix::begin();
+        }
+        virtual vector_fp::const_iterator end() const {
+            checkBanded("end");
+            return BandMatrix::end();
+        }
+
+        virtual int factor() {
+            if (m_blocktri) return m_block.factor();
+            return BandMatrix::factor();
+        }
+
+        /// True if the matrix has been factored since it was last
+        /// modified.
+        bool factored() const {
+            if (m_blocktri) return m_block.factored();
+            return m_factored;
+        }
+
+        virtual int solve(int n, const doublereal* b, doublereal* x) {
+            if (m_blocktri) return m_block.solve(n, b, x);
+            return BandMatrix::solve(n, b, x);
+        }
+
+        virtual int solve(int n, doublereal* b) {
+            if (m_blocktri) return m_block.solve(n, b);
+            return BandMatrix::solve(n, b);
+        }
+
+        /// Bytes used to store the Jacobian and its factorization.
+        size_t memory() const;
+
     protected:
 
+        //! Throw an exception if the band storage is not used.
+        void checkBanded(std::string method) const;
+
+        void evalPoint(int j, doublereal* x0, doublereal* resid0, 
+            doublereal rdt);
+        void storeTransport(doublereal* x0, doublereal rdt);
+        void evalSources(doublereal* x0, doublereal* resid0, 
+            doublereal rdt);
+
         //!  Residual evaluator for this jacobian
         /*!
          *  This is a pointer to the residual evaluator. This
@@ -95,6 +228,20 @@ namespace Cantera {
         int m_age;
         int m_size;
         int m_points;
+        bool m_blocktri;
+        BlockTridiagMatrix m_block;
+
+        // reuse of the transport terms
+        int m_maxTransAge;        // max. iterations between full evals
+        int m_transAge;           // iterations since the last full eval
+        bool m_rest_ok;           // true if m_rest is current
+        bool m_partial;           // true if last eval was source-only
+        doublereal m_rest_rdt;    // rdt used to compute m_rest
+        int m_nsrc;
+        vector_fp m_rest;         // diagonal blocks, less source terms
+        vector_int m_restloc;     // location of each block in m_rest
+        vector_int m_hassrc;      // 1 if the domain supplied source terms
+        vector_fp m_src;
     };
 }
 
@@ -25,6 +25,7 @@ using namespace std;
 #include "MultiNewton.h"
 
 #include "ctexceptions.h"
+#include "ctlapack.h"
 #include "vec_functions.h"
 #include "stringUtils.h"
 
@@ -58,6 +59,16 @@ namespace Cantera {
     const doublereal DampFactor = sqrt(2.0);
     const int NDAMP = 7;
 
+    // number of accepted Newton-Krylov steps in a row, each computed
+    // by a GMRES solve that did not converge, after which the Newton
+    // iteration fails
+    const int NKFAIL = 5;
+
+    // perturbations used for Jacobian-vector products, which are the
+    // same as those used by MultiJac to evaluate the Jacobian
+    const doublereal KrylovRelPert = 1.0e-5;
+    const doublereal KrylovAbsPert = 1.490116119384765625e-8; // 2^(-26)
+
 
 
     //-----------------------------------------------------------
@@ -66,7 +77,12 @@ namespace Cantera {
 
 
     MultiNewton::MultiNewton(int sz) 
-        : m_maxAge(5) {
+        : m_maxAge(5), m_krylov(false), m_sgs(true), m_kconverged(true),
+          m_kdim(30), m_kmaxit(200),
+          m_etamax(1.0e-6), m_eta(1.0e-6), m_fnorm(0.0), m_stepeta(1.0e-6),
+          m_stepnorm(0.0), m_pc_ok(false),
+          m_pc_evals(-1), m_pc_rdt(0.0), m_nkiters(0), m_nksteps(0),
+          m_nkfails(0) {
         m_n  = sz;
         m_elapsed = 0.0;
     }
@@ -90,6 +106,19 @@ namespace Cantera {
             delete[] m_workarrays[i];
         }
         m_workarrays.clear();
+        m_pc_ok = false;
+    }
+
+    void MultiNewton::setKrylovOptions(int kdim, int maxit, 
+        doublereal etaMax, bool gaussSeidel) {
+        if (kdim < 1 || maxit < 1 || etaMax <= 0.0 || etaMax >= 1.0)
+            throw CanteraError("MultiNewton::setKrylovOptions",
+                "illegal option values");
+        m_kdim = kdim;
+        m_kmaxit = maxit;
+        m_etamax = etaMax;
+        m_sgs = gaussSeidel;
+        m_pc_ok = false;
     }
 
 
@@ -117,6 +146,11 @@ namespace Cantera {
      */ 
     void MultiNewton::step(doublereal* x, doublereal* step, 
         OneDim& r, MultiJac& jac, int loglevel) {
+        if (m_krylov) {
+            krylovStep(x, step, r, jac, loglevel);
+            return;
+        }
+        m_kconverged = true;
         int n, iok;
         int sz = r.size();
         r.eval(-1, x, step);
@@ -133,7 +167,15 @@ namespace Cantera {
         }
 #endif
 
-        iok = jac.solve(sz, step, step);
+        iok = 0;
+        if (!jac.factored()) {
+            ScopedPhase sf(&r.profile(), phase_factor);
+            iok = jac.factor();
+        }
+        if (iok == 0) {
+            ScopedPhase ss(&r.profile(), phase_linsolve);
+            iok = jac.solve(sz, step, step);
+        }
 
         // if iok is non-zero, then solve failed
         if (iok > 0) {
@@ -149,7 +191,8 @@ namespace Cantera {
                 "Jacobian is singular for domain "+
                 dom.id() + ", component "
                 +dom.componentName(comp)+" at point "
-                +int2str(pt)+"\n(Matrix row "+int2str(iok)+") \nsee file bandmatrix.csv\n");
+                +int2str(pt)+"\n(Matrix row "+int2str(iok)+") \nsee file "
+                +(jac.blockTridiagonal() ? "blocktridiag.csv\n" : "bandmatrix.csv\n"));
         }
         else if (iok < 0)   
 	    throw CanteraError("MultiNewton::step",
@@ -172,6 +215,378 @@ namespace Cantera {
     }
 
 
+    /**
+     * Compute the error weights used by norm2 for solution x.
+     */
+    void MultiNewton::errorWeights(const doublereal* x, OneDim& r) {
+        int n, j, i;
+        m_ewt.resize(r.size());
+        for (i = 0; i < r.nDomains(); i++) {
+            Domain1D& d = r.domain(i);
+            const doublereal* xd = x + r.start(i);
+            doublereal* wd = DATA_PTR(m_ewt) + r.start(i);
+            int nv = d.nComponents();
+            int np = d.nPoints();
+            for (n = 0; n < nv; n++) {
+                doublereal esum = 0.0;
+                for (j = 0; j < np; j++) esum += fabs(xd[nv*j + n]);
+                doublereal ewt = d.rtol(n)*esum/np + d.atol(n);
+                for (j = 0; j < np; j++) wd[nv*j + n] = ewt;
+            }
+        }
+    }
+
+    /**
+     * Copy the diagonal block of the Jacobian for each grid point,
+     * and factor it with LAPACK routine DGETRF. These blocks form the
+     * block-Jacobi preconditioner used by krylovStep. If the symmetric
+     * Gauss-Seidel preconditioner is selected, the blocks coupling
+     * each point to its neighbors are also copied.
+     */
+    void MultiNewton::factorPreconditioner(OneDim& r, MultiJac& jac) {
+        const MultiJac& cjac = jac;
+        int np = r.points();
+        int jg, i, j, nv, info = 0;
+        m_pcloc.resize(np);
+        m_pcrow.resize(np);
+        m_pcnv.resize(np);
+        int sz = 0;
+        for (jg = 0; jg < np; jg++) {
+            nv = r.nVars(jg);
+            m_pcloc[jg] = sz;
+            m_pcrow[jg] = r.loc(jg);
+            m_pcnv[jg] = nv;
+            sz += nv*nv;
+        }
+        m_pc.resize(sz);
+        m_pcipiv.resize(r.size());
+        for (jg = 0; jg < np; jg++) {
+            nv = m_pcnv[jg];
+            int loc = m_pcrow[jg];
+            doublereal* b = DATA_PTR(m_pc) + m_pcloc[jg];
+            for (j = 0; j < nv; j++)
+                for (i = 0; i < nv; i++)
+                    b[i + nv*j] = cjac.value(loc + i, loc + j);
+            ct_dgetrf(nv, nv, b, nv, &m_pcipiv[loc], info);
+            if (info == 0) continue;
+
+            // The block is singular. This happens at points where a
+            // variable does not appear in the equations of its own
+            // point (for example, lambda at the first point of a flow
+            // domain), so that a column of the block is zero. Each
+            // zero pivot is replaced by the largest element of the
+            // Jacobian column, which changes the preconditioner by a
+            // matrix of rank one.
+            int rmin = (jg > 0 ? r.loc(jg-1) : loc);
+            int rmax = (jg < np - 1 ? r.loc(jg+1) + r.nVars(jg+1) 
+                : loc + nv);
+            for (j = 0; j < nv; j++) {
+                if (b[j + nv*j] != 0.0) continue;
+                doublereal cmax = 0.0;
+                for (i = rmin; i < rmax; i++) 
+                    cmax = fmaxx(cmax, fabs(cjac.value(i, loc + j)));
+                if (cmax == 0.0) {
+                    m_pc_ok = false;
+                    throw CanteraError("MultiNewton::factorPreconditioner",
+                        "Jacobian is singular (matrix column "
+                        +int2str(loc + j)+" is zero)");
+                }
+                b[j + nv*j] = cmax;
+            }
+        }
+
+        // for the Gauss-Seidel preconditioner, also copy the blocks
+        // coupling each point to its neighbors
+        if (m_sgs) {
+            m_pclower.resize(np);
+            m_pcupper.resize(np);
+            sz = 0;
+            for (jg = 0; jg < np; jg++) {
+                nv = m_pcnv[jg];
+                m_pclower[jg] = sz;
+                if (jg > 0) sz += nv*m_pcnv[jg-1];
+                m_pcupper[jg] = sz;
+                if (jg < np - 1) sz += nv*m_pcnv[jg+1];
+            }
+            m_pcoff.resize(sz);
+            m_pcwork.resize(r.size());
+            for (jg = 0; jg < np; jg++) {
+                nv = m_pcnv[jg];
+                int loc = m_pcrow[jg];
+                if (jg > 0) {
+                    int nl = m_pcnv[jg-1], locl = m_pcrow[jg-1];
+                    doublereal* b = DATA_PTR(m_pcoff) + m_pclower[jg];
+                    for (j = 0; j < nl; j++)
+                        for (i = 0; i < nv; i++)
+                            b[i + nv*j] = cjac.value(loc + i, locl + j);
+                }
+                if (jg < np - 1) {
+                    int nu = m_pcnv[jg+1], locu = m_pcrow[jg+1];
+                    doublereal* b = DATA_PTR(m_pcoff) + m_pcupper[jg];
+                    for (j = 0; j < nu; j++)
+                        for (i = 0; i < nv; i++)
+                            b[i + nv*j] = cjac.value(loc + i, locu + j);
+                }
+            }
+        }
+        m_pc_ok = true;
+        m_pc_evals = jac.nEvals();
+        m_pc_rdt = r.rdt();
+    }
+
+    /**
+     * Apply the preconditioner to v in place. For block Jacobi, this
+     * solves D z = v, where D is the block-diagonal part of the
+     * Jacobian. For symmetric block Gauss-Seidel, it solves 
+     * (D + L) D^{-1} (D + U) z = v, where L and U are the blocks
+     * coupling each point to its left and right neighbors, with one
+     * forward and one backward sweep over the grid. Unlike block
+     * Jacobi, this propagates information across the whole domain
+     * in a single application, which is needed for the first-order
+     * equations (continuity, and the eigenvalue equation) that
+     * couple all points of a flow domain.
+     */
+    void MultiNewton::precondition(doublereal* v) {
+        int info = 0;
+        int np = static_cast<int>(m_pcnv.size());
+        int jg, nv, loc;
+        for (jg = 0; jg < np; jg++) {
+            nv = m_pcnv[jg];
+            loc = m_pcrow[jg];
+            if (m_sgs && jg > 0) 
+                ct_dgemv(ctlapack::ColMajor, ctlapack::NoTranspose,
+                    nv, m_pcnv[jg-1], -1.0, 
+                    DATA_PTR(m_pcoff) + m_pclower[jg], nv, 
+                    v + m_pcrow[jg-1], 1, 1.0, v + loc, 1);
+            ct_dgetrs(ctlapack::NoTranspose, nv, 1, 
+                DATA_PTR(m_pc) + m_pcloc[jg], nv, &m_pcipiv[loc],
+                v + loc, nv, info);
+        }
+        if (!m_sgs) return;
+        doublereal* w = DATA_PTR(m_pcwork);
+        for (jg = np - 2; jg >= 0; jg--) {
+            nv = m_pcnv[jg];
+            loc = m_pcrow[jg];
+            ct_dgemv(ctlapack::ColMajor, ctlapack::NoTranspose,
+                nv, m_pcnv[jg+1], 1.0, 
+                DATA_PTR(m_pcoff) + m_pcupper[jg], nv, 
+                v + m_pcrow[jg+1], 1, 0.0, w, 1);
+            ct_dgetrs(ctlapack::NoTranspose, nv, 1, 
+                DATA_PTR(m_pc) + m_pcloc[jg], nv, &m_pcipiv[loc],
+                w, nv, info);
+            for (int n = 0; n < nv; n++) v[loc + n] -= w[n];
+        }
+    }
+
+    /**
+     * Compute w = W M^{-1} J W^{-1} u, where J is the Jacobian at x,
+     * M is the preconditioner, and W is the diagonal matrix of the
+     * reciprocals of the error weights. The product with J is
+     * approximated by a finite difference of the residual function,
+     * whose value at x is f0. The perturbation is chosen so that no
+     * component of x is perturbed by more than the amount used for
+     * the corresponding column of the Jacobian.
+     */
+    void MultiNewton::krylovMult(const doublereal* x, const doublereal* f0,
+        const doublereal* u, doublereal* w, OneDim& r) {
+        int i;
+        int sz = r.size();
+        doublereal* xp = getWorkArray();
+        doublereal vmax = 0.0;
+        for (i = 0; i < sz; i++) {
+            xp[i] = u[i]*m_ewt[i];
+            vmax = fmaxx(vmax, fabs(xp[i])/(KrylovAbsPert 
+                           + KrylovRelPert*fabs(x[i])));
+        }
+        if (vmax == 0.0) {
+            fill(w, w + sz, 0.0);
+            releaseWorkArray(xp);
+            return;
+        }
+        doublereal sigma = 1.0/vmax;
+        for (i = 0; i < sz; i++) xp[i] = x[i] + sigma*xp[i];
+        r.eval(-1, xp, w);
+        for (i = 0; i < sz; i++) w[i] = (w[i] - f0[i])/sigma;
+        precondition(w);
+        for (i = 0; i < sz; i++) w[i] /= m_ewt[i];
+        releaseWorkArray(xp);
+    }
+
+    /**
+     * Compute the undamped Newton step by the Jacobian-free
+     * Newton-Krylov method. The linear system J s = -F is solved
+     * approximately by restarted GMRES, with the products of J with
+     * vectors approximated by finite differences of the residual
+     * function, so the Jacobian is not factored. The system is
+     * preconditioned on the left (see precondition) using the
+     * diagonal blocks of the Jacobian, one for each grid point,
+     * which are factored only when the Jacobian is re-evaluated or
+     * the time step changes. The unknowns are scaled by the error weights, so
+     * that the norm minimized by GMRES is the one used by norm2 to
+     * test for convergence.
+     *
+     * The iteration stops when the residual of the linear system has
+     * been reduced by the forcing term eta, which is computed from
+     * the change in the norm of the preconditioned residual between
+     * accepted Newton iterates (choice 2 of Eisenstat and Walker),
+     * and is limited to the range needed to resolve the convergence
+     * criterion of the Newton iteration. Loose tolerances far from the solution avoid
+     * wasted iterations, while tight ones close to it preserve fast
+     * convergence. If GMRES does not converge within the maximum
+     * number of iterations, m_kconverged is set to false, and solve
+     * gives up after NKFAIL such steps in a row.
+     */
+    void MultiNewton::krylovStep(doublereal* x, doublereal* step, 
+        OneDim& r, MultiJac& jac, int loglevel) {
+        int i, j, k;
+        int sz = r.size();
+        if (!m_pc_ok || jac.nEvals() != m_pc_evals || r.rdt() != m_pc_rdt)
+            factorPreconditioner(r, jac);
+        errorWeights(x, r);
+
+        doublereal* f0 = getWorkArray();
+        doublereal* b = getWorkArray();
+        r.eval(-1, x, f0);
+
+        // right-hand side
+        for (i = 0; i < sz; i++) b[i] = -f0[i];
+        precondition(b);
+        doublereal bnorm = 0.0;
+        for (i = 0; i < sz; i++) {
+            b[i] /= m_ewt[i];
+            bnorm += b[i]*b[i];
+        }
+        bnorm = sqrt(bnorm);
+        fill(step, step + sz, 0.0);
+        m_stepnorm = bnorm;
+        m_stepeta = m_eta;
+        if (bnorm == 0.0) {
+            releaseWorkArray(f0);
+            releaseWorkArray(b);
+            return;
+        }
+
+        // forcing term, relative to the last accepted iterate. Trial
+        // steps computed by dampStep do not change m_fnorm and m_eta;
+        // solve updates them once a step has been accepted.
+        doublereal eta = m_etamax;
+        if (m_fnorm > 0.0) {
+            eta = 0.9*(bnorm/m_fnorm)*(bnorm/m_fnorm);
+            if (0.9*m_eta*m_eta > 0.1) eta = fmaxx(eta, 0.9*m_eta*m_eta);
+        }
+        eta = fmaxx(eta, 0.1*sqrt(doublereal(sz))/bnorm);
+        eta = fminn(eta, m_etamax);
+        m_stepnorm = bnorm;
+        m_stepeta = eta;
+
+        int m = m_kdim;
+        m_kv.resize((m+1)*sz);
+        m_hess.resize((m+1)*m);
+        vector_fp cs(m), sn(m), g(m+1);
+        doublereal* v = DATA_PTR(m_kv);
+        doublereal* h = DATA_PTR(m_hess);
+        doublereal tol = eta*bnorm;
+        doublereal rnorm = bnorm;
+        doublereal t;
+        int iter = 0;
+        bool first = true;
+
+        while (1 > 0) {
+            // residual of the linear system
+            if (first) {
+                copy(b, b + sz, v);
+                first = false;
+            }
+            else {
+                krylovMult(x, f0, step, v, r);
+                for (i = 0; i < sz; i++) v[i] = b[i] - v[i];
+            }
+            rnorm = 0.0;
+            for (i = 0; i < sz; i++) rnorm += v[i]*v[i];
+            rnorm = sqrt(rnorm);
+            if (rnorm <= tol || iter >= m_kmaxit) break;
+            for (i = 0; i < sz; i++) v[i] /= rnorm;
+            fill(g.begin(), g.end(), 0.0);
+            g[0] = rnorm;
+
+            // Arnoldi process, with modified Gram-Schmidt
+            // orthogonalization
+            for (k = 0; k < m && iter < m_kmaxit; k++) {
+                doublereal* vk = v + k*sz;
+                doublereal* vn = v + (k+1)*sz;
+                krylovMult(x, f0, vk, vn, r);
+                iter++;
+                for (j = 0; j <= k; j++) {
+                    doublereal* vj = v + j*sz;
+                    t = 0.0;
+                    for (i = 0; i < sz; i++) t += vn[i]*vj[i];
+                    h[j + (m+1)*k] = t;
+                    for (i = 0; i < sz; i++) vn[i] -= t*vj[i];
+                }
+                t = 0.0;
+                for (i = 0; i < sz; i++) t += vn[i]*vn[i];
+                t = sqrt(t);
+                h[k+1 + (m+1)*k] = t;
+                if (t > 0.0) 
+                    for (i = 0; i < sz; i++) vn[i] /= t;
+
+                // apply the previous Givens rotations to the new
+                // column of the Hessenberg matrix, and compute the
+                // rotation that eliminates its subdiagonal element
+                for (j = 0; j < k; j++) {
+                    doublereal h1 = h[j + (m+1)*k];
+                    doublereal h2 = h[j+1 + (m+1)*k];
+                    h[j + (m+1)*k] = cs[j]*h1 + sn[j]*h2;
+                    h[j+1 + (m+1)*k] = -sn[j]*h1 + cs[j]*h2;
+                }
+                doublereal h1 = h[k + (m+1)*k];
+                doublereal h2 = h[k+1 + (m+1)*k];
+                doublereal d = sqrt(h1*h1 + h2*h2);
+                if (d == 0.0) {
+                    cs[k] = 1.0;
+                    sn[k] = 0.0;
+                }
+                else {
+                    cs[k] = h1/d;
+                    sn[k] = h2/d;
+                }
+                h[k + (m+1)*k] = d;
+                h[k+1 + (m+1)*k] = 0.0;
+                g[k+1] = -sn[k]*g[k];
+                g[k] = cs[k]*g[k];
+                if (fabs(g[k+1]) <= tol || t == 0.0) {
+                    k++;
+                    break;
+                }
+            }
+
+            // solve the triangular system for the coefficients of the
+            // basis vectors, and update the solution
+            for (j = k-1; j >= 0; j--) {
+                t = g[j];
+                for (i = j+1; i < k; i++) t -= h[j + (m+1)*i]*g[i];
+                g[j] = (h[j + (m+1)*j] != 0.0 ? t/h[j + (m+1)*j] : 0.0);
+            }
+            for (j = 0; j < k; j++) {
+                doublereal* vj = v + j*sz;
+                for (i = 0; i < sz; i++) step[i] += g[j]*vj[i];
+            }
+        }
+
+        for (i = 0; i < sz; i++) step[i] *= m_ewt[i];
+        m_nksteps++;
+        m_nkiters += iter;
+        m_kconverged = (rnorm <= tol);
+        if (!m_kconverged) m_nkfails++;
+        if (loglevel > 0) {
+            sprintf(m_buf, "\nGMRES: %d iterations, eta = %9.3e, "
+                "residual reduced by %9.3e", iter, eta, rnorm/bnorm);
+            writelog(m_buf);
+        }
+        releaseWorkArray(f0);
+        releaseWorkArray(b);
+    }
+
     /**
      * Return the factor by which the undamped Newton step 'step0'
      * must be multiplied in order to keep all solution components in
@@ -203,6 +618,7 @@ namespace Cantera {
     int MultiNewton::dampStep(const doublereal* x0, const doublereal* step0, 
         doublereal* x1, doublereal* step1, doublereal& s1,
         OneDim& r, MultiJac& jac, int loglevel, bool writetitle) {
+        ScopedPhase sp(&r.profile(), phase_damping);
 
         // write header 
         if (loglevel > 0 && writetitle) {
@@ -280,8 +696,10 @@ namespace Cantera {
         // solution after stepping by the damped step would represent
         // a converged solution, and return 0 otherwise. If no damping
         // coefficient could be found, return -2.
+        // A small step1 does not indicate convergence if it was
+        // computed by a Krylov solve that did not converge.
         if (m < NDAMP) {
-            if (s1 > 1.0) return 0;
+            if (s1 > 1.0 || !m_kconverged) return 0;
             else return 1;
         }
         else {
@@ -297,6 +715,7 @@ namespace Cantera {
      */
     int MultiNewton::solve(doublereal* x0, doublereal* x1, 
         OneDim& r, MultiJac& jac, int loglevel) {
+        ScopedPhase sp(&r.profile(), phase_newton);
         clock_t t0 = clock();
         int m = 0;
         bool forceNewJac = false;
@@ -307,10 +726,12 @@ namespace Cantera {
         doublereal* stp1 = getWorkArray();
 
         copy(x0, x0 + m_n, x);
+        m_fnorm = 0.0;
 
         bool frst = true;
         doublereal rdt = r.rdt();
         int j0 = jac.nEvals();
+        int nkfail = 0;
 
         while (1 > 0) {
 
@@ -331,6 +752,13 @@ namespace Cantera {
             // compute the undamped Newton step
             step(x, stp, r, jac, loglevel-1);
 
+            // x is an accepted iterate, so its residual norm is the
+            // reference for the forcing terms of the following steps
+            if (m_krylov) {
+                m_fnorm = m_stepnorm;
+                m_eta = m_stepeta;
+            }
+
             // increment the Jacobian age
             jac.incrementAge();
 
@@ -355,17 +783,33 @@ namespace Cantera {
             // step, and try again.
             if (m == 0) {
                 copy(x1, x1 + m_n, x);
+
+                // Steps computed by GMRES solves that do not converge
+                // may never lead to a converged solution. After
+                // NKFAIL of them in a row, return -1, so that the
+                // caller can take time steps instead.
+                if (m_krylov && !m_kconverged) nkfail++;
+                else nkfail = 0;
+                if (nkfail >= NKFAIL) {
+                    if (loglevel > 0)
+                        writelog("\nGMRES did not converge for "
+                            +int2str(NKFAIL)+" steps.\n");
+                    m = -1;
+                    goto done;
+                }
             }
 
             // convergence
             else if (m == 1) goto done;
 
             // If dampStep fails, first try a new Jacobian if an old
-            // one was being used. If it was a new Jacobian, then
-            // return -1 to signify failure.
+            // one was being used, or if only its source terms were
+            // updated. If it was a new Jacobian, then return -1 to
+            // signify failure.
             else if (m < 0) {
-                if (jac.age() > 1) {
+                if (jac.age() > 1 || jac.sourceOnly()) {
                     forceNewJac = true;
+                    jac.invalidateTransport();
                     if (loglevel > 0)
                         writelog("\nRe-evaluating Jacobian, since no damping "
                             "coefficient\ncould be found with this Jacobian.\n");
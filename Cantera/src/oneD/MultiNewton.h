@@ -56,16 +56,91 @@ namespace Cantera {
         /// Change the problem size.
         void resize(int points);
 
+        /**
+         * Select the method used to solve for the Newton step. If
+         * krylov is false (the default), the linear system is solved
+         * directly, using the factored Jacobian. If true, it is solved
+         * approximately by restarted GMRES (see krylovStep).
+         */
+        void setNewtonKrylov(bool krylov) { m_krylov = krylov; }
+
+        /// True if the Newton step is computed by GMRES.
+        bool newtonKrylov() const { return m_krylov; }
+
+        /**
+         * Set options for the Newton-Krylov method.
+         * @param kdim    dimension of the Krylov subspace, after which
+         *                GMRES is restarted
+         * @param maxit   maximum number of GMRES iterations per step
+         * @param etaMax  maximum value of the forcing term, i.e., of the
+         *                ratio of the final and initial norms of the
+         *                residual of the linear system. Components
+         *                with small absolute tolerances have large
+         *                weights in the norm used to test for
+         *                convergence, so that larger values may
+         *                prevent the Newton iteration from converging.
+         * @param gaussSeidel  if true, the preconditioner is symmetric
+         *                block Gauss-Seidel; otherwise, it is block
+         *                Jacobi. See factorPreconditioner.
+         */
+        void setKrylovOptions(int kdim = 30, int maxit = 200, 
+            doublereal etaMax = 1.0e-6, bool gaussSeidel = true);
+
+        /// Total number of GMRES iterations.
+        int nKrylovIters() const { return m_nkiters; }
+
+        /// Number of Newton steps computed by GMRES.
+        int nKrylovSteps() const { return m_nksteps; }
+
+        /// Number of Newton steps for which GMRES did not converge
+        /// within the maximum number of iterations.
+        int nKrylovFails() const { return m_nkfails; }
 
     protected:
 
         doublereal* getWorkArray();
         void releaseWorkArray(doublereal* work);
+
+        void krylovStep(doublereal* x, doublereal* step, 
+            OneDim& r, MultiJac& jac, int loglevel);
+        void factorPreconditioner(OneDim& r, MultiJac& jac);
+        void precondition(doublereal* v);
+        void krylovMult(const doublereal* x, const doublereal* f0,
+            const doublereal* u, doublereal* w, OneDim& r);
+        void errorWeights(const doublereal* x, OneDim& r);
+
         std::vector<doublereal*> m_workarrays;
         int m_maxAge;
         int m_nv, m_np, m_n;
         doublereal m_elapsed;
 
+        // Newton-Krylov
+        bool m_krylov;
+        bool m_sgs;               // symmetric Gauss-Seidel preconditioner
+        bool m_kconverged;        // true if GMRES converged at last step
+        int m_kdim, m_kmaxit;
+        doublereal m_etamax;
+        doublereal m_eta;         // forcing term at the last accepted iterate
+        doublereal m_fnorm;       // residual norm at the last accepted iterate
+        doublereal m_stepeta;     // forcing term used for the last step
+        doublereal m_stepnorm;    // residual norm at the last step
+        vector_fp m_ewt;          // error weights
+        vector_fp m_kv;           // Krylov basis
+        vector_fp m_hess;         // Hessenberg matrix
+        vector_fp m_pc;           // factored diagonal blocks
+        vector_int m_pcloc;       // location of each block in m_pc
+        vector_int m_pcrow;       // first row of each block
+        vector_int m_pcnv;        // size of each block
+        vector_int m_pcipiv;      // pivots of the diagonal blocks
+        vector_fp m_pcoff;        // off-diagonal blocks
+        vector_int m_pclower;     // location of each block row's lower 
+        vector_int m_pcupper;     //   and upper blocks in m_pcoff
+        vector_fp m_pcwork;
+        bool m_pc_ok;
+        int m_pc_evals;           // Jacobian evaluation it was formed from
+        doublereal m_pc_rdt;      // reciprocal time step it was formed with
+        int m_nkiters, m_nksteps, m_nkfails;
+
     private:
 
         char m_buf[100];
@@ -7,6 +7,7 @@
 #include "MultiJac.h"
 #include "MultiNewton.h"
 #include "OneDim.h"
+#include "SolutionStore.h"
 
 #include "ctml.h"
 using namespace ctml;
@@ -20,10 +21,10 @@ namespace Cantera {
     OneDim::OneDim() 
         : m_tmin(1.0e-16), m_tmax(10.0), m_tfactor(0.5),
           m_jac(0), m_newt(0), 
-          m_rdt(0.0), m_jac_ok(false),
+          m_rdt(0.0), m_jac_ok(false), m_blocktri(false),
           m_nd(0), m_bw(0), m_size(0),
           m_init(false),
-          m_ss_jac_age(10), m_ts_jac_age(20),
+          m_ss_jac_age(10), m_ts_jac_age(20), m_trans_jac_age(0),
           m_nevals(0), m_evaltime(0.0)
     {
       //writelog("OneDim default constructor\n");
@@ -39,10 +40,10 @@ namespace Cantera {
     OneDim::OneDim(vector<Domain1D*> domains) :
         m_tmin(1.0e-16), m_tmax(10.0), m_tfactor(0.5),
         m_jac(0), m_newt(0), 
-	m_rdt(0.0), m_jac_ok(false),
+	m_rdt(0.0), m_jac_ok(false), m_blocktri(false),
 	m_nd(0), m_bw(0), m_size(0),
 	m_init(false),
-	m_ss_jac_age(10), m_ts_jac_age(20),
+	m_ss_jac_age(10), m_ts_jac_age(20), m_trans_jac_age(0),
 	m_nevals(0), m_evaltime(0.0)
     {
       //writelog("OneDim constructor\n");
@@ -113,6 +114,45 @@ namespace Cantera {
                 m_jacEvals[i], m_jacElapsed[i]);
             writelog(buf);
         }
+        n = m_gridHistPts.size();
+        if (n > 0) {
+            sprintf(buf,"\nGrid history:\n\n Grid   Added   Removed \n");
+            writelog(buf);
+            for (int i = 0; i < n; i++) {
+                sprintf(buf,"%5i   %5i    %5i \n", m_gridHistPts[i],
+                    m_gridAdded[i], m_gridRemoved[i]);
+                writelog(buf);
+            }
+        }
+        if (m_newt->nKrylovSteps() > 0) {
+            sprintf(buf,"\nNewton-Krylov: %i steps, %i GMRES iterations, "
+                "%i not converged\n", m_newt->nKrylovSteps(),
+                m_newt->nKrylovIters(), m_newt->nKrylovFails());
+            writelog(buf);
+        }
+        if (m_profile.enabled()) {
+            sprintf(buf,"\nProfile:\n\n Phase        Calls       Time \n");
+            writelog(buf);
+            for (int p = 0; p < n_solver_phases; p++) {
+                sprintf(buf,"%-10s %7i  %9.4f \n", 
+                    SolverProfile::phaseName(p).c_str(), 
+                    m_profile.calls(p), m_profile.time(p));
+                writelog(buf);
+            }
+        }
+    }
+
+
+    /**
+     * Save the number of grid points after a change of the grid,
+     * with the number of points added and removed.
+     */
+    void OneDim::saveGridChange(int added, int removed) {
+        int np = 0;
+        for (int i = 0; i < m_nd; i++) np += m_dom[i]->nPoints();
+        m_gridHistPts.push_back(np);
+        m_gridAdded.push_back(added);
+        m_gridRemoved.push_back(removed);
     }
 
 
@@ -197,7 +237,8 @@ namespace Cantera {
 
         // delete the current Jacobian evaluator and create a new one        
         delete m_jac;
-        m_jac = new MultiJac(*this);
+        m_jac = new MultiJac(*this, m_blocktri);
+        m_jac->setTransportAge(m_trans_jac_age);
         m_jac_ok = false;
 
         for (i = 0; i < m_nd; i++)
@@ -205,6 +246,34 @@ namespace Cantera {
     }
 
 
+    void OneDim::setBlockTridiagonal(bool blockTridiag) {
+        if (blockTridiag == m_blocktri) return;
+        m_blocktri = blockTridiag;
+        if (m_jac) {
+            delete m_jac;
+            m_jac = new MultiJac(*this, m_blocktri);
+            m_jac->setTransportAge(m_trans_jac_age);
+            m_jac_ok = false;
+            for (int i = 0; i < m_nd; i++)
+                m_dom[i]->setJac(m_jac);
+            m_newt->resize(size());
+        }
+    }
+
+    void OneDim::setNewtonKrylov(bool krylov) {
+        m_newt->setNewtonKrylov(krylov);
+    }
+
+    bool OneDim::newtonKrylov() const {
+        return m_newt->newtonKrylov();
+    }
+
+    void OneDim::setTransportJacAge(int n) {
+        m_trans_jac_age = n;
+        if (m_jac) m_jac->setTransportAge(n);
+    }
+
+
     int OneDim::solve(doublereal* x, doublereal* xnew, int loglevel) {
         if (!m_jac_ok) {
             eval(-1, x, xnew, 0.0, 0);
@@ -403,9 +472,15 @@ namespace Cantera {
              else {
                  if (loglevel > 0) writelog("...failure.\n");
                  dt *= m_tfactor;
-                 if (dt < m_tmin)
+
+                 // leave the steady problem set up, so that the
+                 // next solve does not start from this transient one
+                 if (dt < m_tmin) {
+                     setSteadyMode();
+                     newton().setOptions(m_ss_jac_age);
                      throw CanteraError("OneDim::timeStep",
                          "Time integration failed.");
+                 }
              }
          }
 
@@ -426,6 +501,25 @@ namespace Cantera {
         ::time( &aclock );              /* Get time in seconds */
         newtime = localtime( &aclock ); /* Convert time to struct tm form */
 
+        // binary solution store: append a record, without reading
+        // the solutions already in the file
+        if (SolutionStore::isStore(fname)) {
+            SolutionStore store(fname);
+            id = store.uniqueID(id);
+            XML_Node sim("simulation");
+            sim.addAttribute("id",id);
+            addString(sim,"timestamp",asctime(newtime));
+            if (desc != "") addString(sim,"description",desc);
+            Domain1D* d = left();
+            while (d) {
+                d->save(sim, sol);
+                d = d->right();
+            }
+            store.add(sim);
+            writelog("Solution saved to file "+fname+" as solution "+id+".\n");
+            return;
+        }
+
         XML_Node root("doc");
         ifstream fin(fname.c_str());
         XML_Node* ct;
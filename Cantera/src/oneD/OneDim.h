@@ -154,6 +154,61 @@ namespace Cantera {
         }
         void saveStats();
 
+        /**
+         * Record a change of the grid, for the grid history printed by
+         * writeStats. 
+         * @param added    number of points added
+         * @param removed  number of points removed
+         */
+        void saveGridChange(int added, int removed);
+
+        /**
+         * Select the storage and factorization of the Jacobian. If
+         * true, the Jacobian is stored as a block-tridiagonal matrix
+         * with one block per grid point, and factored by block
+         * Gaussian elimination. Otherwise (the default) it is stored
+         * as a banded matrix and factored with LAPACK routine DGBTRF.
+         */
+        void setBlockTridiagonal(bool blockTridiag);
+
+        /// True if the Jacobian is stored as a block-tridiagonal matrix.
+        bool blockTridiagonal() const { return m_blocktri; }
+
+        /**
+         * Select the method used to compute Newton steps. If true,
+         * each step is computed by GMRES, with Jacobian-vector
+         * products approximated by differences of the residual
+         * function, and preconditioned by blocks of the Jacobian
+         * (see MultiNewton::krylovStep). The Jacobian is
+         * then evaluated as before, but never factored. Otherwise
+         * (the default), steps are computed using the factored
+         * Jacobian. Options for GMRES may be set with
+         * newton().setKrylovOptions.
+         */
+        void setNewtonKrylov(bool krylov);
+
+        /// True if Newton steps are computed by GMRES.
+        bool newtonKrylov() const;
+
+        /**
+         * Reuse the transport and convection terms of the Jacobian
+         * for up to n Newton iterations. Until then, re-evaluations of
+         * the Jacobian update only the chemical source terms at each
+         * point (see MultiJac::setTransportAge). If n <= 0 (the
+         * default), the Jacobian is always evaluated in full.
+         */
+        void setTransportJacAge(int n);
+
+        /// The value set by setTransportJacAge.
+        int transportJacAge() const { return m_trans_jac_age; }
+
+        /**
+         * Timers and call counters for the phases of the solution
+         * (see class SolverProfile). Profiling is enabled with
+         * profile().enable().
+         */
+        SolverProfile& profile() { return m_profile; }
+
     protected:
 
         void evalSSJacobian(doublereal* x, doublereal* xnew);
@@ -167,6 +222,7 @@ namespace Cantera {
         MultiNewton* m_newt;      // Newton iterator
         doublereal m_rdt;         // reciprocal of time step
         bool m_jac_ok;            // if true, Jacobian is current
+        bool m_blocktri;          // if true, use block-tridiagonal Jacobian
         int m_nd;                 // number of domains
         int m_bw;                 // Jacobian bandwidth
         int m_size;               // solution vector size
@@ -182,6 +238,9 @@ namespace Cantera {
 
         // options
         int m_ss_jac_age, m_ts_jac_age;
+        int m_trans_jac_age;
+
+        SolverProfile m_profile;
 
     private:
 
@@ -194,6 +253,11 @@ namespace Cantera {
         vector_int m_funcEvals;
         vector_fp m_funcElapsed;
 
+        // grid history
+        vector_int m_gridHistPts;
+        vector_int m_gridAdded;
+        vector_int m_gridRemoved;
+
 
     };
 
@@ -10,6 +10,8 @@
 
 #include "Sim1D.h"
 #include "MultiJac.h"
+#include "MultiNewton.h"
+#include "SolutionStore.h"
 
 #include <cstdlib>
 
@@ -23,11 +25,13 @@ namespace Cantera {
     writelog(s.c_str());
   }
 
-  Sim1D::Sim1D() : OneDim() { 
+  Sim1D::Sim1D() : OneDim(), m_cont_npts(0) { 
     //writelog("Sim1D default constructor\n"); 
+    setContinuationOptions();
   }
 
-  Sim1D::Sim1D(vector<Domain1D*>& domains) : OneDim(domains) {
+  Sim1D::Sim1D(vector<Domain1D*>& domains) : OneDim(domains),
+                                             m_cont_npts(0) {
 
     // resize the internal solution vector and the wprk array,
     // and perform domain-specific initialization of the
@@ -47,7 +51,7 @@ namespace Cantera {
     m_steps.push_back(2);
     m_steps.push_back(5);
     m_steps.push_back(10);
-
+    setContinuationOptions();
   }
 
 	
@@ -154,10 +158,18 @@ namespace Cantera {
 			 "could not open input file "+fname);
 
     XML_Node root;
-    root.build(s);
-    s.close();
-
-    XML_Node* f = root.findID(id);
+    XML_Node* f;
+    if (SolutionStore::isStore(fname)) {
+      // read only the requested solution from a binary solution store
+      s.close();
+      SolutionStore store(fname);
+      f = &store.read(id, root);
+    }
+    else {
+      root.build(s);
+      s.close();
+      f = root.findID(id);
+    }
     if (!f) {
       throw CanteraError("Sim1D::restore","No solution with id = "+id);
     }
@@ -337,7 +349,7 @@ namespace Cantera {
    * Refine the grid in all domains.
    */
   int Sim1D::refine(int loglevel) {
-    int np = 0;
+    int np = 0, nremoved = 0;
     vector_fp znew, xnew;
     doublereal xmid, zmid;
     int strt, n, m, i, ianalyze;
@@ -355,7 +367,6 @@ namespace Cantera {
 
       if (loglevel > 0) { r.show(); }
 
-      np += r.nNewPoints();
       int comp = d.nComponents();
 
       // loop over points in the current grid
@@ -393,8 +404,9 @@ namespace Cantera {
 	  }
 	}
 	else {
-	  writelog(string("refine: discarding point at ")+fp2str(d.grid(m))+"\n");
-	  ; // throw CanteraError("refine","keepPoint is false at m = "+int2str(m));
+	  nremoved++;
+	  if (loglevel > 1) 
+	    writelog(string("refine: discarding point at ")+fp2str(d.grid(m))+"\n");
 	}
       }
       dsize.push_back(znew.size() - nstart);
@@ -425,6 +437,118 @@ namespace Cantera {
 
     resize();
     finalize();
+    if (np + nremoved > 0) saveGridChange(np, nremoved);
+    return np + nremoved;
+  }
+
+
+  /**
+   * Integral from z[0] to zz of the piecewise-linear function with
+   * values v[0], v[stride], ... at the points of grid z.
+   */
+  static doublereal linearIntegral(int n, const doublereal* z,
+                                   const doublereal* v, int stride, 
+                                   doublereal zz) {
+    doublereal sum = 0.0, dz, a, b;
+    for (int j = 0; j < n-1; j++) {
+      a = v[j*stride];
+      b = v[(j+1)*stride];
+      dz = z[j+1] - z[j];
+      if (zz >= z[j+1]) {
+        sum += 0.5*(a + b)*dz;
+      }
+      else {
+        doublereal h = zz - z[j];
+        if (h > 0.0) sum += a*h + 0.5*(b - a)*h*h/dz;
+        break;
+      }
+    }
+    return sum;
+  }
+
+
+  /**
+   * Replace the grid in domain dom (or in all domains with more than
+   * one point, if dom < 0) by a grid of npts points that
+   * equidistributes the arclength of the solution, as computed by
+   * Refiner::getEquidistributedGrid. If npts < 0, the number of
+   * points is not changed.
+   *
+   * The solution is transferred to the new grid conservatively: the
+   * value at each interior point of the new grid is the average of
+   * the piecewise-linear interpolant of the old solution over the
+   * control volume of the point, which extends halfway to each of
+   * its neighbors. The integral of each component over the interior
+   * control volumes, which extend from the midpoint of the first
+   * interval to the midpoint of the last, is therefore preserved.
+   * The values at the end points are not changed, so the integral
+   * over the half intervals next to the ends, and hence over the
+   * whole domain, is preserved only to the accuracy of the grid.
+   */
+  int Sim1D::remesh(int dom, int npts, int loglevel) {
+    vector_fp znew, xnew, zn;
+    int n, m, i, j, nn, np = 0, npold = 0;
+    vector_int dsize;
+    char buf[100];
+
+    for (n = 0; n < m_nd; n++) {
+      Domain1D& d = domain(n);
+      int comp = d.nComponents();
+      int npnow = d.nPoints();
+      const doublereal* x = DATA_PTR(m_x) + start(n);
+      npold += npnow;
+      if ((dom >= 0 && n != dom) || npnow <= 1) {
+	for (m = 0; m < npnow; m++) {
+	  znew.push_back(d.grid(m));
+	  for (i = 0; i < comp; i++) xnew.push_back(value(n, i, m));
+	}
+	dsize.push_back(npnow);
+	continue;
+      }
+
+      nn = (npts > 1 ? npts : npnow);
+      zn.resize(nn);
+      d.refiner().getEquidistributedGrid(npnow, DATA_PTR(d.grid()), x,
+					 nn, DATA_PTR(zn));
+      if (loglevel > 0) {
+	sprintf(buf, "Remeshing %s: %d points -> %d points\n",
+		d.id().c_str(), npnow, nn);
+	writelog(buf);
+      }
+
+      // boundaries of the control volumes, and the integral of
+      // each component up to each boundary
+      vector_fp zb(nn-1), ib(nn-1);
+      for (j = 0; j < nn-1; j++) zb[j] = 0.5*(zn[j] + zn[j+1]);
+      int xstart = xnew.size();
+      xnew.resize(xstart + nn*comp);
+      for (i = 0; i < comp; i++) {
+	for (j = 0; j < nn-1; j++) {
+	  ib[j] = linearIntegral(npnow, DATA_PTR(d.grid()), 
+				 x + d.index(i,0), comp, zb[j]);
+	}
+	xnew[xstart + i] = value(n, i, 0);
+	for (j = 1; j < nn-1; j++) {
+	  xnew[xstart + j*comp + i] = (ib[j] - ib[j-1])/(zb[j] - zb[j-1]);
+	}
+	xnew[xstart + (nn-1)*comp + i] = value(n, i, npnow-1);
+      }
+      for (j = 0; j < nn; j++) znew.push_back(zn[j]);
+      dsize.push_back(nn);
+    }
+
+    int gridstart = 0;
+    for (n = 0; n < m_nd; n++) {
+      domain(n).setupGrid(dsize[n], DATA_PTR(znew) + gridstart);
+      gridstart += dsize[n];
+      np += dsize[n];
+    }
+    m_x.resize(xnew.size());
+    copy(xnew.begin(), xnew.end(), m_x.begin());
+    m_xnew.resize(xnew.size());
+    resize();
+    finalize();
+    saveGridChange(max(np - npold, 0), max(npold - np, 0));
     return np;
   }
 
@@ -588,4 +712,337 @@ namespace Cantera {
   void Sim1D::evalSSJacobian() {
     OneDim::evalSSJacobian(DATA_PTR(m_x), DATA_PTR(m_xnew));
   }
+
+  void Sim1D::setContinuationOptions(doublereal ds, doublereal dsmin,
+                                     doublereal dsmax, bool secant, int maxiter) {
+    m_cont_ds = ds;
+    m_cont_dsmin = dsmin;
+    m_cont_dsmax = dsmax;
+    m_cont_secant = secant;
+    m_cont_maxiter = maxiter;
+  }
+
+  /**
+   * Scaled inner product used to measure arclength. Each term is
+   * divided by the square of the scale factor of its component, and
+   * the sum is divided by the number of components.
+   */
+  doublereal Sim1D::contDot(const doublereal* a, const doublereal* b) const {
+    doublereal sum = 0.0;
+    int n = static_cast<int>(m_cont_scale.size());
+    for (int i = 0; i < n; i++) {
+      sum += a[i]*b[i]/(m_cont_scale[i]*m_cont_scale[i]);
+    }
+    return sum/n;
+  }
+
+  /**
+   * Evaluate the steady-state residual r at (x, pval), and the
+   * derivative of the residual with respect to the parameter, which
+   * is returned in rp. The derivative is evaluated by a one-sided
+   * finite difference.
+   */
+  void Sim1D::contResidual(ContinuationParameter& p, doublereal pval,
+                           doublereal* x, doublereal* r, doublereal* rp) {
+    int n = size();
+    doublereal dp = 1.0e-7*fmaxx(fabs(pval), m_cont_pscale);
+    p.setValue(pval + dp);
+    OneDim::eval(-1, x, rp, 0.0);
+    p.setValue(pval);
+    OneDim::eval(-1, x, r, 0.0);
+    for (int i = 0; i < n; i++) {
+      rp[i] = (rp[i] - r[i])/dp;
+    }
+  }
+
+  /**
+   * Compute the undamped Newton step (dx, dp) at (x, pval) for the
+   * residual equations augmented by the arclength condition
+   * \f[
+   *     N(x, p) = <t, x - x_0> + t_p (p - p_0) - ds = 0,
+   * \f]
+   * where \f$ (x_0, p_0) \f$ is the last solution on the branch, and
+   * \f$ (t, t_p) \f$ is the unit tangent. J a = -F and J b = -dF/dp
+   * are solved using the same factored Jacobian J, and the step is
+   * (a + dp b, dp), with dp chosen to satisfy the linearized
+   * arclength condition. Returns the weighted norm of dx, or -1 if
+   * the Jacobian is singular.
+   */
+  doublereal Sim1D::contStep(ContinuationParameter& p, doublereal* x,
+                             doublereal pval, doublereal p0,
+                             const doublereal* t, doublereal tp, doublereal ds,
+                             doublereal* dx, doublereal& dp) {
+    int n = size();
+    int i;
+    vector_fp r(n), b(n);
+    doublereal pscl2 = m_cont_pscale*m_cont_pscale;
+
+    contResidual(p, pval, x, DATA_PTR(r), DATA_PTR(b));
+    if (!m_jac_ok || m_jac->age() > m_ss_jac_age) {
+      m_jac->eval(x, DATA_PTR(r), 0.0);
+      m_jac->updateTransient(0.0, DATA_PTR(m_mask));
+      m_jac_ok = true;
+    }
+    for (i = 0; i < n; i++) {
+      dx[i] = -r[i];
+      b[i] = -b[i];
+    }
+    int iok = m_jac->solve(n, dx, dx);
+    if (iok == 0) iok = m_jac->solve(n, DATA_PTR(b), DATA_PTR(b));
+    if (iok != 0) return -1.0;
+
+    // solve the linearized arclength condition for the change
+    // in the parameter
+    for (i = 0; i < n; i++) r[i] = x[i] - m_x[i];
+    doublereal nres = contDot(t, DATA_PTR(r)) + tp*(pval - p0)/pscl2 - ds;
+    doublereal den = contDot(t, DATA_PTR(b)) + tp/pscl2;
+    if (den == 0.0) return -1.0;
+    dp = (-nres - contDot(t, dx))/den;
+    for (i = 0; i < n; i++) dx[i] += dp*b[i];
+    return m_newt->norm2(x, dx, *this);
+  }
+
+  /**
+   * Damped Newton iteration for the augmented system, as in
+   * MultiNewton::solve. On entry, (x, pval) is the predicted point;
+   * on successful return, it is the corrected one. Returns the number
+   * of iterations, or -1 if the iteration did not converge.
+   */
+  int Sim1D::contCorrector(ContinuationParameter& p, doublereal* x,
+                           doublereal& pval, const doublereal* t, doublereal tp,
+                           doublereal ds, int loglevel) {
+    const int ndamp = 7;
+    int n = size();
+    int i, m, iter;
+    vector_fp dx(n), x1(n), dx1(n);
+    doublereal dp, p1, dp1, s1 = 0.0, damp, fbound;
+    doublereal p0 = p.value();
+    char buf[100];
+
+    doublereal s0 = contStep(p, x, pval, p0, t, tp, ds, DATA_PTR(dx), dp);
+    m_jac->incrementAge();
+    if (s0 < 0.0) return -1;
+
+    for (iter = 1; iter <= m_cont_maxiter; iter++) {
+      fbound = m_newt->boundStep(x, DATA_PTR(dx), *this, loglevel-2);
+      if (fbound < 1.0e-10) {
+        if (loglevel > 1) writelog("    at limits\n");
+        return -1;
+      }
+
+      // find a damping coefficient such that the next undamped step
+      // is smaller than this one
+      damp = 1.0;
+      for (m = 0; m < ndamp; m++) {
+        for (i = 0; i < n; i++) x1[i] = x[i] + fbound*damp*dx[i];
+        p1 = pval + fbound*damp*dp;
+        s1 = contStep(p, DATA_PTR(x1), p1, p0, t, tp, ds, DATA_PTR(dx1), dp1);
+        m_jac->incrementAge();
+        if (s1 < 0.0) return -1;
+        if (s1 < 1.0 || s1 < s0) break;
+        damp /= sqrt(2.0);
+      }
+      if (loglevel > 1) {
+        sprintf(buf, "    %2d  %10.4g  %10.4f  %9.5f  %9.5f  %d\n", iter,
+                p1, log10(s1 + SmallNumber), damp, fbound, m_jac->nEvals());
+        writelog(buf);
+      }
+
+      // if no damping coefficient was found, try again with a new
+      // Jacobian, unless the Jacobian is already current
+      if (m == ndamp) {
+        if (m_jac->age() <= ndamp + 1) return -1;
+        m_jac->setAge(m_ss_jac_age + 1);
+        s0 = contStep(p, x, pval, p0, t, tp, ds, DATA_PTR(dx), dp);
+        m_jac->incrementAge();
+        if (s0 < 0.0) return -1;
+        continue;
+      }
+
+      copy(x1.begin(), x1.end(), x);
+      pval = p1;
+      if (s1 < 1.0) {
+        p.setValue(pval);
+        return iter;
+      }
+      copy(dx1.begin(), dx1.end(), dx.begin());
+      dp = dp1;
+      s0 = s1;
+    }
+    p.setValue(p0);
+    return -1;
+  }
+
+  /**
+   * Take one step of pseudo-arclength continuation.
+   */
+  int Sim1D::continuationStep(ContinuationParameter& p, doublereal direction,
+                              int loglevel) {
+    int n = size();
+    int i, j, k, m;
+    char buf[100];
+    doublereal p0 = p.value();
+
+    // start a new branch if the parameter or the grid has changed
+    if (p.name() != m_cont_name || int(m_cont_x.size()) != n) {
+      m_cont_npts = 0;
+      m_cont_name = p.name();
+    }
+    if (m_cont_npts == 0) {
+      m_cont_pscale = (p0 != 0.0 ? fabs(p0) : 1.0);
+    }
+    setSteadyMode();
+
+    // scale each component by its largest magnitude in its domain,
+    // but not by less than the magnitude at which its absolute
+    // error tolerance dominates the relative one
+    m_cont_scale.resize(n);
+    for (m = 0; m < m_nd; m++) {
+      Domain1D& d = domain(m);
+      int nc = d.nComponents();
+      int np = d.nPoints();
+      for (k = 0; k < nc; k++) {
+        doublereal smax = d.atol(k)/d.rtol(k);
+        for (j = 0; j < np; j++) {
+          smax = fmaxx(smax, fabs(m_x[d.loc() + d.index(k,j)]));
+        }
+        if (smax == 0.0) smax = 1.0;
+        for (j = 0; j < np; j++) {
+          m_cont_scale[d.loc() + d.index(k,j)] = smax;
+        }
+      }
+    }
+    doublereal pscl2 = m_cont_pscale*m_cont_pscale;
+
+    // the tangent to the branch: J t = -dF/dp, with t_p = 1. This is
+    // computed even if the secant predictor is used, since the
+    // difference between two solutions computed with a small step
+    // length may be dominated by their convergence errors.
+    vector_fp t(n), r(n), sec(n);
+    doublereal tp = 1.0;
+    contResidual(p, p0, DATA_PTR(m_x), DATA_PTR(r), DATA_PTR(t));
+    if (!m_jac_ok || m_jac->age() > m_ss_jac_age) {
+      m_jac->eval(DATA_PTR(m_x), DATA_PTR(r), 0.0);
+      m_jac->updateTransient(0.0, DATA_PTR(m_mask));
+      m_jac_ok = true;
+    }
+    for (i = 0; i < n; i++) t[i] = -t[i];
+    if (m_jac->solve(n, DATA_PTR(t), DATA_PTR(t)) != 0)
+      throw CanteraError("Sim1D::continuationStep",
+                         "singular Jacobian");
+    doublereal tnorm = sqrt(contDot(DATA_PTR(t), DATA_PTR(t)) + tp*tp/pscl2);
+    for (i = 0; i < n; i++) t[i] /= tnorm;
+    tp /= tnorm;
+
+    // keep going in the same direction along the branch
+    doublereal sgn = direction;
+    if (m_cont_npts > 0) {
+      sgn = contDot(DATA_PTR(t), DATA_PTR(m_cont_t)) + tp*m_cont_tp/pscl2;
+    }
+    if (sgn < 0.0) {
+      for (i = 0; i < n; i++) t[i] = -t[i];
+      tp = -tp;
+    }
+
+    // the secant predictor, used only if it is close to the tangent
+    vector_fp pred(t);
+    doublereal predp = tp;
+    if (m_cont_npts > 0 && m_cont_secant) {
+      for (i = 0; i < n; i++) sec[i] = m_x[i] - m_cont_x[i];
+      doublereal secp = p0 - m_cont_p;
+      doublereal snorm = sqrt(contDot(DATA_PTR(sec), DATA_PTR(sec))
+                              + secp*secp/pscl2);
+      if (snorm > 0.0 && contDot(DATA_PTR(sec), DATA_PTR(t))
+          + secp*tp/pscl2 > 0.9*snorm) {
+        for (i = 0; i < n; i++) pred[i] = sec[i]/snorm;
+        predp = secp/snorm;
+      }
+    }
+
+    // predict and correct, reducing the step length until the
+    // corrector converges
+    vector_fp x(n);
+    doublereal pval;
+    int iter = -1;
+    while (1 > 0) {
+      doublereal ds = m_cont_ds;
+      for (i = 0; i < n; i++) x[i] = m_x[i] + ds*pred[i];
+      pval = p0 + ds*predp;
+      if (loglevel > 0) {
+        sprintf(buf, "Continuation step: ds = %10.4g, %s = %10.4g\n",
+                ds, p.name().c_str(), pval);
+        writelog(buf);
+      }
+      iter = contCorrector(p, DATA_PTR(x), pval, DATA_PTR(t), tp, ds,
+                           loglevel);
+      if (iter > 0) break;
+      p.setValue(p0);
+      if (m_cont_ds <= m_cont_dsmin) {
+        throw CanteraError("Sim1D::continuationStep",
+                           "no solution found with the minimum step length "
+                           + fp2str(m_cont_dsmin));
+      }
+      m_cont_ds = fmaxx(0.5*m_cont_ds, m_cont_dsmin);
+      m_jac->setAge(m_ss_jac_age + 1);
+    }
+
+    // accept the new point
+    m_cont_x = m_x;
+    m_cont_p = p0;
+    m_cont_t = t;
+    m_cont_tp = tp;
+    m_cont_npts++;
+    copy(x.begin(), x.end(), m_x.begin());
+    if (loglevel > 0) {
+      sprintf(buf, "    converged in %d iterations; %s = %10.4g\n",
+              iter, p.name().c_str(), pval);
+      writelog(buf);
+    }
+
+    // adjust the step length, aiming to converge in no more than
+    // about 2/3 of the maximum number of iterations
+    if (3*iter <= m_cont_maxiter) m_cont_ds *= 2.0;
+    else if (3*iter <= 2*m_cont_maxiter) m_cont_ds *= 1.25;
+    else if (iter >= m_cont_maxiter - 1) m_cont_ds *= 0.5;
+    m_cont_ds = fmaxx(m_cont_dsmin, fminn(m_cont_ds, m_cont_dsmax));
+    return iter;
+  }
+
+  /**
+   * Follow a branch of solutions from the current solution.
+   */
+  int Sim1D::continuation(ContinuationParameter& p, doublereal pEnd,
+                          int maxSteps, int loglevel, bool refine_grid) {
+    doublereal p0 = p.value();
+    doublereal dir = (pEnd >= p0 ? 1.0 : -1.0);
+    doublereal stepdir = dir;
+    int nsteps = 0;
+    finalize();
+    m_cont_npts = 0;
+    m_cont_values.clear();
+    m_cont_values.push_back(p0);
+    while (nsteps < maxSteps) {
+      try {
+        continuationStep(p, stepdir, loglevel);
+      }
+      catch (CanteraError) {
+        if (loglevel > 0) showErrors();
+        else popError();
+        break;
+      }
+      nsteps++;
+      m_cont_values.push_back(p.value());
+      if (refine_grid && refine(loglevel - 1) > 0) {
+        // re-converge on the new grid at fixed parameter value. The
+        // branch history is lost, so the next step begins with the
+        // tangent predictor, oriented to continue in the direction
+        // the parameter was changing.
+        solve(loglevel - 1, false);
+        m_cont_npts = 0;
+        stepdir = (m_cont_tp >= 0.0 ? 1.0 : -1.0);
+      }
+      if ((p.value() - pEnd)*dir >= 0.0) break;
+    }
+    return nsteps;
+  }
 }
@@ -11,6 +11,7 @@
 
 #include "OneDim.h"
 #include "funcs.h"
+#include "ContinuationParameter.h"
 
 namespace Cantera {
 
@@ -73,6 +74,13 @@ namespace Cantera {
 
         //@}
 
+        /**
+         * Save the current solution to file fname, with identifier
+         * id. If fname is a binary solution store, or does not exist
+         * and has extension '.ctsol', the solution is appended to it
+         * as a new record (see class SolutionStore). Otherwise, it is
+         * added to the CTML file fname.
+         */
         void save(std::string fname, std::string id, std::string desc);
 
         /// Print to stream s the current solution for all domains.     
@@ -91,9 +99,28 @@ namespace Cantera {
             OneDim::eval(-1, DATA_PTR(m_x), DATA_PTR(m_xnew), rdt, count);
         }
 
-        /// Refine the grid in all domains.
+        /**
+         * Refine the grid in all domains. If the prune parameter of
+         * the refinement criteria is positive, points that are not
+         * needed are also removed (see Refiner::analyze). Returns the
+         * total number of points added and removed.
+         */
         int refine(int loglevel=0);
 
+        /**
+         * Replace the grid in domain dom with a grid of npts points
+         * that equidistributes the arclength of the solution, and
+         * interpolate the solution onto the new grid. The end values
+         * are not changed, and the interior values are averages over
+         * their control volumes, so that the integral of each
+         * component between the midpoints of the first and last
+         * intervals is preserved. If dom < 0, all domains with
+         * more than one point are remeshed; if npts < 0, the number
+         * of points is unchanged. Returns the total number of grid
+         * points.
+         */
+        int remesh(int dom = -1, int npts = -1, int loglevel = 0);
+
         //added by Karl Meredith
         int setFixedTemperature(doublereal t);
         //added by Karl Meredith
@@ -104,6 +131,8 @@ namespace Cantera {
             doublereal slope = 0.8, doublereal curve = 0.8, doublereal prune = -0.1);
         void setMaxGridPoints(int dom = -1, int npoints = 300);
 
+        /// Initialize the solution with a solution previously saved
+        /// in a CTML file or binary solution store.
         void restore(std::string fname, std::string id);
         void getInitialSoln();
 
@@ -117,6 +146,89 @@ namespace Cantera {
 
         void evalSSJacobian();
 
+        /**
+         * @name Continuation
+         *
+         * These methods follow a branch of steady-state solutions as
+         * a parameter p (see class ContinuationParameter) is varied,
+         * by pseudo-arclength continuation. The step length ds is
+         * measured in a norm in which each solution component is
+         * scaled by its largest magnitude over the grid, and the
+         * parameter by the magnitude of its initial value, so that a
+         * step ds = 0.1 corresponds to an RMS change of about 10%.
+         * Since the parameter is itself an unknown, turning points
+         * (such as extinction points) are passed without difficulty.
+         *
+         * Each step consists of a predictor, either the secant
+         * through the last two solutions (if it is close to the
+         * tangent) or the tangent to the branch, followed by Newton iteration on the residual
+         * equations augmented by the arclength condition. The
+         * augmented linear systems are solved by block elimination,
+         * with two back-substitutions using the Jacobian of the
+         * residual equations, which is re-evaluated only when the
+         * iteration fails to converge or it reaches its maximum age
+         * (see setJacAge). The step length is increased if the
+         * corrector converges quickly, and cut back if it fails.
+         */
+        //@{
+
+        /**
+         * Set options for continuation.
+         * @param ds       initial step length
+         * @param dsmin    minimum step length. If a step fails with
+         *                 this step length, continuation stops.
+         * @param dsmax    maximum step length
+         * @param secant   if true, use the secant predictor once two
+         *                 solutions on the branch are known; otherwise,
+         *                 always use the tangent predictor.
+         * @param maxiter  maximum number of corrector iterations
+         */
+        void setContinuationOptions(doublereal ds = 0.05,
+            doublereal dsmin = 1.0e-5, doublereal dsmax = 0.5,
+            bool secant = true, int maxiter = 10);
+
+        /**
+         * Take one continuation step, beginning with the current
+         * solution, which must be a converged solution for the
+         * current value of parameter p. On return, the solution and
+         * the parameter have been set to the new point on the branch.
+         * @param p          the parameter
+         * @param direction  if positive, the first step increases the
+         *                   parameter, and if negative it decreases
+         *                   it. Subsequent steps continue in the same
+         *                   direction along the branch.
+         * @param loglevel   controls amount of diagnostic output
+         * @return the number of corrector iterations.
+         */
+        int continuationStep(ContinuationParameter& p,
+            doublereal direction = 1.0, int loglevel = 0);
+
+        /**
+         * Follow a branch of solutions, beginning with the current
+         * solution, until the parameter passes pEnd or maxSteps steps
+         * have been taken. Continuation also stops if the step length
+         * falls below the minimum. If refine_grid is true, the grid is
+         * refined after each step.
+         * @return the number of steps taken.
+         */
+        int continuation(ContinuationParameter& p, doublereal pEnd,
+            int maxSteps = 100, int loglevel = 0, bool refine_grid = false);
+
+        /// Forget the previous solutions on the branch, so that the
+        /// next step begins with the tangent predictor.
+        void resetContinuation() { m_cont_npts = 0; }
+
+        /// The step length to be used for the next continuation step.
+        doublereal continuationStepSize() const { return m_cont_ds; }
+
+        /// The parameter values at the solutions found by the last
+        /// call to continuation, including the initial one.
+        const vector_fp& continuationValues() const {
+            return m_cont_values;
+        }
+
+        //@}
+
     protected:
 
         vector_fp m_x;          // the solution vector
@@ -126,6 +238,20 @@ namespace Cantera {
         vector_int m_steps;     // array of number of steps to take before 
                                 //      re-attempting the steady-state solution
 
+        // continuation
+        doublereal m_cont_ds, m_cont_dsmin, m_cont_dsmax;
+        bool m_cont_secant;
+        int m_cont_maxiter;
+        int m_cont_npts;        // number of solutions on the branch
+        std::string m_cont_name;  // name of the parameter
+        vector_fp m_cont_x;     // previous solution on the branch
+        doublereal m_cont_p;    // parameter value at m_cont_x
+        vector_fp m_cont_t;     // tangent at the previous step
+        doublereal m_cont_tp;   // parameter component of m_cont_t
+        vector_fp m_cont_scale; // scale factors for the solution
+        doublereal m_cont_pscale; // scale factor for the parameter
+        vector_fp m_cont_values;
+
 
     private:
 
@@ -134,6 +260,19 @@ namespace Cantera {
 
         void newtonSolve(int loglevel);
 
+        doublereal contDot(const doublereal* a, const doublereal* b) const;
+
+        void contResidual(ContinuationParameter& p, doublereal pval,
+            doublereal* x, doublereal* r, doublereal* rp);
+
+        doublereal contStep(ContinuationParameter& p, doublereal* x,
+            doublereal pval, doublereal p0, const doublereal* t, doublereal tp,
+            doublereal ds, doublereal* dx, doublereal& dp);
+
+        int contCorrector(ContinuationParameter& p, doublereal* x,
+            doublereal& pval, const doublereal* t, doublereal tp,
+            doublereal ds, int loglevel);
+
 
     };
 
@@ -0,0 +1,348 @@
+/**
+ * @file SolutionStore.cpp
+ *
+ * Binary, append-only storage for one-dimensional solutions.
+ */
+
+/*
+ * Copyright 2002 California Institute of Technology
+ */
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#pragma warning(disable:4503)
+#endif
+
+#include <fstream>
+#include <cstring>
+
+#ifndef WIN32
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "SolutionStore.h"
+#include "ctexceptions.h"
+#include "xml.h"
+#include "ctml.h"
+#include "stringUtils.h"
+
+using namespace ctml;
+using namespace std;
+
+namespace Cantera {
+
+    /// Signature at the beginning of the file
+    static const char store_signature[9] = "CTSOL\001\000\000";
+
+    /// Tag at the beginning of each record
+    static const char record_tag[5] = "CTSR";
+
+    // node types
+    const int store_text = 0;
+    const int store_array = 1;
+
+    static void putInt(string& buf, int n) {
+        buf.append(reinterpret_cast<const char*>(&n), sizeof(int));
+    }
+
+    static void putString(string& buf, const string& s) {
+        putInt(buf, static_cast<int>(s.size()));
+        buf.append(s);
+    }
+
+    /**
+     * Serialize node and its children. Each node is written as its
+     * name, its attributes, its value, and its children. The values
+     * of 'floatArray' nodes are written as arrays of doubles.
+     */
+    static void putNode(string& buf, const XML_Node& node) {
+        putString(buf, node.name());
+        const map<string, string>& attribs = node.attribsConst();
+        putInt(buf, static_cast<int>(attribs.size()));
+        map<string, string>::const_iterator b = attribs.begin();
+        for (; b != attribs.end(); ++b) {
+            putString(buf, b->first);
+            putString(buf, b->second);
+        }
+        if (node.name() == "floatArray") {
+            vector_fp v;
+            getFloatArray(node, v, false);
+            putInt(buf, store_array);
+            putInt(buf, static_cast<int>(v.size()));
+            if (v.size() > 0)
+                buf.append(reinterpret_cast<const char*>(&v[0]),
+                    v.size()*sizeof(doublereal));
+        }
+        else {
+            putInt(buf, store_text);
+            putString(buf, node.value());
+        }
+        int nc = node.nChildren();
+        putInt(buf, nc);
+        for (int i = 0; i < nc; i++) putNode(buf, node.child(i));
+    }
+
+    /**
+     * Reads serialized data from a buffer, checking that it does not
+     * read past the end.
+     */
+    class StoreReader {
+    public:
+        StoreReader(const char* p, const char* end) : m_p(p), m_end(end) {}
+        void get(void* dest, size_t n) {
+            if (m_p + n > m_end)
+                throw CanteraError("SolutionStore::read",
+                    "record is truncated or corrupt");
+            memcpy(dest, m_p, n);
+            m_p += n;
+        }
+        int getInt() {
+            int n;
+            get(&n, sizeof(int));
+            if (n < 0)
+                throw CanteraError("SolutionStore::read",
+                    "record is corrupt");
+            return n;
+        }
+        string getString() {
+            int n = getInt();
+            string s(n, ' ');
+            if (n > 0) get(&s[0], n);
+            return s;
+        }
+    private:
+        const char* m_p;
+        const char* m_end;
+    };
+
+    /**
+     * Format an array in the same way as ctml::addFloatArray.
+     */
+    static string arrayText(const vector_fp& v) {
+        string s = "";
+        int n = static_cast<int>(v.size());
+        for (int i = 0; i < n; i++) {
+            s += fp2str(v[i], "%17.9E");
+            if (i == n-1) s += "\n";
+            else if (i > 0 && (i+1) % 3 == 0) s += ",\n";
+            else s += ", ";
+        }
+        return s;
+    }
+
+    static void getNode(StoreReader& r, XML_Node& parent) {
+        XML_Node& node = parent.addChild(r.getString());
+        int i, n = r.getInt();
+        for (i = 0; i < n; i++) {
+            string key = r.getString();
+            node.addAttribute(key, r.getString());
+        }
+        int type = r.getInt();
+        if (type == store_array) {
+            vector_fp v(r.getInt());
+            if (v.size() > 0) r.get(&v[0], v.size()*sizeof(doublereal));
+            node.addValue(arrayText(v));
+        }
+        else {
+            string val = r.getString();
+            if (val != "") node.addValue(val);
+        }
+        n = r.getInt();
+        for (i = 0; i < n; i++) getNode(r, node);
+    }
+
+
+    SolutionStore::SolutionStore(string fname) : m_file(fname), m_end(0) {
+        ifstream f(fname.c_str(), ios::in | ios::binary);
+        if (!f) {
+            ofstream s(fname.c_str(), ios::out | ios::binary);
+            if (!s)
+                throw CanteraError("SolutionStore",
+                    "could not create file "+fname);
+            s.write(store_signature, 8);
+            m_end = 8;
+            return;
+        }
+        f.close();
+        scan();
+    }
+
+    /**
+     * Build the index by reading the record headers. If the last
+     * record is incomplete (for example, because the program writing
+     * it was interrupted), it is ignored, and the next record added
+     * overwrites it.
+     */
+    void SolutionStore::scan() {
+        ifstream f(m_file.c_str(), ios::in | ios::binary);
+        char sig[8], tag[4];
+        f.read(sig, 8);
+        if (!f || memcmp(sig, store_signature, 8) != 0)
+            throw CanteraError("SolutionStore",
+                m_file+" is not a solution store");
+        f.seekg(0, ios::end);
+        long fsize = f.tellg();
+        m_ids.clear();
+        m_index.clear();
+        m_size.clear();
+        m_end = 8;
+        int n, len;
+        string id;
+        while (m_end < fsize) {
+            f.seekg(m_end);
+            f.read(tag, 4);
+            f.read(reinterpret_cast<char*>(&n), sizeof(int));
+            if (!f || memcmp(tag, record_tag, 4) != 0 || n < 0
+                || m_end + n > fsize) break;
+            id.resize(n);
+            if (n > 0) f.read(&id[0], n);
+            f.read(reinterpret_cast<char*>(&len), sizeof(int));
+            if (!f || len < 0) break;
+            long start = f.tellg();
+            if (start + len > fsize) break;
+            if (hasID(id))
+                throw CanteraError("SolutionStore",
+                    "duplicate solution ID " + id + " in " + m_file);
+            m_ids.push_back(id);
+            m_index[id] = start;
+            m_size[id] = len;
+            m_end = start + len;
+        }
+    }
+
+    bool SolutionStore::isStore(string fname) {
+        ifstream f(fname.c_str(), ios::in | ios::binary);
+        if (f) {
+            char sig[8];
+            f.read(sig, 8);
+            return (f && memcmp(sig, store_signature, 8) == 0);
+        }
+        string::size_type n = fname.size();
+        return (n > 6 && fname.substr(n - 6) == ".ctsol");
+    }
+
+    string SolutionStore::uniqueID(string id) const {
+        string idnew = id;
+        int jid = 1;
+        while (hasID(idnew)) {
+            idnew = id + "_" + int2str(jid);
+            jid++;
+        }
+        return idnew;
+    }
+
+    void SolutionStore::add(const XML_Node& sim) {
+        string id = sim["id"];
+        if (hasID(id))
+            throw CanteraError("SolutionStore::add",
+                "solution ID " + id + " is already in use in " + m_file);
+        string buf;
+        putNode(buf, sim);
+        string hdr(record_tag, 4);
+        putString(hdr, id);
+        putInt(hdr, static_cast<int>(buf.size()));
+
+        fstream f(m_file.c_str(), ios::in | ios::out | ios::binary);
+        if (!f)
+            throw CanteraError("SolutionStore::add",
+                "could not open file "+m_file);
+        f.seekp(m_end);
+        f.write(hdr.data(), hdr.size());
+        f.write(buf.data(), buf.size());
+        f.close();
+        if (!f)
+            throw CanteraError("SolutionStore::add",
+                "error writing to file "+m_file);
+        m_ids.push_back(id);
+        m_index[id] = m_end + static_cast<long>(hdr.size());
+        m_size[id] = static_cast<int>(buf.size());
+        m_end += static_cast<long>(hdr.size() + buf.size());
+    }
+
+    XML_Node& SolutionStore::read(string id, XML_Node& parent) const {
+        map<string, long>::const_iterator loc = m_index.find(id);
+        if (loc == m_index.end())
+            throw CanteraError("SolutionStore::read",
+                "no solution with id = " + id + " in " + m_file);
+        long start = loc->second;
+        int len = m_size.find(id)->second;
+        int nc = parent.nChildren();
+#ifndef WIN32
+        int fd = open(m_file.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw CanteraError("SolutionStore::read",
+                "could not open file "+m_file);
+        // map only the pages that hold the record. The offset must
+        // be a multiple of the page size.
+        long page = sysconf(_SC_PAGESIZE);
+        long offset = (start/page)*page;
+        size_t mlen = static_cast<size_t>(start + len - offset);
+        void* p = mmap(0, mlen, PROT_READ, MAP_SHARED, fd, offset);
+        close(fd);
+        if (p == MAP_FAILED)
+            throw CanteraError("SolutionStore::read",
+                "could not map file "+m_file);
+        const char* data = static_cast<const char*>(p) + (start - offset);
+        try {
+            StoreReader r(data, data + len);
+            getNode(r, parent);
+        }
+        catch (CanteraError) {
+            munmap(p, mlen);
+            throw;
+        }
+        munmap(p, mlen);
+#else
+        string buf(len, ' ');
+        ifstream f(m_file.c_str(), ios::in | ios::binary);
+        f.seekg(start);
+        if (len > 0) f.read(&buf[0], len);
+        if (!f)
+            throw CanteraError("SolutionStore::read",
+                "error reading file "+m_file);
+        StoreReader r(buf.data(), buf.data() + len);
+        getNode(r, parent);
+#endif
+        return parent.child(nc);
+    }
+
+    int SolutionStore::importCTML(string ctmlFile, string storeFile) {
+        ifstream fin(ctmlFile.c_str());
+        if (!fin)
+            throw CanteraError("SolutionStore::importCTML",
+                "could not open file "+ctmlFile);
+        XML_Node root("doc");
+        root.build(fin);
+        fin.close();
+        vector<XML_Node*> sims;
+        root.child("ctml").getChildren("simulation", sims);
+        SolutionStore store(storeFile);
+        for (size_t i = 0; i < sims.size(); i++) {
+            store.add(*sims[i]);
+        }
+        return static_cast<int>(sims.size());
+    }
+
+    int SolutionStore::exportCTML(string storeFile, string ctmlFile) {
+        if (!isStore(storeFile))
+            throw CanteraError("SolutionStore::exportCTML",
+                storeFile+" is not a solution store");
+        SolutionStore store(storeFile);
+        XML_Node root("doc");
+        XML_Node& ct = root.addChild("ctml");
+        for (int i = 0; i < store.nSolutions(); i++) {
+            store.read(store.ids()[i], ct);
+        }
+        ofstream s(ctmlFile.c_str());
+        if (!s)
+            throw CanteraError("SolutionStore::exportCTML",
+                "could not open file "+ctmlFile);
+        ct.write(s);
+        s.close();
+        return store.nSolutions();
+    }
+}
@@ -0,0 +1,114 @@
+/**
+ * @file SolutionStore.h
+ *
+ * Binary, append-only storage for one-dimensional solutions.
+ */
+
+/*
+ * Copyright 2002 California Institute of Technology
+ */
+
+#ifndef CT_SOLUTIONSTORE_H
+#define CT_SOLUTIONSTORE_H
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "ct_defs.h"
+
+namespace Cantera {
+
+    class XML_Node;
+
+    /**
+     * A binary file holding solutions saved by OneDim::save. Each
+     * solution is a 'simulation' XML tree, of the same form as is
+     * saved in CTML files, with the grids and solution components
+     * stored as arrays of doubles rather than as text.
+     *
+     * The file begins with an 8-byte signature, followed by one
+     * record per solution. Each record consists of a header holding
+     * the solution ID and the length of the record, followed by the
+     * serialized tree. Records are only ever appended to the end of
+     * the file, so saving a solution takes time proportional to the
+     * size of the solution, not of the file. When a file is opened,
+     * only the record headers are read, to build an index that maps
+     * each solution ID to the location of its record. A solution is
+     * read by mapping the pages of the file that hold its record
+     * into memory (on systems that support mmap), and reconstructing
+     * the tree of that record only.
+     *
+     * All numbers are stored in the native byte order.
+     */
+    class SolutionStore {
+
+    public:
+
+        /// Open file fname, creating it if it does not exist.
+        SolutionStore(std::string fname);
+
+        virtual ~SolutionStore() {}
+
+        /// True if file fname is a solution store, or if it does not
+        /// exist and its name has extension '.ctsol'.
+        static bool isStore(std::string fname);
+
+        /// Number of solutions in the file.
+        int nSolutions() const { return static_cast<int>(m_ids.size()); }
+
+        /// IDs of the solutions, in the order they were saved.
+        const std::vector<std::string>& ids() const { return m_ids; }
+
+        /// True if a solution with this ID is in the file.
+        bool hasID(std::string id) const {
+            return m_index.find(id) != m_index.end();
+        }
+
+        /**
+         * An ID that is not in use. If id is not in use, it is
+         * returned; otherwise, the first of id_1, id_2, ... that is not
+         * in use is returned. This is the same rule used for CTML files.
+         */
+        std::string uniqueID(std::string id) const;
+
+        /**
+         * Append a 'simulation' node to the file, with the ID given
+         * by its 'id' attribute. An exception is thrown if this ID is
+         * already in use.
+         */
+        void add(const XML_Node& sim);
+
+        /**
+         * Read the solution with the given ID, and add it to node
+         * 'parent' as a child node named 'simulation'. The arrays are
+         * converted to text, so that the domains can restore
+         * themselves from it in the same way as from a CTML
+         * file. Returns a reference to the new node. An exception is
+         * thrown if there is no solution with this ID.
+         */
+        XML_Node& read(std::string id, XML_Node& parent) const;
+
+        /// Copy all solutions in CTML file 'ctmlFile' to the solution
+        /// store 'storeFile'. Returns the number copied.
+        static int importCTML(std::string ctmlFile, std::string storeFile);
+
+        /// Write all solutions in solution store 'storeFile' to CTML
+        /// file 'ctmlFile', which is overwritten. Returns the number
+        /// written.
+        static int exportCTML(std::string storeFile, std::string ctmlFile);
+
+    protected:
+
+        void scan();
+
+        std::string m_file;
+        std::vector<std::string> m_ids;
+        std::map<std::string, long> m_index;    // offset of each record
+        std::map<std::string, int> m_size;      // size of each record
+        long m_end;                             // end of the last record
+    };
+
+}
+
+#endif
@@ -0,0 +1,98 @@
+/**
+ * @file SolverProfile.cpp
+ *
+ * Timers and call counters for the phases of the one-dimensional
+ * solver.
+ */
+
+/*
+ * Copyright 2002 California Institute of Technology
+ */
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#pragma warning(disable:4503)
+#endif
+
+#include <fstream>
+
+#include "SolverProfile.h"
+#include "ctexceptions.h"
+#include "stringUtils.h"
+
+using namespace std;
+
+namespace Cantera {
+
+    static const char* phase_names[n_solver_phases] = {
+        "newton", "damping", "jacobian", "factor", "linsolve",
+        "residual", "thermo", "transport", "diffflux", "kinetics"
+    };
+
+    SolverProfile::SolverProfile() : ProfileData("OneDim"), 
+                                     m_enabled(false) {
+        for (int p = 0; p < n_solver_phases; p++) m_depth[p] = 0;
+    }
+
+    /**
+     * The timers are added when profiling is first enabled, so that
+     * solvers that are never profiled do not appear in profileReport.
+     */
+    void SolverProfile::enable(bool on) {
+        m_enabled = on;
+        if (on && nEntries() == 0) {
+            for (int p = 0; p < n_solver_phases; p++) 
+                addTimer(phase_names[p]);
+        }
+    }
+
+    void SolverProfile::reset() {
+        ProfileData::reset();
+        for (int p = 0; p < n_solver_phases; p++) m_depth[p] = 0;
+    }
+
+    doublereal SolverProfile::time(int p) const {
+        if (nEntries() == 0) return 0.0;
+        return value2(p)/profileTicksPerSecond();
+    }
+
+    string SolverProfile::phaseName(int p) {
+        if (p < 0 || p >= n_solver_phases)
+            throw CanteraError("SolverProfile::phaseName",
+                "unknown phase "+int2str(p));
+        return phase_names[p];
+    }
+
+    string SolverProfile::toJSON() const {
+        string s = "{\n";
+        for (int p = 0; p < n_solver_phases; p++) {
+            s += "  \"" + phaseName(p) + "\": {\"calls\": "
+                + int2str(calls(p)) + ", \"time\": "
+                + fp2str(time(p), "%.6e") + "}";
+            s += (p < n_solver_phases - 1 ? ",\n" : "\n");
+        }
+        s += "}\n";
+        return s;
+    }
+
+    string SolverProfile::toCSV() const {
+        string s = "phase,calls,time\n";
+        for (int p = 0; p < n_solver_phases; p++) {
+            s += phaseName(p) + "," + int2str(calls(p)) + ","
+                + fp2str(time(p), "%.6e") + "\n";
+        }
+        return s;
+    }
+
+    void SolverProfile::save(string fname) const {
+        ofstream f(fname.c_str());
+        if (!f)
+            throw CanteraError("SolverProfile::save",
+                "could not open file "+fname);
+        string::size_type n = fname.size();
+        if (n > 4 && fname.substr(n - 4) == ".csv")
+            f << toCSV();
+        else
+            f << toJSON();
+    }
+}
@@ -0,0 +1,136 @@
+/**
+ * @file SolverProfile.h
+ *
+ * Timers and call counters for the phases of the one-dimensional
+ * solver.
+ */
+
+/*
+ * Copyright 2002 California Institute of Technology
+ */
+
+#ifndef CT_SOLVERPROFILE_H
+#define CT_SOLVERPROFILE_H
+
+#include <string>
+
+#include "ct_defs.h"
+#include "ProfileData.h"
+
+namespace Cantera {
+
+    /**
+     * The phases of the one-dimensional solver for which the time
+     * and number of calls are recorded by class SolverProfile. The
+     * times are inclusive, so that, for example, the time for
+     * phase_jacobian includes the time spent in phase_residual while
+     * evaluating the Jacobian.
+     */
+    enum SolverPhase {
+        phase_newton = 0,   ///< MultiNewton::solve
+        phase_damping,      ///< MultiNewton::dampStep
+        phase_jacobian,     ///< MultiJac::eval
+        phase_factor,       ///< factorization of the Jacobian
+        phase_linsolve,     ///< back-substitution for the Newton step
+        phase_residual,     ///< StFlow::eval
+        phase_thermo,       ///< StFlow::updateThermo
+        phase_transport,    ///< StFlow::updateTransport
+        phase_diffflux,     ///< StFlow::updateDiffFluxes
+        phase_kinetics,     ///< net production rates in StFlow
+        n_solver_phases
+    };
+
+    /**
+     * Per-phase timers and call counters for a OneDim solver. The
+     * timers are entries of a ProfileData object named after the
+     * phases (see phaseName), so that they are also included in
+     * profileReport once profiling has been enabled.
+     *
+     * Profiling is disabled by default, in which case start and stop
+     * do nothing but test a flag, and no entries exist. When it is
+     * enabled, each call of start and stop reads the time stamp
+     * counter (see profileTicks).
+     *
+     * The profile can be written in JSON format, as an object with
+     * one member per phase giving the number of calls and the elapsed
+     * time in seconds, or as CSV with one row per phase.
+     */
+    class SolverProfile : public ProfileData {
+
+    public:
+
+        SolverProfile();
+        virtual ~SolverProfile() {}
+
+        /// Enable or disable profiling.
+        void enable(bool on = true);
+
+        /// True if profiling is enabled.
+        bool enabled() const { return m_enabled; }
+
+        /// Set all times and counters to zero.
+        void reset();
+
+        /**
+         * Start timing phase p. Nested calls for the same phase are
+         * counted once, and timed from the outermost call.
+         */
+        void start(int p) {
+            if (m_enabled && m_depth[p]++ == 0) startTimer(p);
+        }
+
+        /// Stop timing phase p.
+        void stop(int p) {
+            if (m_depth[p] == 0) return;
+            if (--m_depth[p] == 0) stopTimer(p);
+        }
+
+        /// Number of calls recorded for phase p.
+        int calls(int p) const { 
+            return (nEntries() > 0 ? static_cast<int>(value(p)) : 0);
+        }
+
+        /// Elapsed time in seconds recorded for phase p.
+        doublereal time(int p) const;
+
+        /// Name of phase p, as used in the JSON and CSV output.
+        static std::string phaseName(int p);
+
+        /// The profile in JSON format. profileReport uses the
+        /// generic format of ProfileData::toJSON instead.
+        std::string toJSON() const;
+
+        /// The profile in CSV format.
+        std::string toCSV() const;
+
+        /**
+         * Write the profile to file fname, in CSV format if the name
+         * has extension '.csv', and in JSON format otherwise.
+         */
+        void save(std::string fname) const;
+
+    protected:
+
+        bool m_enabled;
+        int m_depth[n_solver_phases];
+    };
+
+    /**
+     * Times a phase for the lifetime of the object. If the profile
+     * pointer is null, nothing is done.
+     */
+    class ScopedPhase {
+    public:
+        ScopedPhase(SolverProfile* prof, int p) : m_prof(prof), m_phase(p) {
+            if (m_prof) m_prof->start(p);
+        }
+        ~ScopedPhase() {
+            if (m_prof) m_prof->stop(m_phase);
+        }
+    private:
+        SolverProfile* m_prof;
+        int m_phase;
+    };
+}
+
+#endif
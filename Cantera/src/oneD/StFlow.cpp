@@ -112,6 +112,7 @@ namespace Cantera {
         m_jac(0),
 	m_ok(false),
 	m_do_soret(false),
+	m_do_multiflux(false),
 	m_transport_option(-1),
 	m_efctr(0.0)
     {
@@ -144,7 +145,6 @@ namespace Cantera {
         m_do_energy.resize(m_points,false);
 
         m_diff.resize(m_nsp*m_points);
-        m_multidiff.resize(m_nsp*m_nsp*m_points);
         m_flux.resize(m_nsp,m_points);
         m_wdot.resize(m_nsp,m_points, 0.0);
         m_surfdot.resize(m_nsp, 0.0);
@@ -215,8 +215,8 @@ namespace Cantera {
             m_diff.resize(m_nsp*m_points);
         }
         else {
-            m_multidiff.resize(m_nsp*m_nsp*m_points);
             m_diff.resize(m_nsp*m_points);
+            m_dthermal.resize(m_nsp, m_points, 0.0);
         }
         m_flux.resize(m_nsp,m_points);
         m_wdot.resize(m_nsp,m_points, 0.0);
@@ -251,12 +251,14 @@ namespace Cantera {
 
         if (m_trans->model() == cMulticomponent) {
             m_transport_option = c_Multi_Transport;
-            m_multidiff.resize(m_nsp*m_nsp*m_points);
+            m_multidiff.resize(m_nsp*m_nsp);
+            m_gradx.resize(m_nsp);
             m_diff.resize(m_nsp*m_points);
             m_dthermal.resize(m_nsp, m_points, 0.0);
         }
         else if (m_trans->model() == cMixtureAveraged) {
             m_transport_option = c_Mixav_Transport;
+            m_do_multiflux = false;
             m_diff.resize(m_nsp*m_points);
             if (withSoret) 
                 throw CanteraError("setTransport",
@@ -278,6 +280,17 @@ namespace Cantera {
     }
 
 
+    void StFlow::enableMultiFluxes(bool withFluxes) {
+        if (m_transport_option == c_Multi_Transport)
+            m_do_multiflux = withFluxes;
+        else {
+            throw CanteraError("enableMultiFluxes",
+                "Multicomponent fluxes "
+                "require using a multicomponent transport model.");
+        }
+    }
+
+
     /**
      * Set the gas object state to be consistent with the solution at
      * point j.
@@ -345,6 +358,7 @@ namespace Cantera {
         // the domain of influence for this domain, then skip
         // evaluating the residual
         if (jg >=0 && (jg < firstPoint() - 1 || jg > lastPoint() + 1)) return;
+        ScopedPhase sp(profile(), phase_residual);
 
         // if evaluating a Jacobian, compute the steady-state residual
         if (jg >= 0) rdt = 0.0;
@@ -582,11 +596,67 @@ namespace Cantera {
 
 
 
+    /**
+     * Evaluate the chemical source terms of the residual equations
+     * at point j, using the density and heat capacity stored for this
+     * point.
+     */
+    void StFlow::evalSource(doublereal* x, int j, doublereal* src) {
+        int k;
+        getWdot(x,j);
+        for (k = 0; k < m_nsp; k++) 
+            src[c_offset_Y + k] = m_wt[k]*wdot(k,j)/m_rho[j];
+        if (m_do_energy[j]) {
+            const vector_fp& h_RT = m_thermo->enthalpy_RT_ref();
+            doublereal sum = 0.0;
+            for (k = 0; k < m_nsp; k++) sum += wdot(k,j)*h_RT[k];
+            src[c_offset_T] = -GasConstant*T(x,j)*sum/(m_rho[j]*m_cp[j]);
+        }
+        else 
+            src[c_offset_T] = 0.0;
+    }
+
+    /**
+     * The source terms are differentiated with respect to T and the
+     * mass fractions. Since the density and heat capacity are held
+     * fixed, as they are when MultiJac evaluates the Jacobian, the
+     * result is the part of the diagonal block of the Jacobian that
+     * depends on the reaction rates.
+     */
+    bool StFlow::evalSourceJacobian(doublereal* xg, int j, 
+        doublereal rtol, doublereal atol, doublereal* jac) {
+        if (j <= 0 || j >= m_points - 1) return false;
+        doublereal* x = xg + loc();
+        int n, i;
+        m_src.resize(2*m_nv);
+        doublereal* src0 = DATA_PTR(m_src);
+        doublereal* src1 = src0 + m_nv;
+        for (n = 0; n < m_nv*m_nv; n++) jac[n] = 0.0;
+        evalSource(x, j, src0);
+        for (n = c_offset_T; n < m_nv; n++) {
+            if (n == c_offset_L) continue;
+            doublereal xsave = x[index(n,j)];
+            doublereal dx = atol + fabs(xsave)*rtol;
+            x[index(n,j)] = xsave + dx;
+            dx = x[index(n,j)] - xsave;
+            evalSource(x, j, src1);
+            x[index(n,j)] = xsave;
+            jac[c_offset_T + m_nv*n] = (src1[c_offset_T] - src0[c_offset_T])/dx;
+            for (i = c_offset_Y; i < m_nv; i++) 
+                jac[i + m_nv*n] = (src1[i] - src0[i])/dx;
+        }
+        // restore the production rates at point j
+        getWdot(x,j);
+        return true;
+    }
+
+
     /**
      * Update the transport properties at grid points in the range
      * from j0 to j1, based on solution x.
      */
     void StFlow::updateTransport(doublereal* x,int j0, int j1) {
+        ScopedPhase sp(profile(), phase_transport);
         int j,k,m;
 
         if (m_transport_option == c_Mixav_Transport) {
@@ -607,24 +677,30 @@ namespace Cantera {
 
                 m_visc[m] = (m_dovisc ? m_trans->viscosity() : 0.0);
 
-                m_trans->getMultiDiffCoeffs(m_nsp, 
-                    DATA_PTR(m_multidiff) + mindex(0,0,m));
+                // the multicomponent diffusion coefficients are
+                // only needed to compute the effective diffusion
+                // coefficients at this point, so the same storage
+                // is used for all points
+                if (!m_do_multiflux) {
+                    m_trans->getMultiDiffCoeffs(m_nsp, 
+                        DATA_PTR(m_multidiff));
 
-                for (k = 0; k < m_nsp; k++) {
-                    sum = 0.0;
-                    sumx = 0.0;
-                    for (j = 0; j < m_nsp; j++) {
-                        if (j != k) {
-                            sum += m_wt[j]*m_multidiff[mindex(k,j,m)]*
-                                   ((X(x,j,m+1) - X(x,j,m))/dz + eps);
-                            sumx += (X(x,j,m+1) - X(x,j,m))/dz;
+                    for (k = 0; k < m_nsp; k++) {
+                        sum = 0.0;
+                        sumx = 0.0;
+                        for (j = 0; j < m_nsp; j++) {
+                            if (j != k) {
+                                sum += m_wt[j]*m_multidiff[m_nsp*j + k]*
+                                       ((X(x,j,m+1) - X(x,j,m))/dz + eps);
+                                sumx += (X(x,j,m+1) - X(x,j,m))/dz;
+                            }
                         }
+                        m_diff[k + m*m_nsp] = sum/(wtm*(sumx+eps));
                     }
-                    m_diff[k + m*m_nsp] = sum/(wtm*(sumx+eps));
                 }
 
                 m_tcon[m] = m_trans->thermalConductivity();
-                if (m_do_soret) {
+                if (m_do_soret && !m_do_multiflux) {
                     m_trans->getThermalDiffCoeffs(m_dthermal.ptrColumn(0) + m*m_nsp);
                 }
             }
@@ -651,6 +727,7 @@ namespace Cantera {
         // the domain of influence for this domain, then skip
         // evaluating the residual
         if (jg >=0 && (jg < firstPoint() - 1 || jg > lastPoint() + 1)) return;
+        ScopedPhase sp(profile(), phase_residual);
 
         // if evaluating a Jacobian, compute the steady-state residual
         if (jg >= 0) rdt = 0.0;
@@ -943,13 +1020,54 @@ namespace Cantera {
      * Update the diffusive mass fluxes.
      */
     void StFlow::updateDiffFluxes(const doublereal* x, int j0, int j1) {
+        ScopedPhase sp(profile(), phase_diffflux);
         int j, k, m;
-        doublereal sum, wtm, rho, dz, gradlogT;
+        doublereal sum, wtm, rho, dz, gradlogT, s0, s1;
 
         switch (m_transport_option) {
 
-        case c_Mixav_Transport:
         case c_Multi_Transport:
+            if (m_do_multiflux) {
+                // exact multicomponent fluxes, with the diffusion
+                // coefficients evaluated at the midpoint of each interval
+                for (j = j0; j < j1; j++) {
+                    setGasAtMidpoint(x,j);
+                    m_trans->getMultiDiffCoeffs(m_nsp, DATA_PTR(m_multidiff));
+                    if (m_do_soret)
+                        m_trans->getThermalDiffCoeffs(m_dthermal.ptrColumn(j));
+                    wtm = m_thermo->meanMolecularWeight();
+                    rho = m_thermo->density();
+                    dz = z(j+1) - z(j);
+
+                    // mole fractions from the mass fractions at both
+                    // points, rather than from m_wtm, which is not
+                    // updated while evaluating the Jacobian. The
+                    // gradients then sum to zero, as the multicomponent
+                    // fluxes require.
+                    s0 = 0.0;
+                    s1 = 0.0;
+                    for (k = 0; k < m_nsp; k++) {
+                        s0 += Y(x,k,j)/m_wt[k];
+                        s1 += Y(x,k,j+1)/m_wt[k];
+                    }
+                    for (k = 0; k < m_nsp; k++)
+                        m_gradx[k] = (Y(x,k,j+1)/s1 - Y(x,k,j)/s0)/dz;
+                    sum = 0.0;
+                    for (k = 0; k < m_nsp; k++) {
+                        doublereal fk = 0.0;
+                        for (m = 0; m < m_nsp; m++) 
+                            fk += m_multidiff[m_nsp*m + k]*m_gradx[m];
+                        m_flux(k,j) = m_wt[k]*rho*fk/(wtm*wtm);
+                        sum -= m_flux(k,j);
+                    }
+                    for (k = 0; k < m_nsp; k++) m_flux(k,j) += sum*Y(x,k,j);
+                }
+                break;
+            }
+            // otherwise, use the effective diffusion coefficients
+            // computed by updateTransport
+
+        case c_Mixav_Transport:
             for (j = j0; j < j1; j++) {
                 sum = 0.0;
                 wtm = m_wtm[j];
@@ -103,11 +103,26 @@ namespace Cantera {
         void enableSoret(bool withSoret);
         bool withSoret() const { return m_do_soret; }
 
+        /**
+         * Evaluate the species diffusive fluxes from the full matrix
+         * of multicomponent diffusion coefficients, evaluated at the
+         * midpoint of each interval, rather than from the default
+         * effective diffusion coefficients. The coefficients are then
+         * recomputed whenever the residual is evaluated, including
+         * during Jacobian evaluation, so this is considerably more
+         * expensive. Requires a multicomponent transport model.
+         */
+        void enableMultiFluxes(bool withFluxes = true);
+        bool withMultiFluxes() const { return m_do_multiflux; }
+
         /// Set the pressure. Since the flow equations are for the limit of
         /// small Mach number, the pressure is very nearly constant
         /// throughout the flow.
         void setPressure(doublereal p) { m_press = p; }
 
+        /// The current pressure [Pa].
+        doublereal pressure() const { return m_press; }
+
 
         /// @todo remove? may be unused
         virtual void setState(int point, const doublereal* state,
@@ -242,6 +257,15 @@ namespace Cantera {
 
 
         void setJac(MultiJac* jac);
+
+        /**
+         * Evaluate the Jacobian of the chemical source terms in the
+         * species and energy equations at interior point j. See
+         * Domain1D::evalSourceJacobian.
+         */
+        virtual bool evalSourceJacobian(doublereal* x, int j, 
+            doublereal rtol, doublereal atol, doublereal* jac);
+
         void setGas(const doublereal* x,int j);
         void setGasAtMidpoint(const doublereal* x,int j);
 
@@ -275,6 +299,7 @@ namespace Cantera {
 
         /// write the net production rates at point j into array m_wdot
         void getWdot(doublereal* x,int j) {
+            ScopedPhase sp(profile(), phase_kinetics);
             setGas(x,j);
             m_kin->getNetProductionRates(&m_wdot(0,j));
         }
@@ -284,6 +309,7 @@ namespace Cantera {
          * j0 to point j1 (inclusive), based on solution x.
          */
         void updateThermo(const doublereal* x, int j0, int j1) {
+            ScopedPhase sp(profile(), phase_thermo);
             int j;
             for (j = j0; j <= j1; j++) {
                 setGas(x,j);
@@ -383,12 +409,10 @@ namespace Cantera {
             return -2.0*(c2/(z(j+1) - z(j)) - c1/(z(j) - z(j-1)))/(z(j+1) - z(j-1));
         }
 
-        int mindex(int k, int j, int m) {
-            return m*m_nsp*m_nsp + m_nsp*j + k;
-        }
-
         void updateDiffFluxes(const doublereal* x, int j0, int j1);
 
+        void evalSource(doublereal* x, int j, doublereal* src);
+
 
         //---------------------------------------------------------
         //
@@ -425,7 +449,9 @@ namespace Cantera {
         vector_fp m_visc;
         vector_fp m_tcon;
         vector_fp m_diff;
-        vector_fp m_multidiff;
+        vector_fp m_multidiff;  // multicomponent coefficients at one point
+        vector_fp m_gradx;      // weighted mole fraction gradients
+        vector_fp m_src;        // chemical source terms at one point
         Array2D m_dthermal;
         Array2D m_flux;
 
@@ -446,6 +472,7 @@ namespace Cantera {
         // flags
         std::vector<bool> m_do_energy;
         bool m_do_soret;
+        bool m_do_multiflux;
         std::vector<bool> m_do_species;
         int m_transport_option;
 
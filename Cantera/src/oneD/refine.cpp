@@ -39,7 +39,8 @@ namespace Cantera {
     
     Refiner::Refiner(Domain1D& domain) :
         m_ratio(10.0), m_slope(0.8), m_curve(0.8), m_prune(-0.001), 
-        m_min_range(0.01), m_domain(&domain), m_npmax(3000)
+        m_min_range(0.01), m_domain(&domain), m_npmax(3000),
+        m_nremove(0)
     {
         m_nv = m_domain->nComponents();
         m_active.resize(m_nv, true);
@@ -63,6 +64,7 @@ namespace Cantera {
         m_loc.clear();
         m_c.clear();
         m_keep.clear();
+        m_nremove = 0;
 
         m_keep[0] = 1;
         m_keep[n-1] = 1;
@@ -125,18 +127,6 @@ namespace Cantera {
                             m_c[name] = 1;
                             //if (int(m_loc.size()) + n > m_npmax) goto done;
                         }
-                        if (r >= m_prune) {
-                            m_keep[j] = 1;
-                            m_keep[j+1] = 1;
-                        }
-                        else {
-                            //writelog(string("r = ")+fp2str(r)+"\n");
-                            if (m_keep[j] == 0) {
-                                //if (m_keep[j-1] > -1 && m_keep[j+1] > -1) 
-                                m_keep[j] = -1;
-                            }
-                            //if (m_keep[j+1] == 0) m_keep[j+1] = -1;
-                        }
                     }
                 }
 
@@ -159,16 +149,6 @@ namespace Cantera {
                             m_loc[j+1] = 1;
                             //if (int(m_loc.size()) + n > m_npmax) goto done;
                         }
-                        if (r >= m_prune) {
-                            m_keep[j+1] = 1;
-                        }
-                        else {
-                            //writelog(string("r slope = ")+fp2str(r)+"\n");
-                            if (m_keep[j+1] == 0) {
-                                //if (m_keep[j] > -1 && m_keep[j+2] > -1) 
-                                m_keep[j+1] = -1;
-                            }
-                        }
                     }
                 }
 
@@ -193,9 +173,90 @@ namespace Cantera {
 
         //done:
         //m_did_analysis = true;
+        if (m_prune > 0.0) coarsen(n, z, x);
         return static_cast<int>(m_loc.size());
     }
 
+
+    /**
+     * Find grid points that are not needed. Point j may be removed
+     * if, for every component that is examined by analyze, the
+     * refinement criteria would still be satisfied to the level
+     * 'prune' on the interval from point j-1 to point j+1 that would
+     * result -- that is, if the difference in value across this
+     * interval is less than prune times the maximum difference
+     * allowed by the slope criterion, and the differences between
+     * its slope and the slopes of the neighboring intervals are less
+     * than prune times the maximum allowed by the curvature
+     * criterion. The new interval must also satisfy the ratio
+     * criterion.
+     *
+     * Since these conditions are checked using the intervals of the
+     * current grid, the points removed must be separated by at least
+     * two points that are kept. Points adjacent to an interval where
+     * a new point is to be inserted, the end points, and the point
+     * where the temperature is fixed in a freely-propagating flame
+     * are never removed.
+     */
+    void Refiner::coarsen(int n, const doublereal* z, const doublereal* x) {
+        if (n < 5) return;
+        int i, j;
+        vector_int ok(n, 1);
+        ok[0] = 0;
+        ok[1] = 0;
+        ok[n-2] = 0;
+        ok[n-1] = 0;
+        for (j = 0; j < n; j++) {
+            if (has_key(m_loc, j)) {
+                ok[j] = 0;
+                if (j < n-1) ok[j+1] = 0;
+            }
+            if (z[j] == m_domain->m_zfixed) ok[j] = 0;
+        }
+
+        vector_fp v(n), s(n-1);
+        doublereal vmin, vmax, smin, smax, aa, ss, dmax, sm;
+        for (i = 0; i < m_nv; i++) {
+            if (!m_active[i]) continue;
+            for (j = 0; j < n; j++) v[j] = value(x, i, j);
+            for (j = 0; j < n-1; j++) s[j] = (v[j+1] - v[j])/(z[j+1] - z[j]);
+            vmin = *min_element(v.begin(), v.end());
+            vmax = *max_element(v.begin(), v.end());
+            smin = *min_element(s.begin(), s.end());
+            smax = *max_element(s.begin(), s.end());
+            aa = fmaxx(fabs(vmax), fabs(vmin));
+            ss = fmaxx(fabs(smax), fabs(smin));
+
+            if ((vmax - vmin) > m_min_range*aa) {
+                dmax = m_prune*(m_slope*(vmax - vmin) + m_thresh);
+                for (j = 2; j < n-2; j++) {
+                    if (fabs(v[j+1] - v[j-1]) > dmax) ok[j] = 0;
+                }
+            }
+            if ((smax - smin) > m_min_range*ss) {
+                dmax = m_prune*m_curve*(smax - smin);
+                for (j = 2; j < n-2; j++) {
+                    sm = (v[j+1] - v[j-1])/(z[j+1] - z[j-1]);
+                    if (fabs(s[j] - s[j-1]) > dmax ||
+                        fabs(sm - s[j-2]) > dmax ||
+                        fabs(s[j+1] - sm) > dmax) ok[j] = 0;
+                }
+            }
+        }
+
+        // remove points, working from left to right
+        doublereal dz;
+        for (j = 2; j < n-2; j++) {
+            if (!ok[j]) continue;
+            dz = z[j+1] - z[j-1];
+            if (dz > m_ratio*(z[j-1] - z[j-2]) ||
+                dz > m_ratio*(z[j+2] - z[j+1])) continue;
+            m_keep[j] = -1;
+            m_nremove++;
+            j += 2;
+        }
+    }
+
     double Refiner::value(const double* x, int i, int j) {
         return x[m_domain->index(i,j)];
     }
@@ -219,12 +280,22 @@ namespace Cantera {
             }
             writelog("\n");
         }
-        else if (m_domain->nPoints() > 1) {
+        else if (m_domain->nPoints() > 1 && m_nremove == 0) {
             writelog("no new points needed in "+m_domain->id()+"\n");
             //writelog("curve = "+fp2str(m_curve)+"\n");
             //writelog("slope = "+fp2str(m_slope)+"\n");
             //writelog("prune = "+fp2str(m_prune)+"\n");
         }
+        if (m_nremove > 0) {
+            if (nnew == 0) r_drawline();
+            writelog("Coarsening grid in " + m_domain->id() +
+                ".\n    Removing grid points ");
+            map<int, int>::const_iterator b = m_keep.begin();
+            for (; b != m_keep.end(); ++b) {
+                if (b->second == -1) writelog(int2str(b->first)+" ");
+            }
+            writelog("\n");
+        }
     }
 
 
@@ -255,4 +326,77 @@ namespace Cantera {
         zn[jn] = z[n-1];
         return 0;
     }    
+
+
+    /**
+     * Compute a new grid of nn points on which the arclength of the
+     * solution is equidistributed. The arclength element on interval
+     * j is 
+     * \f[
+     *    w_j = \sqrt{ \left(\frac{\Delta z_j}{L}\right)^2 + 
+     *      \sum_i \left(\frac{\Delta v_{i,j}}{v_{i,max} - v_{i,min}}\right)^2 },
+     * \f]
+     * where L is the length of the domain and the sum is over the
+     * active components that are examined by analyze. The grid
+     * points of the new grid are placed so that each new interval
+     * has the same arclength, which places points where the
+     * components change rapidly, while the first term keeps the
+     * grid from becoming too coarse where they do not. If the
+     * current grid contains the point where the temperature is fixed
+     * in a freely-propagating flame, the nearest point of the new
+     * grid is moved to this location.
+     */
+    int Refiner::getEquidistributedGrid(int n, const doublereal* z,
+        const doublereal* x, int nn, doublereal* zn) {
+        if (nn < 2 || n < 2) {
+            throw CanteraError("Refiner::getEquidistributedGrid",
+                "at least two grid points are required");
+        }
+        int i, j, k;
+        doublereal len = z[n-1] - z[0];
+        vector_fp w(n-1), v(n), arc(n);
+        for (j = 0; j < n-1; j++) {
+            w[j] = (z[j+1] - z[j])*(z[j+1] - z[j])/(len*len);
+        }
+        doublereal vmin, vmax, aa, dv;
+        for (i = 0; i < m_nv; i++) {
+            if (!m_active[i]) continue;
+            for (j = 0; j < n; j++) v[j] = value(x, i, j);
+            vmin = *min_element(v.begin(), v.end());
+            vmax = *max_element(v.begin(), v.end());
+            aa = fmaxx(fabs(vmax), fabs(vmin));
+            if ((vmax - vmin) <= m_min_range*aa) continue;
+            for (j = 0; j < n-1; j++) {
+                dv = (v[j+1] - v[j])/(vmax - vmin);
+                w[j] += dv*dv;
+            }
+        }
+        arc[0] = 0.0;
+        for (j = 0; j < n-1; j++) arc[j+1] = arc[j] + sqrt(w[j]);
+
+        // invert the piecewise-linear function arc(z)
+        doublereal target;
+        zn[0] = z[0];
+        j = 0;
+        for (k = 1; k < nn-1; k++) {
+            target = arc[n-1]*k/(nn - 1);
+            while (j < n-2 && arc[j+1] < target) j++;
+            zn[k] = z[j] + (z[j+1] - z[j])*(target - arc[j])/
+                    (arc[j+1] - arc[j]);
+        }
+        zn[nn-1] = z[n-1];
+
+        // keep the fixed-temperature point
+        doublereal zf = m_domain->m_zfixed;
+        for (j = 1; j < n-1; j++) {
+            if (z[j] == zf) {
+                if (nn < 3) break;
+                k = static_cast<int>(lower_bound(zn + 1, zn + nn - 1, zf) - zn);
+                if (k == nn - 1 || (k > 1 && zf - zn[k-1] < zn[k] - zf)) k--;
+                zn[k] = zf;
+                break;
+            }
+        }
+        return 0;
+    }
 }
@@ -23,8 +23,17 @@ namespace Cantera {
         void setMaxPoints(int npmax) { m_npmax = npmax; }
         int analyze(int n, const doublereal* z, const doublereal* x);
         int getNewGrid(int n, const doublereal* z, int nn, doublereal* znew);
+
+        /// Compute a grid of nn points that equidistributes the
+        /// arclength of the solution.
+        int getEquidistributedGrid(int n, const doublereal* z, 
+            const doublereal* x, int nn, doublereal* znew);
         //int getNewSoln(int n, const doublereal* x, doublereal* xnew);
         int nNewPoints() { return static_cast<int>(m_loc.size()); }
+
+        /// Number of points marked for removal by the last call to
+        /// analyze. Points are removed only if prune > 0.
+        int nRemovedPoints() { return m_nremove; }
         void show();
         bool newPointNeeded(int j) { 
             return m_loc.find(j) != m_loc.end();
@@ -49,6 +58,9 @@ namespace Cantera {
         Domain1D*            m_domain;
         int                 m_nv, m_npmax;
         doublereal          m_thresh;
+        int                 m_nremove;
+
+        void coarsen(int n, const doublereal* z, const doublereal* x);
 
     };
 
@@ -80,6 +80,13 @@ namespace Cantera {
     CROP_ln_gamma_o_max(3.0),
     CROP_ln_gamma_k_min(-5.0),
     CROP_ln_gamma_k_max(15.0),
+    m_lnActCoeffCurrent(false),
+    m_dlnActCoeffCurrent(false),
+    m_lnActCoeffTemp(-1.0),
+    m_lnActCoeffPres(-1.0),
+    m_lnActCoeffADebye(-1.0),
+    m_lnActCoeffStateNum(-1),
+    m_lnActCoeffpHScale(-1),
     m_debugCalc(0)
   {
     for (int i = 0; i < 17; i++) {
@@ -137,6 +144,13 @@ namespace Cantera {
     CROP_ln_gamma_o_max(3.0),
     CROP_ln_gamma_k_min(-5.0),
     CROP_ln_gamma_k_max(15.0),
+    m_lnActCoeffCurrent(false),
+    m_dlnActCoeffCurrent(false),
+    m_lnActCoeffTemp(-1.0),
+    m_lnActCoeffPres(-1.0),
+    m_lnActCoeffADebye(-1.0),
+    m_lnActCoeffStateNum(-1),
+    m_lnActCoeffpHScale(-1),
     m_debugCalc(0)
   {
     for (int i = 0; i < 17; i++) {
@@ -188,6 +202,13 @@ namespace Cantera {
     CROP_ln_gamma_o_max(3.0),
     CROP_ln_gamma_k_min(-5.0),
     CROP_ln_gamma_k_max(15.0),
+    m_lnActCoeffCurrent(false),
+    m_dlnActCoeffCurrent(false),
+    m_lnActCoeffTemp(-1.0),
+    m_lnActCoeffPres(-1.0),
+    m_lnActCoeffADebye(-1.0),
+    m_lnActCoeffStateNum(-1),
+    m_lnActCoeffpHScale(-1),
     m_debugCalc(0)
   {
     for (int i = 0; i < 17; i++) {
@@ -245,6 +266,13 @@ namespace Cantera {
     CROP_ln_gamma_o_max(3.0),
     CROP_ln_gamma_k_min(-5.0),
     CROP_ln_gamma_k_max(15.0),
+    m_lnActCoeffCurrent(false),
+    m_dlnActCoeffCurrent(false),
+    m_lnActCoeffTemp(-1.0),
+    m_lnActCoeffPres(-1.0),
+    m_lnActCoeffADebye(-1.0),
+    m_lnActCoeffStateNum(-1),
+    m_lnActCoeffpHScale(-1),
     m_debugCalc(0)
   {
     /*
@@ -328,6 +356,8 @@ namespace Cantera {
       m_Psi_ijk_LL          = b.m_Psi_ijk_LL;
       m_Psi_ijk_P           = b.m_Psi_ijk_P;
       m_Psi_ijk_coeff       = b.m_Psi_ijk_coeff;
+      m_PsiRowStart         = b.m_PsiRowStart;
+      m_PsiRowSpecies       = b.m_PsiRowSpecies;
       m_Lambda_nj           = b.m_Lambda_nj;
       m_Lambda_nj_L         = b.m_Lambda_nj_L;
       m_Lambda_nj_LL        = b.m_Lambda_nj_LL;
@@ -405,6 +435,8 @@ namespace Cantera {
       m_CounterIJ           = b.m_CounterIJ;
       m_molalitiesCropped   = b.m_molalitiesCropped;
       m_molalitiesAreCropped= b.m_molalitiesAreCropped;
+      m_lnActCoeffCurrent   = false;
+      m_dlnActCoeffCurrent  = false;
       m_debugCalc           = b.m_debugCalc;
     }
     return *this;
@@ -479,6 +511,13 @@ namespace Cantera {
     CROP_ln_gamma_o_max(3.0),
     CROP_ln_gamma_k_min(-5.0),
     CROP_ln_gamma_k_max(15.0),
+    m_lnActCoeffCurrent(false),
+    m_dlnActCoeffCurrent(false),
+    m_lnActCoeffTemp(-1.0),
+    m_lnActCoeffPres(-1.0),
+    m_lnActCoeffADebye(-1.0),
+    m_lnActCoeffStateNum(-1),
+    m_lnActCoeffpHScale(-1),
     m_debugCalc(0)
   {
     if (testProb != 1) {
@@ -575,6 +614,7 @@ namespace Cantera {
     m_Psi_ijk[n] = param;
     m_Psi_ijk_coeff(0,n) = param;
 
+    psiRows_setup();
     printCoeffs();
   }
 
@@ -1654,6 +1694,8 @@ namespace Cantera {
    */
   void HMWSoln::initLengths() {
     m_kk = nSpecies();
+    m_lnActCoeffCurrent = false;
+    m_dlnActCoeffCurrent = false;
  
     /*
      * Resize lengths equal to the number of species in
@@ -1722,6 +1764,8 @@ namespace Cantera {
     m_Psi_ijk_LL.resize(m_kk*m_kk*m_kk, 0.0);
     m_Psi_ijk_P.resize(m_kk*m_kk*m_kk, 0.0);
     m_Psi_ijk_coeff.resize(TCoeffLength, n, 0.0);
+    m_PsiRowStart.assign(m_kk*m_kk + 1, 0);
+    m_PsiRowSpecies.clear();
 
     m_Lambda_nj.resize(leng, leng, 0.0);
     m_Lambda_nj_L.resize(leng, leng, 0.0);
@@ -1791,6 +1835,25 @@ namespace Cantera {
    *
    */
   void HMWSoln::s_update_lnMolalityActCoeff() const {
+    /*
+     * Nothing to do if the activity coefficients have already been
+     * evaluated at this temperature, pressure, composition and
+     * value of A_Debye. Always recompute when debug printing is
+     * requested, so that every call produces its printout.
+     */
+    double tnow = temperature();
+    double pnow = pressure();
+#ifdef DEBUG_MODE
+    if (m_debugCalc) {
+      m_lnActCoeffCurrent = false;
+    }
+#endif
+    if (m_lnActCoeffCurrent && tnow == m_lnActCoeffTemp &&
+	pnow == m_lnActCoeffPres && m_A_Debye == m_lnActCoeffADebye &&
+	stateMFNumber() == m_lnActCoeffStateNum &&
+	m_pHScalingType == m_lnActCoeffpHScale) {
+      return;
+    }
 
     /*
      * Calculate the molalities. Currently, the molalities
@@ -1875,6 +1938,14 @@ namespace Cantera {
      * Now do the pH Scaling
      */
     s_updateScaling_pHScaling();
+
+    m_lnActCoeffTemp = tnow;
+    m_lnActCoeffPres = pnow;
+    m_lnActCoeffADebye = m_A_Debye;
+    m_lnActCoeffStateNum = stateMFNumber();
+    m_lnActCoeffpHScale = m_pHScalingType;
+    m_lnActCoeffCurrent = true;
+    m_dlnActCoeffCurrent = false;
   }
 
 
@@ -2076,6 +2147,36 @@ namespace Cantera {
     }
   }
 
+  /*
+   * Make the compressed list of the nonzero psi interactions.
+   *
+   * ij = m_kk*i + j 
+   * n = m_kk*ij + m_PsiRowSpecies[p],
+   *        m_PsiRowStart[ij] <= p < m_PsiRowStart[ij+1]
+   */
+  void HMWSoln::psiRows_setup() {
+    int i, j, k, n, ij, l;
+    int nCoeff = static_cast<int>(m_Psi_ijk_coeff.nRows());
+    m_PsiRowStart.assign(m_kk*m_kk + 1, 0);
+    m_PsiRowSpecies.clear();
+    for (i = 0; i < m_kk; i++) {
+      for (j = 0; j < m_kk; j++) {
+	ij = m_kk*i + j;
+	m_PsiRowStart[ij] = static_cast<int>(m_PsiRowSpecies.size());
+	for (k = 0; k < m_kk; k++) {
+	  n = m_kk*ij + k;
+	  for (l = 0; l < nCoeff; l++) {
+	    if (m_Psi_ijk_coeff(l, n) != 0.0) {
+	      m_PsiRowSpecies.push_back(k);
+	      break;
+	    }
+	  }
+	}
+      }
+    }
+    m_PsiRowStart[m_kk*m_kk] = static_cast<int>(m_PsiRowSpecies.size());
+  }
+
   /*
    * Calculates the Pitzer coefficients' dependence on the
    * temperature. It will also calculate the temperature
@@ -2271,6 +2372,7 @@ namespace Cantera {
 	    m_Lambda_nj(i,j)      = Lambda_coeff[0] + Lambda_coeff[1]*tlin;
 	    m_Lambda_nj_L(i,j)    = Lambda_coeff[1];
 	    m_Lambda_nj_LL(i,j)   = 0.0;
+	    break;
 	  case PITZER_TEMP_COMPLEX1:
 	    m_Lambda_nj(i,j) = Lambda_coeff[0] 
 	      + Lambda_coeff[1]*tlin
@@ -2299,6 +2401,7 @@ namespace Cantera {
 	      m_Mu_nnn[i]      = Mu_coeff[0] + Mu_coeff[1]*tlin;
 	      m_Mu_nnn_L[i]    = Mu_coeff[1];
 	      m_Mu_nnn_LL[i]   = 0.0;
+	      break;
 	    case PITZER_TEMP_COMPLEX1:
 	      m_Mu_nnn[i] = Mu_coeff[0] 
 		+ Mu_coeff[1]*tlin
@@ -2322,36 +2425,40 @@ namespace Cantera {
     }
   
 
-    for (i = 1; i < m_kk; i++) {
-      for (j = 1; j < m_kk; j++) {
-	for (int k = 1; k < m_kk; k++) {
-	  n = i * m_kk *m_kk + j * m_kk + k ;
-	  const double *Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-	  switch (m_formPitzerTemp) {
-	  case PITZER_TEMP_CONSTANT:
-	    m_Psi_ijk[n] = Psi_coeff[0];
-	    break;
-	  case PITZER_TEMP_LINEAR:
-	    m_Psi_ijk[n]      = Psi_coeff[0] + Psi_coeff[1]*tlin;
-	    m_Psi_ijk_L[n]    = Psi_coeff[1];
-	    m_Psi_ijk_LL[n]   = 0.0;
-	  case PITZER_TEMP_COMPLEX1:
-	    m_Psi_ijk[n] = Psi_coeff[0] 
-	      + Psi_coeff[1]*tlin
-	      + Psi_coeff[2]*tquad
-	      + Psi_coeff[3]*tinv
-	      + Psi_coeff[4]*tln;
-	    
-	    m_Psi_ijk_L[n] = Psi_coeff[1]
-	      + Psi_coeff[2]*2.0*T
-	      - Psi_coeff[3]/(T*T)
-	      + Psi_coeff[4]/T;
-
-	    m_Psi_ijk_LL[n] = 
-	        Psi_coeff[2]*2.0
-	      + 2.0*Psi_coeff[3]/(T*T*T)
-	      - Psi_coeff[4]/(T*T);
-	  }
+    /*
+     * Only the nonzero psi interactions need to be evaluated.
+     * The others stay at zero.
+     */
+    int ij, p;
+    for (ij = 0; ij < m_kk * m_kk; ij++) {
+      for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	n = ij * m_kk + m_PsiRowSpecies[p];
+	const double *Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
+	switch (m_formPitzerTemp) {
+	case PITZER_TEMP_CONSTANT:
+	  m_Psi_ijk[n] = Psi_coeff[0];
+	  break;
+	case PITZER_TEMP_LINEAR:
+	  m_Psi_ijk[n]      = Psi_coeff[0] + Psi_coeff[1]*tlin;
+	  m_Psi_ijk_L[n]    = Psi_coeff[1];
+	  m_Psi_ijk_LL[n]   = 0.0;
+	  break;
+	case PITZER_TEMP_COMPLEX1:
+	  m_Psi_ijk[n] = Psi_coeff[0] 
+	    + Psi_coeff[1]*tlin
+	    + Psi_coeff[2]*tquad
+	    + Psi_coeff[3]*tinv
+	    + Psi_coeff[4]*tln;
+	  
+	  m_Psi_ijk_L[n] = Psi_coeff[1]
+	    + Psi_coeff[2]*2.0*T
+	    - Psi_coeff[3]/(T*T)
+	    + Psi_coeff[4]/T;
+
+	  m_Psi_ijk_LL[n] = 
+	      Psi_coeff[2]*2.0
+	    + 2.0*Psi_coeff[3]/(T*T*T)
+	    - Psi_coeff[4]/(T*T);
 	}
       }
     }
@@ -2450,7 +2557,11 @@ namespace Cantera {
     double sum_m_phi_minus_1, osmotic_coef, lnwateract;
 
     int z1, z2;
-    int n, i, j, k, m, counterIJ,  counterIJ2;
+    int n, i, j, k, m, counterIJ;
+    int ij, p;
+#ifdef DEBUG_MODE
+    int k2, counterIJ2;
+#endif
 
 #ifdef DEBUG_MODE
     if (m_debugCalc) {
@@ -2556,7 +2667,15 @@ namespace Cantera {
 	    hfunc[counterIJ] = 0.0;
 	  }
 	  
-	  if (beta2MX[counterIJ] != 0.0) {
+	  /*
+	   * g2(x) and h2(x) are also needed by the temperature and
+	   * pressure derivatives, whose beta2MX terms may be nonzero
+	   * even when beta2MX is zero.
+	   */
+	  if (beta2MX[counterIJ] != 0.0 || 
+	      m_Beta2MX_ij_L[counterIJ] != 0.0 ||
+	      m_Beta2MX_ij_LL[counterIJ] != 0.0 ||
+	      m_Beta2MX_ij_P[counterIJ] != 0.0) {
 	    x2 = sqrtIs * alpha2MX[counterIJ];
 	    if (x2 > 1.0E-100) {
 	      g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
@@ -2566,11 +2685,16 @@ namespace Cantera {
 	      g2func[counterIJ] = 0.0;
 	      h2func[counterIJ] = 0.0;
 	    }
+	  } else {
+	    g2func[counterIJ] = 0.0;
+	    h2func[counterIJ] = 0.0;
 	  }
 	} 
 	else {
 	  gfunc[counterIJ] = 0.0;
 	  hfunc[counterIJ] = 0.0;
+	  g2func[counterIJ] = 0.0;
+	  h2func[counterIJ] = 0.0;
 	}
 #ifdef DEBUG_MODE
 	if (m_debugCalc) {
@@ -2806,6 +2930,23 @@ namespace Cantera {
     }
 #endif
 
+    /*
+     * The ternary CMX term of each ion is abs(z_i) times the same
+     * sum over all cation-anion pairs, so it is only formed once.
+     */
+    double sumMMCMX = 0.0;
+    for (j = 1; j < m_kk; j++) {
+      if (charge[j] > 0.0) {
+	for (k = 1; k < m_kk; k++) {
+	  if (charge[k] < 0.0) {
+	    n = m_kk*j + k;
+	    counterIJ = m_CounterIJ[n];
+	    sumMMCMX += molality[j]*molality[k]*CMX[counterIJ];
+	  }
+	}
+      }
+    }
+
     for (i = 1; i < m_kk; i++) {
 
       /*
@@ -2831,7 +2972,7 @@ namespace Cantera {
 	sum1 = 0.0;
 	sum2 = 0.0;
 	sum3 = 0.0;
-	sum4 = 0.0;
+	sum4 = fabs(charge[i]) * sumMMCMX;
 	sum5 = 0.0;
 	for (j = 1; j < m_kk; j++) {
 	  /*
@@ -2839,6 +2980,7 @@ namespace Cantera {
 	   */
 	  n = m_kk*i + j;
 	  counterIJ = m_CounterIJ[n];
+	  ij = n;
 
 	  if (charge[j] < 0.0) {
 	    // sum over all anions
@@ -2853,27 +2995,26 @@ namespace Cantera {
 		     molality[j]* molarcharge*CMX[counterIJ]);
 	    }
 #endif
-	    if (j < m_kk-1) {
-	      /*
-	       * This term is the ternary interaction involving the 
-	       * non-duplicate sum over double anions, j, k, with
-	       * respect to the cation, i.
-	       */
-	      for (k = j+1; k < m_kk; k++) {
-		// an inner sum over all anions
-		if (charge[k] < 0.0) {
-		  n = k + j * m_kk + i * m_kk * m_kk;
-		  sum3 = sum3 + molality[j]*molality[k]*psi_ijk[n];
+	    /*
+	     * This term is the ternary interaction involving the 
+	     * non-duplicate sum over double anions, j, k, with
+	     * respect to the cation, i.
+	     */
+	    for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	      k = m_PsiRowSpecies[p];
+	      // an inner sum over all anions
+	      if (k > j && charge[k] < 0.0) {
+		n = k + ij * m_kk;
+		sum3 = sum3 + molality[j]*molality[k]*psi_ijk[n];
 #ifdef DEBUG_MODE
-		  if (m_debugCalc) {
-		    if (psi_ijk[n] != 0.0) {
-		      snj = speciesName(j) + "," + speciesName(k) + ":";
-		      printf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj.c_str(),
-			     molality[j]*molality[k]*psi_ijk[n]);
-		    }
+		if (m_debugCalc) {
+		  if (psi_ijk[n] != 0.0) {
+		    snj = speciesName(j) + "," + speciesName(k) + ":";
+		    printf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj.c_str(),
+			   molality[j]*molality[k]*psi_ijk[n]);
 		  }
-#endif
 		}
+#endif
 	      }
 	    }
 	  }
@@ -2893,39 +3034,42 @@ namespace Cantera {
 	      }
 #endif
 	    }
-	    for (k = 1; k < m_kk; k++) {
+	    for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	      k = m_PsiRowSpecies[p];
 	      if (charge[k] < 0.0) {
 		// two inner sums over anions
-
-		n = k + j * m_kk + i * m_kk * m_kk;
+		n = k + ij * m_kk;
 		sum2 = sum2 + molality[j]*molality[k]*psi_ijk[n];
+	      }
+	    }
 #ifdef DEBUG_MODE
-		if (m_debugCalc) {
+	    /*
+	     * The ternary CMX term is in sum4 already; here it is only
+	     * printed, together with the psi terms.
+	     */
+	    if (m_debugCalc) {
+	      for (k2 = 1; k2 < m_kk; k2++) {
+		if (charge[k2] < 0.0) {
+		  n = k2 + ij * m_kk;
 		  if (psi_ijk[n] != 0.0) {
-		    snj = speciesName(j) + "," + speciesName(k) + ":";
+		    snj = speciesName(j) + "," + speciesName(k2) + ":";
 		    printf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj.c_str(),
-			   molality[j]*molality[k]*psi_ijk[n]);
+			   molality[j]*molality[k2]*psi_ijk[n]);
 		  }
-		}
-#endif
-		/*
-		 * Find the counterIJ for the j,k interaction
-		 */
-		n = m_kk*j + k;
-		counterIJ2 = m_CounterIJ[n];
-		sum4 = sum4 + (fabs(charge[i])*
-			       molality[j]*molality[k]*CMX[counterIJ2]);
-#ifdef DEBUG_MODE
-		if (m_debugCalc) {
-		  if ((molality[j]*molality[k]*CMX[counterIJ2]) != 0.0) {
-		    snj = speciesName(j) + "," + speciesName(k) + ":";
+		  /*
+		   * Find the counterIJ for the j,k interaction
+		   */
+		  n = m_kk*j + k2;
+		  counterIJ2 = m_CounterIJ[n];
+		  if ((molality[j]*molality[k2]*CMX[counterIJ2]) != 0.0) {
+		    snj = speciesName(j) + "," + speciesName(k2) + ":";
 		    printf("      Tern CMX term on %-16s abs(z_i) m_j m_k CMX = %10.5f\n", snj.c_str(),
-			   fabs(charge[i])* molality[j]*molality[k]*CMX[counterIJ2]);
+			   fabs(charge[i])* molality[j]*molality[k2]*CMX[counterIJ2]);
 		  }
 		}
-#endif
 	      }
 	    }
+#endif
 	  }
 
 	  /*
@@ -2945,11 +3089,13 @@ namespace Cantera {
 	    /*
 	     * Zeta interaction term
 	     */
-	    for (int k = 1; k < m_kk; k++) {
+	    int izeta = j;
+	    int jzeta = i;
+	    int ijzeta = izeta * m_kk + jzeta;
+	    for (p = m_PsiRowStart[ijzeta]; p < m_PsiRowStart[ijzeta+1]; p++) {
+	      k = m_PsiRowSpecies[p];
 	      if (charge[k] < 0.0) {
-		int izeta = j;
-		int jzeta = i;
-		n = izeta * m_kk * m_kk + jzeta * m_kk + k;
+		n = ijzeta * m_kk + k;
 		double zeta = psi_ijk[n];
 		if (zeta != 0.0) {
 		  sum5 = sum5 + molality[j]*molality[k]*zeta;
@@ -3004,7 +3150,7 @@ namespace Cantera {
 	sum1 = 0.0;
 	sum2 = 0.0;
 	sum3 = 0.0;
-	sum4 = 0.0;
+	sum4 = fabs(charge[i]) * sumMMCMX;
 	sum5 = 0.0;
 	for (j = 1; j < m_kk; j++) {
 	  /*
@@ -3012,6 +3158,7 @@ namespace Cantera {
 	   */
 	  n = m_kk*i + j;
 	  counterIJ = m_CounterIJ[n];
+	  ij = n;
 
 	  /*
 	   * For Anions, do the cation interactions.
@@ -3028,22 +3175,21 @@ namespace Cantera {
 		     molality[j]* molarcharge*CMX[counterIJ]);
 	    }
 #endif
-	    if (j < m_kk-1) {
-	      for (k = j+1; k < m_kk; k++) {
-		// an inner sum over all cations
-		if (charge[k] > 0) {
-		  n = k + j * m_kk + i * m_kk * m_kk;
-		  sum3 = sum3 + molality[j]*molality[k]*psi_ijk[n];
+	    for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	      k = m_PsiRowSpecies[p];
+	      // an inner sum over all cations
+	      if (k > j && charge[k] > 0) {
+		n = k + ij * m_kk;
+		sum3 = sum3 + molality[j]*molality[k]*psi_ijk[n];
 #ifdef DEBUG_MODE
-		  if (m_debugCalc) {
-		    if (psi_ijk[n] != 0.0) {
-		      snj = speciesName(j) + "," + speciesName(k) + ":";
-		      printf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj.c_str(),
-			     molality[j]*molality[k]*psi_ijk[n]);
-		    }
+		if (m_debugCalc) {
+		  if (psi_ijk[n] != 0.0) {
+		    snj = speciesName(j) + "," + speciesName(k) + ":";
+		    printf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj.c_str(),
+			   molality[j]*molality[k]*psi_ijk[n]);
 		  }
-#endif
 		}
+#endif
 	      }
 	    }
 	  }
@@ -3065,39 +3211,38 @@ namespace Cantera {
 	      }
 #endif
 	    }
-	    for (k = 1; k < m_kk; k++) {
+	    for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	      k = m_PsiRowSpecies[p];
 	      if (charge[k] > 0.0) {
 		// two inner sums over cations
-		n = k + j * m_kk + i * m_kk * m_kk;
+		n = k + ij * m_kk;
 		sum2 = sum2 + molality[j]*molality[k]*psi_ijk[n];
+	      }
+	    }
 #ifdef DEBUG_MODE
-		if (m_debugCalc) {
+	    if (m_debugCalc) {
+	      for (k2 = 1; k2 < m_kk; k2++) {
+		if (charge[k2] > 0.0) {
+		  n = k2 + ij * m_kk;
 		  if (psi_ijk[n] != 0.0) {
-		    snj = speciesName(j) + "," + speciesName(k) + ":";
+		    snj = speciesName(j) + "," + speciesName(k2) + ":";
 		    printf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj.c_str(),
-			   molality[j]*molality[k]*psi_ijk[n]);
+			   molality[j]*molality[k2]*psi_ijk[n]);
 		  }
-		}
-#endif
-		/*
-		 * Find the counterIJ for the symmetric binary interaction
-		 */
-		n = m_kk*j + k;
-		counterIJ2 = m_CounterIJ[n];
-		sum4 = sum4 + 
-		  (fabs(charge[i])*
-		   molality[j]*molality[k]*CMX[counterIJ2]);
-#ifdef DEBUG_MODE
-		if (m_debugCalc) {
-		  if ((molality[j]*molality[k]*CMX[counterIJ2]) != 0.0) {
-		    snj = speciesName(j) + "," + speciesName(k) + ":";
+		  /*
+		   * Find the counterIJ for the symmetric binary interaction
+		   */
+		  n = m_kk*j + k2;
+		  counterIJ2 = m_CounterIJ[n];
+		  if ((molality[j]*molality[k2]*CMX[counterIJ2]) != 0.0) {
+		    snj = speciesName(j) + "," + speciesName(k2) + ":";
 		    printf("      Tern CMX term on %-16s abs(z_i) m_j m_k CMX = %10.5f\n", snj.c_str(),
-			   fabs(charge[i])* molality[j]*molality[k]*CMX[counterIJ2]);
+			   fabs(charge[i])* molality[j]*molality[k2]*CMX[counterIJ2]);
 		  }
 		}
-#endif
 	      }
 	    }
+#endif
 	  }
 
 	  /*
@@ -3178,9 +3323,11 @@ namespace Cantera {
 	   * Zeta term -> we piggyback on the psi term
 	   */
 	  if (charge[j] > 0.0) {
-	    for (k = 1; k < m_kk; k++) {
+	    ij = m_kk*i + j;
+	    for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	      k = m_PsiRowSpecies[p];
 	      if (charge[k] < 0.0) {
-		n = k + j * m_kk + i * m_kk * m_kk;
+		n = k + ij * m_kk;
 		sum3 = sum3 + molality[j]*molality[k]*psi_ijk[n];
 #ifdef DEBUG_MODE
 		if (m_debugCalc) {
@@ -3275,10 +3422,12 @@ namespace Cantera {
 	    n = m_kk*j + k;
 	    counterIJ = m_CounterIJ[n];
 	    sum2 = sum2 + molality[j]*molality[k]*Phiphi[counterIJ];
-	    for (m = 1; m < m_kk; m++) {
+	    ij = m_kk*j + k;
+	    for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	      m = m_PsiRowSpecies[p];
 	      if (charge[m] < 0.0) {
 		// species m is an anion
-		n = m + k * m_kk + j * m_kk * m_kk;
+		n = m + ij * m_kk;
 		sum2 = sum2 + 
 		  molality[j]*molality[k]*molality[m]*psi_ijk[n];
 	      }
@@ -3306,9 +3455,11 @@ namespace Cantera {
 	    counterIJ = m_CounterIJ[n];
 
 	    sum3 = sum3 + molality[j]*molality[k]*Phiphi[counterIJ];
-	    for (m = 1; m < m_kk; m++) {
+	    ij = m_kk*j + k;
+	    for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	      m = m_PsiRowSpecies[p];
 	      if (charge[m] > 0.0) {
-		n = m + k * m_kk + j * m_kk * m_kk;
+		n = m + ij * m_kk;
 		sum3 = sum3 + 
 		  molality[j]*molality[k]*molality[m]*psi_ijk[n];
 	      }
@@ -3335,12 +3486,19 @@ namespace Cantera {
 	      sum6 = sum6 + 0.5 * molality[j]*molality[k]*m_Lambda_nj(j,k);
 	    }
 	  }
-	  if (charge[k] < 0.0) {
-	    int izeta = j;
-	    for (m = 1; m < m_kk; m++) {
-	      if (charge[m] > 0.0) {
-		int jzeta = m;
-		n = k + jzeta * m_kk + izeta * m_kk * m_kk;
+	}
+	/*
+	 * Zeta terms for the neutral j, cation m, anion k triplets
+	 */
+	int izeta = j;
+	for (m = 1; m < m_kk; m++) {
+	  if (charge[m] > 0.0) {
+	    int jzeta = m;
+	    ij = izeta * m_kk + jzeta;
+	    for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	      k = m_PsiRowSpecies[p];
+	      if (charge[k] < 0.0) {
+		n = k + ij * m_kk;
 		double zeta = psi_ijk[n];
 		if (zeta != 0.0) {
 		  sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta;
@@ -3405,136 +3563,205 @@ namespace Cantera {
 #endif
   }
 
-  /**
-   * s_update_dlnMolalityActCoeff_dT()         (private, const )
+  /*
+   * s_update_dlnMolalityActCoeff_TP()         (private, const )
    *
    *   Using internally stored values, this function calculates
-   *   the temperature derivative of the logarithm of the
-   *   activity coefficient for all species in the mechanism.
+   *   the first and second temperature derivatives and the
+   *   pressure derivative of the logarithm of the
+   *   activity coefficient for all species in the mechanism,
+   *   in one pass.
    *
    *   We assume that the activity coefficients are current.
+   *   The result is kept until s_update_lnMolalityActCoeff()
+   *   evaluates the activity coefficients at a new state.
    *
    *   solvent activity coefficient is on the molality
-   *   scale. It's derivative is too.
+   *   scale. It's derivatives are too.
    */
-  void HMWSoln::s_update_dlnMolalityActCoeff_dT() const {
+  void HMWSoln::s_update_dlnMolalityActCoeff_TP() const {
+    if (m_dlnActCoeffCurrent) {
+      return;
+    }
     /*
-     *  Zero the unscaled 2nd derivatives
+     *  Zero the unscaled derivatives
      */
     fbo_zero_dbl_1(DATA_PTR(m_dlnActCoeffMolaldT_Unscaled), m_kk);
+    fbo_zero_dbl_1(DATA_PTR(m_d2lnActCoeffMolaldT2_Unscaled), m_kk);
+    fbo_zero_dbl_1(DATA_PTR(m_dlnActCoeffMolaldP_Unscaled), m_kk);
     /*
-     *  Do the actual calculation of the unscaled temperature derivatives
+     *  Do the actual calculation of the unscaled derivatives
      */
-    s_updatePitzer_dlnMolalityActCoeff_dT();
-
-    //double xmolSolvent = moleFraction(m_indexSolvent);
-    //double xx = MAX(m_xmolSolventMIN, xmolSolvent);
-    //    double lnxs = log(xx);
+    s_updatePitzer_dlnMolalityActCoeff_TP();
 
+    /*
+     * Species in the cropped regime have no temperature or
+     * pressure dependence.
+     */
     for (int k = 1; k < m_kk; k++) {
       if (CROP_speciesCropped_[k] == 2) {
 	m_dlnActCoeffMolaldT_Unscaled[k] = 0.0;
+	m_d2lnActCoeffMolaldT2_Unscaled[k] = 0.0;
+	m_dlnActCoeffMolaldP_Unscaled[k] = 0.0;
       }
     }
 
     if (CROP_speciesCropped_[0]) {
       m_dlnActCoeffMolaldT_Unscaled[0] = 0.0;
+      m_d2lnActCoeffMolaldT2_Unscaled[0] = 0.0;
+      m_dlnActCoeffMolaldP_Unscaled[0] = 0.0;
     }
 
     /*
-     *  Do the pH scaling to the derivatives 
+     *  Do the pH scaling to the derivatives
      */
     s_updateScaling_pHScaling_dT();
+    s_updateScaling_pHScaling_dT2();
+    s_updateScaling_pHScaling_dP();
+
+    m_dlnActCoeffCurrent = true;
+  }
+
+  /*
+   * s_update_dlnMolalityActCoeff_dT()         (private, const )
+   *
+   *   Using internally stored values, this function calculates
+   *   the temperature derivative of the logarithm of the
+   *   activity coefficient for all species in the mechanism.
+   *
+   *   We assume that the activity coefficients are current.
+   *
+   *   solvent activity coefficient is on the molality
+   *   scale. It's derivative is too.
+   */
+  void HMWSoln::s_update_dlnMolalityActCoeff_dT() const {
+    s_update_dlnMolalityActCoeff_TP();
+  }
 
+  /*
+   * This function calculates the temperature second derivative
+   * of the natural logarithm of the molality activity
+   * coefficients.
+   */
+  void HMWSoln::s_update_d2lnMolalityActCoeff_dT2() const {
+    s_update_dlnMolalityActCoeff_TP();
+  }
 
+  /*
+   * s_update_dlnMolalityActCoeff_dP()         (private, const )
+   *
+   *   Using internally stored values, this function calculates
+   *   the pressure derivative of the logarithm of the
+   *   activity coefficient for all species in the mechanism.
+   *
+   *   We assume that the activity coefficients are current.
+   *
+   *   solvent activity coefficient is on the molality
+   *   scale. It's derivative is too.
+   */
+  void HMWSoln::s_update_dlnMolalityActCoeff_dP() const {
+    s_update_dlnMolalityActCoeff_TP();
   }
 
   /*************************************************************************************/
 
   /*
-   * Calculate the Pitzer portion of the temperature
-   * derivative of the log activity coefficients.
-   * This is an internal routine.
+   * s_updatePitzer_dlnMolalityActCoeff_TP()         (private, const )
+   *
+   *   Calculate the Pitzer portion of the first and second temperature
+   *   derivatives and of the pressure derivative of the log
+   *   activity coefficients. This is an internal routine.
    *
-   * It may be assumed that the 
-   * Pitzer activity coefficient routine is called immediately
-   * preceding the calling of this routine. Therefore, some
-   * quantities do not need to be recalculated in this routine.
+   *   The three derivatives share everything except for the
+   *   derivatives of the Pitzer coefficients and of A_Debye, so
+   *   the binary and ternary interaction sums are walked once and
+   *   the three derivatives are accumulated side by side. Index d
+   *   of the local arrays below is 0 for d/dT, 1 for d2/dT2 and
+   *   2 for d/dP.
    *
+   *   It is assumed that s_updatePitzer_lnMolalityActCoeff() has been
+   *   called immediately preceding this routine. Its values of the
+   *   functions g(x), h(x), g2(x) and h2(x) of the ionic strength are
+   *   reused here. The E-theta terms do not contribute to the
+   *   derivatives, so calc_lambdas() and calc_thetas() are not needed.
+   *
+   *   solvent activity coefficient is on the molality
+   *   scale. It's derivatives are too.
    */
-  void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const {
+  void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_TP() const {
 
     /*
      * HKM -> Assumption is made that the solvent is
      *        species 0.
      */
-#ifdef DEBUG_MODE
-    m_debugCalc = 0;
-#endif
     if (m_indexSolvent != 0) {
       printf("Wrong index solvent value!\n");
       exit(EXIT_FAILURE);
     }
 
-    double d_wateract_dT;
-    std::string sni, snj, snk; 
-
     const double *molality  =  DATA_PTR(m_molalitiesCropped);
     const double *charge    =  DATA_PTR(m_speciesCharge);
-    const double *beta0MX_L =  DATA_PTR(m_Beta0MX_ij_L);
-    const double *beta1MX_L =  DATA_PTR(m_Beta1MX_ij_L);
-    const double *beta2MX_L =  DATA_PTR(m_Beta2MX_ij_L);
-    const double *CphiMX_L  =  DATA_PTR(m_CphiMX_ij_L);
-    const double *thetaij_L =  DATA_PTR(m_Theta_ij_L);
-    const double *alpha1MX   =  DATA_PTR(m_Alpha1MX_ij);
-    const double *alpha2MX   =  DATA_PTR(m_Alpha2MX_ij);
-    const double *psi_ijk_L =  DATA_PTR(m_Psi_ijk_L);
-    double *d_gamma_dT_Unscaled   =  DATA_PTR(m_gamma_tmp);
-    /*
-     * Local variables defined by Coltrin
-     */
-    double etheta[5][5], etheta_prime[5][5], sqrtIs;
+    const double *gfunc     =  DATA_PTR(m_gfunc_IJ);
+    const double *g2func    =  DATA_PTR(m_g2func_IJ);
+    const double *hfunc     =  DATA_PTR(m_hfunc_IJ);
+    const double *h2func    =  DATA_PTR(m_h2func_IJ);
+
     /*
-     * Molality based ionic strength of the solution
+     * Derivatives of the Pitzer coefficients
      */
-    double Is = 0.0;
+    const double *beta0MX[3] = { DATA_PTR(m_Beta0MX_ij_L),
+				 DATA_PTR(m_Beta0MX_ij_LL),
+				 DATA_PTR(m_Beta0MX_ij_P) };
+    const double *beta1MX[3] = { DATA_PTR(m_Beta1MX_ij_L),
+				 DATA_PTR(m_Beta1MX_ij_LL),
+				 DATA_PTR(m_Beta1MX_ij_P) };
+    const double *beta2MX[3] = { DATA_PTR(m_Beta2MX_ij_L),
+				 DATA_PTR(m_Beta2MX_ij_LL),
+				 DATA_PTR(m_Beta2MX_ij_P) };
+    const double *CphiMX[3]  = { DATA_PTR(m_CphiMX_ij_L),
+				 DATA_PTR(m_CphiMX_ij_LL),
+				 DATA_PTR(m_CphiMX_ij_P) };
+    const double *thetaij[3] = { DATA_PTR(m_Theta_ij_L),
+				 DATA_PTR(m_Theta_ij_LL),
+				 DATA_PTR(m_Theta_ij_P) };
+    const double *psi_ijk[3] = { DATA_PTR(m_Psi_ijk_L),
+				 DATA_PTR(m_Psi_ijk_LL),
+				 DATA_PTR(m_Psi_ijk_P) };
+    const double *mu_nnn[3]  = { DATA_PTR(m_Mu_nnn_L),
+				 DATA_PTR(m_Mu_nnn_LL),
+				 DATA_PTR(m_Mu_nnn_P) };
+    const Array2D *lambda_nj[3] = { &m_Lambda_nj_L, &m_Lambda_nj_LL,
+				    &m_Lambda_nj_P };
+
     /*
-     * Molarcharge of the solution: In Pitzer's notation, 
-     * this is his variable called "Z".
+     * Derivatives of the intermediate quantities
      */
-    double molarcharge = 0.0;
+    double *BMX[3]      = { DATA_PTR(m_BMX_IJ_L), DATA_PTR(m_BMX_IJ_LL),
+			    DATA_PTR(m_BMX_IJ_P) };
+    double *BprimeMX[3] = { DATA_PTR(m_BprimeMX_IJ_L),
+			    DATA_PTR(m_BprimeMX_IJ_LL),
+			    DATA_PTR(m_BprimeMX_IJ_P) };
+    double *BphiMX[3]   = { DATA_PTR(m_BphiMX_IJ_L), DATA_PTR(m_BphiMX_IJ_LL),
+			    DATA_PTR(m_BphiMX_IJ_P) };
+    double *Phi[3]      = { DATA_PTR(m_Phi_IJ_L), DATA_PTR(m_Phi_IJ_LL),
+			    DATA_PTR(m_Phi_IJ_P) };
+    double *Phiphi[3]   = { DATA_PTR(m_PhiPhi_IJ_L), DATA_PTR(m_PhiPhi_IJ_LL),
+			    DATA_PTR(m_PhiPhi_IJ_P) };
+    double *CMX[3]      = { DATA_PTR(m_CMX_IJ_L), DATA_PTR(m_CMX_IJ_LL),
+			    DATA_PTR(m_CMX_IJ_P) };
+
     /*
-     * molalitysum is the sum of the molalities over all solutes,
-     * even those with zero charge.
+     * Output arrays
      */
-    double molalitysum = 0.0;
-
-    double *gfunc    =  DATA_PTR(m_gfunc_IJ);
-    double *g2func   =  DATA_PTR(m_g2func_IJ);
-    double *hfunc    =  DATA_PTR(m_hfunc_IJ);
-    double *h2func   =  DATA_PTR(m_h2func_IJ);
-    double *BMX_L    =  DATA_PTR(m_BMX_IJ_L);
-    double *BprimeMX_L= DATA_PTR(m_BprimeMX_IJ_L);
-    double *BphiMX_L =  DATA_PTR(m_BphiMX_IJ_L);
-    double *Phi_L    =  DATA_PTR(m_Phi_IJ_L);
-    double *Phiprime =  DATA_PTR(m_Phiprime_IJ);
-    double *Phiphi_L =  DATA_PTR(m_PhiPhi_IJ_L);
-    double *CMX_L    =  DATA_PTR(m_CMX_IJ_L);
-
-    double x1, x2;
-    double Aphi, dFdT, zsqdFdT;
-    double sum1, sum2, sum3, sum4, sum5, term1;
-    double sum_m_phi_minus_1, d_osmotic_coef_dT, d_lnwateract_dT;
+    double *dlnActCoeff[3] = { DATA_PTR(m_dlnActCoeffMolaldT_Unscaled),
+			       DATA_PTR(m_d2lnActCoeffMolaldT2_Unscaled),
+			       DATA_PTR(m_dlnActCoeffMolaldP_Unscaled) };
 
-    int z1, z2;
-    int n, i, j, k, m, counterIJ,  counterIJ2;
+    double dAphi[3], dF[3], sum1[3], sum2[3], sum3[3], sum4[3], sum5[3];
+    double sum6[3], sum7[3], term1[3], sumMMCMX[3];
+    double mm, zeta, sum_m_phi_minus_1, d_osmotic_coef;
+    int d, n, i, j, k, m, counterIJ, ij, p;
 
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf("\n Debugging information from "
-	     "s_Pitzer_dlnMolalityActCoeff_dT()\n");
-    }
-#endif
     /*
      * Make sure the counter variables are setup
      */
@@ -3543,2170 +3770,206 @@ namespace Cantera {
     /*
      * ---------- Calculate common sums over solutes ---------------------
      */
+    double Is = 0.0;
+    double molarcharge = 0.0;
+    double molalitysum = 0.0;
     for (n = 1; n < m_kk; n++) {
-      //      ionic strength
       Is += charge[n] * charge[n] * molality[n];
-      //      total molar charge
       molarcharge +=  fabs(charge[n]) * molality[n];
       molalitysum += molality[n];
     }
     Is *= 0.5;
- 
+    double sqrtIs = sqrt(Is);
+
     /*
-     * Store the ionic molality in the object for reference.
+     * ------- SUBSECTION TO CALCULATE BMX, BprimeMX, BphiMX, CMX, -------
+     * ------- Phi and Phiphi derivatives, for all pairs
      */
-    m_IionicMolality = Is;
-    sqrtIs = sqrt(Is);
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 1: \n");
-      printf(" ionic strenth      = %14.7le \n total molar "
-	     "charge = %14.7le \n", Is, molarcharge);
+    for (i = 1; i < m_kk - 1; i++) {
+      for (j = i+1; j < m_kk; j++) {
+	/*
+	 * Find the counterIJ for the symmetric binary interaction
+	 */
+	n = m_kk*i + j;
+	counterIJ = m_CounterIJ[n];
+	/*
+	 * 	both species have a non-zero charge, and one is positive
+	 *  and the other is negative
+	 */
+	if (charge[i]*charge[j] < 0.0) {
+	  double cfac = 2.0 * sqrt(fabs(charge[i]*charge[j]));
+	  for (d = 0; d < 3; d++) {
+	    BMX[d][counterIJ] = beta0MX[d][counterIJ]
+	      + beta1MX[d][counterIJ] * gfunc[counterIJ]
+	      + beta2MX[d][counterIJ] * g2func[counterIJ];
+	    if (Is > 1.0E-150) {
+	      BprimeMX[d][counterIJ] = (beta1MX[d][counterIJ] * hfunc[counterIJ]/Is +
+					beta2MX[d][counterIJ] * h2func[counterIJ]/Is);
+	    } else {
+	      BprimeMX[d][counterIJ] = 0.0;
+	    }
+	    BphiMX[d][counterIJ] = BMX[d][counterIJ] + Is*BprimeMX[d][counterIJ];
+	    CMX[d][counterIJ] = CphiMX[d][counterIJ] / cfac;
+	    Phi[d][counterIJ] = 0.0;
+	    Phiphi[d][counterIJ] = 0.0;
+	  }
+	}
+	/*
+	 * Both species have a non-zero charge, and they
+	 * have the same sign. The E-theta terms do not depend
+	 * on temperature or pressure.
+	 */
+	else if (charge[i]*charge[j] > 0) {
+	  for (d = 0; d < 3; d++) {
+	    BMX[d][counterIJ] = 0.0;
+	    BprimeMX[d][counterIJ] = 0.0;
+	    BphiMX[d][counterIJ] = 0.0;
+	    CMX[d][counterIJ] = 0.0;
+	    Phi[d][counterIJ] = thetaij[d][counterIJ];
+	    Phiphi[d][counterIJ] = Phi[d][counterIJ];
+	  }
+	}
+	else {
+	  for (d = 0; d < 3; d++) {
+	    BMX[d][counterIJ] = 0.0;
+	    BprimeMX[d][counterIJ] = 0.0;
+	    BphiMX[d][counterIJ] = 0.0;
+	    CMX[d][counterIJ] = 0.0;
+	    Phi[d][counterIJ] = 0.0;
+	    Phiphi[d][counterIJ] = 0.0;
+	  }
+	}
+      }
     }
-#endif
 
     /*
-     * The following call to calc_lambdas() calculates all 16 elements
-     * of the elambda and elambda1 arrays, given the value of the 
-     * ionic strength (Is)
-     */
-    calc_lambdas(Is);
-
-    /*
-     * ----- Step 2:  Find the coefficients E-theta and -------------------
-     *                E-thetaprime for all combinations of positive 
-     *                unlike charges up to 4
-     */
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 2: \n");
-    }
-#endif
-    for (z1 = 1; z1 <=4; z1++) {
-      for (z2 =1; z2 <=4; z2++) {
-	calc_thetas(z1, z2, &etheta[z1][z2], &etheta_prime[z1][z2]);
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  printf(" z1=%3d z2=%3d E-theta(I) = %f, E-thetaprime(I) = %f\n", 
-		 z1, z2, etheta[z1][z2], etheta_prime[z1][z2]);
-	}
-#endif
-      }
-    }
-
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 3: \n");
-      printf(" Species          Species            g(x) "
-	     " hfunc(x)   \n");
-    }
-#endif
-	
-    /*
-     *
-     *  calculate g(x) and hfunc(x) for each cation-anion pair MX
-     *   In the original literature, hfunc, was called gprime. However,
-     *   it's not the derivative of g(x), so I renamed it.
-     */
-    for (i = 1; i < (m_kk - 1); i++) {
-      for (j = (i+1); j < m_kk; j++) {
-	/*
-	 * Find the counterIJ for the symmetric binary interaction
-	 */
-	n = m_kk*i + j;
-	counterIJ = m_CounterIJ[n];
-	/*
-	 * Only loop over oppositely charge species
-	 */
-	if (charge[i]*charge[j] < 0) {
-	  /*
-	   * x is a reduced function variable
-	   */
-	  x1 = sqrtIs * alpha1MX[counterIJ];
-	  if (x1 > 1.0E-100) {
-	    gfunc[counterIJ]     =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-	    hfunc[counterIJ] = -2.0 *
-	      (1.0-(1.0 + x1 + 0.5 * x1 *x1) * exp(-x1)) / (x1 * x1);
-	  }
-	  else {
-	    gfunc[counterIJ] = 0.0;
-	    hfunc[counterIJ] = 0.0;
-	  }
-	  
-	  if (beta2MX_L[counterIJ] != 0.0) {
-	    x2 = sqrtIs * alpha2MX[counterIJ];
-	    if (x2 > 1.0E-100) {
-	      g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-	      h2func[counterIJ] = -2.0 *
-		(1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-	    } else {
-	      g2func[counterIJ] = 0.0;
-	      h2func[counterIJ] = 0.0;
-	    }
-	  }
-	} 
-	else {
-	  gfunc[counterIJ] = 0.0;
-	  hfunc[counterIJ] = 0.0;
-	}
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  snj = speciesName(j);
-	  printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(), 
-		 gfunc[counterIJ], hfunc[counterIJ]);
-	}
-#endif
-      }
-    }
-
-    /*
-     * ------- SUBSECTION TO CALCULATE BMX_L, BprimeMX_L, BphiMX_L ----------
-     * ------- These are now temperature derivatives of the
-     *         previously calculated quantities.
-     */
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 4: \n");
-      printf(" Species          Species            BMX    "
-	     "BprimeMX    BphiMX   \n");
-    }
-#endif
-
-    for (i = 1; i < m_kk - 1; i++) {
-      for (j = i+1; j < m_kk; j++) {
-	/*
-	 * Find the counterIJ for the symmetric binary interaction
-	 */
-	n = m_kk*i + j;
-	counterIJ = m_CounterIJ[n];
-	/*
-	 * 	both species have a non-zero charge, and one is positive
-	 *  and the other is negative
-	 */
-	if (charge[i]*charge[j] < 0.0) {	
-	  BMX_L[counterIJ]  = beta0MX_L[counterIJ]
-	    + beta1MX_L[counterIJ] * gfunc[counterIJ]
-	    + beta2MX_L[counterIJ] * gfunc[counterIJ];
-#ifdef DEBUG_MODE
-	  if (m_debugCalc) {
-	    printf("%d %g: %g %g %g %g\n",
-		   counterIJ,  BMX_L[counterIJ], beta0MX_L[counterIJ],
-		   beta1MX_L[counterIJ],  beta2MX_L[counterIJ], gfunc[counterIJ]);
-	  }
-#endif
-	  if (Is > 1.0E-150) {
-	    BprimeMX_L[counterIJ] = (beta1MX_L[counterIJ] * hfunc[counterIJ]/Is +
-				     beta2MX_L[counterIJ] * h2func[counterIJ]/Is);
-	  } else {
-	    BprimeMX_L[counterIJ] = 0.0;
-	  }
-	  BphiMX_L[counterIJ] = BMX_L[counterIJ] + Is*BprimeMX_L[counterIJ];
-	} 
-	else {
-	  BMX_L[counterIJ]      = 0.0;
-	  BprimeMX_L[counterIJ] = 0.0;
-	  BphiMX_L[counterIJ]     = 0.0;
-	}
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  snj = speciesName(j);
-	  printf(" %-16s %-16s %11.7f %11.7f %11.7f \n", 
-		 sni.c_str(), snj.c_str(), 
-		 BMX_L[counterIJ], BprimeMX_L[counterIJ], BphiMX_L[counterIJ]);
-	}
-#endif
-      }
-    }	
-
-    /*
-     * --------- SUBSECTION TO CALCULATE CMX_L ----------
-     * ---------
-     */
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 5: \n");
-      printf(" Species          Species            CMX \n");
-    }
-#endif
-    for (i = 1; i < m_kk-1; i++) {
-      for (j = i+1; j < m_kk; j++) {
-	/*
-	 * Find the counterIJ for the symmetric binary interaction
-	 */
-	n = m_kk*i + j;
-	counterIJ = m_CounterIJ[n];
-	/*
-	 * 	both species have a non-zero charge, and one is positive
-	 *  and the other is negative
-	 */
-	if (charge[i]*charge[j] < 0.0) {
-	  CMX_L[counterIJ] = CphiMX_L[counterIJ]/ 
-	    (2.0* sqrt(fabs(charge[i]*charge[j])));
-	} 
-	else {
-	  CMX_L[counterIJ] = 0.0;
-	}
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  snj = speciesName(j);
-	  printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
-		 CMX_L[counterIJ]);
-	}
-#endif
-      }
-    }
-
-    /*
-     * ------- SUBSECTION TO CALCULATE Phi, PhiPrime, and PhiPhi ----------
-     * --------
-     */
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 6: \n");
-      printf(" Species          Species            Phi_ij "
-	     " Phiprime_ij  Phi^phi_ij \n");
-    }
-#endif
-    for (i = 1; i < m_kk-1; i++) {
-      for (j = i+1; j < m_kk; j++) {
-	/*
-	 * Find the counterIJ for the symmetric binary interaction
-	 */
-	n = m_kk*i + j;
-	counterIJ = m_CounterIJ[n];
-	/*
-	 * 	both species have a non-zero charge, and one is positive
-	 *  and the other is negative
-	 */
-	if (charge[i]*charge[j] > 0) {
-	  z1 = (int) fabs(charge[i]);
-	  z2 = (int) fabs(charge[j]);
-	  //Phi[counterIJ] = thetaij_L[counterIJ] + etheta[z1][z2];
-	  Phi_L[counterIJ] = thetaij_L[counterIJ];
-	  //Phiprime[counterIJ] = etheta_prime[z1][z2];
-	  Phiprime[counterIJ] = 0.0;
-	  Phiphi_L[counterIJ] = Phi_L[counterIJ] + Is * Phiprime[counterIJ];
-	} 
-	else {
-	  Phi_L[counterIJ]      = 0.0;
-	  Phiprime[counterIJ] = 0.0;
-	  Phiphi_L[counterIJ]   = 0.0;
-	}
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  snj = speciesName(j);
-	  printf(" %-16s %-16s %10.6f %10.6f %10.6f \n", 
-		 sni.c_str(), snj.c_str(),
-		 Phi_L[counterIJ], Phiprime[counterIJ], Phiphi_L[counterIJ] );
-	}
-#endif
-      }
-    }
-
-    /*
-     * ----------- SUBSECTION FOR CALCULATION OF dFdT ---------------------
-     */
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 7: \n");
-    }
-#endif
-    // A_Debye_Huckel = 0.5092; (units = sqrt(kg/gmol))
-    // A_Debye_Huckel = 0.5107; <- This value is used to match GWB data
-    //                             ( A * ln(10) = 1.17593)
-    // Aphi = A_Debye_Huckel * 2.30258509 / 3.0;
-    Aphi = m_A_Debye / 3.0;
-
-    double dA_DebyedT = dA_DebyedT_TP();
-    double dAphidT = dA_DebyedT /3.0;
-#ifdef DEBUG_HKM
-    //dAphidT = 0.0;
-#endif
-    //F = -Aphi * ( sqrt(Is) / (1.0 + 1.2*sqrt(Is)) 
-    //      + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
-    //dAphidT = Al / (4.0 * GasConstant * T * T);
-    dFdT = -dAphidT * ( sqrt(Is) / (1.0 + 1.2*sqrt(Is)) 
-			+ (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" initial value of dFdT = %10.6f \n", dFdT );		
-    }
-#endif
-    for (i = 1; i < m_kk-1; i++) {
-      for (j = i+1; j < m_kk; j++) {
-	/*
-	 * Find the counterIJ for the symmetric binary interaction
-	 */
-	n = m_kk*i + j;
-	counterIJ = m_CounterIJ[n];
-	/*
-	 * 	both species have a non-zero charge, and one is positive
-	 *  and the other is negative
-	 */
-	if (charge[i]*charge[j] < 0) {
-	  dFdT = dFdT + molality[i]*molality[j] * BprimeMX_L[counterIJ];
-	}
-	/*
-	 * Both species have a non-zero charge, and they
-	 * have the same sign, e.g., both positive or both negative.
-	 */
-	if (charge[i]*charge[j] > 0) {
-	  dFdT = dFdT + molality[i]*molality[j] * Phiprime[counterIJ];
-	}
-#ifdef DEBUG_MODE
-	if (m_debugCalc) printf(" dFdT = %10.6f \n", dFdT);
-#endif
-      }
-    }
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 8: \n");
-    }
-#endif
-
-    for (i = 1; i < m_kk; i++) {
-
-      /*
-       * -------- SUBSECTION FOR CALCULATING THE dACTCOEFFdT FOR CATIONS -----
-       * --
-       */
-      if (charge[i] > 0 ) {
-	// species i is the cation (positive) to calc the actcoeff
-	zsqdFdT = charge[i]*charge[i]*dFdT;
-	sum1 = 0.0;
-	sum2 = 0.0;
-	sum3 = 0.0;
-	sum4 = 0.0;
-	sum5 = 0.0;
-	for (j = 1; j < m_kk; j++) {
-	  /*
-	   * Find the counterIJ for the symmetric binary interaction
-	   */
-	  n = m_kk*i + j;
-	  counterIJ = m_CounterIJ[n];
-
-	  if (charge[j] < 0.0) {
-	    // sum over all anions
-	    sum1 = sum1 + molality[j]*
-	      (2.0*BMX_L[counterIJ] + molarcharge*CMX_L[counterIJ]);
-	    if (j < m_kk-1) {
-	      /*
-	       * This term is the ternary interaction involving the 
-	       * non-duplicate sum over double anions, j, k, with
-	       * respect to the cation, i.
-	       */
-	      for (k = j+1; k < m_kk; k++) {
-		// an inner sum over all anions
-		if (charge[k] < 0.0) {
-		  n = k + j * m_kk + i * m_kk * m_kk;
-		  sum3 = sum3 + molality[j]*molality[k]*psi_ijk_L[n];
-		}
-	      }
-	    }
-	  }
-
-	     
-	  if (charge[j] > 0.0) {
-	    // sum over all cations
-	    if (j != i) {
-	      sum2 = sum2 + molality[j]*(2.0*Phi_L[counterIJ]);
-	    }
-	    for (k = 1; k < m_kk; k++) {
-	      if (charge[k] < 0.0) {
-		// two inner sums over anions
-
-		n = k + j * m_kk + i * m_kk * m_kk;
-		sum2 = sum2 + molality[j]*molality[k]*psi_ijk_L[n];
-		/*
-		 * Find the counterIJ for the j,k interaction
-		 */
-		n = m_kk*j + k;
-		counterIJ2 = m_CounterIJ[n];
-		sum4 = sum4 + (fabs(charge[i])*
-			       molality[j]*molality[k]*CMX_L[counterIJ2]);
-	      }
-	    }
-	  }
-
-	  /*
-	   * Handle neutral j species
-	   */
-	  if (charge[j] == 0) {
-	    sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_L(j,i);
-	  }
-	  /*
-	   * Zeta interaction term
-	   */
-	  for (int k = 1; k < m_kk; k++) {
-	    if (charge[k] < 0.0) {
-	      int izeta = j;
-	      int jzeta = i;
-	      n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-	      double zeta_L = psi_ijk_L[n];
-	      if (zeta_L != 0.0) {
-		sum5 = sum5 + molality[j]*molality[k]*zeta_L;
-	      }
-	    }
-	  }
-	}
-	/*
-	 * Add all of the contributions up to yield the log of the
-	 * solute activity coefficients (molality scale)
-	 */
-	m_dlnActCoeffMolaldT_Unscaled[i] =
-	  zsqdFdT + sum1 + sum2 + sum3 + sum4 + sum5;
-	d_gamma_dT_Unscaled[i] = exp(m_dlnActCoeffMolaldT_Unscaled[i]);
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  printf(" %-16s lngamma[i]=%10.6f gamma[i]=%10.6f \n", 
-		 sni.c_str(), m_dlnActCoeffMolaldT_Unscaled[i], d_gamma_dT_Unscaled[i]);
-	  printf("                   %12g %12g %12g %12g %12g %12g\n",
-		 zsqdFdT, sum1, sum2, sum3, sum4, sum5);
-	}
-#endif
-      }
-
-      /*
-       * ------ SUBSECTION FOR CALCULATING THE dACTCOEFFdT FOR ANIONS ------
-       *
-       */
-      if (charge[i] < 0 ) {
-	//          species i is an anion (negative)
-	zsqdFdT = charge[i]*charge[i]*dFdT;
-	sum1 = 0.0;
-	sum2 = 0.0;
-	sum3 = 0.0;
-	sum4 = 0.0;
-	sum5 = 0.0;
-	for (j = 1; j < m_kk; j++) {
-	  /*
-	   * Find the counterIJ for the symmetric binary interaction
-	   */
-	  n = m_kk*i + j;
-	  counterIJ = m_CounterIJ[n];
-
-	  /*
-	   * For Anions, do the cation interactions.
-	   */
-	  if (charge[j] > 0) {
-	    sum1 = sum1 + molality[j]*
-	      (2.0*BMX_L[counterIJ] + molarcharge*CMX_L[counterIJ]);
-	    if (j < m_kk-1) {
-	      for (k = j+1; k < m_kk; k++) {
-		// an inner sum over all cations
-		if (charge[k] > 0) {
-		  n = k + j * m_kk + i * m_kk * m_kk;
-		  sum3 = sum3 + molality[j]*molality[k]*psi_ijk_L[n];
-		}
-	      }
-	    }
-	  }
-
-	  /*
-	   * For Anions, do the other anion interactions.
-	   */
-	  if (charge[j] < 0.0) {
-	    //  sum over all anions
-	    if (j != i) {
-	      sum2 = sum2 + molality[j]*(2.0*Phi_L[counterIJ]);
-	    }
-	    for (k = 1; k < m_kk; k++) {
-	      if (charge[k] > 0.0) {
-		// two inner sums over cations
-		n = k + j * m_kk + i * m_kk * m_kk;
-		sum2 = sum2 + molality[j]*molality[k]*psi_ijk_L[n];
-		/*
-		 * Find the counterIJ for the symmetric binary interaction
-		 */
-		n = m_kk*j + k;
-		counterIJ2 = m_CounterIJ[n];
-		sum4 = sum4 + 
-		  (fabs(charge[i])*
-		   molality[j]*molality[k]*CMX_L[counterIJ2]);
-	      }
-	    }
-	  }
-
-	  /*
-	   * for Anions, do the neutral species interaction
-	   */
-	  if (charge[j] == 0.0) {
-	    sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_L(j,i);
-	    for (int k = 1; k < m_kk; k++) {
-	      if (charge[k] > 0.0) {
-		int izeta = j;
-		int jzeta = k;
-		int kzeta = i;
-		n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-		double zeta_L = psi_ijk_L[n];
-		if (zeta_L != 0.0) {
-		  sum5 = sum5 + molality[j]*molality[k]*zeta_L;
-		}
-	      }
-	    }
-	  }
-	}
-	m_dlnActCoeffMolaldT_Unscaled[i] = 
-	  zsqdFdT + sum1 + sum2 + sum3 + sum4 + sum5;
-	d_gamma_dT_Unscaled[i] = exp(m_dlnActCoeffMolaldT_Unscaled[i]);
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  printf(" %-16s lngamma[i]=%10.6f gamma[i]=%10.6f\n", 
-		 sni.c_str(), m_dlnActCoeffMolaldT_Unscaled[i], d_gamma_dT_Unscaled[i]);
-	  printf("                   %12g %12g %12g %12g %12g %12g\n",
-		 zsqdFdT, sum1, sum2, sum3, sum4, sum5);
-	}
-#endif
-      }
-      /*
-       * ------ SUBSECTION FOR CALCULATING NEUTRAL SOLUTE ACT COEFF -------
-       * ------ -> equations agree with my notes,
-       *        -> Equations agree with Pitzer,
-       */
-      if (charge[i] == 0.0 ) {
-	sum1 = 0.0;
-	sum3 = 0.0;
-	for (j = 1; j < m_kk; j++) {
-	  sum1 = sum1 + molality[j]*2.0*m_Lambda_nj_L(i,j);
-	  /*
-	   * Zeta term -> we piggyback on the psi term
-	   */
-	  if (charge[j] > 0.0) {
-	    for (k = 1; k < m_kk; k++) {
-	      if (charge[k] < 0.0) {
-		n = k + j * m_kk + i * m_kk * m_kk;
-		sum3 = sum3 + molality[j]*molality[k]*psi_ijk_L[n];
-	      }
-	    }
-	  }
-	}
-	sum2 = 3.0 * molality[i] * molality[i] * m_Mu_nnn_L[i];
-	m_dlnActCoeffMolaldT_Unscaled[i] = sum1 + sum2 + sum3;
-	d_gamma_dT_Unscaled[i] = exp(m_dlnActCoeffMolaldT_Unscaled[i]);
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  printf(" %-16s lngamma[i]=%10.6f gamma[i]=%10.6f \n", 
-		 sni.c_str(), m_dlnActCoeffMolaldT_Unscaled[i], d_gamma_dT_Unscaled[i]);
-	}
-#endif
-      }
-
-    }
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 9: \n");
-    }
-#endif
-    /*
-     * ------ SUBSECTION FOR CALCULATING THE d OSMOTIC COEFF dT ---------
-     *
-     */
-    sum1 = 0.0;
-    sum2 = 0.0;
-    sum3 = 0.0;
-    sum4 = 0.0;
-    sum5 = 0.0;
-    double sum6 = 0.0;
-    double sum7 = 0.0;
-    /*
-     * term1 is the temperature derivative of the
-     * DH term in the osmotic coefficient expression
-     * b = 1.2 sqrt(kg/gmol) <- arbitrarily set in all Pitzer 
-     *                          implementations.
-     * Is = Ionic strength on the molality scale (units of (gmol/kg))
-     * Aphi = A_Debye / 3   (units of sqrt(kg/gmol))
-     */
-    term1 = -dAphidT * Is * sqrt(Is) / (1.0 + 1.2 * sqrt(Is));
-
-    for (j = 1; j < m_kk; j++) {
-      /*
-       * Loop Over Cations
-       */
-      if (charge[j] > 0.0) {
-	for (k = 1; k < m_kk; k++){
-	  if (charge[k] < 0.0) {
-	    /*
-	     * Find the counterIJ for the symmetric j,k binary interaction
-	     */
-	    n = m_kk*j + k;
-	    counterIJ = m_CounterIJ[n];
-	
-	    sum1 = sum1 + molality[j]*molality[k]*
-	      (BphiMX_L[counterIJ] + molarcharge*CMX_L[counterIJ]);
-	  }
-	}
-
-	for (k = j+1; k < m_kk; k++) {
-	  if (j == (m_kk-1)) {
-	    // we should never reach this step
-	    printf("logic error 1 in Step 9 of hmw_act");
-	    exit(EXIT_FAILURE);
-	  }
-	  if (charge[k] > 0.0) {
-	    /*
-	     * Find the counterIJ for the symmetric j,k binary interaction
-	     * between 2 cations.
-	     */
-	    n = m_kk*j + k;
-	    counterIJ = m_CounterIJ[n];
-	    sum2 = sum2 + molality[j]*molality[k]*Phiphi_L[counterIJ];
-	    for (m = 1; m < m_kk; m++) {
-	      if (charge[m] < 0.0) {
-		// species m is an anion
-		n = m + k * m_kk + j * m_kk * m_kk;
-		sum2 = sum2 + 
-		  molality[j]*molality[k]*molality[m]*psi_ijk_L[n];
-	      }
-	    }
-	  }
-	}
-      }
-	  
-      /*
-       * Loop Over Anions
-       */
-      if (charge[j] < 0) {
-	for (k = j+1; k < m_kk; k++) {
-	  if (j == m_kk-1) {
-	    // we should never reach this step
-	    printf("logic error 2 in Step 9 of hmw_act");
-	    exit(EXIT_FAILURE);
-	  }
-	  if (charge[k] < 0) {
-	    /*
-	     * Find the counterIJ for the symmetric j,k binary interaction
-	     * between two anions
-	     */
-	    n = m_kk*j + k;
-	    counterIJ = m_CounterIJ[n];
-
-	    sum3 = sum3 + molality[j]*molality[k]*Phiphi_L[counterIJ];
-	    for (m = 1; m < m_kk; m++) {
-	      if (charge[m] > 0.0) {
-		n = m + k * m_kk + j * m_kk * m_kk;
-		sum3 = sum3 + 
-		  molality[j]*molality[k]*molality[m]*psi_ijk_L[n];
-	      }
-	    }
-	  }
-	}
-      }
-	  
-      /*
-       * Loop Over Neutral Species
-       */
-      if (charge[j] == 0) {
-	for (k = 1; k < m_kk; k++) {
-	  if (charge[k] < 0.0) {
-	    sum4 = sum4 + molality[j]*molality[k]*m_Lambda_nj_L(j,k);
-	  }
-	  if (charge[k] > 0.0) {
-	    sum5 = sum5 + molality[j]*molality[k]*m_Lambda_nj_L(j,k);
-	  }
-	  if (charge[k] == 0.0) {
-	    if (k > j) {
-	      sum6 = sum6 + molality[j]*molality[k]*m_Lambda_nj_L(j,k);
-	    } else if (k == j) {
-	      sum6 = sum6 + 0.5 * molality[j]*molality[k]*m_Lambda_nj_L(j,k);
-	    }
-	  }
-	  if (charge[k] < 0.0) {
-	    int izeta = j;
-	    for (m = 1; m < m_kk; m++) {
-	      if (charge[m] > 0.0) {
-		int jzeta = m;
-		n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-		double zeta_L = psi_ijk_L[n];
-		if (zeta_L != 0.0) {
-		  sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta_L;
-		}
-	      }
-	    }
-	  }
-	}
-	sum7 += molality[j]*molality[j]*molality[j]*m_Mu_nnn_L[j];
-      }
-    }
-    sum_m_phi_minus_1 = 2.0 * 
-      (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7);
-    /*
-     * Calculate the osmotic coefficient from 
-     *       osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
-     */
-    if (molalitysum > 1.0E-150) {
-      d_osmotic_coef_dT = 0.0 + (sum_m_phi_minus_1 / molalitysum);
-    } else {
-      d_osmotic_coef_dT = 0.0;
-    }
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" term1=%10.6f sum1=%10.6f sum2=%10.6f "
-	     "sum3=%10.6f sum4=%10.6f sum5=%10.6f\n",
-	     term1, sum1, sum2, sum3, sum4, sum5);
-      printf("     sum_m_phi_minus_1=%10.6f        d_osmotic_coef_dT =%10.6f\n", 
-	     sum_m_phi_minus_1, d_osmotic_coef_dT);
-    }
-
-    if (m_debugCalc) {
-      printf(" Step 10: \n");
-    }
-#endif
-    d_lnwateract_dT = -(m_weightSolvent/1000.0) * molalitysum * d_osmotic_coef_dT;
-    d_wateract_dT = exp(d_lnwateract_dT);
-
-    /*
-     * In Cantera, we define the activity coefficient of the solvent as
-     *
-     *     act_0 = actcoeff_0 * Xmol_0
-     *
-     * We have just computed act_0. However, this routine returns
-     *  ln(actcoeff[]). Therefore, we must calculate ln(actcoeff_0).
-     */
-    //double xmolSolvent = moleFraction(m_indexSolvent);
-    m_dlnActCoeffMolaldT_Unscaled[0] = d_lnwateract_dT;
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" d_ln_a_water_dT = %10.6f d_a_water_dT=%10.6f\n\n", 
-	     d_lnwateract_dT, d_wateract_dT); 
-    }
-#endif
-  }
-
-  /**
-   * This function calculates the temperature second derivative
-   * of the natural logarithm of the molality activity 
-   * coefficients.
-   */
-  void HMWSoln::s_update_d2lnMolalityActCoeff_dT2() const {
-    /*
-     *  Zero the unscaled 2nd derivatives
-     */
-    fbo_zero_dbl_1(DATA_PTR(m_d2lnActCoeffMolaldT2_Unscaled), m_kk);
-    /*
-     * Calculate the unscaled 2nd derivatives
-     */
-    s_updatePitzer_d2lnMolalityActCoeff_dT2();
-
-    //double xmolSolvent = moleFraction(m_indexSolvent);
-    //double xx = MAX(m_xmolSolventMIN, xmolSolvent);
-    //double lnxs = log(xx);
-
-    for (int k = 1; k < m_kk; k++) {
-      if (CROP_speciesCropped_[k] == 2) {
-	m_d2lnActCoeffMolaldT2_Unscaled[k] = 0.0;
-      }
-    }
-
-    if (CROP_speciesCropped_[0]) {
-      m_d2lnActCoeffMolaldT2_Unscaled[0] = 0.0;
-    }    
-
-    /*
-     * Scale the 2nd derivatives 
-     */
-    s_updateScaling_pHScaling_dT2();
-  }
-
-  /*************************************************************************************/
-
-  /*
-   * s_updatePitzer_d2lnMolalityActCoeff_dT2()         (private, const )
-   *
-   *   Using internally stored values, this function calculates
-   *   the temperature 2nd derivative of the logarithm of the
-   *   activity coefficient for all species in the mechanism.
-   *   This is an internal routine
-   *
-   *   We assume that the activity coefficients and first temperature
-   *   derivatives of the activity coefficients  are current.
-   *
-   * It may be assumed that the 
-   * Pitzer activity coefficient and first deriv routine are called immediately
-   * preceding the calling of this routine. Therefore, some
-   * quantities do not need to be recalculated in this routine.
-   *
-   *   solvent activity coefficient is on the molality
-   *   scale. It's derivatives are too.
-   */
-  void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const {
-
-    /*
-     * HKM -> Assumption is made that the solvent is
-     *        species 0.
-     */
-#ifdef DEBUG_MODE
-    m_debugCalc = 0;
-#endif
-    if (m_indexSolvent != 0) {
-      printf("Wrong index solvent value!\n");
-      exit(EXIT_FAILURE);
-    }
-
-    std::string sni, snj, snk; 
-
-    const double *molality  =  DATA_PTR(m_molalitiesCropped);
-    const double *charge    =  DATA_PTR(m_speciesCharge);
-    const double *beta0MX_LL=  DATA_PTR(m_Beta0MX_ij_LL);
-    const double *beta1MX_LL=  DATA_PTR(m_Beta1MX_ij_LL);
-    const double *beta2MX_LL=  DATA_PTR(m_Beta2MX_ij_LL);
-    const double *CphiMX_LL =  DATA_PTR(m_CphiMX_ij_LL);
-    const double *thetaij_LL=  DATA_PTR(m_Theta_ij_LL);
-    const double *alpha1MX  =  DATA_PTR(m_Alpha1MX_ij);
-    const double *alpha2MX  =  DATA_PTR(m_Alpha2MX_ij);
-    const double *psi_ijk_LL=  DATA_PTR(m_Psi_ijk_LL);
-
-    /*
-     * Local variables defined by Coltrin
-     */
-    double etheta[5][5], etheta_prime[5][5], sqrtIs;
-    /*
-     * Molality based ionic strength of the solution
-     */
-    double Is = 0.0;
-    /*
-     * Molarcharge of the solution: In Pitzer's notation, 
-     * this is his variable called "Z".
-     */
-    double molarcharge = 0.0;
-    /*
-     * molalitysum is the sum of the molalities over all solutes,
-     * even those with zero charge.
-     */
-    double molalitysum = 0.0;
-
-    double *gfunc    =  DATA_PTR(m_gfunc_IJ);
-    double *g2func   =  DATA_PTR(m_g2func_IJ);
-    double *hfunc    =  DATA_PTR(m_hfunc_IJ);
-    double *h2func   =  DATA_PTR(m_h2func_IJ);
-    double *BMX_LL   =  DATA_PTR(m_BMX_IJ_LL);
-    double *BprimeMX_LL=DATA_PTR(m_BprimeMX_IJ_LL);
-    double *BphiMX_LL=  DATA_PTR(m_BphiMX_IJ_LL);
-    double *Phi_LL   =  DATA_PTR(m_Phi_IJ_LL);
-    double *Phiprime =  DATA_PTR(m_Phiprime_IJ);
-    double *Phiphi_LL=  DATA_PTR(m_PhiPhi_IJ_LL);
-    double *CMX_LL   =  DATA_PTR(m_CMX_IJ_LL);
-
-
-    double x1, x2;
-    double d2FdT2, zsqd2FdT2;
-    double sum1, sum2, sum3, sum4, sum5, term1;
-    double sum_m_phi_minus_1, d2_osmotic_coef_dT2, d2_lnwateract_dT2;
-
-    int z1, z2;
-    int n, i, j, k, m, counterIJ,  counterIJ2;
-
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf("\n Debugging information from "
-	     "s_Pitzer_d2lnMolalityActCoeff_dT2()\n");
-    }
-#endif
-    /*
-     * Make sure the counter variables are setup
-     */
-    counterIJ_setup();
-
-
-    /*
-     * ---------- Calculate common sums over solutes ---------------------
-     */
-    for (n = 1; n < m_kk; n++) {
-      //      ionic strength
-      Is += charge[n] * charge[n] * molality[n];
-      //      total molar charge
-      molarcharge +=  fabs(charge[n]) * molality[n];
-      molalitysum += molality[n];
-    }
-    Is *= 0.5;
-
-    /*
-     * Store the ionic molality in the object for reference.
-     */
-    m_IionicMolality = Is;
-    sqrtIs = sqrt(Is);
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 1: \n");
-      printf(" ionic strenth      = %14.7le \n total molar "
-	     "charge = %14.7le \n", Is, molarcharge);
-    }
-#endif
-
-    /*
-     * The following call to calc_lambdas() calculates all 16 elements
-     * of the elambda and elambda1 arrays, given the value of the 
-     * ionic strength (Is)
-     */
-    calc_lambdas(Is);
-
-    /*
-     * ----- Step 2:  Find the coefficients E-theta and -------------------
-     *                E-thetaprime for all combinations of positive 
-     *                unlike charges up to 4
-     */
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 2: \n");
-    }
-#endif
-    for (z1 = 1; z1 <=4; z1++) {
-      for (z2 =1; z2 <=4; z2++) {
-	calc_thetas(z1, z2, &etheta[z1][z2], &etheta_prime[z1][z2]);
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  printf(" z1=%3d z2=%3d E-theta(I) = %f, E-thetaprime(I) = %f\n", 
-		 z1, z2, etheta[z1][z2], etheta_prime[z1][z2]);
-	}
-#endif
-      }
-    }
-
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 3: \n");
-      printf(" Species          Species            g(x) "
-	     " hfunc(x)   \n");
-    }
-#endif
-	
-    /*
-     *
-     *  calculate gfunc(x) and hfunc(x) for each cation-anion pair MX
-     *   In the original literature, hfunc, was called gprime. However,
-     *   it's not the derivative of gfunc(x), so I renamed it.
-     */
-    for (i = 1; i < (m_kk - 1); i++) {
-      for (j = (i+1); j < m_kk; j++) {
-	/*
-	 * Find the counterIJ for the symmetric binary interaction
-	 */
-	n = m_kk*i + j;
-	counterIJ = m_CounterIJ[n];
-	/*
-	 * Only loop over oppositely charge species
-	 */
-	if (charge[i]*charge[j] < 0) {
-	  /*
-	   * x is a reduced function variable
-	   */
-	  x1 = sqrtIs * alpha1MX[counterIJ];
-	  if (x1 > 1.0E-100) {
-	    gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 *x1);
-	    hfunc[counterIJ] = -2.0*
-	      (1.0-(1.0 + x1 + 0.5*x1 * x1) * exp(-x1)) / (x1 * x1);
-	  }
-	  else {
-	    gfunc[counterIJ] = 0.0;
-	    hfunc[counterIJ] = 0.0;
-	  }
-	  
-	  if (beta2MX_LL[counterIJ] != 0.0) {
-	    x2 = sqrtIs * alpha2MX[counterIJ];
-	    if (x2 > 1.0E-100) {
-	      g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-	      h2func[counterIJ] = -2.0 *
-		(1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-	    } else {
-	      g2func[counterIJ] = 0.0;
-	      h2func[counterIJ] = 0.0;
-	    }
-	  }
-	} 
-	else {
-	  gfunc[counterIJ] = 0.0;
-	  hfunc[counterIJ] = 0.0;
-	}
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  snj = speciesName(j);
-	  printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(), 
-		 gfunc[counterIJ], hfunc[counterIJ]);
-	}
-#endif
-      }
-    }
-    /*
-     * ------- SUBSECTION TO CALCULATE BMX_L, BprimeMX_LL, BphiMX_L ----------
-     * ------- These are now temperature derivatives of the
-     *         previously calculated quantities.
-     */
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 4: \n");
-      printf(" Species          Species            BMX    "
-	     "BprimeMX    BphiMX   \n");
-    }
-#endif
-  
-    for (i = 1; i < m_kk - 1; i++) {
-      for (j = i+1; j < m_kk; j++) {
-	/*
-	 * Find the counterIJ for the symmetric binary interaction
-	 */
-	n = m_kk*i + j;
-	counterIJ = m_CounterIJ[n];
-	/*
-	 * 	both species have a non-zero charge, and one is positive
-	 *  and the other is negative
-	 */
-	if (charge[i]*charge[j] < 0.0) {
-	  BMX_LL[counterIJ]  = beta0MX_LL[counterIJ]
-	    + beta1MX_LL[counterIJ] * gfunc[counterIJ]
-	    + beta2MX_LL[counterIJ] * g2func[counterIJ];
-#ifdef DEBUG_MODE
-	  if (m_debugCalc) {
-	    printf("%d %g: %g %g %g %g\n",
-		   counterIJ,  BMX_LL[counterIJ], beta0MX_LL[counterIJ],
-		   beta1MX_LL[counterIJ], beta2MX_LL[counterIJ], gfunc[counterIJ]);
-	  }
-#endif
-	  if (Is > 1.0E-150) {
-	    BprimeMX_LL[counterIJ] = (beta1MX_LL[counterIJ] * hfunc[counterIJ]/Is +
-				      beta2MX_LL[counterIJ] * h2func[counterIJ]/Is);
-	  } else {
-	    BprimeMX_LL[counterIJ] = 0.0;
-	  }
-	  BphiMX_LL[counterIJ] = BMX_LL[counterIJ] + Is*BprimeMX_LL[counterIJ];
-	} 
-	else {
-	  BMX_LL[counterIJ]      = 0.0;
-	  BprimeMX_LL[counterIJ] = 0.0;
-	  BphiMX_LL[counterIJ]     = 0.0;
-	}
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  snj = speciesName(j);
-	  printf(" %-16s %-16s %11.7f %11.7f %11.7f \n", 
-		 sni.c_str(), snj.c_str(), 
-		 BMX_LL[counterIJ], BprimeMX_LL[counterIJ], BphiMX_LL[counterIJ]);
-	}
-#endif
-      }
-    }	
-
-    /*
-     * --------- SUBSECTION TO CALCULATE CMX_LL ----------
-     * ---------
-     */
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 5: \n");
-      printf(" Species          Species            CMX \n");
-    }
-#endif
-    for (i = 1; i < m_kk-1; i++) {
-      for (j = i+1; j < m_kk; j++) {
-	/*
-	 * Find the counterIJ for the symmetric binary interaction
-	 */
-	n = m_kk*i + j;
-	counterIJ = m_CounterIJ[n];
-	/*
-	 * 	both species have a non-zero charge, and one is positive
-	 *  and the other is negative
-	 */
-	if (charge[i]*charge[j] < 0.0) {
-	  CMX_LL[counterIJ] = CphiMX_LL[counterIJ]/ 
-	    (2.0* sqrt(fabs(charge[i]*charge[j])));
-	} else {
-	  CMX_LL[counterIJ] = 0.0;
-	}
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  snj = speciesName(j);
-	  printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
-		 CMX_LL[counterIJ]);
-	}
-#endif
-      }
-    }
-
-    /*
-     * ------- SUBSECTION TO CALCULATE Phi, PhiPrime, and PhiPhi ----------
-     * --------
-     */
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 6: \n");
-      printf(" Species          Species            Phi_ij "
-	     " Phiprime_ij  Phi^phi_ij \n");
-    }
-#endif
-    for (i = 1; i < m_kk-1; i++) {
-      for (j = i+1; j < m_kk; j++) {
-	/*
-	 * Find the counterIJ for the symmetric binary interaction
-	 */
-	n = m_kk*i + j;
-	counterIJ = m_CounterIJ[n];
-	/*
-	 * 	both species have a non-zero charge, and one is positive
-	 *  and the other is negative
-	 */
-	if (charge[i]*charge[j] > 0) {
-	  z1 = (int) fabs(charge[i]);
-	  z2 = (int) fabs(charge[j]);
-	  //Phi[counterIJ] = thetaij[counterIJ] + etheta[z1][z2];
-	  //Phi_L[counterIJ] = thetaij_L[counterIJ];
-	  Phi_LL[counterIJ] = thetaij_LL[counterIJ];
-	  //Phiprime[counterIJ] = etheta_prime[z1][z2];
-	  Phiprime[counterIJ] = 0.0;
-	  //Phiphi[counterIJ] = Phi[counterIJ] + Is * Phiprime[counterIJ];
-	  //Phiphi_L[counterIJ] = Phi_L[counterIJ] + Is * Phiprime[counterIJ];
-	  Phiphi_LL[counterIJ] = Phi_LL[counterIJ];
-	} 
-	else {
-	  Phi_LL[counterIJ]      = 0.0;
-	  Phiprime[counterIJ] = 0.0;
-	  Phiphi_LL[counterIJ]   = 0.0;
-	}
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  snj = speciesName(j);
-	  //printf(" %-16s %-16s %10.6f %10.6f %10.6f \n", 
-	  //	     sni.c_str(), snj.c_str(),
-	  //     Phi_L[counterIJ], Phiprime[counterIJ], Phiphi_L[counterIJ] );
-	  printf(" %-16s %-16s %10.6f %10.6f %10.6f \n", 
-		 sni.c_str(), snj.c_str(),
-		 Phi_LL[counterIJ], Phiprime[counterIJ], Phiphi_LL[counterIJ] );
-	}
-#endif
-      }
-    }
-
-    /*
-     * ----------- SUBSECTION FOR CALCULATION OF d2FdT2 ---------------------
-     */
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 7: \n");
-    }
-#endif
-    // A_Debye_Huckel = 0.5092; (units = sqrt(kg/gmol))
-    // A_Debye_Huckel = 0.5107; <- This value is used to match GWB data
-    //                             ( A * ln(10) = 1.17593)
-    // Aphi = A_Debye_Huckel * 2.30258509 / 3.0;
-    // Aphi = m_A_Debye / 3.0;
-
-    //double dA_DebyedT = dA_DebyedT_TP();
-    //double dAphidT = dA_DebyedT /3.0;
-    double d2AphidT2 = d2A_DebyedT2_TP() / 3.0;
-#ifdef DEBUG_HKM
-    //d2AphidT2 = 0.0;
-#endif
-    //F = -Aphi * ( sqrt(Is) / (1.0 + 1.2*sqrt(Is)) 
-    //      + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
-    //dAphidT = Al / (4.0 * GasConstant * T * T);
-    //dFdT = -dAphidT * ( sqrt(Is) / (1.0 + 1.2*sqrt(Is)) 
-    //		    + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
-    d2FdT2 = -d2AphidT2 * ( sqrt(Is) / (1.0 + 1.2*sqrt(Is)) 
-			    + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {	
-      printf(" initial value of d2FdT2 = %10.6f \n", d2FdT2 );		
-    }
-#endif
-    for (i = 1; i < m_kk-1; i++) {
-      for (j = i+1; j < m_kk; j++) {
-	/*
-	 * Find the counterIJ for the symmetric binary interaction
-	 */
-	n = m_kk*i + j;
-	counterIJ = m_CounterIJ[n];
-	/*
-	 * 	both species have a non-zero charge, and one is positive
-	 *  and the other is negative
-	 */
-	if (charge[i]*charge[j] < 0) {
-	  d2FdT2 = d2FdT2 + molality[i]*molality[j] * BprimeMX_LL[counterIJ];
-	}
-	/*
-	 * Both species have a non-zero charge, and they
-	 * have the same sign, e.g., both positive or both negative.
-	 */
-	if (charge[i]*charge[j] > 0) {
-	  d2FdT2 = d2FdT2 + molality[i]*molality[j] * Phiprime[counterIJ];
-	}
-#ifdef DEBUG_MODE
-	if (m_debugCalc) printf(" d2FdT2 = %10.6f \n", d2FdT2);
-#endif
-      }
-    }
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 8: \n");
-    }
-#endif
-
-    for (i = 1; i < m_kk; i++) {
-
-      /*
-       * -------- SUBSECTION FOR CALCULATING THE dACTCOEFFdT FOR CATIONS -----
-       * --
-       */
-      if (charge[i] > 0 ) {
-	// species i is the cation (positive) to calc the actcoeff
-	zsqd2FdT2 = charge[i]*charge[i]*d2FdT2;
-	sum1 = 0.0;
-	sum2 = 0.0;
-	sum3 = 0.0;
-	sum4 = 0.0;
-	sum5 = 0.0;
-	for (j = 1; j < m_kk; j++) {
-	  /*
-	   * Find the counterIJ for the symmetric binary interaction
-	   */
-	  n = m_kk*i + j;
-	  counterIJ = m_CounterIJ[n];
-
-	  if (charge[j] < 0.0) {
-	    // sum over all anions
-	    sum1 = sum1 + molality[j]*
-	      (2.0*BMX_LL[counterIJ] + molarcharge*CMX_LL[counterIJ]);
-	    if (j < m_kk-1) {
-	      /*
-	       * This term is the ternary interaction involving the 
-	       * non-duplicate sum over double anions, j, k, with
-	       * respect to the cation, i.
-	       */
-	      for (k = j+1; k < m_kk; k++) {
-		// an inner sum over all anions
-		if (charge[k] < 0.0) {
-		  n = k + j * m_kk + i * m_kk * m_kk;
-		  sum3 = sum3 + molality[j]*molality[k]*psi_ijk_LL[n];
-		}
-	      }
-	    }
-	  }
-
-	     
-	  if (charge[j] > 0.0) {
-	    // sum over all cations
-	    if (j != i) {
-	      sum2 = sum2 + molality[j]*(2.0*Phi_LL[counterIJ]);
-	    }
-	    for (k = 1; k < m_kk; k++) {
-	      if (charge[k] < 0.0) {
-		// two inner sums over anions
-
-		n = k + j * m_kk + i * m_kk * m_kk;
-		sum2 = sum2 + molality[j]*molality[k]*psi_ijk_LL[n];
-		/*
-		 * Find the counterIJ for the j,k interaction
-		 */
-		n = m_kk*j + k;
-		counterIJ2 = m_CounterIJ[n];
-		sum4 = sum4 + (fabs(charge[i])*
-			       molality[j]*molality[k]*CMX_LL[counterIJ2]);
-	      }
-	    }
-	  }
-
-	  /*
-	   * Handle neutral j species
-	   */
-	  if (charge[j] == 0) {
-	    sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_LL(j,i);
-	    /*
-	     * Zeta interaction term
-	     */
-	    for (int k = 1; k < m_kk; k++) {
-	      if (charge[k] < 0.0) {
-		int izeta = j;
-		int jzeta = i;
-		n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-		double zeta_LL = psi_ijk_LL[n];
-		if (zeta_LL != 0.0) {
-		  sum5 = sum5 + molality[j]*molality[k]*zeta_LL;
-		}
-	      }
-	    }
-	  }
-	}
-	/*
-	 * Add all of the contributions up to yield the log of the
-	 * solute activity coefficients (molality scale)
-	 */
-	m_d2lnActCoeffMolaldT2_Unscaled[i] =
-	  zsqd2FdT2 + sum1 + sum2 + sum3 + sum4 + sum5;
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  printf(" %-16s d2lngammadT2[i]=%10.6f \n", 
-		 sni.c_str(), m_d2lnActCoeffMolaldT2_Unscaled[i]);
-	  printf("                   %12g %12g %12g %12g %12g %12g\n",
-		 zsqd2FdT2, sum1, sum2, sum3, sum4, sum5);
-	}
-#endif
-      }
-
-
-      /*
-       * ------ SUBSECTION FOR CALCULATING THE d2ACTCOEFFdT2 FOR ANIONS ------
-       *
-       */
-      if (charge[i] < 0 ) {
-	//          species i is an anion (negative)
-	zsqd2FdT2 = charge[i]*charge[i]*d2FdT2;
-	sum1 = 0.0;
-	sum2 = 0.0;
-	sum3 = 0.0;
-	sum4 = 0.0;
-	sum5 = 0.0;
-	for (j = 1; j < m_kk; j++) {
-	  /*
-	   * Find the counterIJ for the symmetric binary interaction
-	   */
-	  n = m_kk*i + j;
-	  counterIJ = m_CounterIJ[n];
-
-	  /*
-	   * For Anions, do the cation interactions.
-	   */
-	  if (charge[j] > 0) {
-	    sum1 = sum1 + molality[j]*
-	      (2.0*BMX_LL[counterIJ] + molarcharge*CMX_LL[counterIJ]);
-	    if (j < m_kk-1) {
-	      for (k = j+1; k < m_kk; k++) {
-		// an inner sum over all cations
-		if (charge[k] > 0) {
-		  n = k + j * m_kk + i * m_kk * m_kk;
-		  sum3 = sum3 + molality[j]*molality[k]*psi_ijk_LL[n];
-		}
-	      }
-	    }
-	  }
-
-	  /*
-	   * For Anions, do the other anion interactions.
-	   */
-	  if (charge[j] < 0.0) {
-	    //  sum over all anions
-	    if (j != i) {
-	      sum2 = sum2 + molality[j]*(2.0*Phi_LL[counterIJ]);
-	    }
-	    for (k = 1; k < m_kk; k++) {
-	      if (charge[k] > 0.0) {
-		// two inner sums over cations
-		n = k + j * m_kk + i * m_kk * m_kk;
-		sum2 = sum2 + molality[j]*molality[k]*psi_ijk_LL[n];
-		/*
-		 * Find the counterIJ for the symmetric binary interaction
-		 */
-		n = m_kk*j + k;
-		counterIJ2 = m_CounterIJ[n];
-		sum4 = sum4 + 
-		  (fabs(charge[i])*
-		   molality[j]*molality[k]*CMX_LL[counterIJ2]);
-	      }
-	    }
-	  }
-
-	  /*
-	   * for Anions, do the neutral species interaction
-	   */
-	  if (charge[j] == 0.0) {
-	    sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_LL(j,i);
-	    /*
-	     * Zeta interaction term
-	     */
-	    for (int k = 1; k < m_kk; k++) {
-	      if (charge[k] > 0.0) {
-		int izeta = j;
-		int jzeta = k;
-		int kzeta = i;
-		n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-		double zeta_LL = psi_ijk_LL[n];
-		if (zeta_LL != 0.0) {
-		  sum5 = sum5 + molality[j]*molality[k]*zeta_LL;
-		}
-	      }
-	    }
-	  }
-	}
-	m_d2lnActCoeffMolaldT2_Unscaled[i] = 
-	  zsqd2FdT2 + sum1 + sum2 + sum3 + sum4 + sum5;
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  printf(" %-16s d2lngammadT2[i]=%10.6f\n", 
-		 sni.c_str(), m_d2lnActCoeffMolaldT2_Unscaled[i]);
-	  printf("                   %12g %12g %12g %12g %12g %12g\n",
-		 zsqd2FdT2, sum1, sum2, sum3, sum4, sum5);
-	}
-#endif
-      }
-      /*
-       * ------ SUBSECTION FOR CALCULATING NEUTRAL SOLUTE ACT COEFF -------
-       * ------ -> equations agree with my notes,
-       *        -> Equations agree with Pitzer,
-       */
-      if (charge[i] == 0.0 ) {
-	sum1 = 0.0;
-	sum3 = 0.0;
-	for (j = 1; j < m_kk; j++) {
-	  sum1 = sum1 + molality[j]*2.0*m_Lambda_nj_LL(i,j);
-	  /*
-	   * Zeta term -> we piggyback on the psi term
-	   */
-	  if (charge[j] > 0.0) {
-	    for (k = 1; k < m_kk; k++) {
-	      if (charge[k] < 0.0) {
-		n = k + j * m_kk + i * m_kk * m_kk;
-		sum3 = sum3 + molality[j]*molality[k]*psi_ijk_LL[n];
-	      }
-	    }
-	  }
-	}
-	sum2 = 3.0 * molality[i] * molality[i] * m_Mu_nnn_LL[i];
-	m_d2lnActCoeffMolaldT2_Unscaled[i] = sum1 + sum2 + sum3;
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  printf(" %-16s d2lngammadT2[i]=%10.6f \n", 
-		 sni.c_str(), m_d2lnActCoeffMolaldT2_Unscaled[i]);
-	}
-#endif
-      }
-
-    }
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 9: \n");
-    }
-#endif
-
-    /*
-     * ------ SUBSECTION FOR CALCULATING THE d2 OSMOTIC COEFF dT2 ---------
-     *
-     */
-    sum1 = 0.0;
-    sum2 = 0.0;
-    sum3 = 0.0;
-    sum4 = 0.0;
-    sum5 = 0.0;
-    double sum6 = 0.0;
-    double sum7 = 0.0;
-    /*
-     * term1 is the temperature derivative of the
-     * DH term in the osmotic coefficient expression
-     * b = 1.2 sqrt(kg/gmol) <- arbitrarily set in all Pitzer 
-     *                          implementations.
-     * Is = Ionic strength on the molality scale (units of (gmol/kg))
-     * Aphi = A_Debye / 3   (units of sqrt(kg/gmol))
-     */
-    term1 = -d2AphidT2 * Is * sqrt(Is) / (1.0 + 1.2 * sqrt(Is));
-
-    for (j = 1; j < m_kk; j++) {
-      /*
-       * Loop Over Cations
-       */
-      if (charge[j] > 0.0) {
-	for (k = 1; k < m_kk; k++){
-	  if (charge[k] < 0.0) {
-	    /*
-	     * Find the counterIJ for the symmetric j,k binary interaction
-	     */
-	    n = m_kk*j + k;
-	    counterIJ = m_CounterIJ[n];
-	
-	    sum1 = sum1 + molality[j]*molality[k]*
-	      (BphiMX_LL[counterIJ] + molarcharge*CMX_LL[counterIJ]);
-	  }
-	}
-
-	for (k = j+1; k < m_kk; k++) {
-	  if (j == (m_kk-1)) {
-	    // we should never reach this step
-	    printf("logic error 1 in Step 9 of hmw_act");
-	    exit(EXIT_FAILURE);
-	  }
-	  if (charge[k] > 0.0) {
-	    /*
-	     * Find the counterIJ for the symmetric j,k binary interaction
-	     * between 2 cations.
-	     */
-	    n = m_kk*j + k;
-	    counterIJ = m_CounterIJ[n];
-	    sum2 = sum2 + molality[j]*molality[k]*Phiphi_LL[counterIJ];
-	    for (m = 1; m < m_kk; m++) {
-	      if (charge[m] < 0.0) {
-		// species m is an anion
-		n = m + k * m_kk + j * m_kk * m_kk;
-		sum2 = sum2 + 
-		  molality[j]*molality[k]*molality[m]*psi_ijk_LL[n];
-	      }
-	    }
-	  }
-	}
-      }
-	  
-      /*
-       * Loop Over Anions
-       */
-      if (charge[j] < 0) {
-	for (k = j+1; k < m_kk; k++) {
-	  if (j == m_kk-1) {
-	    // we should never reach this step
-	    printf("logic error 2 in Step 9 of hmw_act");
-	    exit(EXIT_FAILURE);
-	  }
-	  if (charge[k] < 0) {
-	    /*
-	     * Find the counterIJ for the symmetric j,k binary interaction
-	     * between two anions
-	     */
-	    n = m_kk*j + k;
-	    counterIJ = m_CounterIJ[n];
-
-	    sum3 = sum3 + molality[j]*molality[k]*Phiphi_LL[counterIJ];
-	    for (m = 1; m < m_kk; m++) {
-	      if (charge[m] > 0.0) {
-		n = m + k * m_kk + j * m_kk * m_kk;
-		sum3 = sum3 + 
-		  molality[j]*molality[k]*molality[m]*psi_ijk_LL[n];
-	      }
-	    }
-	  }
-	}
-      }
-	  
-      /*
-       * Loop Over Neutral Species
-       */
-      if (charge[j] == 0) {
-	for (k = 1; k < m_kk; k++) {
-	  if (charge[k] < 0.0) {
-	    sum4 = sum4 + molality[j]*molality[k]*m_Lambda_nj_LL(j,k);
-	  }
-	  if (charge[k] > 0.0) {
-	    sum5 = sum5 + molality[j]*molality[k]*m_Lambda_nj_LL(j,k);
-	  }
-	  if (charge[k] == 0.0) {
-	    if (k > j) {
-	      sum6 = sum6 + molality[j]*molality[k]*m_Lambda_nj_LL(j,k);
-	    } else if (k == j) {
-	      sum6 = sum6 + 0.5 * molality[j]*molality[k]*m_Lambda_nj_LL(j,k);
-	    }
-	  }
-	  if (charge[k] < 0.0) {
-	    int izeta = j;
-	    for (m = 1; m < m_kk; m++) {
-	      if (charge[m] > 0.0) {
-		int jzeta = m;
-		n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-		double zeta_LL = psi_ijk_LL[n];
-		if (zeta_LL != 0.0) {
-		  sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta_LL;
-		}
-	      }
-	    }
-	  }
-	}
-
-	sum7 += molality[j] * molality[j] * molality[j] * m_Mu_nnn_LL[j];
-      }
-    }
-    sum_m_phi_minus_1 = 2.0 * 
-      (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7);
-    /*
-     * Calculate the osmotic coefficient from 
-     *       osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
-     */
-    if (molalitysum > 1.0E-150) {
-      d2_osmotic_coef_dT2 = 0.0 + (sum_m_phi_minus_1 / molalitysum);
-    } else {
-      d2_osmotic_coef_dT2 = 0.0;
-    }
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" term1=%10.6f sum1=%10.6f sum2=%10.6f "
-	     "sum3=%10.6f sum4=%10.6f sum5=%10.6f\n",
-	     term1, sum1, sum2, sum3, sum4, sum5);
-      printf("     sum_m_phi_minus_1=%10.6f        d2_osmotic_coef_dT2=%10.6f\n", 
-	     sum_m_phi_minus_1, d2_osmotic_coef_dT2);
-    }
-
-    if (m_debugCalc) {
-      printf(" Step 10: \n");
-    }
-#endif
-    d2_lnwateract_dT2 = -(m_weightSolvent/1000.0) * molalitysum * d2_osmotic_coef_dT2;
-
-    /*
-     * In Cantera, we define the activity coefficient of the solvent as
-     *
-     *     act_0 = actcoeff_0 * Xmol_0
-     *
-     * We have just computed act_0. However, this routine returns
-     *  ln(actcoeff[]). Therefore, we must calculate ln(actcoeff_0).
-     */
-    m_d2lnActCoeffMolaldT2_Unscaled[0] = d2_lnwateract_dT2;
-
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      double d2_wateract_dT2 = exp(d2_lnwateract_dT2);
-      printf(" d2_ln_a_water_dT2 = %10.6f d2_a_water_dT2=%10.6f\n\n", 
-	     d2_lnwateract_dT2, d2_wateract_dT2); 
-    }
-#endif
-  }
-
-  /********************************************************************************************/
-
-  /*
-   * s_update_dlnMolalityActCoeff_dP()         (private, const )
-   *
-   *   Using internally stored values, this function calculates
-   *   the pressure derivative of the logarithm of the
-   *   activity coefficient for all species in the mechanism.
-   *
-   *   We assume that the activity coefficients are current.
-   *
-   *   solvent activity coefficient is on the molality
-   *   scale. It's derivative is too.
-   */
-  void HMWSoln::s_update_dlnMolalityActCoeff_dP() const {
- 
-    fbo_zero_dbl_1(DATA_PTR(m_dlnActCoeffMolaldP_Unscaled), m_kk);
-  
-    s_updatePitzer_dlnMolalityActCoeff_dP();
-
-
-    for (int k = 1; k < m_kk; k++) {
-      if (CROP_speciesCropped_[k] == 2) {
-	m_dlnActCoeffMolaldP_Unscaled[k] = 0.0;
-      }
-    }
-
-    if (CROP_speciesCropped_[0]) {
-      m_dlnActCoeffMolaldP_Unscaled[0] = 0.0;
-    }
-
-
-    s_updateScaling_pHScaling_dP();
-  }
-
-  /*
-   * s_updatePitzer_dlnMolalityActCoeff_dP()         (private, const )
-   *
-   *   Using internally stored values, this function calculates
-   *   the pressure derivative of the logarithm of the
-   *   activity coefficient for all species in the mechanism.
-   *   This is an internal routine
-   *
-   *   We assume that the activity coefficients are current.
-   *
-   * It may be assumed that the 
-   * Pitzer activity coefficient and first deriv routine are called immediately
-   * preceding the calling of this routine. Therefore, some
-   * quantities do not need to be recalculated in this routine.
-   *
-   *   solvent activity coefficient is on the molality
-   *   scale. It's derivatives are too.
-   */
-  void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const {
-   
-    /*
-     * HKM -> Assumption is made that the solvent is
-     *        species 0.
-     */
-#ifdef DEBUG_MODE
-    m_debugCalc = 0;
-#endif
-    if (m_indexSolvent != 0) {
-      printf("Wrong index solvent value!\n");
-      exit(EXIT_FAILURE);
-    }
-
-    double d_wateract_dP;
-    std::string sni, snj, snk; 
-
-    const double *molality  =  DATA_PTR(m_molalitiesCropped);
-    const double *charge    =  DATA_PTR(m_speciesCharge);
-    const double *beta0MX_P =  DATA_PTR(m_Beta0MX_ij_P);
-    const double *beta1MX_P =  DATA_PTR(m_Beta1MX_ij_P);
-    const double *beta2MX_P =  DATA_PTR(m_Beta2MX_ij_P);
-    const double *CphiMX_P  =  DATA_PTR(m_CphiMX_ij_P);
-    const double *thetaij_P =  DATA_PTR(m_Theta_ij_P);
-    const double *alpha1MX  =  DATA_PTR(m_Alpha1MX_ij);
-    const double *alpha2MX  =  DATA_PTR(m_Alpha2MX_ij);
-    const double *psi_ijk_P =  DATA_PTR(m_Psi_ijk_P);
-
-    /*
-     * Local variables defined by Coltrin
-     */
-    double etheta[5][5], etheta_prime[5][5], sqrtIs;
-    /*
-     * Molality based ionic strength of the solution
-     */
-    double Is = 0.0;
-    /*
-     * Molarcharge of the solution: In Pitzer's notation, 
-     * this is his variable called "Z".
-     */
-    double molarcharge = 0.0;
-    /*
-     * molalitysum is the sum of the molalities over all solutes,
-     * even those with zero charge.
-     */
-    double molalitysum = 0.0;
-
-    double *gfunc    =  DATA_PTR(m_gfunc_IJ);
-    double *g2func   =  DATA_PTR(m_g2func_IJ);
-    double *hfunc    =  DATA_PTR(m_hfunc_IJ);
-    double *h2func   =  DATA_PTR(m_h2func_IJ);
-    double *BMX_P    =  DATA_PTR(m_BMX_IJ_P);
-    double *BprimeMX_P= DATA_PTR(m_BprimeMX_IJ_P);
-    double *BphiMX_P =  DATA_PTR(m_BphiMX_IJ_P);
-    double *Phi_P    =  DATA_PTR(m_Phi_IJ_P);
-    double *Phiprime =  DATA_PTR(m_Phiprime_IJ);
-    double *Phiphi_P =  DATA_PTR(m_PhiPhi_IJ_P);
-    double *CMX_P    =  DATA_PTR(m_CMX_IJ_P);
-
-    double x1, x2;
-    double Aphi, dFdP, zsqdFdP;
-    double sum1, sum2, sum3, sum4, sum5, term1;
-    double sum_m_phi_minus_1, d_osmotic_coef_dP, d_lnwateract_dP;
-
-    int z1, z2;
-    int n, i, j, k, m, counterIJ,  counterIJ2;
-
-    double currTemp = temperature();
-    double currPres = pressure();
-
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf("\n Debugging information from "
-	     "s_Pitzer_dlnMolalityActCoeff_dP()\n");
-    }
-#endif
-    /*
-     * Make sure the counter variables are setup
-     */
-    counterIJ_setup();
-
-    /*
-     * ---------- Calculate common sums over solutes ---------------------
-     */
-    for (n = 1; n < m_kk; n++) {
-      //      ionic strength
-      Is += charge[n] * charge[n] * molality[n];
-      //      total molar charge
-      molarcharge +=  fabs(charge[n]) * molality[n];
-      molalitysum += molality[n];
-    }
-    Is *= 0.5;
-
-    /*
-     * Store the ionic molality in the object for reference.
-     */
-    m_IionicMolality = Is;
-    sqrtIs = sqrt(Is);
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 1: \n");
-      printf(" ionic strenth      = %14.7le \n total molar "
-	     "charge = %14.7le \n", Is, molarcharge);
-    }
-#endif
-
-    /*
-     * The following call to calc_lambdas() calculates all 16 elements
-     * of the elambda and elambda1 arrays, given the value of the 
-     * ionic strength (Is)
-     */
-    calc_lambdas(Is);
-
-
-    /*
-     * ----- Step 2:  Find the coefficients E-theta and -------------------
-     *                E-thetaprime for all combinations of positive 
-     *                unlike charges up to 4
-     */
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 2: \n");
-    }
-#endif
-    for (z1 = 1; z1 <=4; z1++) {
-      for (z2 =1; z2 <=4; z2++) {
-	calc_thetas(z1, z2, &etheta[z1][z2], &etheta_prime[z1][z2]);
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  printf(" z1=%3d z2=%3d E-theta(I) = %f, E-thetaprime(I) = %f\n", 
-		 z1, z2, etheta[z1][z2], etheta_prime[z1][z2]);
-	}
-#endif
-      }
-    }
-
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 3: \n");
-      printf(" Species          Species            g(x) "
-	     " hfunc(x)   \n");
-    }
-#endif
-   
-    /*
-     *
-     *  calculate g(x) and hfunc(x) for each cation-anion pair MX
-     *   In the original literature, hfunc, was called gprime. However,
-     *   it's not the derivative of g(x), so I renamed it.
-     */
-    for (i = 1; i < (m_kk - 1); i++) {
-      for (j = (i+1); j < m_kk; j++) {
-	/*
-	 * Find the counterIJ for the symmetric binary interaction
-	 */
-	n = m_kk*i + j;
-	counterIJ = m_CounterIJ[n];
-	/*
-	 * Only loop over oppositely charge species
-	 */
-	if (charge[i]*charge[j] < 0) {
-	  /*
-	   * x is a reduced function variable
-	   */
-	  x1 = sqrtIs * alpha1MX[counterIJ];
-	  if (x1 > 1.0E-100) {
-	    gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-	    hfunc[counterIJ] = -2.0*
-	      (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
-	  }
-	  else {
-	    gfunc[counterIJ] = 0.0;
-	    hfunc[counterIJ] = 0.0;
-	  }
-	  
-	  if (beta2MX_P[counterIJ] != 0.0) {
-	    x2 = sqrtIs * alpha2MX[counterIJ];
-	    if (x2 > 1.0E-100) {
-	      g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-	      h2func[counterIJ] = -2.0 *
-		(1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-	    } else {
-	      g2func[counterIJ] = 0.0;
-	      h2func[counterIJ] = 0.0;
-	    }
-	  }
-	} 
-	else {
-	  gfunc[counterIJ] = 0.0;
-	  hfunc[counterIJ] = 0.0;
-	}
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  snj = speciesName(j);
-	  printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(), 
-		 gfunc[counterIJ], hfunc[counterIJ]);
-	}
-#endif
-      }
-    }
-
-    /*
-     * ------- SUBSECTION TO CALCULATE BMX_P, BprimeMX_P, BphiMX_P ----------
-     * ------- These are now temperature derivatives of the
-     *         previously calculated quantities.
-     */
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 4: \n");
-      printf(" Species          Species            BMX    "
-	     "BprimeMX    BphiMX   \n");
-    }
-#endif
-
-    for (i = 1; i < m_kk - 1; i++) {
-      for (j = i+1; j < m_kk; j++) {
-	/*
-	 * Find the counterIJ for the symmetric binary interaction
-	 */
-	n = m_kk*i + j;
-	counterIJ = m_CounterIJ[n];
-	/*
-	 * 	both species have a non-zero charge, and one is positive
-	 *  and the other is negative
-	 */
-	if (charge[i]*charge[j] < 0.0) {	
-	  BMX_P[counterIJ]  = beta0MX_P[counterIJ]
-	    + beta1MX_P[counterIJ] * gfunc[counterIJ]
-	    + beta2MX_P[counterIJ] * g2func[counterIJ];
-#ifdef DEBUG_MODE
-	  if (m_debugCalc) {
-	    printf("%d %g: %g %g %g %g\n",
-		   counterIJ,  BMX_P[counterIJ], beta0MX_P[counterIJ],
-		   beta1MX_P[counterIJ], beta2MX_P[counterIJ], gfunc[counterIJ]);
-	  }
-#endif
-	  if (Is > 1.0E-150) {
-	    BprimeMX_P[counterIJ] = (beta1MX_P[counterIJ] * hfunc[counterIJ]/Is +
-				     beta2MX_P[counterIJ] * h2func[counterIJ]/Is);
-	  } else {
-	    BprimeMX_P[counterIJ] = 0.0;
-	  }
-	  BphiMX_P[counterIJ] = BMX_P[counterIJ] + Is*BprimeMX_P[counterIJ];
-	} 
-	else {
-	  BMX_P[counterIJ]      = 0.0;
-	  BprimeMX_P[counterIJ] = 0.0;
-	  BphiMX_P[counterIJ]     = 0.0;
-	}
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  snj = speciesName(j);
-	  printf(" %-16s %-16s %11.7f %11.7f %11.7f \n", 
-		 sni.c_str(), snj.c_str(), 
-		 BMX_P[counterIJ], BprimeMX_P[counterIJ], BphiMX_P[counterIJ]);
-	}
-#endif
-      }
-    }
-
-    /*
-     * --------- SUBSECTION TO CALCULATE CMX_P ----------
-     * ---------
-     */
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 5: \n");
-      printf(" Species          Species            CMX \n");
-    }
-#endif
-    for (i = 1; i < m_kk-1; i++) {
-      for (j = i+1; j < m_kk; j++) {
-	/*
-	 * Find the counterIJ for the symmetric binary interaction
-	 */
-	n = m_kk*i + j;
-	counterIJ = m_CounterIJ[n];
-	/*
-	 * 	both species have a non-zero charge, and one is positive
-	 *  and the other is negative
-	 */
-	if (charge[i]*charge[j] < 0.0) {
-	  CMX_P[counterIJ] = CphiMX_P[counterIJ]/ 
-	    (2.0* sqrt(fabs(charge[i]*charge[j])));
-	} 
-	else {
-	  CMX_P[counterIJ] = 0.0;
-	}
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  snj = speciesName(j);
-	  printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
-		 CMX_P[counterIJ]);
-	}
-#endif
-      }
-    }
-
-    /*
-     * ------- SUBSECTION TO CALCULATE Phi, PhiPrime, and PhiPhi ----------
-     * --------
+     * ----------- SUBSECTION FOR CALCULATION OF dF ---------------------
      */
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 6: \n");
-      printf(" Species          Species            Phi_ij "
-	     " Phiprime_ij  Phi^phi_ij \n");
+    dAphi[0] = dA_DebyedT_TP() / 3.0;
+    dAphi[1] = d2A_DebyedT2_TP() / 3.0;
+    dAphi[2] = dA_DebyedP_TP(temperature(), pressure()) / 3.0;
+    double fIs = sqrtIs / (1.0 + 1.2*sqrtIs) + (2.0/1.2) * log(1.0+1.2*sqrtIs);
+    for (d = 0; d < 3; d++) {
+      dF[d] = -dAphi[d] * fIs;
     }
-#endif
     for (i = 1; i < m_kk-1; i++) {
+      if (charge[i] == 0.0) continue;
       for (j = i+1; j < m_kk; j++) {
-	/*
-	 * Find the counterIJ for the symmetric binary interaction
-	 */
-	n = m_kk*i + j;
-	counterIJ = m_CounterIJ[n];
-	/*
-	 * 	both species have a non-zero charge, and one is positive
-	 *  and the other is negative
-	 */
-	if (charge[i]*charge[j] > 0) {
-	  z1 = (int) fabs(charge[i]);
-	  z2 = (int) fabs(charge[j]);
-	  //Phi[counterIJ] = thetaij_L[counterIJ] + etheta[z1][z2];
-	  Phi_P[counterIJ] = thetaij_P[counterIJ];
-	  //Phiprime[counterIJ] = etheta_prime[z1][z2];
-	  Phiprime[counterIJ] = 0.0;
-	  Phiphi_P[counterIJ] = Phi_P[counterIJ] + Is * Phiprime[counterIJ];
-	} 
-	else {
-	  Phi_P[counterIJ]      = 0.0;
-	  Phiprime[counterIJ] = 0.0;
-	  Phiphi_P[counterIJ]   = 0.0;
-	}
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  snj = speciesName(j);
-	  printf(" %-16s %-16s %10.6f %10.6f %10.6f \n", 
-		 sni.c_str(), snj.c_str(),
-		 Phi_P[counterIJ], Phiprime[counterIJ], Phiphi_P[counterIJ] );
+	if (charge[i]*charge[j] < 0) {
+	  n = m_kk*i + j;
+	  counterIJ = m_CounterIJ[n];
+	  mm = molality[i]*molality[j];
+	  for (d = 0; d < 3; d++) {
+	    dF[d] += mm * BprimeMX[d][counterIJ];
+	  }
 	}
-#endif
       }
     }
 
     /*
-     * ----------- SUBSECTION FOR CALCULATION OF dFdT ---------------------
+     * The ternary CMX term is abs(z_i) times the same sum over all
+     * cation-anion pairs for every ion.
      */
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 7: \n");
-    }
-#endif
-    // A_Debye_Huckel = 0.5092; (units = sqrt(kg/gmol))
-    // A_Debye_Huckel = 0.5107; <- This value is used to match GWB data
-    //                             ( A * ln(10) = 1.17593)
-    // Aphi = A_Debye_Huckel * 2.30258509 / 3.0;
-    Aphi = m_A_Debye / 3.0;
-
-    double dA_DebyedP = dA_DebyedP_TP(currTemp, currPres);
-    double dAphidP = dA_DebyedP /3.0;
-#ifdef DEBUG_MODE
-    //dAphidT = 0.0;
-#endif
-    //F = -Aphi * ( sqrt(Is) / (1.0 + 1.2*sqrt(Is)) 
-    //      + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
-    //dAphidT = Al / (4.0 * GasConstant * T * T);
-    dFdP = -dAphidP * ( sqrt(Is) / (1.0 + 1.2*sqrt(Is)) 
-			+ (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" initial value of dFdP = %10.6f \n", dFdP );		
+    for (d = 0; d < 3; d++) {
+      sumMMCMX[d] = 0.0;
     }
-#endif
-    for (i = 1; i < m_kk-1; i++) {
-      for (j = i+1; j < m_kk; j++) {
-	/*
-	 * Find the counterIJ for the symmetric binary interaction
-	 */
-	n = m_kk*i + j;
-	counterIJ = m_CounterIJ[n];
-	/*
-	 * 	both species have a non-zero charge, and one is positive
-	 *  and the other is negative
-	 */
-	if (charge[i]*charge[j] < 0) {
-	  dFdP = dFdP + molality[i]*molality[j] * BprimeMX_P[counterIJ];
-	}
-	/*
-	 * Both species have a non-zero charge, and they
-	 * have the same sign, e.g., both positive or both negative.
-	 */
-	if (charge[i]*charge[j] > 0) {
-	  dFdP = dFdP + molality[i]*molality[j] * Phiprime[counterIJ];
+    for (j = 1; j < m_kk; j++) {
+      if (charge[j] > 0.0) {
+	for (k = 1; k < m_kk; k++) {
+	  if (charge[k] < 0.0) {
+	    counterIJ = m_CounterIJ[m_kk*j + k];
+	    mm = molality[j]*molality[k];
+	    for (d = 0; d < 3; d++) {
+	      sumMMCMX[d] += mm*CMX[d][counterIJ];
+	    }
+	  }
 	}
-#ifdef DEBUG_MODE
-	if (m_debugCalc) printf(" dFdP = %10.6f \n", dFdP);
-#endif
       }
     }
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 8: \n");
-    }
-#endif
-
 
     for (i = 1; i < m_kk; i++) {
 
       /*
-       * -------- SUBSECTION FOR CALCULATING THE dACTCOEFFdP FOR CATIONS -----
+       * -------- SUBSECTION FOR CALCULATING THE DERIVATIVES FOR CATIONS -----
        * --
        */
       if (charge[i] > 0 ) {
-	// species i is the cation (positive) to calc the actcoeff
-	zsqdFdP = charge[i]*charge[i]*dFdP;
-	sum1 = 0.0;
-	sum2 = 0.0;
-	sum3 = 0.0;
-	sum4 = 0.0;
-	sum5 = 0.0;
+	for (d = 0; d < 3; d++) {
+	  sum1[d] = sum2[d] = sum3[d] = sum5[d] = 0.0;
+	  sum4[d] = fabs(charge[i])*sumMMCMX[d];
+	}
 	for (j = 1; j < m_kk; j++) {
 	  /*
 	   * Find the counterIJ for the symmetric binary interaction
 	   */
 	  n = m_kk*i + j;
 	  counterIJ = m_CounterIJ[n];
+	  ij = n;
 
 	  if (charge[j] < 0.0) {
 	    // sum over all anions
-	    sum1 = sum1 + molality[j]*
-	      (2.0*BMX_P[counterIJ] + molarcharge*CMX_P[counterIJ]);
-	    if (j < m_kk-1) {
-	      /*
-	       * This term is the ternary interaction involving the 
-	       * non-duplicate sum over double anions, j, k, with
-	       * respect to the cation, i.
-	       */
-	      for (k = j+1; k < m_kk; k++) {
-		// an inner sum over all anions
-		if (charge[k] < 0.0) {
-		  n = k + j * m_kk + i * m_kk * m_kk;
-		  sum3 = sum3 + molality[j]*molality[k]*psi_ijk_P[n];
+	    for (d = 0; d < 3; d++) {
+	      sum1[d] += molality[j]*
+		(2.0*BMX[d][counterIJ] + molarcharge*CMX[d][counterIJ]);
+	    }
+	    /*
+	     * This term is the ternary interaction involving the
+	     * non-duplicate sum over double anions, j, k, with
+	     * respect to the cation, i.
+	     */
+	    for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	      k = m_PsiRowSpecies[p];
+	      if (k > j && charge[k] < 0.0) {
+		n = k + ij * m_kk;
+		mm = molality[j]*molality[k];
+		for (d = 0; d < 3; d++) {
+		  sum3[d] += mm*psi_ijk[d][n];
 		}
 	      }
 	    }
 	  }
 
-	     
 	  if (charge[j] > 0.0) {
 	    // sum over all cations
 	    if (j != i) {
-	      sum2 = sum2 + molality[j]*(2.0*Phi_P[counterIJ]);
+	      for (d = 0; d < 3; d++) {
+		sum2[d] += molality[j]*(2.0*Phi[d][counterIJ]);
+	      }
 	    }
-	    for (k = 1; k < m_kk; k++) {
+	    for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	      k = m_PsiRowSpecies[p];
 	      if (charge[k] < 0.0) {
 		// two inner sums over anions
-
-		n = k + j * m_kk + i * m_kk * m_kk;
-		sum2 = sum2 + molality[j]*molality[k]*psi_ijk_P[n];
-		/*
-		 * Find the counterIJ for the j,k interaction
-		 */
-		n = m_kk*j + k;
-		counterIJ2 = m_CounterIJ[n];
-		sum4 = sum4 + (fabs(charge[i])*
-			       molality[j]*molality[k]*CMX_P[counterIJ2]);
+		n = k + ij * m_kk;
+		mm = molality[j]*molality[k];
+		for (d = 0; d < 3; d++) {
+		  sum2[d] += mm*psi_ijk[d][n];
+		}
 	      }
 	    }
 	  }
 
 	  /*
-	   * for Anions, do the neutral species interaction
+	   * for Cations, do the neutral species interaction
 	   */
 	  if (charge[j] == 0) {
-	    sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_P(j,i);
+	    for (d = 0; d < 3; d++) {
+	      sum5[d] += molality[j]*2.0*(*lambda_nj[d])(j,i);
+	    }
 	    /*
 	     * Zeta interaction term
 	     */
-	    for (int k = 1; k < m_kk; k++) {
+	    int ijzeta = j * m_kk + i;
+	    for (p = m_PsiRowStart[ijzeta]; p < m_PsiRowStart[ijzeta+1]; p++) {
+	      k = m_PsiRowSpecies[p];
 	      if (charge[k] < 0.0) {
-		int izeta = j;
-		int jzeta = i;
-		n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-		double zeta_P = psi_ijk_P[n];
-		if (zeta_P != 0.0) {
-		  sum5 = sum5 + molality[j]*molality[k]*zeta_P;
+		n = ijzeta * m_kk + k;
+		mm = molality[j]*molality[k];
+		for (d = 0; d < 3; d++) {
+		  zeta = psi_ijk[d][n];
+		  if (zeta != 0.0) {
+		    sum5[d] += mm*zeta;
+		  }
 		}
 	      }
 	    }
@@ -5714,55 +3977,48 @@ namespace Cantera {
 	}
 
 	/*
-	 * Add all of the contributions up to yield the log of the
-	 * solute activity coefficients (molality scale)
+	 * Add all of the contributions up to yield the derivatives
+	 * of the log of the solute activity coefficients (molality scale)
 	 */
-	m_dlnActCoeffMolaldP_Unscaled[i] =
-	  zsqdFdP + sum1 + sum2 + sum3 + sum4 + sum5;
-
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  printf(" %-16s lngamma[i]=%10.6f \n", 
-		 sni.c_str(), m_dlnActCoeffMolaldP_Unscaled[i]);
-	  printf("                   %12g %12g %12g %12g %12g %12g\n",
-		 zsqdFdP, sum1, sum2, sum3, sum4, sum5);
+	for (d = 0; d < 3; d++) {
+	  dlnActCoeff[d][i] = charge[i]*charge[i]*dF[d]
+	    + sum1[d] + sum2[d] + sum3[d] + sum4[d] + sum5[d];
 	}
-#endif
       }
 
-
       /*
-       * ------ SUBSECTION FOR CALCULATING THE dACTCOEFFdP FOR ANIONS ------
+       * ------ SUBSECTION FOR CALCULATING THE DERIVATIVES FOR ANIONS ------
        *
        */
       if (charge[i] < 0) {
-	//          species i is an anion (negative)
-	zsqdFdP = charge[i]*charge[i]*dFdP;
-	sum1 = 0.0;
-	sum2 = 0.0;
-	sum3 = 0.0;
-	sum4 = 0.0;
-	sum5 = 0.0;
+	for (d = 0; d < 3; d++) {
+	  sum1[d] = sum2[d] = sum3[d] = sum5[d] = 0.0;
+	  sum4[d] = fabs(charge[i])*sumMMCMX[d];
+	}
 	for (j = 1; j < m_kk; j++) {
 	  /*
 	   * Find the counterIJ for the symmetric binary interaction
 	   */
 	  n = m_kk*i + j;
 	  counterIJ = m_CounterIJ[n];
+	  ij = n;
 
 	  /*
 	   * For Anions, do the cation interactions.
 	   */
 	  if (charge[j] > 0) {
-	    sum1 = sum1 + molality[j]*
-	      (2.0*BMX_P[counterIJ] + molarcharge*CMX_P[counterIJ]);
-	    if (j < m_kk-1) {
-	      for (k = j+1; k < m_kk; k++) {
-		// an inner sum over all cations
-		if (charge[k] > 0) {
-		  n = k + j * m_kk + i * m_kk * m_kk;
-		  sum3 = sum3 + molality[j]*molality[k]*psi_ijk_P[n];
+	    for (d = 0; d < 3; d++) {
+	      sum1[d] += molality[j]*
+		(2.0*BMX[d][counterIJ] + molarcharge*CMX[d][counterIJ]);
+	    }
+	    for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	      k = m_PsiRowSpecies[p];
+	      // an inner sum over all cations
+	      if (k > j && charge[k] > 0) {
+		n = k + ij * m_kk;
+		mm = molality[j]*molality[k];
+		for (d = 0; d < 3; d++) {
+		  sum3[d] += mm*psi_ijk[d][n];
 		}
 	      }
 	    }
@@ -5774,21 +4030,19 @@ namespace Cantera {
 	  if (charge[j] < 0.0) {
 	    //  sum over all anions
 	    if (j != i) {
-	      sum2 = sum2 + molality[j]*(2.0*Phi_P[counterIJ]);
+	      for (d = 0; d < 3; d++) {
+		sum2[d] += molality[j]*(2.0*Phi[d][counterIJ]);
+	      }
 	    }
-	    for (k = 1; k < m_kk; k++) {
+	    for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	      k = m_PsiRowSpecies[p];
 	      if (charge[k] > 0.0) {
 		// two inner sums over cations
-		n = k + j * m_kk + i * m_kk * m_kk;
-		sum2 = sum2 + molality[j]*molality[k]*psi_ijk_P[n];
-		/*
-		 * Find the counterIJ for the symmetric binary interaction
-		 */
-		n = m_kk*j + k;
-		counterIJ2 = m_CounterIJ[n];
-		sum4 = sum4 + 
-		  (fabs(charge[i])*
-		   molality[j]*molality[k]*CMX_P[counterIJ2]);
+		n = k + ij * m_kk;
+		mm = molality[j]*molality[k];
+		for (d = 0; d < 3; d++) {
+		  sum2[d] += mm*psi_ijk[d][n];
+		}
 	      }
 	    }
 	  }
@@ -5797,95 +4051,80 @@ namespace Cantera {
 	   * for Anions, do the neutral species interaction
 	   */
 	  if (charge[j] == 0.0) {
-	    sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_P(j,i);
+	    for (d = 0; d < 3; d++) {
+	      sum5[d] += molality[j]*2.0*(*lambda_nj[d])(j,i);
+	    }
 	    /*
 	     * Zeta interaction term
 	     */
-	    for (int k = 1; k < m_kk; k++) {
+	    for (k = 1; k < m_kk; k++) {
 	      if (charge[k] > 0.0) {
-		int izeta = j;
-		int jzeta = k;
-		int kzeta = i;
-		n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-		double zeta_P = psi_ijk_P[n];
-		if (zeta_P != 0.0) {
-		  sum5 = sum5 + molality[j]*molality[k]*zeta_P;
+		n = j * m_kk * m_kk + k * m_kk + i;
+		mm = molality[j]*molality[k];
+		for (d = 0; d < 3; d++) {
+		  zeta = psi_ijk[d][n];
+		  if (zeta != 0.0) {
+		    sum5[d] += mm*zeta;
+		  }
 		}
 	      }
 	    }
 	  }
 	}
-	m_dlnActCoeffMolaldP_Unscaled[i] = 
-	  zsqdFdP + sum1 + sum2 + sum3 + sum4 + sum5;
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  printf(" %-16s lndactcoeffmolaldP[i]=%10.6f \n", 
-		 sni.c_str(), m_dlnActCoeffMolaldP_Unscaled[i]);
-	  printf("                   %12g %12g %12g %12g %12g %12g\n",
-		 zsqdFdP, sum1, sum2, sum3, sum4, sum5);
+	for (d = 0; d < 3; d++) {
+	  dlnActCoeff[d][i] = charge[i]*charge[i]*dF[d]
+	    + sum1[d] + sum2[d] + sum3[d] + sum4[d] + sum5[d];
 	}
-#endif
       }
 
       /*
-       * ------ SUBSECTION FOR CALCULATING d NEUTRAL SOLUTE ACT COEFF dP -------
+       * ------ SUBSECTION FOR CALCULATING NEUTRAL SOLUTE DERIVATIVES -------
        */
       if (charge[i] == 0.0) {
-	sum1 = 0.0;
-	sum3 = 0.0;
+	for (d = 0; d < 3; d++) {
+	  sum1[d] = sum3[d] = 0.0;
+	}
 	for (j = 1; j < m_kk; j++) {
-	  sum1 +=  molality[j]*2.0*m_Lambda_nj_P(i,j);
+	  for (d = 0; d < 3; d++) {
+	    sum1[d] += molality[j]*2.0*(*lambda_nj[d])(i,j);
+	  }
 	  /*
 	   * Zeta term -> we piggyback on the psi term
 	   */
 	  if (charge[j] > 0.0) {
-	    for (k = 1; k < m_kk; k++) {
+	    ij = m_kk*i + j;
+	    for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	      k = m_PsiRowSpecies[p];
 	      if (charge[k] < 0.0) {
-		n = k + j * m_kk + i * m_kk * m_kk;
-		sum3 = sum3 + molality[j]*molality[k]*psi_ijk_P[n];
+		n = k + ij * m_kk;
+		mm = molality[j]*molality[k];
+		for (d = 0; d < 3; d++) {
+		  sum3[d] += mm*psi_ijk[d][n];
+		}
 	      }
 	    }
 	  }
 	}
-	sum2 = 3.0 * molality[i] * molality[i] * m_Mu_nnn_P[i];
-	m_dlnActCoeffMolaldP_Unscaled[i] = sum1 + sum2 + sum3;
-#ifdef DEBUG_MODE
-	if (m_debugCalc) {
-	  sni = speciesName(i);
-	  printf(" %-16s dlnActCoeffMolaldP[i]=%10.6f \n", 
-		 sni.c_str(), m_dlnActCoeffMolaldP_Unscaled[i]);
+	for (d = 0; d < 3; d++) {
+	  dlnActCoeff[d][i] = sum1[d] + sum3[d]
+	    + 3.0 * molality[i] * molality[i] * mu_nnn[d][i];
 	}
-#endif
       }
-
     }
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" Step 9: \n");
-    }
-#endif
 
     /*
-     * ------ SUBSECTION FOR CALCULATING THE d OSMOTIC COEFF dP ---------
+     * ------ SUBSECTION FOR CALCULATING THE OSMOTIC COEFF DERIVATIVES ------
      *
      */
-    sum1 = 0.0;
-    sum2 = 0.0;
-    sum3 = 0.0;
-    sum4 = 0.0;
-    sum5 = 0.0;
-    double sum6 = 0.0;
-    double sum7 = 0.0;
-    /*
-     * term1 is the temperature derivative of the
-     * DH term in the osmotic coefficient expression
-     * b = 1.2 sqrt(kg/gmol) <- arbitrarily set in all Pitzer 
-     *                          implementations.
-     * Is = Ionic strength on the molality scale (units of (gmol/kg))
-     * Aphi = A_Debye / 3   (units of sqrt(kg/gmol))
-     */
-    term1 = -dAphidP * Is * sqrt(Is) / (1.0 + 1.2 * sqrt(Is));
+    for (d = 0; d < 3; d++) {
+      sum1[d] = sum2[d] = sum3[d] = sum4[d] = 0.0;
+      sum5[d] = sum6[d] = sum7[d] = 0.0;
+      /*
+       * term1 is the derivative of the DH term in the
+       * osmotic coefficient expression
+       */
+      term1[d] = -dAphi[d] * Is * sqrtIs / (1.0 + 1.2 * sqrtIs);
+    }
 
     for (j = 1; j < m_kk; j++) {
       /*
@@ -5897,152 +4136,146 @@ namespace Cantera {
 	    /*
 	     * Find the counterIJ for the symmetric j,k binary interaction
 	     */
-	    n = m_kk*j + k;
-	    counterIJ = m_CounterIJ[n];
-	
-	    sum1 = sum1 + molality[j]*molality[k]*
-	      (BphiMX_P[counterIJ] + molarcharge*CMX_P[counterIJ]);
+	    counterIJ = m_CounterIJ[m_kk*j + k];
+	    mm = molality[j]*molality[k];
+	    for (d = 0; d < 3; d++) {
+	      sum1[d] += mm*(BphiMX[d][counterIJ] + molarcharge*CMX[d][counterIJ]);
+	    }
 	  }
 	}
 
 	for (k = j+1; k < m_kk; k++) {
-	  if (j == (m_kk-1)) {
-	    // we should never reach this step
-	    printf("logic error 1 in Step 9 of hmw_act");
-	    exit(EXIT_FAILURE);
-	  }
 	  if (charge[k] > 0.0) {
 	    /*
 	     * Find the counterIJ for the symmetric j,k binary interaction
 	     * between 2 cations.
 	     */
-	    n = m_kk*j + k;
-	    counterIJ = m_CounterIJ[n];
-	    sum2 = sum2 + molality[j]*molality[k]*Phiphi_P[counterIJ];
-	    for (m = 1; m < m_kk; m++) {
+	    counterIJ = m_CounterIJ[m_kk*j + k];
+	    mm = molality[j]*molality[k];
+	    for (d = 0; d < 3; d++) {
+	      sum2[d] += mm*Phiphi[d][counterIJ];
+	    }
+	    ij = m_kk*j + k;
+	    for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	      m = m_PsiRowSpecies[p];
 	      if (charge[m] < 0.0) {
 		// species m is an anion
-		n = m + k * m_kk + j * m_kk * m_kk;
-		sum2 = sum2 + 
-		  molality[j]*molality[k]*molality[m]*psi_ijk_P[n];
+		n = m + ij * m_kk;
+		for (d = 0; d < 3; d++) {
+		  sum2[d] += mm*molality[m]*psi_ijk[d][n];
+		}
 	      }
 	    }
 	  }
 	}
       }
-	 
-      
+
       /*
        * Loop Over Anions
        */
       if (charge[j] < 0) {
 	for (k = j+1; k < m_kk; k++) {
-	  if (j == m_kk-1) {
-	    // we should never reach this step
-	    printf("logic error 2 in Step 9 of hmw_act");
-	    exit(EXIT_FAILURE);
-	  }
 	  if (charge[k] < 0) {
 	    /*
 	     * Find the counterIJ for the symmetric j,k binary interaction
 	     * between two anions
 	     */
-	    n = m_kk*j + k;
-	    counterIJ = m_CounterIJ[n];
-
-	    sum3 = sum3 + molality[j]*molality[k]*Phiphi_P[counterIJ];
-	    for (m = 1; m < m_kk; m++) {
+	    counterIJ = m_CounterIJ[m_kk*j + k];
+	    mm = molality[j]*molality[k];
+	    for (d = 0; d < 3; d++) {
+	      sum3[d] += mm*Phiphi[d][counterIJ];
+	    }
+	    ij = m_kk*j + k;
+	    for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	      m = m_PsiRowSpecies[p];
 	      if (charge[m] > 0.0) {
-		n = m + k * m_kk + j * m_kk * m_kk;
-		sum3 = sum3 + 
-		  molality[j]*molality[k]*molality[m]*psi_ijk_P[n];
+		n = m + ij * m_kk;
+		for (d = 0; d < 3; d++) {
+		  sum3[d] += mm*molality[m]*psi_ijk[d][n];
+		}
 	      }
 	    }
 	  }
 	}
       }
-	  
+
       /*
        * Loop Over Neutral Species
        */
       if (charge[j] == 0) {
 	for (k = 1; k < m_kk; k++) {
+	  mm = molality[j]*molality[k];
 	  if (charge[k] < 0.0) {
-	    sum4 = sum4 + molality[j]*molality[k]*m_Lambda_nj_P(j,k);
+	    for (d = 0; d < 3; d++) {
+	      sum4[d] += mm*(*lambda_nj[d])(j,k);
+	    }
 	  }
 	  if (charge[k] > 0.0) {
-	    sum5 = sum5 + molality[j]*molality[k]*m_Lambda_nj_P(j,k);
+	    for (d = 0; d < 3; d++) {
+	      sum5[d] += mm*(*lambda_nj[d])(j,k);
+	    }
 	  }
 	  if (charge[k] == 0.0) {
 	    if (k > j) {
-	      sum6 = sum6 + molality[j]*molality[k]*m_Lambda_nj_P(j,k);
+	      for (d = 0; d < 3; d++) {
+		sum6[d] += mm*(*lambda_nj[d])(j,k);
+	      }
 	    } else if (k == j) {
-	      sum6 = sum6 + 0.5 * molality[j]*molality[k]*m_Lambda_nj_P(j,k);
+	      for (d = 0; d < 3; d++) {
+		sum6[d] += 0.5 * mm*(*lambda_nj[d])(j,k);
+	      }
 	    }
 	  }
-	  if (charge[k] < 0.0) {
-	    int izeta = j;
-	    for (m = 1; m < m_kk; m++) {
-	      if (charge[m] > 0.0) {
-		int jzeta = m;
-		n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-		double zeta_P = psi_ijk_P[n];
-		if (zeta_P != 0.0) {
-		  sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta_P;
+	}
+	/*
+	 * Zeta terms for the neutral j, cation m, anion k triplets
+	 */
+	for (m = 1; m < m_kk; m++) {
+	  if (charge[m] > 0.0) {
+	    ij = m_kk*j + m;
+	    for (p = m_PsiRowStart[ij]; p < m_PsiRowStart[ij+1]; p++) {
+	      k = m_PsiRowSpecies[p];
+	      if (charge[k] < 0.0) {
+		n = k + ij * m_kk;
+		mm = molality[j]*molality[k];
+		for (d = 0; d < 3; d++) {
+		  zeta = psi_ijk[d][n];
+		  if (zeta != 0.0) {
+		    sum7[d] += mm*molality[m]*zeta;
+		  }
 		}
 	      }
 	    }
 	  }
 	}
-
-	sum7 += molality[j] * molality[j] * molality[j] * m_Mu_nnn_P[j];
+	for (d = 0; d < 3; d++) {
+	  sum7[d] += molality[j] * molality[j] * molality[j] * mu_nnn[d][j];
+	}
       }
     }
-    sum_m_phi_minus_1 = 2.0 * 
-      (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7);
-
-    /*
-     * Calculate the osmotic coefficient from 
-     *       osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
-     */
-    if (molalitysum > 1.0E-150) {
-      d_osmotic_coef_dP = 0.0 + (sum_m_phi_minus_1 / molalitysum);
-    } else {
-      d_osmotic_coef_dP = 0.0;
-    }
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" term1=%10.6f sum1=%10.6f sum2=%10.6f "
-	     "sum3=%10.6f sum4=%10.6f sum5=%10.6f\n",
-	     term1, sum1, sum2, sum3, sum4, sum5);
-      printf("     sum_m_phi_minus_1=%10.6f        d_osmotic_coef_dP =%10.6f\n", 
-	     sum_m_phi_minus_1, d_osmotic_coef_dP);
-    }
-
-    if (m_debugCalc) {
-      printf(" Step 10: \n");
-    }
-#endif
-    d_lnwateract_dP = -(m_weightSolvent/1000.0) * molalitysum * d_osmotic_coef_dP;
-    d_wateract_dP = exp(d_lnwateract_dP);
 
-    /*
-     * In Cantera, we define the activity coefficient of the solvent as
-     *
-     *     act_0 = actcoeff_0 * Xmol_0
-     *
-     * We have just computed act_0. However, this routine returns
-     *  ln(actcoeff[]). Therefore, we must calculate ln(actcoeff_0).
-     */
-    //double xmolSolvent = moleFraction(m_indexSolvent);
-    m_dlnActCoeffMolaldP_Unscaled[0] = d_lnwateract_dP;
-#ifdef DEBUG_MODE
-    if (m_debugCalc) {
-      printf(" d_ln_a_water_dP = %10.6f d_a_water_dP=%10.6f\n\n", 
-	     d_lnwateract_dP, d_wateract_dP); 
+    for (d = 0; d < 3; d++) {
+      sum_m_phi_minus_1 = 2.0 * (term1[d] + sum1[d] + sum2[d] + sum3[d]
+				 + sum4[d] + sum5[d] + sum6[d] + sum7[d]);
+      /*
+       * Calculate the osmotic coefficient derivative from
+       *       osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
+       */
+      if (molalitysum > 1.0E-150) {
+	d_osmotic_coef = sum_m_phi_minus_1 / molalitysum;
+      } else {
+	d_osmotic_coef = 0.0;
+      }
+      /*
+       * In Cantera, we define the activity coefficient of the solvent as
+       *
+       *     act_0 = actcoeff_0 * Xmol_0
+       *
+       * The mole fraction doesn't depend on T or P, so the derivative
+       * of ln(act_0) is the derivative of ln(actcoeff_0).
+       */
+      dlnActCoeff[d][0] = -(m_weightSolvent/1000.0) * molalitysum * d_osmotic_coef;
     }
-#endif
-
   }
 
   /**********************************************************************************************/
@@ -1010,12 +1010,15 @@ namespace Cantera {
    * \f]
    *
    *  The majority of work for these functions take place in the internal
-   *  routines that calculate the first and second derivatives of the log
-   *  of the activity coefficients wrt temperature,
-   *  s_update_dlnMolalityActCoeff_dT(), s_update_d2lnMolalityActCoeff_dT2(),
-   *  and the first 
+   *  routine that calculates the first and second derivatives of the log
+   *  of the activity coefficients wrt temperature and the first 
    *  derivative of the log activity coefficients wrt pressure,
-   *  s_update_dlnMolalityActCoeff_dP().
+   *  s_update_dlnMolalityActCoeff_TP(). All three derivatives are
+   *  evaluated in a single pass over the Pitzer interaction terms,
+   *  and they are stored along with the activity coefficients
+   *  until the temperature, pressure or composition changes.
+   *  Asking for the enthalpy, heat capacity and volume at the same
+   *  state therefore costs one evaluation of the derivatives.
    *
    * <HR>
    * <H2> %Application within %Kinetics Managers </H2>
@@ -2856,6 +2859,28 @@ namespace Cantera {
      */
     Array2D m_Psi_ijk_coeff;
 
+    //! Starting positions of the rows of the nonzero psi interactions
+    /*!
+     * Real databases only have a handful of nonzero entries in
+     * m_Psi_ijk, so the activity coefficient routines loop over
+     * a compressed list of them instead of over all m_kk**3 entries.
+     * For the row ij = j + i * m_kk, the third indices k of the
+     * nonzero ijk interactions are stored in ascending order in
+     *
+     *   m_PsiRowSpecies[m_PsiRowStart[ij]], ...,
+     *   m_PsiRowSpecies[m_PsiRowStart[ij+1]-1]
+     *
+     * The entry is then n = k + ij * m_kk. Length = m_kk * m_kk + 1.
+     * The lists are made by psiRows_setup().
+     */
+    array_int m_PsiRowStart;
+
+    //! Third species index of each nonzero psi interaction
+    /*!
+     *  see m_PsiRowStart for reference on the indexing into this variable.
+     */
+    array_int m_PsiRowSpecies;
+
     //! Lambda coefficient for the ij interaction
     /*!
      * Array of 2D data used in the Pitzer/HMW formulation.
@@ -3333,6 +3358,29 @@ namespace Cantera {
      */
     mutable std::vector<int> CROP_speciesCropped_;
 
+    //! True if m_lnActCoeffMolal_Unscaled and m_lnActCoeffMolal_Scaled
+    //! are current for the state stored below
+    mutable bool m_lnActCoeffCurrent;
+
+    //! True if the temperature and pressure derivatives of the
+    //! log activity coefficients are current for the same state
+    mutable bool m_dlnActCoeffCurrent;
+
+    //! Temperature at which the activity coefficients were last evaluated
+    mutable doublereal m_lnActCoeffTemp;
+
+    //! Pressure at which the activity coefficients were last evaluated
+    mutable doublereal m_lnActCoeffPres;
+
+    //! Value of m_A_Debye used in the last evaluation
+    mutable doublereal m_lnActCoeffADebye;
+
+    //! Value of stateMFNumber() at the last evaluation
+    mutable int m_lnActCoeffStateNum;
+
+    //! pH scale used in the last evaluation
+    mutable int m_lnActCoeffpHScale;
+
 
     //! Local error routine
     /*!
@@ -3356,10 +3404,22 @@ namespace Cantera {
   private:
     /*
      * This function will be called to update the internally storred
-     * natural logarithm of the molality activity coefficients 
+     * natural logarithm of the molality activity coefficients.
+     * It returns immediately if they were already evaluated at the
+     * current temperature, pressure, composition, A_Debye and pH scale.
      */
     void s_update_lnMolalityActCoeff() const;
 
+    //! Calculates the first and second temperature derivatives and
+    //! the pressure derivative of the natural logarithm of the
+    //! molality activity coefficients.
+    /*!
+     * The three derivatives are evaluated together, and are kept
+     * until s_update_lnMolalityActCoeff() moves to a new state.
+     * s_update_lnMolalityActCoeff() must be called first.
+     */
+    void s_update_dlnMolalityActCoeff_TP() const;
+
     //! This function calculates the temperature derivative of the
      //! natural logarithm of the molality activity coefficients.
      /*!
@@ -3399,28 +3459,16 @@ namespace Cantera {
      */
     void s_updatePitzer_lnMolalityActCoeff() const;
 
-    //!  Calculates the temperature derivative of the
-    //!  natural logarithm of the molality activity coefficients.
+    //!  Calculates the Pitzer portion of the first and second
+    //!  temperature derivatives and of the pressure derivative of
+    //!  the natural logarithm of the molality activity coefficients.
     /*!
-     * Public function makes sure that all dependent data is
-     * up to date, before calling a private function
+     * The binary and ternary interaction sums are walked once, and
+     * the three derivatives are accumulated together. The functions
+     * of the ionic strength calculated by
+     * s_updatePitzer_lnMolalityActCoeff() are reused.
      */
-    void s_updatePitzer_dlnMolalityActCoeff_dT() const;
-
-    /**
-     * This function calculates the temperature second derivative
-     * of the natural logarithm of the molality activity 
-     * coefficients.
-     */
-    void s_updatePitzer_d2lnMolalityActCoeff_dT2() const;
-
-    //!  Calculates the Pressure derivative of the
-    //!  natural logarithm of the molality activity coefficients.
-    /*!
-     * Public function makes sure that all dependent data is
-     * up to date, before calling a private function
-     */
-    void s_updatePitzer_dlnMolalityActCoeff_dP() const;
+    void s_updatePitzer_dlnMolalityActCoeff_TP() const;
 
  
    
@@ -3486,6 +3534,15 @@ namespace Cantera {
      */
     void counterIJ_setup() const;
 
+    //! Make the compressed list of the nonzero psi interactions
+    /*!
+     * An interaction is kept if any of its temperature coefficients
+     * in m_Psi_ijk_coeff is nonzero. This must be called after all
+     * of the psi and zeta parameters have been set.
+     * See m_PsiRowStart.
+     */
+    void psiRows_setup();
+
     //! Calculate the cropped molalities
     /*!
      * This is an internal routine that calculates values
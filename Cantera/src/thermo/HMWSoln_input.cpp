@@ -1582,6 +1582,12 @@ namespace Cantera {
 
     }
 
+    /*
+     * Make the compressed list of the nonzero psi and
+     * zeta interactions that were just read in.
+     */
+    psiRows_setup();
+
     /*
      * Fill in the vector specifying the electrolyte species
      * type
@@ -1655,6 +1661,12 @@ namespace Cantera {
     setMoleFSolventMin(1.0E-5);
 
     MolalityVPSSTP::initThermoXML(phaseNode, id);
+    /*
+     * The Pitzer parameters have changed, so any stored
+     * activity coefficients are no longer valid.
+     */
+    m_lnActCoeffCurrent = false;
+    m_dlnActCoeffCurrent = false;
     /*
      * Lastly set the state
      */
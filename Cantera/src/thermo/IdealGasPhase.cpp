@@ -23,6 +23,12 @@
 using namespace std;
 
 namespace Cantera {
+
+#ifdef CANTERA_PROFILING
+  //! indices of the profiling data entries of IdealGasPhase
+  enum { prof_thermo, prof_cache_T };
+#endif
+
   // Default empty Constructor
   IdealGasPhase::IdealGasPhase():
     m_mm(0),
@@ -32,6 +38,11 @@ namespace Cantera {
     m_tlast(0.0),
     m_logc0(0.0)
   {
+#ifdef CANTERA_PROFILING
+    m_profile.setOwner("IdealGasPhase");
+    m_profile.addTimer("updateThermo");
+    m_profile.addCache("thermo_T");
+#endif
   }
 
   // Copy Constructor
@@ -159,6 +170,176 @@ namespace Cantera {
   }
 
   // Mechanical Equation of State ----------------------------
+
+  // Setting Many States at Once -----------------------------
+
+  void IdealGasPhase::setStates_HP(int n, const doublereal* h, 
+				   const doublereal* p, const doublereal* y,
+				   doublereal* T, const doublereal* Tguess,
+				   doublereal tol) {
+    setStates_HPorUV(n, h, p, y, T, Tguess, tol, false);
+  }
+
+  void IdealGasPhase::setStates_UV(int n, const doublereal* u, 
+				   const doublereal* v, const doublereal* y,
+				   doublereal* T, const doublereal* Tguess,
+				   doublereal tol) {
+    setStates_HPorUV(n, u, v, y, T, Tguess, tol, true);
+  }
+
+  /*
+   * The specific enthalpy of state i is
+   * \f[
+   *    h_i(T) = R T \sum_k w_{ik} \frac{h^o_k(T)}{R T},
+   *    \qquad w_{ik} = \frac{Y_{ik}}{W_k},
+   * \f]
+   * and u_i = h_i - R T \sum_k w_{ik}, so that the Newton iteration
+   * for T needs only the weighted sums returned by
+   * SpeciesThermo::updateMixture(). Each sweep evaluates these for
+   * all of the states that have not converged, which are kept
+   * packed at the front of the work arrays. The step control follows
+   * ThermoPhase::setState_HPorUV(): steps are limited to 100 K, and
+   * to 3/4 of the distance to the closest temperatures found so far
+   * that bracket the solution. Unlike there, a state is done as soon
+   * as its Newton step is below the tolerance, since its properties
+   * at the final temperature are not needed.
+   */
+  void IdealGasPhase::setStates_HPorUV(int n, const doublereal* h, 
+				       const doublereal* pv, 
+				       const doublereal* y,
+				       doublereal* T, const doublereal* Tguess,
+				       doublereal dTtol, bool doUV) {
+    if (n <= 0) return;
+    int i, j, k;
+    string proc = (doUV ? "IdealGasPhase::setStates_HPorUV (UV)" 
+		   : "IdealGasPhase::setStates_HPorUV (HP)");
+    const array_fp& mw = molecularWeights();
+
+    // weights w_ik, packed in the order of the active states
+    vector_fp w(n*m_kk);
+    vector_fp rmw(n);
+    for (i = 0; i < n; i++) {
+      if (pv[i] < 1.0E-300) {
+	throw CanteraError(proc, string(doUV ? "Input specific volume" 
+					: "Input pressure") 
+			   + " is too small or negative for state " 
+			   + int2str(i) + ": " + fp2str(pv[i]));
+      }
+      const doublereal* yi = y + i*m_kk;
+      doublereal norm = accumulate(yi, yi + m_kk, 0.0);
+      doublereal sum = 0.0;
+      for (k = 0; k < m_kk; k++) {
+	w[i*m_kk + k] = yi[k]/(norm*mw[k]);
+	sum += w[i*m_kk + k];
+      }
+      rmw[i] = sum;
+    }
+
+    doublereal Tmax = maxTemp() + 0.1;
+    doublereal Tmin = minTemp() - 0.1;
+    doublereal T0 = temperature();
+    vector<int> act(n);
+    vector_fp Ta(n), cpa(n), ha(n);
+    vector_fp Htop(n), Ttop(n), Hbot(n), Tbot(n);
+    vector<int> haveTop(n, 0), haveBot(n, 0);
+    for (i = 0; i < n; i++) {
+      act[i] = i;
+      doublereal t = (Tguess ? Tguess[i] : T0);
+      if (t > Tmax) t = Tmax - 1.0;
+      if (t < Tmin) t = Tmin + 1.0;
+      Ta[i] = t;
+    }
+
+    int na = n;
+    for (int iter = 0; iter < 500 && na > 0; iter++) {
+      m_spthermo->updateMixture(na, DATA_PTR(Ta), m_kk, DATA_PTR(w), 
+				DATA_PTR(cpa), DATA_PTR(ha));
+      int nkeep = 0;
+      for (j = 0; j < na; j++) {
+	i = act[j];
+	doublereal t = Ta[j];
+	doublereal Htarget = h[i];
+	doublereal Hnew, Cpnew;
+	if (doUV) {
+	  Hnew = GasConstant * t * (ha[j] - rmw[i]);
+	  Cpnew = GasConstant * (cpa[j] - rmw[i]);
+	} else {
+	  Hnew = GasConstant * t * ha[j];
+	  Cpnew = GasConstant * cpa[j];
+	}
+
+	// converged?
+	doublereal Herr = Htarget - Hnew;
+	doublereal acpd = fmaxx(fabs(Cpnew), 1.0E-5);
+	doublereal denom = fmaxx(fabs(Htarget), acpd * dTtol);
+	if (Hnew == Htarget || fabs(Herr/denom) < 0.00001 * dTtol) {
+	  T[i] = t;
+	  continue;
+	}
+
+	if (Hnew > Htarget) {
+	  if (!haveTop[i] || Hnew < Htop[i]) {
+	    Htop[i] = Hnew;
+	    Ttop[i] = t;
+	    haveTop[i] = 1;
+	  }
+	} else {
+	  if (!haveBot[i] || Hnew > Hbot[i]) {
+	    Hbot[i] = Hnew;
+	    Tbot[i] = t;
+	    haveBot[i] = 1;
+	  }
+	}
+
+	doublereal d = Herr/Cpnew;
+	if (d > 100.0)       d =  100.0;
+	else if (d < -100.0) d = -100.0;
+	if (d > 0.0 && haveTop[i] && t + d > 0.75*Ttop[i] + 0.25*t) {
+	  d = 0.75*(Ttop[i] - t);
+	}
+	else if (d < 0.0 && haveBot[i] && t + d < 0.75*Tbot[i] + 0.25*t) {
+	  d = 0.75*(Tbot[i] - t);
+	}
+	if (t + d <= 0.0) d = -0.5*t;
+
+	// a step below the tolerance is taken without evaluating the
+	// properties at the new temperature again
+	if (fabs(d) < dTtol) {
+	  T[i] = t + d;
+	  continue;
+	}
+
+	// keep the state active, packing it toward the front
+	if (nkeep != j) {
+	  act[nkeep] = i;
+	  copy(w.begin() + j*m_kk, w.begin() + (j+1)*m_kk, 
+	       w.begin() + nkeep*m_kk);
+	}
+	Ta[nkeep] = t + d;
+	nkeep++;
+      }
+      na = nkeep;
+    }
+    if (na > 0) {
+      i = act[0];
+      throw CanteraError(proc, "No convergence in 500 iterations for "
+			 + int2str(na) + " of " + int2str(n) + " states\n"
+			 + "\tFirst state not converged = " + int2str(i) + "\n"
+			 + "\tTarget Enthalpy/Energy     = " + fp2str(h[i]) + "\n"
+			 + "\tCurrent Temperature        = " + fp2str(Ta[0]) 
+			 + "\n");
+    }
+
+    // leave the phase in the last state
+    setMassFractions(y + (n-1)*m_kk);
+    if (doUV) {
+      setTemperature(T[n-1]);
+      setDensity(1.0/pv[n-1]);
+    } else {
+      setState_TP(T[n-1], pv[n-1]);
+    }
+  }
+
   // Chemical Potentials and Activities ----------------------
 
   /*
@@ -514,6 +695,8 @@ namespace Cantera {
         // If the temperature has changed since the last time these
         // properties were computed, recompute them.
         if (m_tlast != tnow) {
+            CT_PROFILE_MISS(m_profile, prof_cache_T);
+            CT_PROFILE_TIMER(m_profile, prof_thermo);
             m_spthermo->update(tnow, &m_cp0_R[0], &m_h0_RT[0], 
                 &m_s0_R[0]);
             m_tlast = tnow;
@@ -526,6 +709,9 @@ namespace Cantera {
             m_logc0 = log(m_p0/(GasConstant * tnow));
             m_tlast = tnow;
         }
+        else {
+            CT_PROFILE_HIT(m_profile, prof_cache_T);
+        }
     }
 }
 
@@ -495,6 +495,54 @@ namespace Cantera {
 
     //@}
 
+    /**
+     * @name Setting Many States at Once ---------------------------------------------------
+     * @{
+     */
+
+    //! Set a sequence of states given their specific enthalpies,
+    //! pressures and mass fractions, and return their temperatures.
+    /*!
+     * See ThermoPhase::setStates_HP(). The temperatures of all of the
+     * states are found by one Newton iteration, in which the enthalpies
+     * and heat capacities of the states that have not converged yet are
+     * evaluated together by SpeciesThermo::updateMixture(). The
+     * pressures only enter the final state of the phase.
+     *
+     * @param n      Number of states
+     * @param h      Specific enthalpies (J/kg). Length n.
+     * @param p      Pressures (Pa). Length n.
+     * @param y      Mass fractions. Length n*nSpecies().
+     * @param T      Output temperatures (K). Length n.
+     * @param Tguess Optional initial guesses for the temperatures.
+     * @param tol    Tolerance on the temperature (K).
+     */
+    virtual void setStates_HP(int n, const doublereal* h, 
+			      const doublereal* p, const doublereal* y,
+			      doublereal* T, const doublereal* Tguess = 0,
+			      doublereal tol = 1.e-4);
+
+    //! Set a sequence of states given their specific internal energies,
+    //! specific volumes and mass fractions, and return their
+    //! temperatures.
+    /*!
+     * See ThermoPhase::setStates_UV() and setStates_HP().
+     *
+     * @param n      Number of states
+     * @param u      Specific internal energies (J/kg). Length n.
+     * @param v      Specific volumes (m^3/kg). Length n.
+     * @param y      Mass fractions. Length n*nSpecies().
+     * @param T      Output temperatures (K). Length n.
+     * @param Tguess Optional initial guesses for the temperatures.
+     * @param tol    Tolerance on the temperature (K).
+     */
+    virtual void setStates_UV(int n, const doublereal* u, 
+			      const doublereal* v, const doublereal* y,
+			      doublereal* T, const doublereal* Tguess = 0,
+			      doublereal tol = 1.e-4);
+
+    //@}
+
     /**
      * @name Chemical Potentials and Activities ------------------------------------------
      *     
@@ -951,6 +999,22 @@ namespace Cantera {
      */
     void _updateThermo() const;
 
+    //! Carry out the work in setStates_HP() and setStates_UV()
+    /*!
+     * @param n      Number of states
+     * @param h      Specific enthalpies or internal energies (J/kg)
+     * @param pv     Pressures (Pa) or specific volumes (m^3/kg)
+     * @param y      Mass fractions. Length n*nSpecies().
+     * @param T      Output temperatures (K)
+     * @param Tguess Optional initial guesses for the temperatures
+     * @param tol    Tolerance on the temperature (K)
+     * @param doUV   True for UV, false for HP
+     */
+    void setStates_HPorUV(int n, const doublereal* h, 
+			  const doublereal* pv, const doublereal* y,
+			  doublereal* T, const doublereal* Tguess,
+			  doublereal tol, bool doUV);
+
   };
 }
         
@@ -504,38 +504,38 @@ namespace Cantera {
    */
   void MargulesVPSSTP::getPartialMolarVolumes(doublereal* vbar) const {
 
-    int iA, iB, iK, delAK, delBK;
-    double XA, XB, XK, g0 , g1;
+    int iA, iB, iK;
+    double XA, XB, g0 , g1;
     double T = temperature();
 
     /*
      * Get the standard state values in m^3 kmol-1
      */
     getStandardVolumes(vbar);
-    //cout << "species name(0) = " << speciesName(0) << endl;
-    //cout << "iA = " << speciesName(m_pSpecies_A_ij[0]) << endl;   
-    //cout << "iB = " << speciesName(m_pSpecies_B_ij[0]) << endl;   
-    
-    for ( iK = 0; iK < m_kk; iK++ ){
-      delAK = 0;
-      delBK = 0;
-      XK = moleFractions_[iK];  
-      for (int i = 0; i <  numBinaryInteractions_; i++) {
-    
-	iA =  m_pSpecies_A_ij[i];    
-	iB =  m_pSpecies_B_ij[i];
 
-	if (iA==iK) delAK = 1;
-	else if (iB==iK) delBK = 1;
+    /*
+     * Each binary interaction adds the same term to every species,
+     * plus an extra term to its own two species. Summing the common
+     * part separately makes this linear in the number of interactions.
+     */
+    double common = 0.0;
+    for (int i = 0; i <  numBinaryInteractions_; i++) {
+    
+      iA =  m_pSpecies_A_ij[i];    
+      iB =  m_pSpecies_B_ij[i];
 	
-	XA = moleFractions_[iA];
-	XB = moleFractions_[iB];
+      XA = moleFractions_[iA];
+      XB = moleFractions_[iB];
 	
-	g0 = (m_VHE_b_ij[i] - T * m_VSE_b_ij[i]);
-	g1 = (m_VHE_c_ij[i] - T * m_VSE_c_ij[i]);
+      g0 = (m_VHE_b_ij[i] - T * m_VSE_b_ij[i]);
+      g1 = (m_VHE_c_ij[i] - T * m_VSE_c_ij[i]);
 	
-	vbar[iK] += XA*XB*(g0+g1*XB)+((delAK-XA)*XB+XA*(delBK-XB))*(g0+g1*XB)+XA*XB*(delBK-XB)*g1;
-      }
+      common   -= XA*XB*(g0+2*g1*XB);
+      vbar[iA] += XB*(g0+g1*XB);
+      vbar[iB] += XA*(g0+2*g1*XB);
+    }
+    for ( iK = 0; iK < m_kk; iK++ ){
+      vbar[iK] += common;
     }
   }  
 
@@ -656,38 +656,41 @@ namespace Cantera {
    *
    *   he = X_A X_B(B + C X_B)
    */
-    void MargulesVPSSTP::s_update_lnActCoeff() const {
-    int iA, iB, iK, delAK, delBK;
-    double XA, XB, XK, g0 , g1;
+  void MargulesVPSSTP::s_update_lnActCoeff() const {
+    int iA, iB, iK;
+    double XA, XB, g0 , g1;
     double T = temperature();
     double RT = GasConstant*T;
 
     fvo_zero_dbl_1(lnActCoeff_Scaled_, m_kk);
-    
-    for ( iK = 0; iK < m_kk; iK++ ){
-
-      XK = moleFractions_[iK];  
 
-      for (int i = 0; i <  numBinaryInteractions_; i++) {
+    /*
+     * The contribution of an interaction to species K is
+     *
+     *   (delAK*XB+XA*delBK-XA*XB)*(g0+g1*XB)+XA*XB*(delBK-XB)*g1
+     *
+     * The part with delAK = delBK = 0 is common to all species.
+     * It is summed up once, so that the cost is linear in the
+     * number of interactions.
+     */
+    double common = 0.0;
+    for (int i = 0; i <  numBinaryInteractions_; i++) {
     
-	iA =  m_pSpecies_A_ij[i];    
-	iB =  m_pSpecies_B_ij[i];
-
-	delAK = 0;
-	delBK = 0;
-
-	if (iA==iK) delAK = 1;
-	else if (iB==iK) delBK = 1;
+      iA =  m_pSpecies_A_ij[i];    
+      iB =  m_pSpecies_B_ij[i];
 	
-	XA = moleFractions_[iA];
-	XB = moleFractions_[iB];
+      XA = moleFractions_[iA];
+      XB = moleFractions_[iB];
 	
-	g0 = (m_HE_b_ij[i] - T * m_SE_b_ij[i]) / RT;
-	g1 = (m_HE_c_ij[i] - T * m_SE_c_ij[i]) / RT;
+      g0 = (m_HE_b_ij[i] - T * m_SE_b_ij[i]) / RT;
+      g1 = (m_HE_c_ij[i] - T * m_SE_c_ij[i]) / RT;
 	
-	lnActCoeff_Scaled_[iK] += (delAK*XB+XA*delBK-XA*XB)*(g0+g1*XB)+XA*XB*(delBK-XB)*g1;
-	//lnActCoeff_Scaled_[iK] += XA*XB*(g0+g1*XB)+((delAK-XA)*XB+XA*(delBK-XB))*(g0+g1*XB)+XA*XB*(delBK-XB)*g1;
-      }
+      common                 -= XA*XB*(g0+2*g1*XB);
+      lnActCoeff_Scaled_[iA] += XB*(g0+g1*XB);
+      lnActCoeff_Scaled_[iB] += XA*(g0+2*g1*XB);
+    }
+    for ( iK = 0; iK < m_kk; iK++ ){
+      lnActCoeff_Scaled_[iK] += common;
     }
   }
 
@@ -727,36 +730,34 @@ namespace Cantera {
    *   he = X_A X_B(B + C X_B)
    */
   void MargulesVPSSTP::s_update_dlnActCoeff_dT() const {
-    int iA, iB, iK, delAK, delBK;
-    double XA, XB, XK, g0 , g1;
+    int iA, iB, iK;
+    double XA, XB, g0 , g1;
     double T = temperature();
     double RTT = GasConstant*T*T;
 
     fvo_zero_dbl_1(dlnActCoeffdT_Scaled_, m_kk);
-    
-    for ( iK = 0; iK < m_kk; iK++ ){
-
-      XK = moleFractions_[iK];  
 
-      for (int i = 0; i <  numBinaryInteractions_; i++) {
+    /*
+     * Same form as s_update_lnActCoeff()
+     */
+    double common = 0.0;
+    for (int i = 0; i <  numBinaryInteractions_; i++) {
     
-	iA =  m_pSpecies_A_ij[i];    
-	iB =  m_pSpecies_B_ij[i];
-	
-	delAK = 0;
-	delBK = 0;
-
-	if (iA==iK) delAK = 1;
-	else if (iB==iK) delBK = 1;
+      iA =  m_pSpecies_A_ij[i];    
+      iB =  m_pSpecies_B_ij[i];
 	
-	XA = moleFractions_[iA];
-	XB = moleFractions_[iB];
+      XA = moleFractions_[iA];
+      XB = moleFractions_[iB];
 	
-	g0 = -m_HE_b_ij[i] / RTT;
-	g1 = -m_HE_c_ij[i] / RTT;
+      g0 = -m_HE_b_ij[i] / RTT;
+      g1 = -m_HE_c_ij[i] / RTT;
 	
-	dlnActCoeffdT_Scaled_[iK] += (delAK*XB+XA*delBK-XA*XB)*(g0+g1*XB)+XA*XB*(delBK-XB)*g1;
-      }
+      common                    -= XA*XB*(g0+2*g1*XB);
+      dlnActCoeffdT_Scaled_[iA] += XB*(g0+g1*XB);
+      dlnActCoeffdT_Scaled_[iB] += XA*(g0+2*g1*XB);
+    }
+    for ( iK = 0; iK < m_kk; iK++ ){
+      dlnActCoeffdT_Scaled_[iK] += common;
     }
   }
 
@@ -801,41 +802,47 @@ namespace Cantera {
    *   he = X_A X_B(B + C X_B)
    */
   void MargulesVPSSTP::getdlnActCoeff(const doublereal dT, const doublereal * const dX, doublereal* dlnActCoeff) const {
-    int iA, iB, iK, delAK, delBK;
-    double XA, XB, XK, g0 , g1, dXA, dXB;
+    int iA, iB, iK;
+    double XA, XB, g0 , g1, dXA, dXB;
     double T = temperature();
     double RT = GasConstant*T;
 
-    //fvo_zero_dbl_1(dlnActCoeff, m_kk);
     s_update_dlnActCoeff_dT();
+    fbo_zero_dbl_1(dlnActCoeff, m_kk);
 
-    for ( iK = 0; iK < m_kk; iK++ ){
-
-      XK = moleFractions_[iK];  
-      dlnActCoeff[iK] = 0.0;
-
-      for (int i = 0; i <  numBinaryInteractions_; i++) {
+    /*
+     * The contribution of an interaction to species K is
+     *
+     *   ((delBK-XB)*dXA + (delAK-XA)*dXB)*(g0+2*g1*XB) + (delBK-XB)*2*g1*XA*dXB
+     *
+     * As in s_update_lnActCoeff(), the part common to all
+     * species is summed up once.
+     */
+    double common = 0.0;
+    for (int i = 0; i <  numBinaryInteractions_; i++) {
     
-	iA =  m_pSpecies_A_ij[i];    
-	iB =  m_pSpecies_B_ij[i];
-
-	delAK = 0;
-	delBK = 0;
-
-	if (iA==iK) delAK = 1;
-	else if (iB==iK) delBK = 1;
+      iA =  m_pSpecies_A_ij[i];    
+      iB =  m_pSpecies_B_ij[i];
 	
-	XA = moleFractions_[iA];
-	XB = moleFractions_[iB];
+      XA = moleFractions_[iA];
+      XB = moleFractions_[iB];
 
-	dXA = dX[iA];
-	dXB = dX[iB];
+      dXA = dX[iA];
+      dXB = dX[iB];
 	
-	g0 = (m_HE_b_ij[i] - T * m_SE_b_ij[i]) / RT;
-	g1 = (m_HE_c_ij[i] - T * m_SE_c_ij[i]) / RT;
+      g0 = (m_HE_b_ij[i] - T * m_SE_b_ij[i]) / RT;
+      g1 = (m_HE_c_ij[i] - T * m_SE_c_ij[i]) / RT;
 	
-	dlnActCoeff[iK] += ((delBK-XB)*dXA + (delAK-XA)*dXB)*(g0+2*g1*XB) + (delBK-XB)*2*g1*XA*dXB + dlnActCoeffdT_Scaled_[iK]*dT;
-      }
+      common          -= (XB*dXA + XA*dXB)*(g0+2*g1*XB) + 2*g1*XA*XB*dXB;
+      dlnActCoeff[iA] += dXB*(g0+2*g1*XB);
+      dlnActCoeff[iB] += dXA*(g0+2*g1*XB) + 2*g1*XA*dXB;
+    }
+    /*
+     * The temperature term already contains the sum over all
+     * interactions, so it is added once per species.
+     */
+    for ( iK = 0; iK < m_kk; iK++ ){
+      dlnActCoeff[iK] += common + dlnActCoeffdT_Scaled_[iK]*dT;
     }
   }
 
@@ -848,37 +855,40 @@ namespace Cantera {
    *   he = X_A X_B(B + C X_B)
    */
   void MargulesVPSSTP::s_update_dlnActCoeff_dlnN() const {
-    int iA, iB, iK, delAK, delBK;
+    int iA, iB, iK;
     double XA, XB, XK, g0 , g1;
     double T = temperature();
     double RT = GasConstant*T;
 
     fvo_zero_dbl_1(dlnActCoeffdlnN_Scaled_, m_kk);
-    
-    for ( iK = 0; iK < m_kk; iK++ ){
 
-      XK = moleFractions_[iK];  
-
-      for (int i = 0; i <  numBinaryInteractions_; i++) {
+    /*
+     * The contribution of an interaction to species K is
+     *
+     *   2*(delBK-XB) * (g0*(delAK-XA) + g1*(2*(delAK-XA)*XB + XA*(delBK-XB)))
+     *
+     * As in s_update_lnActCoeff(), the part common to all
+     * species is summed up once.
+     */
+    double common = 0.0;
+    for (int i = 0; i <  numBinaryInteractions_; i++) {
     
-	iA =  m_pSpecies_A_ij[i];    
-	iB =  m_pSpecies_B_ij[i];
-
-	delAK = 0;
-	delBK = 0;
-
-	if (iA==iK) delAK = 1;
-	else if (iB==iK) delBK = 1;
+      iA =  m_pSpecies_A_ij[i];    
+      iB =  m_pSpecies_B_ij[i];
 	
-	XA = moleFractions_[iA];
-	XB = moleFractions_[iB];
+      XA = moleFractions_[iA];
+      XB = moleFractions_[iB];
 	
-	g0 = (m_HE_b_ij[i] - T * m_SE_b_ij[i]) / RT;
-	g1 = (m_HE_c_ij[i] - T * m_SE_c_ij[i]) / RT;
+      g0 = (m_HE_b_ij[i] - T * m_SE_b_ij[i]) / RT;
+      g1 = (m_HE_c_ij[i] - T * m_SE_c_ij[i]) / RT;
 	
-	dlnActCoeffdlnN_Scaled_[iK] += 2*(delBK-XB) * (g0*(delAK-XA) + g1*(2*(delAK-XA)*XB + XA*(delBK-XB)));
-      }
-      dlnActCoeffdlnN_Scaled_[iK] = XK*dlnActCoeffdlnN_Scaled_[iK]-XK;
+      common                      += 2*XA*XB*(g0+3*g1*XB);
+      dlnActCoeffdlnN_Scaled_[iA] -= 2*XB*(g0+2*g1*XB);
+      dlnActCoeffdlnN_Scaled_[iB] += 2*XA*(g1*(1-4*XB)-g0);
+    }
+    for ( iK = 0; iK < m_kk; iK++ ){
+      XK = moleFractions_[iK];  
+      dlnActCoeffdlnN_Scaled_[iK] = XK*(dlnActCoeffdlnN_Scaled_[iK]+common)-XK;
     }
   }
 
@@ -190,6 +190,33 @@ namespace Cantera {
     }
 
  
+    //! Add the weighted heat capacity and enthalpy of this species
+    //! to running sums.
+    /*!
+     * Used by NasaThermo::updateMixture(). The entropy, and with it the
+     * logarithm of the temperature, is not needed.
+     *
+     * @param tt      vector of temperature polynomials, as in 
+     *                updateProperties(). Only the first five
+     *                entries are used.
+     * @param w       Vector of weights, indexed by species.
+     * @param cp_R    Running sum of w_k cp_R_k
+     * @param h_RT    Running sum of w_k h_RT_k
+     */
+    void addWeightedProperties(const doublereal* tt, const doublereal* w,
+			       doublereal& cp_R, doublereal& h_RT) const {
+      doublereal wk = w[m_index];
+      if (wk == 0.0) return;
+      doublereal ct0 = m_coeff[2];          // a0 
+      doublereal ct1 = m_coeff[3]*tt[0];    // a1 * T
+      doublereal ct2 = m_coeff[4]*tt[1];    // a2 * T^2
+      doublereal ct3 = m_coeff[5]*tt[2];    // a3 * T^3
+      doublereal ct4 = m_coeff[6]*tt[3];    // a4 * T^4
+      cp_R += wk*(ct0 + ct1 + ct2 + ct3 + ct4);
+      h_RT += wk*(ct0 + 0.5*ct1 + OneThird*ct2 + 0.25*ct3 + 0.2*ct4
+		  + m_coeff[0]*tt[4]);
+    }
+
     //! Compute the reference-state property of one species
     /*!
      * Given temperature T in K, this method updates the values of
@@ -308,6 +308,53 @@ namespace Cantera {
 	  _begin->updateProperties(&m_t[0], cp_R, h_RT, s_R);
       }
     }
+
+    //! Weighted sums of the reference-state heat capacities and
+    //! enthalpies at several temperatures.
+    /*!
+     * See SpeciesThermo::updateMixture(). The species properties are
+     * accumulated directly into the sums, and the entropies are not
+     * evaluated.
+     *
+     * @param n       Number of temperatures
+     * @param T       Temperatures (Kelvin). Length n.
+     * @param kk      Number of species
+     * @param w       Weights. Length n*kk.
+     * @param cp_R    Output weighted sums of the dimensionless heat
+     *                capacities. Length n.
+     * @param h_RT    Output weighted sums of the dimensionless 
+     *                enthalpies. Length n.
+     */
+    virtual void updateMixture(int n, const doublereal* T, int kk,
+			       const doublereal* w, doublereal* cp_R,
+			       doublereal* h_RT) const {
+      doublereal tt[5];
+      vector<NasaPoly1>::const_iterator _begin, _end;
+      for (int j = 0; j < n; j++) {
+	doublereal t = T[j];
+	tt[0] = t;
+	tt[1] = t*t;
+	tt[2] = tt[1]*t;
+	tt[3] = tt[2]*t;
+	tt[4] = 1.0/t;
+	const doublereal* wj = w + j*kk;
+	doublereal cpsum = 0.0, hsum = 0.0;
+	for (int i = 0; i != m_ngroups; i++) {
+	  if (t > m_tmid[i]) {
+	    _begin  = m_high[i].begin();
+	    _end    = m_high[i].end();
+	  }
+	  else {
+	    _begin  = m_low[i].begin();
+	    _end    = m_low[i].end();
+	  }
+	  for (; _begin != _end; ++_begin) 
+	    _begin->addWeightedProperties(tt, wj, cpsum, hsum);
+	}
+	cp_R[j] = cpsum;
+	h_RT[j] = hsum;
+      }
+    }
                 
     //! Minimum temperature.
     /*!
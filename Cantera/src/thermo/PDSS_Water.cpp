@@ -24,6 +24,10 @@
 #include <cmath>
 
 namespace Cantera {
+
+  //! index of the profiling data entry of PDSS_Water
+  enum { prof_cache_dens };
+
   /**
    * Basic list of constructors and duplicators
    */
@@ -36,8 +40,16 @@ namespace Cantera {
     EW_Offset(0.0),
     SW_Offset(0.0),
     m_verbose(0),
+    m_tlastSolve(-1.0),
+    m_plastSolve(-1.0),
+    m_tsubSolve(-1.0),
+    m_rhosubSolve(-1.0),
     m_allowGasPhase(false)
   {
+#ifdef CANTERA_PROFILING
+    m_profile.setOwner("PDSS_Water");
+    m_profile.addCache("density_TP");
+#endif
     m_pdssType = cPDSS_WATER;
     m_sub = new WaterPropsIAPWS();
     m_waterProps =  new WaterProps(m_sub);
@@ -56,8 +68,16 @@ namespace Cantera {
     EW_Offset(0.0),
     SW_Offset(0.0),
     m_verbose(0),
+    m_tlastSolve(-1.0),
+    m_plastSolve(-1.0),
+    m_tsubSolve(-1.0),
+    m_rhosubSolve(-1.0),
     m_allowGasPhase(false)
   {
+#ifdef CANTERA_PROFILING
+    m_profile.setOwner("PDSS_Water");
+    m_profile.addCache("density_TP");
+#endif
     m_pdssType = cPDSS_WATER;
     m_sub = new WaterPropsIAPWS();
     m_waterProps =  new WaterProps(m_sub);
@@ -78,8 +98,16 @@ namespace Cantera {
     EW_Offset(0.0),
     SW_Offset(0.0),
     m_verbose(0),
+    m_tlastSolve(-1.0),
+    m_plastSolve(-1.0),
+    m_tsubSolve(-1.0),
+    m_rhosubSolve(-1.0),
     m_allowGasPhase(false)
   {
+#ifdef CANTERA_PROFILING
+    m_profile.setOwner("PDSS_Water");
+    m_profile.addCache("density_TP");
+#endif
     m_pdssType = cPDSS_WATER;
     m_sub = new WaterPropsIAPWS();
     m_waterProps =  new WaterProps(m_sub); 
@@ -100,8 +128,16 @@ namespace Cantera {
     EW_Offset(0.0),
     SW_Offset(0.0),
     m_verbose(0),
+    m_tlastSolve(-1.0),
+    m_plastSolve(-1.0),
+    m_tsubSolve(-1.0),
+    m_rhosubSolve(-1.0),
     m_allowGasPhase(false)
   {
+#ifdef CANTERA_PROFILING
+    m_profile.setOwner("PDSS_Water");
+    m_profile.addCache("density_TP");
+#endif
     m_pdssType = cPDSS_WATER;
     m_sub = new WaterPropsIAPWS();
     m_waterProps =  new WaterProps(m_sub);
@@ -124,6 +160,10 @@ namespace Cantera {
     EW_Offset(b.EW_Offset),
     SW_Offset(b.SW_Offset),
     m_verbose(b.m_verbose),
+    m_tlastSolve(-1.0),
+    m_plastSolve(-1.0),
+    m_tsubSolve(-1.0),
+    m_rhosubSolve(-1.0),
     m_allowGasPhase(b.m_allowGasPhase)
   {
     m_sub = new WaterPropsIAPWS();
@@ -160,6 +200,13 @@ namespace Cantera {
     SW_Offset       = b.SW_Offset;
     m_verbose       = b.m_verbose;
     m_allowGasPhase = b.m_allowGasPhase;
+    m_tlastSolve    = -1.0;
+    m_plastSolve    = -1.0;
+    m_tsubSolve     = -1.0;
+    m_rhosubSolve   = -1.0;
+#ifdef CANTERA_PROFILING
+    m_profile       = b.m_profile;
+#endif
 
     return *this;
   }
@@ -395,6 +442,18 @@ namespace Cantera {
   void PDSS_Water::setPressure(doublereal p) {
     doublereal T = m_temp;
     doublereal dens = m_dens;
+    /*
+     * The HKFT standard states set the water state for every
+     * property they evaluate, so most calls are at the temperature
+     * and pressure of the last solve.
+     */
+    if (p == m_plastSolve && T == m_tlastSolve &&
+	m_sub->temperature() == m_tsubSolve && m_sub->density() == m_rhosubSolve) {
+      CT_PROFILE_HIT(m_profile, prof_cache_dens);
+      m_pres = p;
+      return;
+    }
+    CT_PROFILE_MISS(m_profile, prof_cache_dens);
     int waterState = WATER_LIQUID;
     if (T > m_sub->Tcrit()) {
       waterState = WATER_SUPERCRIT;
@@ -423,6 +482,10 @@ namespace Cantera {
 			   "Water State isn't liquid or crit");
       }
     }
+    m_tlastSolve = T;
+    m_plastSolve = p;
+    m_tsubSolve = m_sub->temperature();
+    m_rhosubSolve = m_sub->density();
   }
  
   // Return the volumetric thermal expansion coefficient. Units: 1/K.
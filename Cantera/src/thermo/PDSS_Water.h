@@ -544,6 +544,28 @@ namespace Cantera {
     //! Verbose flag - used?
     bool m_verbose;
 
+    /**
+     * @name Last density solve
+     *
+     * The temperature and pressure of the last density solve in
+     * setPressure(), and the temperature and density of m_sub just
+     * after it. If setPressure() is called again at the same
+     * temperature and pressure, and m_sub is still in that state, the
+     * solve is skipped. The state of m_sub is checked because it is
+     * shared with m_waterProps, which moves it to other states.
+     */
+    //@{
+    doublereal m_tlastSolve;
+    doublereal m_plastSolve;
+    doublereal m_tsubSolve;
+    doublereal m_rhosubSolve;
+    //@}
+
+#ifdef CANTERA_PROFILING
+    //! Hits and misses of the density solve cache
+    mutable ProfileData m_profile;
+#endif
+
   public:
     /**
      *  Since this phase represents a liquid phase, it's an error to 
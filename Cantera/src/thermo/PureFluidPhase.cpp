@@ -54,6 +54,9 @@ namespace Cantera {
       }
       m_subflag    = right.m_subflag;
       m_sub        = tpx::GetSub(m_subflag);
+      if (m_sub && right.m_sub && right.m_sub->tabulated()) {
+	m_sub->setSatTable(right.m_sub->satTable());
+      }
       m_mw         = right.m_mw;
       m_verbose    = right.m_verbose;
     }
@@ -223,6 +226,22 @@ namespace Cantera {
 
     tpx::Substance& PureFluidPhase::TPX_Substance() { return *m_sub; }
 
+    void PureFluidPhase::setTabulated(bool tab, int npoints, 
+        std::string cacheFile) {
+        try {
+            m_sub->setTabulated(tab, npoints, cacheFile);
+        }
+        catch(tpx::TPX_Error) {
+            reportTPXError();
+        }
+    }
+
+    bool PureFluidPhase::tabulated() const { return m_sub->tabulated(); }
+
+    doublereal PureFluidPhase::tabulationError() const { 
+        return m_sub->tableError(); 
+    }
+
     /// critical temperature 
     doublereal PureFluidPhase::critTemperature() const { return m_sub->Tcrit(); }
         
@@ -163,6 +163,38 @@ namespace Cantera {
     //! Returns a reference to the substance object
     tpx::Substance& TPX_Substance();
 
+    //! Switch between exact and tabulated saturation properties
+    /*!
+     * In tabulated mode the saturation pressure and the saturated liquid
+     * and vapor densities are interpolated from cubic splines fitted to
+     * the exact tpx values, instead of being found by iteration at every
+     * change of temperature. The table is generated on the first call,
+     * or read from cacheFile if that file holds a table for the same
+     * substance and grid; a newly generated table is written to
+     * cacheFile. States outside the tabulated range (very close to the
+     * critical point, or below the lowest tabulated temperature) are
+     * still evaluated exactly.
+     *
+     * @param tab       true for tabulated mode, false for exact mode
+     * @param npoints   Number of table nodes. Defaults to 200.
+     * @param cacheFile Name of the file used to cache the table. If
+     *                  empty (the default), the table is not cached.
+     */
+    void setTabulated(bool tab, int npoints = 200, 
+		      std::string cacheFile = "");
+
+    //! True if the saturation properties are tabulated
+    bool tabulated() const;
+
+    //! Error bound of the tabulated saturation properties
+    /*!
+     * Returns the maximum relative error of the tabulated saturation
+     * pressure and liquid and vapor densities, measured against the
+     * exact values midway between the table nodes. Returns 0 in exact
+     * mode.
+     */
+    doublereal tabulationError() const;
+
     /// critical temperature 
     virtual doublereal critTemperature() const;
  
@@ -295,6 +295,46 @@ namespace Cantera {
       update(T, cp_R, h_RT, s_R);
     }
 
+    //! Weighted sums of the reference-state heat capacities and
+    //! enthalpies at several temperatures.
+    /*!
+     * For each temperature T[j], this method computes
+     * \f[
+     *    \hat{c}_p[j] = \sum_k w_{jk} \frac{c^o_{p,k}(T_j)}{R}, \qquad
+     *    \hat{h}[j] = \sum_k w_{jk} \frac{h^o_k(T_j)}{R T_j},
+     * \f]
+     * with \f$ w_{jk} \f$ = w[j*kk + k]. These are all that is needed
+     * to invert the enthalpy or internal energy of a mixture for the
+     * temperature. The default treatment calls update() for each
+     * temperature; managers that can skip the entropies should
+     * overload it.
+     *
+     * @param n       Number of temperatures
+     * @param T       Temperatures (Kelvin). Length n.
+     * @param kk      Number of species
+     * @param w       Weights. Length n*kk.
+     * @param cp_R    Output weighted sums of the dimensionless heat
+     *                capacities. Length n.
+     * @param h_RT    Output weighted sums of the dimensionless 
+     *                enthalpies. Length n.
+     */
+    virtual void updateMixture(int n, const doublereal* T, int kk,
+			       const doublereal* w, doublereal* cp_R,
+			       doublereal* h_RT) const {
+      std::vector<doublereal> cp(kk), h(kk), s(kk);
+      for (int j = 0; j < n; j++) {
+	update(T[j], &cp[0], &h[0], &s[0]);
+	const doublereal* wj = w + j*kk;
+	doublereal cpsum = 0.0, hsum = 0.0;
+	for (int k = 0; k < kk; k++) {
+	  cpsum += wj[k]*cp[k];
+	  hsum += wj[k]*h[k];
+	}
+	cp_R[j] = cpsum;
+	h_RT[j] = hsum;
+      }
+    }
+
     //! Minimum temperature.
     /*!
      * If no argument is supplied, this
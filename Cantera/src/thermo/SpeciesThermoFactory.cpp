@@ -50,7 +50,7 @@ namespace Cantera {
   SpeciesThermoFactory* SpeciesThermoFactory::s_factory = 0;
 
 #if defined(THREAD_SAFE_CANTERA)
-  boost::mutex SpeciesThermoFactory::species_thermo_mutex ;
+  mutex_t SpeciesThermoFactory::species_thermo_mutex ;
 #endif
  
 
@@ -125,7 +125,7 @@ namespace Cantera {
    */
   SpeciesThermoFactory* SpeciesThermoFactory::factory() {
 #if defined(THREAD_SAFE_CANTERA)
-     boost::mutex::scoped_lock lock(species_thermo_mutex);
+     ScopedLock lock(species_thermo_mutex);
 #endif
      if (!s_factory) s_factory = new SpeciesThermoFactory;
      return s_factory;
@@ -139,7 +139,7 @@ namespace Cantera {
    */
   void SpeciesThermoFactory::deleteFactory() {
 #if defined(THREAD_SAFE_CANTERA)
-    boost::mutex::scoped_lock lock(species_thermo_mutex);
+    ScopedLock lock(species_thermo_mutex);
 #endif
     if (s_factory) {
       delete s_factory;
@@ -215,7 +215,7 @@ namespace Cantera {
 
 #if defined(THREAD_SAFE_CANTERA)
     //! Decl of the static mutex variable that locks the %SpeciesThermo factory singelton
-    static boost::mutex species_thermo_mutex;
+    static mutex_t species_thermo_mutex;
 #endif
 
     //! Constructor. This is made private, so that only the static
@@ -85,7 +85,7 @@ namespace Cantera {
 
     ThermoFactory* ThermoFactory::s_factory = 0;
 #if defined(THREAD_SAFE_CANTERA)
-    boost::mutex ThermoFactory::thermo_mutex;
+    mutex_t ThermoFactory::thermo_mutex;
 #endif
 
     static int ntypes = 18;
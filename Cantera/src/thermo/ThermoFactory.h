@@ -20,9 +20,7 @@
 #include "ThermoPhase.h"
 #include "xml.h"
 
-#if defined(THREAD_SAFE_CANTERA)
-#include <boost/thread/mutex.hpp>
-#endif
+#include "ct_thread.h"
 
 #include "FactoryBase.h"
 
@@ -72,7 +70,7 @@ namespace Cantera {
     //! Static function that creates a static instance of the factory.
     static ThermoFactory* factory() {
 #if defined(THREAD_SAFE_CANTERA)
-        boost::mutex::scoped_lock lock(thermo_mutex);
+        ScopedLock lock(thermo_mutex);
 #endif
       if (!s_factory) s_factory = new ThermoFactory;
       return s_factory;
@@ -81,7 +79,7 @@ namespace Cantera {
       //! delete the static instance of this factory
       virtual void deleteFactory() {
 #if defined(THREAD_SAFE_CANTERA)
-          boost::mutex::scoped_lock lock(thermo_mutex);
+          ScopedLock lock(thermo_mutex);
 #endif
           if (s_factory) {
             delete s_factory;
@@ -119,7 +117,7 @@ namespace Cantera {
 
 #if defined(THREAD_SAFE_CANTERA)
     //! Decl for locking mutex for thermo factory singelton
-    static boost::mutex thermo_mutex;
+    static mutex_t thermo_mutex;
 #endif
 
   };
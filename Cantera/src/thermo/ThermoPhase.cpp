@@ -132,6 +132,9 @@ namespace Cantera {
     m_hasElementPotentials = right.m_hasElementPotentials;
     m_chargeNeutralityNecessary = right.m_chargeNeutralityNecessary;
     m_ssConvention = right.m_ssConvention;
+#ifdef CANTERA_PROFILING
+    m_profile = right.m_profile;
+#endif
     return *this;
   }
 
@@ -249,6 +252,32 @@ namespace Cantera {
     setState_HPorUV(u, v, dTtol, true);
   }
 
+  void ThermoPhase::setStates_HP(int n, const doublereal* h, 
+				 const doublereal* p, const doublereal* y,
+				 doublereal* T, const doublereal* Tguess,
+				 doublereal dTtol) {
+    doublereal T0 = temperature();
+    for (int i = 0; i < n; i++) {
+      setMassFractions(y + i*m_kk);
+      setTemperature(Tguess ? Tguess[i] : T0);
+      setState_HP(h[i], p[i], dTtol);
+      T[i] = temperature();
+    }
+  }
+
+  void ThermoPhase::setStates_UV(int n, const doublereal* u, 
+				 const doublereal* v, const doublereal* y,
+				 doublereal* T, const doublereal* Tguess,
+				 doublereal dTtol) {
+    doublereal T0 = temperature();
+    for (int i = 0; i < n; i++) {
+      setMassFractions(y + i*m_kk);
+      setTemperature(Tguess ? Tguess[i] : T0);
+      setState_UV(u[i], v[i], dTtol);
+      T[i] = temperature();
+    }
+  }
+
   // Do the convergence work
   /*
    *  We assume here that H at constant P is a monotonically increasing
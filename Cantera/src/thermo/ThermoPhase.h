@@ -18,6 +18,7 @@
 #define CT_THERMOPHASE_H
 
 #include "Phase.h"
+#include "ProfileData.h"
 
 
 namespace Cantera {
@@ -1697,6 +1698,60 @@ namespace Cantera {
      */
     virtual void setState_UV(doublereal u, doublereal v, doublereal tol = 1.e-4);
 
+    //! Set a sequence of states given their specific enthalpies,
+    //! pressures and mass fractions, and return their temperatures.
+    /*!
+     * This is the batch form of setState_HP(), for applications that
+     * convert conserved variables to temperature for many states at a
+     * time, e.g. the cells of a CFD grid. State i has the specific
+     * enthalpy h[i], the pressure p[i] and the mass fractions
+     * y[i*nSpecies()], ..., y[i*nSpecies() + nSpecies() - 1]. On
+     * return, T[i] holds its temperature and the phase is left in the
+     * last state.
+     *
+     * The base class treatment calls setState_HP() for each state in
+     * turn. IdealGasPhase overloads it with a Newton iteration that
+     * is carried out for all of the states together.
+     *
+     * @param n      Number of states
+     * @param h      Specific enthalpies (J/kg). Length n.
+     * @param p      Pressures (Pa). Length n.
+     * @param y      Mass fractions. Length n*nSpecies().
+     * @param T      Output temperatures (K). Length n.
+     * @param Tguess Optional initial guesses for the temperatures.
+     *               Length n. If zero (the default), every iteration
+     *               starts from the temperature of the phase on entry.
+     * @param tol    Optional parameter setting the tolerance of the
+     *               calculation. Defaults to 1.0E-4
+     */
+    virtual void setStates_HP(int n, const doublereal* h, 
+			      const doublereal* p, const doublereal* y,
+			      doublereal* T, const doublereal* Tguess = 0,
+			      doublereal tol = 1.e-4);
+
+    //! Set a sequence of states given their specific internal energies,
+    //! specific volumes and mass fractions, and return their
+    //! temperatures.
+    /*!
+     * This is the batch form of setState_UV(). See setStates_HP() for
+     * the layout of the arrays.
+     *
+     * @param n      Number of states
+     * @param u      Specific internal energies (J/kg). Length n.
+     * @param v      Specific volumes (m^3/kg). Length n.
+     * @param y      Mass fractions. Length n*nSpecies().
+     * @param T      Output temperatures (K). Length n.
+     * @param Tguess Optional initial guesses for the temperatures.
+     *               Length n. If zero (the default), every iteration
+     *               starts from the temperature of the phase on entry.
+     * @param tol    Optional parameter setting the tolerance of the
+     *               calculation. Defaults to 1.0E-4
+     */
+    virtual void setStates_UV(int n, const doublereal* u, 
+			      const doublereal* v, const doublereal* y,
+			      doublereal* T, const doublereal* Tguess = 0,
+			      doublereal tol = 1.e-4);
+
   private:
 
     //! Carry out work in HP and UV calculations.
@@ -2033,6 +2088,11 @@ namespace Cantera {
      * @param m  Input the index number.
      */ 
     void setIndex(int m) { m_index = m; }
+
+#ifdef CANTERA_PROFILING
+    //! Profiling data for this phase
+    ProfileData& profileData() const { return m_profile; }
+#endif
     
 
     //! Set the equation of state parameters
@@ -2185,6 +2245,12 @@ namespace Cantera {
      */
     std::vector<doublereal> xMol_Ref;
 
+#ifdef CANTERA_PROFILING
+    //! Counters, timers and cache statistics of the property updates.
+    //! Mutable, since the updates are made by const methods.
+    mutable ProfileData m_profile;
+#endif
+
   private:
 
     //! Error function that gets called for unhandled cases
@@ -57,7 +57,7 @@ namespace Cantera {
 #if defined(THREAD_SAFE_CANTERA)
   // Defn of the static mutex variable that locks the 
   // %VPSSMgr factory singelton
-  boost::mutex VPSSMgrFactory::vpss_species_thermo_mutex;
+  mutex_t VPSSMgrFactory::vpss_species_thermo_mutex;
 #endif
  
   /*
@@ -200,7 +200,7 @@ namespace Cantera {
   void VPSSMgrFactory::deleteFactory() {
 
 #if defined(THREAD_SAFE_CANTERA)
-      boost::mutex::scoped_lock lock(vpss_species_thermo_mutex);
+      ScopedLock lock(vpss_species_thermo_mutex);
 #endif
       if (s_factory) {
 	delete s_factory;
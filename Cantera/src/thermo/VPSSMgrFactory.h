@@ -91,7 +91,7 @@ namespace Cantera {
      */
     static VPSSMgrFactory* factory() {
 #if defined(THREAD_SAFE_CANTERA)
-      boost::mutex::scoped_lock lock(vpss_species_thermo_mutex);
+      ScopedLock lock(vpss_species_thermo_mutex);
 #endif
       if (!s_factory) s_factory = new VPSSMgrFactory;
       return s_factory;
@@ -160,7 +160,7 @@ namespace Cantera {
 #if defined(THREAD_SAFE_CANTERA)
     //! Decl of the static mutex variable that locks the 
     //! %VPSSMgr factory singelton
-    static boost::mutex vpss_species_thermo_mutex;
+    static mutex_t vpss_species_thermo_mutex;
 #endif
 
     //! Constructor. This is made private, so that only the static
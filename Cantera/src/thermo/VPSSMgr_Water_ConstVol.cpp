@@ -83,33 +83,20 @@ namespace Cantera {
   }
 
 
+  /*
+   * The reference state of the water, at (m_tlast, pref_safe(m_tlast)),
+   * is evaluated in _updateRefStateThermo() whenever the temperature
+   * changes, so the getters below only copy the stored vectors. They
+   * used to evaluate the water at the reference pressure and then put
+   * it back at m_plast on every call, which costs two density solves.
+   */
   void
   VPSSMgr_Water_ConstVol::getEnthalpy_RT_ref(doublereal *hrt) const{
-    // Everything should be OK except for the water SS
-    m_p0 = m_waterSS->pref_safe(m_tlast);
-    if (m_p0 != m_plast) {
-      doublereal RT = GasConstant * m_tlast;
-      m_waterSS->setState_TP(m_tlast, m_p0);
-      m_h0_RT[0] = (m_waterSS->enthalpy_mole()) / RT;
-      m_waterSS->setState_TP(m_tlast, m_plast);
-    } else {
-      m_h0_RT[0] = m_hss_RT[0];
-    }
     copy(m_h0_RT.begin(), m_h0_RT.end(), hrt);
   }
 
   void
   VPSSMgr_Water_ConstVol::getGibbs_RT_ref(doublereal *grt) const{
-    // Everything should be OK except for the water SS
-    m_p0 = m_waterSS->pref_safe(m_tlast);
-    if (m_p0 != m_plast) {
-      doublereal RT = GasConstant * m_tlast;
-      m_waterSS->setState_TP(m_tlast, m_p0);
-      m_g0_RT[0] = (m_waterSS->gibbs_mole()) / RT;
-      m_waterSS->setState_TP(m_tlast, m_plast);
-    } else {
-      m_g0_RT[0] = m_gss_RT[0];
-    }
     copy(m_g0_RT.begin(), m_g0_RT.end(), grt);
   }
 
@@ -124,43 +111,16 @@ namespace Cantera {
 
   void
   VPSSMgr_Water_ConstVol::getEntropy_R_ref(doublereal *sr) const{
-    // Everything should be OK except for the water SS
-    m_p0 = m_waterSS->pref_safe(m_tlast);
-    if (m_p0 != m_plast) {
-      m_waterSS->setState_TP(m_tlast, m_p0);
-      m_s0_R[0] = (m_waterSS->entropy_mole()) / GasConstant;
-      m_waterSS->setState_TP(m_tlast, m_plast);
-    } else {
-      m_s0_R[0] = m_sss_R[0];
-    }
     copy(m_s0_R.begin(), m_s0_R.end(), sr);
   }
 
   void
   VPSSMgr_Water_ConstVol::getCp_R_ref(doublereal *cpr) const{
-    // Everything should be OK except for the water SS
-    m_p0 = m_waterSS->pref_safe(m_tlast);
-    if (m_p0 != m_plast) {
-      m_waterSS->setState_TP(m_tlast, m_p0);
-      m_cp0_R[0] = (m_waterSS->cp_mole()) / GasConstant;
-      m_waterSS->setState_TP(m_tlast, m_plast);
-    } else {
-      m_cp0_R[0] = m_cpss_R[0];
-    }
     copy(m_cp0_R.begin(), m_cp0_R.end(), cpr);
   }
 
   void
   VPSSMgr_Water_ConstVol::getStandardVolumes_ref(doublereal *vol) const{
-    // Everything should be OK except for the water SS
-    m_p0 = m_waterSS->pref_safe(m_tlast);
-    if (m_p0 != m_plast) {
-     m_waterSS->setState_TP(m_tlast, m_p0);
-     m_V0[0] = m_vptp_ptr->molecularWeight(0) / m_waterSS->density();
-     m_waterSS->setState_TP(m_tlast, m_plast);
-    } else {
-      m_V0[0] = m_Vss[0];
-    }
     copy(m_V0.begin(), m_V0.end(), vol);
   }
 
@@ -177,7 +137,7 @@ namespace Cantera {
     m_h0_RT[0] = (m_waterSS->enthalpy_mole())/ RT;
     m_s0_R[0]  = (m_waterSS->entropy_mole()) / GasConstant;
     m_cp0_R[0] = (m_waterSS->cp_mole()) / GasConstant;
-    m_g0_RT[0] = (m_hss_RT[0] - m_sss_R[0]);
+    m_g0_RT[0] = (m_waterSS->gibbs_mole()) / RT;
     m_V0[0]    =  m_vptp_ptr->molecularWeight(0) / (m_waterSS->density());
     m_waterSS->setState_TP(m_tlast, m_plast);
   }
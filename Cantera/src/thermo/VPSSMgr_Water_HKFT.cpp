@@ -155,7 +155,7 @@ namespace Cantera {
     m_h0_RT[0] = (m_waterSS->enthalpy_mole())/ RT;
     m_s0_R[0]  = (m_waterSS->entropy_mole()) / GasConstant;
     m_cp0_R[0] = (m_waterSS->cp_mole()) / GasConstant;
-    m_g0_RT[0] = (m_hss_RT[0] - m_sss_R[0]);
+    m_g0_RT[0] = (m_waterSS->gibbs_mole()) / RT;
     m_V0[0]    = (m_waterSS->density()) / m_vptp_ptr->molecularWeight(0);
     PDSS_HKFT *ps;
     for (int k = 1; k < m_kk; k++) {
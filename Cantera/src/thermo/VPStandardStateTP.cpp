@@ -30,6 +30,9 @@ using namespace std;
 
 namespace Cantera {
 
+  //! indices of the profiling data entries of VPStandardStateTP
+  enum { prof_ss, prof_cache_ss };
+
   /*
    * Default constructor
    */
@@ -41,6 +44,11 @@ namespace Cantera {
     m_P0(OneAtm),
     m_VPSS_ptr(0)
   {
+#ifdef CANTERA_PROFILING
+    m_profile.setOwner("VPStandardStateTP");
+    m_profile.addTimer("updateStandardState");
+    m_profile.addCache("standardState_TP");
+#endif
   }
 
   /*
@@ -490,6 +498,7 @@ namespace Cantera {
    * This 
    */                    
   void VPStandardStateTP::_updateStandardStateThermo() const {
+    CT_PROFILE_TIMER(m_profile, prof_ss);
     double Tnow = temperature();
     m_Plast_ss = m_Pcurrent;
     m_Tlast_ss = Tnow;
@@ -501,7 +510,10 @@ namespace Cantera {
   void VPStandardStateTP::updateStandardStateThermo() const {
     double Tnow = temperature();
     if (Tnow != m_Tlast_ss || m_Pcurrent != m_Plast_ss) {
+      CT_PROFILE_MISS(m_profile, prof_cache_ss);
       _updateStandardStateThermo();
+    } else {
+      CT_PROFILE_HIT(m_profile, prof_cache_ss);
     }
   }
 }
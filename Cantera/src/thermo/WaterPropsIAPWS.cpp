@@ -141,6 +141,28 @@ doublereal  WaterPropsIAPWS::pressure() const {
   return (retn * rho * Rgas * temperature/M_water);
 }
 
+/*
+ * Auxiliary equation for the density of the saturated liquid,
+ * Eqn. (2.6) of W. Wagner and A. Pruss, J. Phys. Chem. Ref. Data,
+ * 31, 387 (2002). It agrees with the full formulation to within
+ * 0.1 percent, which makes it a good starting point for dfind().
+ * Valid for temperatures below T_c.
+ */
+static doublereal satLiquidDensityGuess(doublereal temperature) {
+  static const doublereal bi[6] = { 1.99274064, 1.09965342, -0.510839303,
+				    -1.75493479, -45.5170352, -6.74694450E5 };
+  doublereal theta = 1.0 - temperature / T_c;
+  doublereal th13 = pow(theta, 1.0/3.0);
+  doublereal th23 = th13 * th13;
+  doublereal th53 = theta * th23;
+  doublereal th163 = pow(th13, 16.0);
+  doublereal th433 = pow(th13, 43.0);
+  doublereal th1103 = pow(th13, 110.0);
+  doublereal rhor = 1.0 + bi[0] * th13 + bi[1] * th23 + bi[2] * th53
+    + bi[3] * th163 + bi[4] * th433 + bi[5] * th1103;
+  return rhor * Rho_c;
+}
+
 /*
  * Calculates the density given the temperature and the pressure,
  * and a guess at the density. Note, below T_c, this is a
@@ -169,10 +191,12 @@ doublereal WaterPropsIAPWS::density(doublereal temperature, doublereal pressure,
 	  rhoguess = pressure * M_water / (Rgas * temperature);
 	} else if (phase == WATER_LIQUID) {
 	  /*
-	   * Provide a guess about the liquid density that is 
-	   * relatively high -> convergnce from above seems robust.
+	   * Start from the saturated liquid density. This lies
+	   * on the liquid branch and is close to the answer for
+	   * all pressures of interest, so that dfind() needs
+	   * fewer iterations than from a fixed guess.
 	   */
-	  rhoguess = 1000.;
+	  rhoguess = satLiquidDensityGuess(temperature);
 	} else if (phase == WATER_UNSTABLELIQUID || phase == WATER_UNSTABLEGAS) {
 	  throw Cantera::CanteraError("WaterPropsIAPWS::density", 
 				      "Unstable Branch finder is untested");
@@ -255,10 +279,12 @@ doublereal WaterPropsIAPWS::density_const(doublereal pressure,
 	  rhoguess = pressure * M_water / (Rgas * temperature);
 	} else if (phase == WATER_LIQUID) {
 	  /*
-	   * Provide a guess about the liquid density that is 
-	   * relatively high -> convergnce from above seems robust.
+	   * Start from the saturated liquid density. This lies
+	   * on the liquid branch and is close to the answer for
+	   * all pressures of interest, so that dfind() needs
+	   * fewer iterations than from a fixed guess.
 	   */
-	  rhoguess = 1000.;
+	  rhoguess = satLiquidDensityGuess(temperature);
 	} else if (phase == WATER_UNSTABLELIQUID || phase == WATER_UNSTABLEGAS) {
 	  throw Cantera::CanteraError("WaterPropsIAPWS::density", 
 				      "Unstable Branch finder is untested");
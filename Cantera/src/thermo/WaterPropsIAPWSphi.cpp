@@ -367,7 +367,8 @@ static const doublereal  Bbetai[2] = {
 WaterPropsIAPWSphi::WaterPropsIAPWSphi() :
   TAUsave(-1.0),
   TAUsqrt(-1.0),
-  DELTAsave(-1.0)
+  DELTAsave(-1.0),
+  TAU375(-1.0)
 {
   for (int i = 0; i < 52; i++) {
     TAUp[i] = 1.0;
@@ -428,20 +429,56 @@ void WaterPropsIAPWSphi::check2() {
  * storage.
  */
 void WaterPropsIAPWSphi::tdpolycalc(doublereal  tau, doublereal  delta) {
-  if ((tau != TAUsave) || 1) {
+  bool tauChanged = (tau != TAUsave);
+  bool deltaChanged = (delta != DELTAsave);
+  if (tauChanged) {
     TAUsave = tau;
     TAUsqrt = sqrt(tau);
     TAUp[0] = 1.0;
     for (int i = 1; i < 51; i++) {
       TAUp[i] = TAUp[i-1] * tau;
     }
+    TAU375 = pow(tau, 0.375);
+    for (int i = 4; i <= 8; i++) {
+      EXPgam0[i] = exp(-gammi0[i]*tau);
+    }
   }
-  if ((delta != DELTAsave) || 1) {
+  if (deltaChanged) {
     DELTAsave = delta;
     DELTAp[0] = 1.0;
     for (int i = 1; i <= 15; i++) {
       DELTAp[i] = DELTAp[i-1] * delta;
     }
+    for (int c = 1; c <= 6; c++) {
+      EXPdeltaC[c] = exp(-DELTAp[c]);
+    }
+    doublereal  deltam1 = delta - 1.0;
+    doublereal  dtmp2 = deltam1 * deltam1;
+    for (int j = 0; j < 2; j++) {
+      doublereal  atmp = 0.5 / Bbetai[j];
+      NApowA[j]   = pow(dtmp2, atmp);
+      NApowAm1[j] = pow(dtmp2, atmp - 1.0);
+      NApowa[j]   = pow(dtmp2, ai[j]);
+      NApowam1[j] = pow(dtmp2, ai[j]-1.0);
+      NApowam2[j] = pow(dtmp2, ai[j]-2.0);
+    }
+  }
+  if (tauChanged || deltaChanged) {
+    for (int j = 0; j < 3; j++) {
+      doublereal  dtmp = delta - epsi[j];
+      doublereal  ttmp = tau - gammai[j];
+      EXPgauss[j] = exp(-alphai[j]*dtmp*dtmp - betai[j]*ttmp*ttmp);
+    }
+    doublereal  deltam1 = delta - 1.0;
+    doublereal  dtmp2 = deltam1 * deltam1;
+    doublereal  ttmp = tau - 1.0;
+    for (int j = 0; j < 2; j++) {
+      doublereal  theta = (1.0 - tau) + Ai[j] * NApowA[j];
+      doublereal  triag = theta * theta + Bi[j] * NApowa[j];
+      NAtriagB[j]   = pow(triag, bi[j]);
+      NAtriagBm1[j] = pow(triag, bi[j]-1.0);
+      NAphi[j] = exp(-Ci[j]*dtmp2 - Di[j]*ttmp*ttmp);
+    }
   }
 }
 
@@ -454,11 +491,11 @@ doublereal  WaterPropsIAPWSphi::phi0() const {
   doublereal  delta = DELTAsave;
   doublereal  retn = log(delta) + ni0[1] + ni0[2]*tau + ni0[3]*log(tau);
 
-  retn += ni0[4] * log(1.0 - exp(-gammi0[4]*tau));
-  retn += ni0[5] * log(1.0 - exp(-gammi0[5]*tau));
-  retn += ni0[6] * log(1.0 - exp(-gammi0[6]*tau));
-  retn += ni0[7] * log(1.0 - exp(-gammi0[7]*tau));
-  retn += ni0[8] * log(1.0 - exp(-gammi0[8]*tau));
+  retn += ni0[4] * log(1.0 - EXPgam0[4]);
+  retn += ni0[5] * log(1.0 - EXPgam0[5]);
+  retn += ni0[6] * log(1.0 - EXPgam0[6]);
+  retn += ni0[7] * log(1.0 - EXPgam0[7]);
+  retn += ni0[8] * log(1.0 - EXPgam0[8]);
   return retn;
 }
 
@@ -477,7 +514,7 @@ doublereal  WaterPropsIAPWSphi::phiR() const {
   /*
    * Write out the first seven polynomials in the expression
    */
-  doublereal  T375 = pow(tau, 0.375);
+  doublereal  T375 = TAU375;
   doublereal  val = (ni[1] * delta / TAUsqrt +
 		ni[2] * delta * TAUsqrt * T375 +
 		ni[3] * delta * tau +
@@ -489,7 +526,7 @@ doublereal  WaterPropsIAPWSphi::phiR() const {
    * Next, do polynomial contributions 8 to 51
    */
   for (i = 8; i <= 51; i++) {
-    val += (ni[i] * DELTAp[diR[i]] * TAUp[tiR[i]] * exp(-DELTAp[ciR[i]]));
+    val += (ni[i] * DELTAp[diR[i]] * TAUp[tiR[i]] * EXPdeltaC[ciR[i]]);
   }
 
   /*
@@ -497,10 +534,8 @@ doublereal  WaterPropsIAPWSphi::phiR() const {
    */
   for (j = 0; j < 3; j++) {
     i = 52 + j;
-    doublereal  dtmp = delta - epsi[j];
-    doublereal  ttmp = tau - gammai[j];
     val += (ni[i] * DELTAp[diR[i]] * TAUp[tiR[i]] * 
-	    exp(-alphai[j]*dtmp*dtmp - betai[j]*ttmp*ttmp));
+	    EXPgauss[j]);
   }
 
   /*
@@ -508,16 +543,10 @@ doublereal  WaterPropsIAPWSphi::phiR() const {
    */
   for (j = 0; j < 2; j++) {
     i = 55 + j;
-    doublereal  deltam1 = delta - 1.0;
-    doublereal  dtmp2 = deltam1 * deltam1;
-    doublereal  atmp = 0.5 / Bbetai[j];
-    doublereal  theta = (1.0 - tau) + Ai[j] * pow(dtmp2, atmp);
-    doublereal  triag = theta * theta + Bi[j] * pow(dtmp2, ai[j]);
-    doublereal  ttmp = tau - 1.0;
    
-    doublereal  triagtmp = pow(triag, bi[j]);
+    doublereal  triagtmp = NAtriagB[j];
       
-    doublereal  phi = exp(-Ci[j]*dtmp2 - Di[j]*ttmp*ttmp);
+    doublereal  phi = NAphi[j];
     val += (ni[i] * triagtmp * delta * phi);
   }
 
@@ -552,7 +581,7 @@ doublereal  WaterPropsIAPWSphi::phiR_d() const {
   /*
    * Write out the first seven polynomials in the expression
    */
-  doublereal  T375 = pow(tau, 0.375);
+  doublereal  T375 = TAU375;
   doublereal  val = (ni[1] / TAUsqrt +
 		ni[2] * TAUsqrt * T375 +
 		ni[3] * tau +
@@ -564,7 +593,7 @@ doublereal  WaterPropsIAPWSphi::phiR_d() const {
    * Next, do polynomial contributions 8 to 51
    */
   for (i = 8; i <= 51; i++) {
-    val += ( (ni[i] * exp(-DELTAp[ciR[i]]) *  DELTAp[diR[i] - 1] *
+    val += ( (ni[i] * EXPdeltaC[ciR[i]] *  DELTAp[diR[i] - 1] *
 	      TAUp[tiR[i]]) * (diR[i] - ciR[i]* DELTAp[ciR[i]]));
   }
 
@@ -574,9 +603,8 @@ doublereal  WaterPropsIAPWSphi::phiR_d() const {
   for (j = 0; j < 3; j++) {
     i = 52 + j;
     doublereal  dtmp = delta - epsi[j];
-    doublereal  ttmp = tau - gammai[j];
     doublereal  tmp = (ni[i] * DELTAp[diR[i]] * TAUp[tiR[i]] * 
-		  exp(-alphai[j]*dtmp*dtmp - betai[j]*ttmp*ttmp));
+		  EXPgauss[j]);
     val += tmp * (diR[i]/delta - 2.0 * alphai[j] * dtmp);
   }
 
@@ -586,22 +614,17 @@ doublereal  WaterPropsIAPWSphi::phiR_d() const {
   for (j = 0; j < 2; j++) {
     i = 55 + j;
     doublereal  deltam1 = delta - 1.0;
-    doublereal  dtmp2 = deltam1 * deltam1;
-    doublereal  atmp = 0.5 / Bbetai[j];
-    doublereal  theta = (1.0 - tau) + Ai[j] * pow(dtmp2, atmp);
-    doublereal  triag = theta * theta + Bi[j] * pow(dtmp2, ai[j]);
-    doublereal  ttmp = tau - 1.0;
+    doublereal  theta = (1.0 - tau) + Ai[j] * NApowA[j];
    
-    doublereal  triagtmp = pow(triag, bi[j]);
-    doublereal  triagtmpm1 = pow(triag, bi[j]-1.0);
-    doublereal  atmpM1 = atmp - 1.0;
-    doublereal  ptmp = pow(dtmp2,atmpM1); 
-    doublereal  p2tmp = pow(dtmp2, ai[j]-1.0);
+    doublereal  triagtmp = NAtriagB[j];
+    doublereal  triagtmpm1 = NAtriagBm1[j];
+    doublereal  ptmp = NApowAm1[j]; 
+    doublereal  p2tmp = NApowam1[j];
     doublereal  dtriagddelta = 
       deltam1 *(Ai[j] * theta * 2.0 / Bbetai[j] * ptmp +
 		2.0*Bi[j]*ai[j]*p2tmp);
 
-    doublereal  phi = exp(-Ci[j]*dtmp2 - Di[j]*ttmp*ttmp);
+    doublereal  phi = NAphi[j];
     doublereal  dphiddelta = -2.0*Ci[j]*deltam1*phi;
     doublereal  dtriagtmpddelta = bi[j] * triagtmpm1 * dtriagddelta;
 
@@ -668,7 +691,7 @@ doublereal  WaterPropsIAPWSphi::phiR_dd() const {
   /*
    * Write out the first seven polynomials in the expression
    */
-  doublereal  T375 = pow(tau, 0.375);
+  doublereal  T375 = TAU375;
   doublereal  val = (ni[4] * 2.0 * TAUsqrt +
 		ni[5] * 2.0 * T375 * T375 +
 		ni[6] * 6.0 * delta * T375 +
@@ -678,7 +701,7 @@ doublereal  WaterPropsIAPWSphi::phiR_dd() const {
    */
   for (i = 8; i <= 51; i++) {
     doublereal  dtmp = DELTAp[ciR[i]];
-    doublereal  tmp = ni[i] * exp(-dtmp) * TAUp[tiR[i]];
+    doublereal  tmp = ni[i] * EXPdeltaC[ciR[i]] * TAUp[tiR[i]];
     if (diR[i] == 1) {
       atmp = 1.0/delta;
     } else {
@@ -695,9 +718,8 @@ doublereal  WaterPropsIAPWSphi::phiR_dd() const {
   for (j = 0; j < 3; j++) {
     i = 52 + j;
     doublereal  dtmp = delta - epsi[j];
-    doublereal  ttmp = tau - gammai[j];
     doublereal  tmp = (ni[i] * TAUp[tiR[i]] * 
-		  exp(-alphai[j]*dtmp*dtmp - betai[j]*ttmp*ttmp));
+		  EXPgauss[j]);
     doublereal  deltmp =  DELTAp[diR[i]];
     doublereal  deltmpM1 = deltmp/delta;
     doublereal  deltmpM2 = deltmpM1 / delta;
@@ -717,20 +739,18 @@ doublereal  WaterPropsIAPWSphi::phiR_dd() const {
     doublereal  deltam1 = delta - 1.0;
     doublereal  dtmp2 = deltam1 * deltam1;
     atmp = 0.5 / Bbetai[j];
-    doublereal  theta = (1.0 - tau) + Ai[j] * pow(dtmp2, atmp);
-    doublereal  triag = theta * theta + Bi[j] * pow(dtmp2, ai[j]);
-    doublereal  ttmp = tau - 1.0;
+    doublereal  theta = (1.0 - tau) + Ai[j] * NApowA[j];
+    doublereal  triag = theta * theta + Bi[j] * NApowa[j];
    
-    doublereal  triagtmp = pow(triag, bi[j]);
-    doublereal  triagtmpm1 = pow(triag, bi[j]-1.0);
-    doublereal  atmpM1 = atmp - 1.0;
-    doublereal  ptmp = pow(dtmp2,atmpM1);
-    doublereal  p2tmp = pow(dtmp2, ai[j]-1.0);
+    doublereal  triagtmp = NAtriagB[j];
+    doublereal  triagtmpm1 = NAtriagBm1[j];
+    doublereal  ptmp = NApowAm1[j];
+    doublereal  p2tmp = NApowam1[j];
     doublereal  dtriagddelta = 
       deltam1 *(Ai[j] * theta * 2.0 / Bbetai[j] * ptmp +
 		2.0*Bi[j]*ai[j]*p2tmp);
 
-    doublereal  phi = exp(-Ci[j]*dtmp2 - Di[j]*ttmp*ttmp);
+    doublereal  phi = NAphi[j];
     doublereal  dphiddelta = -2.0*Ci[j]*deltam1*phi;
     doublereal  dtriagtmpddelta = bi[j] * triagtmpm1 * dtriagddelta;
 
@@ -740,7 +760,7 @@ doublereal  WaterPropsIAPWSphi::phiR_dd() const {
     doublereal  pptmp = ptmp / dtmp2;
     doublereal  d2triagddelta2 = dtriagddelta / deltam1;
     d2triagddelta2 += 
-      dtmp2 *(4.0*Bi[j]*ai[j]*(ai[j]-1.0)*pow(dtmp2,ai[j]-2.0) +
+      dtmp2 *(4.0*Bi[j]*ai[j]*(ai[j]-1.0)*NApowam2[j] +
 	      2.0*Ai[j]*Ai[j]/(Bbetai[j]*Bbetai[j])*ptmp*ptmp +
 	      Ai[j]*theta*4.0/Bbetai[j]*(atmp-1.0)*pptmp);
 
@@ -805,11 +825,11 @@ doublereal  WaterPropsIAPWSphi::dimdpdT(doublereal  tau, doublereal  delta) {
 doublereal  WaterPropsIAPWSphi::phi0_t() const {
   doublereal  tau = TAUsave;
   doublereal  retn = ni0[2] + ni0[3]/tau;;
-  retn += (ni0[4] * gammi0[4] * (1.0/(1.0 - exp(-gammi0[4]*tau)) - 1.0));
-  retn += (ni0[5] * gammi0[5] * (1.0/(1.0 - exp(-gammi0[5]*tau)) - 1.0));
-  retn += (ni0[6] * gammi0[6] * (1.0/(1.0 - exp(-gammi0[6]*tau)) - 1.0));
-  retn += (ni0[7] * gammi0[7] * (1.0/(1.0 - exp(-gammi0[7]*tau)) - 1.0));
-  retn += (ni0[8] * gammi0[8] * (1.0/(1.0 - exp(-gammi0[8]*tau)) - 1.0));
+  retn += (ni0[4] * gammi0[4] * (1.0/(1.0 - EXPgam0[4]) - 1.0));
+  retn += (ni0[5] * gammi0[5] * (1.0/(1.0 - EXPgam0[5]) - 1.0));
+  retn += (ni0[6] * gammi0[6] * (1.0/(1.0 - EXPgam0[6]) - 1.0));
+  retn += (ni0[7] * gammi0[7] * (1.0/(1.0 - EXPgam0[7]) - 1.0));
+  retn += (ni0[8] * gammi0[8] * (1.0/(1.0 - EXPgam0[8]) - 1.0));
   return retn;
 }
 
@@ -824,12 +844,12 @@ doublereal  WaterPropsIAPWSphi::phiR_t() const {
   doublereal  tau = TAUsave;
   doublereal  delta = DELTAsave;
   int i, j;
-  doublereal  atmp, tmp;
+  doublereal  tmp;
     
   /*
    * Write out the first seven polynomials in the expression
    */
-  doublereal  T375 = pow(tau, 0.375);
+  doublereal  T375 = TAU375;
   doublereal  val = ((-0.5) *ni[1] * delta / TAUsqrt / tau +
 		ni[2] * delta * 0.875 / TAUsqrt * T375 +
 		ni[3] * delta +
@@ -841,7 +861,7 @@ doublereal  WaterPropsIAPWSphi::phiR_t() const {
    * Next, do polynomial contributions 8 to 51
    */
   for (i = 8; i <= 51; i++) {
-    tmp = (ni[i] * DELTAp[diR[i]] * TAUp[tiR[i]-1] * exp(-DELTAp[ciR[i]]));
+    tmp = (ni[i] * DELTAp[diR[i]] * TAUp[tiR[i]-1] * EXPdeltaC[ciR[i]]);
     val += tiR[i] * tmp;
   }
 
@@ -850,10 +870,9 @@ doublereal  WaterPropsIAPWSphi::phiR_t() const {
    */
   for (j = 0; j < 3; j++) {
     i = 52 + j;
-    doublereal  dtmp = delta - epsi[j];
     doublereal  ttmp = tau - gammai[j];
     tmp = (ni[i] * DELTAp[diR[i]] * TAUp[tiR[i]] * 
-	   exp(-alphai[j]*dtmp*dtmp - betai[j]*ttmp*ttmp));
+	   EXPgauss[j]);
     val += tmp *(tiR[i]/tau - 2.0 * betai[j]*ttmp);
   }
 
@@ -862,16 +881,13 @@ doublereal  WaterPropsIAPWSphi::phiR_t() const {
    */
   for (j = 0; j < 2; j++) {
     i = 55 + j;
-    doublereal  deltam1 = delta - 1.0;
-    doublereal  dtmp2 = deltam1 * deltam1;
-    atmp = 0.5 / Bbetai[j];
-    doublereal  theta = (1.0 - tau) + Ai[j] * pow(dtmp2, atmp);
-    doublereal  triag = theta * theta + Bi[j] * pow(dtmp2, ai[j]);
+    doublereal  theta = (1.0 - tau) + Ai[j] * NApowA[j];
+    doublereal  triag = theta * theta + Bi[j] * NApowa[j];
     doublereal  ttmp = tau - 1.0;
    
-    doublereal  triagtmp = pow(triag, bi[j]);
+    doublereal  triagtmp = NAtriagB[j];
       
-    doublereal  phi = exp(-Ci[j]*dtmp2 - Di[j]*ttmp*ttmp);
+    doublereal  phi = NAphi[j];
  
 
     doublereal  dtriagtmpdtau = -2.0*theta * bi[j] * triagtmp / triag;
@@ -905,7 +921,7 @@ doublereal  WaterPropsIAPWSphi::phi0_tt() const {
   doublereal  tmp, itmp;
   doublereal  retn = - ni0[3]/(tau * tau);
   for (int i = 4; i <= 8; i++) {
-    tmp = exp(-gammi0[i]*tau);
+    tmp = EXPgam0[i];
     itmp = 1.0 - tmp;
     retn -= (ni0[i] * gammi0[i] * gammi0[i] * tmp / (itmp * itmp));
   }
@@ -928,7 +944,7 @@ doublereal  WaterPropsIAPWSphi::phiR_tt() const {
   /*
    * Write out the first seven polynomials in the expression
    */
-  doublereal  T375 = pow(tau, 0.375);
+  doublereal  T375 = TAU375;
   doublereal  val = ((-0.5) * (-1.5) * ni[1] * delta / (TAUsqrt * tau * tau) +
 		ni[2] * delta * 0.875 * (-0.125) * T375 / (TAUsqrt * tau) +
 		ni[4] * DELTAp[2] * 0.5 * (-0.5)/ (TAUsqrt * tau) +
@@ -939,7 +955,7 @@ doublereal  WaterPropsIAPWSphi::phiR_tt() const {
    */
   for (i = 8; i <= 51; i++) {
     if (tiR[i] > 1) {
-      tmp = (ni[i] * DELTAp[diR[i]] * TAUp[tiR[i]-2] * exp(-DELTAp[ciR[i]]));
+      tmp = (ni[i] * DELTAp[diR[i]] * TAUp[tiR[i]-2] * EXPdeltaC[ciR[i]]);
       val += tiR[i] *  (tiR[i] - 1.0) * tmp;
     }
   }
@@ -949,10 +965,9 @@ doublereal  WaterPropsIAPWSphi::phiR_tt() const {
    */
   for (j = 0; j < 3; j++) {
     i = 52 + j;
-    doublereal  dtmp = delta - epsi[j];
     doublereal  ttmp = tau - gammai[j];
     tmp = (ni[i] * DELTAp[diR[i]] * TAUp[tiR[i]] * 
-	   exp(-alphai[j]*dtmp*dtmp - betai[j]*ttmp*ttmp));
+	   EXPgauss[j]);
     atmp = tiR[i]/tau - 2.0 * betai[j]*ttmp;
     val += tmp *(atmp * atmp - tiR[i]/(tau*tau) - 2.0*betai[j]);
   }
@@ -962,17 +977,15 @@ doublereal  WaterPropsIAPWSphi::phiR_tt() const {
    */
   for (j = 0; j < 2; j++) {
     i = 55 + j;
-    doublereal  deltam1 = delta - 1.0;
-    doublereal  dtmp2 = deltam1 * deltam1;
     atmp = 0.5 / Bbetai[j];
-    doublereal  theta = (1.0 - tau) + Ai[j] * pow(dtmp2, atmp);
-    doublereal  triag = theta * theta + Bi[j] * pow(dtmp2, ai[j]);
+    doublereal  theta = (1.0 - tau) + Ai[j] * NApowA[j];
+    doublereal  triag = theta * theta + Bi[j] * NApowa[j];
     doublereal  ttmp = tau - 1.0;
    
-    doublereal  triagtmp = pow(triag, bi[j]);
+    doublereal  triagtmp = NAtriagB[j];
     doublereal  triagtmpM1 = triagtmp / triag;
       
-    doublereal  phi = exp(-Ci[j]*dtmp2 - Di[j]*ttmp*ttmp);
+    doublereal  phi = NAphi[j];
  
 
     doublereal  dtriagtmpdtau = -2.0*theta * bi[j] * triagtmp / triag;
@@ -1029,7 +1042,7 @@ doublereal  WaterPropsIAPWSphi::phiR_dt() const {
   /*
    * Write out the first seven polynomials in the expression
    */
-  doublereal  T375 = pow(tau, 0.375);
+  doublereal  T375 = TAU375;
   doublereal  val = (ni[1] * (-0.5) / (TAUsqrt * tau) +
 		ni[2] * (0.875) * T375 / TAUsqrt +
 		ni[3] +
@@ -1041,7 +1054,7 @@ doublereal  WaterPropsIAPWSphi::phiR_dt() const {
    * Next, do polynomial contributions 8 to 51
    */
   for (i = 8; i <= 51; i++) {
-    tmp = (ni[i] * tiR[i] * exp(-DELTAp[ciR[i]]) *  DELTAp[diR[i] - 1] *
+    tmp = (ni[i] * tiR[i] * EXPdeltaC[ciR[i]] *  DELTAp[diR[i] - 1] *
 	   TAUp[tiR[i] - 1]);
     val += tmp * (diR[i] - ciR[i] * DELTAp[ciR[i]]);
   }
@@ -1054,7 +1067,7 @@ doublereal  WaterPropsIAPWSphi::phiR_dt() const {
     doublereal  dtmp = delta - epsi[j];
     doublereal  ttmp = tau - gammai[j];
     tmp = (ni[i] * DELTAp[diR[i]] * TAUp[tiR[i]] * 
-	   exp(-alphai[j]*dtmp*dtmp - betai[j]*ttmp*ttmp));
+	   EXPgauss[j]);
     val += tmp * ((diR[i]/delta - 2.0 * alphai[j] * dtmp) * 
 		  (tiR[i]/tau   - 2.0 * betai[j]  * ttmp));
   }
@@ -1065,22 +1078,19 @@ doublereal  WaterPropsIAPWSphi::phiR_dt() const {
   for (j = 0; j < 2; j++) {
     i = 55 + j;
     doublereal  deltam1 = delta - 1.0;
-    doublereal  dtmp2 = deltam1 * deltam1;
-    doublereal  atmp = 0.5 / Bbetai[j];
-    doublereal  theta = (1.0 - tau) + Ai[j] * pow(dtmp2, atmp);
-    doublereal  triag = theta * theta + Bi[j] * pow(dtmp2, ai[j]);
+    doublereal  theta = (1.0 - tau) + Ai[j] * NApowA[j];
+    doublereal  triag = theta * theta + Bi[j] * NApowa[j];
     doublereal  ttmp = tau - 1.0;
    
-    doublereal  triagtmp = pow(triag, bi[j]);
-    doublereal  triagtmpm1 = pow(triag, bi[j]-1.0);
-    doublereal  atmpM1 = atmp - 1.0;
-    doublereal  ptmp = pow(dtmp2,atmpM1); 
-    doublereal  p2tmp = pow(dtmp2, ai[j]-1.0);
+    doublereal  triagtmp = NAtriagB[j];
+    doublereal  triagtmpm1 = NAtriagBm1[j];
+    doublereal  ptmp = NApowAm1[j]; 
+    doublereal  p2tmp = NApowam1[j];
     doublereal  dtriagddelta = 
       deltam1 *(Ai[j] * theta * 2.0 / Bbetai[j] * ptmp +
 		2.0*Bi[j]*ai[j]*p2tmp);
 
-    doublereal  phi = exp(-Ci[j]*dtmp2 - Di[j]*ttmp*ttmp);
+    doublereal  phi = NAphi[j];
     doublereal  dphiddelta = -2.0*Ci[j]*deltam1*phi;
     doublereal  dtriagtmpddelta = bi[j] * triagtmpm1 * dtriagddelta;
 
@@ -223,5 +223,36 @@ private:
 
   //! Last delta that was used to calculate polynomials
   doublereal DELTAsave;
+
+  //! tau to the 0.375 power
+  doublereal TAU375;
+
+  //! exp(-gammi0[i]*tau) for the ideal gas terms i = 4 to 8
+  doublereal EXPgam0[9];
+
+  //! exp(-delta^c) for the exponents c = 1 to 6 of terms 8 to 51
+  doublereal EXPdeltaC[7];
+
+  //! Gaussian bell factors of terms 52 to 54
+  doublereal EXPgauss[3];
+
+  /**
+   * @name Nonanalytical terms 55 and 56
+   *
+   * Powers and exponentials that appear in the nonanalytical terms,
+   * with dtmp2 = (delta - 1)^2. They are only recalculated by
+   * tdpolycalc() when tau or delta changes, since the phiR
+   * routines are called repeatedly at the same state.
+   */
+  //@{
+  doublereal NApowA[2];      //!< dtmp2^(0.5/Bbetai)
+  doublereal NApowAm1[2];    //!< dtmp2^(0.5/Bbetai - 1)
+  doublereal NApowa[2];      //!< dtmp2^ai
+  doublereal NApowam1[2];    //!< dtmp2^(ai - 1)
+  doublereal NApowam2[2];    //!< dtmp2^(ai - 2)
+  doublereal NAtriagB[2];    //!< triag^bi
+  doublereal NAtriagBm1[2];  //!< triag^(bi - 1)
+  doublereal NAphi[2];       //!< exp(-Ci dtmp2 - Di (tau-1)^2)
+  //@}
 };
 #endif
@@ -38,6 +38,11 @@ namespace Cantera {
 
   //////////////////// class MixTransport methods //////////////
 
+#ifdef CANTERA_PROFILING
+  /// indices of the profiling data entries of MixTransport
+  enum { prof_cache_T, prof_update_C, prof_cond_T, prof_diff_T,
+	 prof_visc_T };
+#endif
 
   MixTransport::MixTransport() :
     m_nsp(0),
@@ -46,8 +51,14 @@ namespace Cantera {
     m_temp(-1.0),
     m_logt(0.0)
   {
-
-
+#ifdef CANTERA_PROFILING
+    m_profile.setOwner("MixTransport");
+    m_profile.addCache("update_T");
+    m_profile.addCounter("update_C");
+    m_profile.addTimer("updateCond_T");
+    m_profile.addTimer("updateDiff_T");
+    m_profile.addTimer("updateViscosity_T");
+#endif
   }
 
   bool MixTransport::initGas( GasTransportParams& tr ) {
@@ -320,7 +331,11 @@ namespace Cantera {
   void MixTransport::update_T() 
   {
     doublereal t = m_thermo->temperature();
-    if (t == m_temp) return;
+    if (t == m_temp) {
+      CT_PROFILE_HIT(m_profile, prof_cache_T);
+      return;
+    }
+    CT_PROFILE_MISS(m_profile, prof_cache_T);
     if (t < 0.0) {
       throw CanteraError("MixTransport::update_T",
 			 "negative temperature "+fp2str(t));
@@ -363,6 +378,7 @@ namespace Cantera {
     // be recomputed before use, and update the local mole
     // fractions.
 
+    CT_PROFILE_COUNT(m_profile, prof_update_C);
     m_viscmix_ok = false;
     m_diffmix_ok = false;
     m_condmix_ok = false;
@@ -388,6 +404,7 @@ namespace Cantera {
    * thermal conductivity. 
    */
   void MixTransport::updateCond_T() {
+    CT_PROFILE_TIMER(m_profile, prof_cond_T);
 
     int k;
     if (m_mode == CK_Mode) {
@@ -410,6 +427,7 @@ namespace Cantera {
    * from the polynomial fits at unit pressure (1 Pa).
    */
   void MixTransport::updateDiff_T() {
+    CT_PROFILE_TIMER(m_profile, prof_diff_T);
 
     // evaluate binary diffusion coefficients at unit pressure
     int i,j;
@@ -469,6 +487,7 @@ namespace Cantera {
    * The flag m_visc_ok is set to true.
    */
   void MixTransport::updateViscosity_T() {
+    CT_PROFILE_TIMER(m_profile, prof_visc_T);
     doublereal vratiokj, wratiojk, factor1;
 
     if (!m_spvisc_ok) updateSpeciesViscosities();
@@ -448,6 +448,9 @@ namespace Cantera {
         const doublereal* grad_T, int ldx, const doublereal* grad_X, 
         int ldf, doublereal* fluxes) {
 
+        // update the mole fractions
+        updateTransport_C();
+
         // update the binary diffusion coefficients if necessary
         updateDiff_T();
 
@@ -836,6 +839,11 @@ namespace Cantera {
         if (m_diff_tlast == m_thermo->temperature()) return;
         _update_diff_T();
         m_diff_tlast = m_thermo->temperature();
+
+        // the diagonal of m_bdiff has been reset, so the
+        // self-diffusion terms set by _update_thermal_T must be
+        // evaluated again before the L matrix is
+        m_thermal_tlast = 0.0;
         //m_thermo->update_T(m_update_diff_T);
     }
 
@@ -61,6 +61,9 @@ namespace Cantera {
     m_nmin          = right.m_nmin;
     m_index         = right.m_index;
     m_nDim          = right.m_nDim;
+#ifdef CANTERA_PROFILING
+    m_profile       = right.m_profile;
+#endif
     return *this;
   }
 
@@ -23,6 +23,7 @@
 #define CT_TRANSPORTBASE_H
 
 #include "ThermoPhase.h"
+#include "ProfileData.h"
 
 
 namespace Cantera {
@@ -133,6 +134,11 @@ namespace Cantera {
      */
     int index() const ;
 
+#ifdef CANTERA_PROFILING
+    /// Profiling data for this transport manager
+    ProfileData& profileData() { return m_profile; }
+#endif
+
     /**
      * Set an integer index number. This is for internal use of
      * Cantera, and may be removed in the future.
@@ -440,6 +446,11 @@ namespace Cantera {
     //! Number of dimensions used in flux expresions
     int       m_nDim;
 
+#ifdef CANTERA_PROFILING
+    //! Counters, timers and cache statistics of the property updates
+    ProfileData m_profile;
+#endif
+
 
   private:
 
@@ -56,7 +56,7 @@ namespace Cantera {
 
   TransportFactory* TransportFactory::s_factory = 0;
 #if defined(THREAD_SAFE_CANTERA)
-  boost::mutex  TransportFactory::transport_mutex;
+  mutex_t  TransportFactory::transport_mutex;
 #endif
 
     
@@ -283,7 +283,7 @@ namespace Cantera {
    */
   void TransportFactory::deleteFactory() {
 #if defined(THREAD_SAFE_CANTERA)
-    boost::mutex::scoped_lock   lock(transport_mutex) ;
+    ScopedLock   lock(transport_mutex) ;
 #endif
     if (s_factory) {
       delete s_factory;
@@ -36,9 +36,7 @@
 #include "FactoryBase.h"
 #include "LiquidTransportData.h"
 
-#if defined(THREAD_SAFE_CANTERA)
-#include <boost/thread/mutex.hpp>
-#endif
+#include "ct_thread.h"
 
 namespace Cantera {
 
@@ -101,7 +99,7 @@ namespace Cantera {
      */
     static TransportFactory* factory() {
 #if defined(THREAD_SAFE_CANTERA)
-      boost::mutex::scoped_lock   lock(transport_mutex) ;
+      ScopedLock   lock(transport_mutex) ;
 #endif
       if (!s_factory) {
 	s_factory = new TransportFactory();
@@ -159,7 +157,7 @@ namespace Cantera {
     //! object allowed
     static TransportFactory* s_factory;
 #if defined(THREAD_SAFE_CANTERA)
-    static boost::mutex transport_mutex ;
+    static mutex_t transport_mutex ;
 #endif
 
     //! The constructor is private; use static method factory() to
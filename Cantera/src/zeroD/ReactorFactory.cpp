@@ -27,7 +27,7 @@ namespace CanteraZeroD {
 
     ReactorFactory* ReactorFactory::s_factory = 0;
    #ifdef THREAD_SAFE_CANTERA
-    boost::mutex ReactorFactory::reactor_mutex ;
+    Cantera::mutex_t ReactorFactory::reactor_mutex ;
    #endif
 
     static int ntypes = 4;
@@ -17,9 +17,7 @@
 #include "ReactorBase.h"
 #include "FactoryBase.h"
 
-#if defined(THREAD_SAFE_CANTERA)
-#include <boost/thread/mutex.hpp>
-#endif
+#include "ct_thread.h"
 
 namespace CanteraZeroD {
 
@@ -30,7 +28,7 @@ namespace CanteraZeroD {
 
         static ReactorFactory* factory() {
             #if defined(THREAD_SAFE_CANTERA)
-               boost::mutex::scoped_lock   lock(reactor_mutex) ;
+               Cantera::ScopedLock   lock(reactor_mutex) ;
             #endif
             if (!s_factory) s_factory = new ReactorFactory;
             return s_factory;
@@ -38,7 +36,7 @@ namespace CanteraZeroD {
 
         virtual void deleteFactory() {
        #if defined(THREAD_SAFE_CANTERA)
-         boost::mutex::scoped_lock   lock(reactor_mutex) ;
+         Cantera::ScopedLock   lock(reactor_mutex) ;
        #endif
         if (s_factory) {
           delete s_factory;
@@ -62,7 +60,7 @@ namespace CanteraZeroD {
 
         static ReactorFactory* s_factory;
          #if defined(THREAD_SAFE_CANTERA)
-            static boost::mutex reactor_mutex ;
+            static Cantera::mutex_t reactor_mutex ;
          #endif
         ReactorFactory(){}
     };
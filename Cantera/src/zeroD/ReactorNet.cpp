@@ -7,6 +7,11 @@ using namespace std;
 
 namespace CanteraZeroD {
 
+#ifdef CANTERA_PROFILING
+  /// indices of the profiling data entries of ReactorNet
+  enum { prof_advance, prof_step, prof_eval, prof_jac };
+#endif
+
   ReactorNet::ReactorNet() : Cantera::FuncEval(), m_nr(0), m_nreactors(0),
 			     m_integ(0), m_time(0.0), m_init(false), 
 			     m_nv(0), m_rtol(1.0e-9), m_rtolsens(1.0e-4), 
@@ -16,6 +21,13 @@ namespace CanteraZeroD {
   {
 #ifdef DEBUG_MODE
     m_verbose = true;
+#endif
+#ifdef CANTERA_PROFILING
+    m_profile.setOwner("ReactorNet");
+    m_profile.addTimer("advance");
+    m_profile.addTimer("step");
+    m_profile.addTimer("eval");
+    m_profile.addTimer("evalJacobian");
 #endif
     m_integ = newIntegrator("CVODE");// CVodeInt;
 
@@ -122,6 +134,7 @@ namespace CanteraZeroD {
   }
 
   void ReactorNet::advance(doublereal time) {
+    CT_PROFILE_TIMER(m_profile, prof_advance);
     if (!m_init) {
       if (m_maxstep < 0.0)
 	m_maxstep = time - m_time;
@@ -133,6 +146,7 @@ namespace CanteraZeroD {
   }
 
   double ReactorNet::step(doublereal time) {
+    CT_PROFILE_TIMER(m_profile, prof_step);
     if (!m_init) {
       if (m_maxstep < 0.0)
 	m_maxstep = time - m_time;
@@ -180,6 +194,7 @@ namespace CanteraZeroD {
         
   void ReactorNet::eval(doublereal t, doublereal* y, 
 			doublereal* ydot, doublereal* p) {
+    CT_PROFILE_TIMER(m_profile, prof_eval);
     int n;
     int start = 0;
     int pstart = 0;
@@ -204,6 +219,7 @@ namespace CanteraZeroD {
         
   void ReactorNet::evalJacobian(doublereal t, doublereal* y, 
 				doublereal* ydot, doublereal* p, Array2D* j) {
+    CT_PROFILE_TIMER(m_profile, prof_jac);
     int n, m;
     doublereal ysave, dy;
     Array2D& jac = *j;
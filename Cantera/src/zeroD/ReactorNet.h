@@ -22,6 +22,7 @@
 #include "FuncEval.h"
 #include "Integrator.h"
 #include "Array.h"
+#include "ProfileData.h"
 
 namespace CanteraZeroD {
 
@@ -138,6 +139,11 @@ namespace CanteraZeroD {
       return (m_connect[m_nr*i + j] == 1);
     }
 
+#ifdef CANTERA_PROFILING
+    /// Profiling data for this reactor network
+    Cantera::ProfileData& profileData() { return m_profile; }
+#endif
+
   protected:
 
     std::vector<ReactorBase*> m_r;
@@ -161,6 +167,11 @@ namespace CanteraZeroD {
 
     std::vector<bool> m_iown;
 
+#ifdef CANTERA_PROFILING
+    /// Timers of the integration and of the right-hand side evaluation
+    Cantera::ProfileData m_profile;
+#endif
+
   private:
 
   };
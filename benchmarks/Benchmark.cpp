@@ -0,0 +1,151 @@
+/**
+ * @file Benchmark.cpp
+ *
+ * Timing harness for the Cantera benchmark suite.
+ */
+
+/*
+ * Copyright 2002 California Institute of Technology
+ */
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#pragma warning(disable:4503)
+#endif
+
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+
+#include "Benchmark.h"
+
+#include "kernel/ct_defs.h"
+#include "kernel/ctexceptions.h"
+#include "kernel/stringUtils.h"
+#include "kernel/clockWC.h"
+
+using namespace std;
+using namespace Cantera;
+
+BenchmarkSuite::~BenchmarkSuite() {
+    for (size_t i = 0; i < m_bench.size(); i++) delete m_bench[i];
+}
+
+bool BenchmarkSuite::selected(const Benchmark& b) const {
+    if (m_select.empty()) return true;
+    for (size_t i = 0; i < m_select.size(); i++) {
+        if (b.name().find(m_select[i]) != string::npos
+            || b.group() == m_select[i]) return true;
+    }
+    return false;
+}
+
+void BenchmarkSuite::list() const {
+    for (size_t i = 0; i < m_bench.size(); i++) {
+        cout << m_bench[i]->group() << "  " << m_bench[i]->name() << endl;
+    }
+}
+
+void BenchmarkSuite::run() {
+    clockWC clock;
+    char buf[200];
+    m_results.clear();
+    for (size_t i = 0; i < m_bench.size(); i++) {
+        Benchmark& b = *m_bench[i];
+        if (!selected(b)) continue;
+        b.setup();
+        BenchmarkResult r;
+        r.name = b.name();
+        r.group = b.group();
+        r.calls = b.calls();
+        r.reps = (m_nrep > 0 ? m_nrep : b.repetitions());
+        r.result = b.run();
+
+        vector<double> t(r.reps);
+        for (int n = 0; n < r.reps; n++) {
+            clock.start();
+            r.result = b.run();
+            t[n] = clock.secondsWC();
+        }
+        sort(t.begin(), t.end());
+        r.tmin = t[0];
+        r.tmedian = (r.reps % 2 ? t[r.reps/2]
+                     : 0.5*(t[r.reps/2 - 1] + t[r.reps/2]));
+        r.tmean = 0.0;
+        for (int n = 0; n < r.reps; n++) r.tmean += t[n]/r.reps;
+        m_results.push_back(r);
+
+        if (m_verbose) {
+            sprintf(buf, "%-32s %6d calls  min %10.4e s  median %10.4e s"
+                    "  (%10.4e s/call)\n", r.name.c_str(), r.calls,
+                    r.tmin, r.tmedian, r.tmin/r.calls);
+            cout << buf;
+        }
+    }
+}
+
+static string timestamp() {
+    char buf[64];
+    time_t now = time(0);
+    strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+    return string(buf);
+}
+
+static string version() {
+#ifdef CANTERA_VERSION
+    return string(CANTERA_VERSION);
+#else
+    return string("unknown");
+#endif
+}
+
+/**
+ * One row per benchmark, preceded by comment lines giving the
+ * Cantera version and the date.
+ */
+string BenchmarkSuite::toCSV() const {
+    string s = "# Cantera " + version() + ", " + timestamp() + "\n";
+    s += "name,group,calls,reps,min,median,mean,min_per_call,result\n";
+    for (size_t i = 0; i < m_results.size(); i++) {
+        const BenchmarkResult& r = m_results[i];
+        s += r.name + "," + r.group + "," + int2str(r.calls) + ","
+            + int2str(r.reps) + "," + fp2str(r.tmin, "%.6e") + ","
+            + fp2str(r.tmedian, "%.6e") + "," + fp2str(r.tmean, "%.6e")
+            + "," + fp2str(r.tmin/r.calls, "%.6e") + ","
+            + fp2str(r.result, "%.10e") + "\n";
+    }
+    return s;
+}
+
+string BenchmarkSuite::toJSON() const {
+    string s = "{\n  \"cantera_version\": \"" + version() + "\",\n"
+        + "  \"date\": \"" + timestamp() + "\",\n"
+        + "  \"benchmarks\": [";
+    for (size_t i = 0; i < m_results.size(); i++) {
+        const BenchmarkResult& r = m_results[i];
+        s += (i > 0 ? ",\n    " : "\n    ");
+        s += "{\"name\": \"" + r.name + "\", \"group\": \"" + r.group
+            + "\", \"calls\": " + int2str(r.calls) + ", \"reps\": "
+            + int2str(r.reps) + ", \"min\": " + fp2str(r.tmin, "%.6e")
+            + ", \"median\": " + fp2str(r.tmedian, "%.6e")
+            + ", \"mean\": " + fp2str(r.tmean, "%.6e")
+            + ", \"min_per_call\": " + fp2str(r.tmin/r.calls, "%.6e")
+            + ", \"result\": " + fp2str(r.result, "%.10e") + "}";
+    }
+    s += "\n  ]\n}\n";
+    return s;
+}
+
+void BenchmarkSuite::save(string fname) const {
+    ofstream f(fname.c_str());
+    if (!f)
+        throw CanteraError("BenchmarkSuite::save",
+            "could not open file "+fname);
+    string::size_type n = fname.size();
+    if (n > 5 && fname.substr(n - 5) == ".json")
+        f << toJSON();
+    else
+        f << toCSV();
+}
@@ -0,0 +1,124 @@
+/**
+ * @file Benchmark.h
+ *
+ * Timing harness for the Cantera benchmark suite.
+ */
+
+/*
+ * Copyright 2002 California Institute of Technology
+ */
+
+#ifndef CT_BENCHMARK_H
+#define CT_BENCHMARK_H
+
+#include <string>
+#include <vector>
+
+/**
+ * A timed operation. Derived classes do any preparation that
+ * should not be timed (reading mechanisms, building initial
+ * guesses) in setup, and the operation itself in run. Each call
+ * of run performs the operation calls() times, and returns a
+ * number computed from the results, which is written with the
+ * timings so that a change in the answer is noticed along with
+ * a change in the speed.
+ */
+class Benchmark {
+public:
+
+    /**
+     * @param name    unique name of the benchmark
+     * @param group   "micro" or "macro"
+     * @param ncalls  number of operations per call of run
+     * @param nrep    default number of timed repetitions
+     */
+    Benchmark(std::string name, std::string group, int ncalls, int nrep) :
+        m_name(name), m_group(group), m_ncalls(ncalls), m_nrep(nrep) {}
+    virtual ~Benchmark() {}
+
+    std::string name() const { return m_name; }
+    std::string group() const { return m_group; }
+    int calls() const { return m_ncalls; }
+    int repetitions() const { return m_nrep; }
+
+    /// Untimed preparation, called once before the first repetition.
+    virtual void setup() {}
+
+    /// Perform the operation calls() times.
+    virtual double run() = 0;
+
+protected:
+    std::string m_name, m_group;
+    int m_ncalls, m_nrep;
+};
+
+/**
+ * Timings of one benchmark. Times are CPU times in seconds for one
+ * repetition, i.e. for calls operations.
+ */
+struct BenchmarkResult {
+    std::string name, group;
+    int calls, reps;
+    double tmin, tmedian, tmean;
+    double result;
+};
+
+/**
+ * Runs a list of benchmarks and writes the timings.
+ */
+class BenchmarkSuite {
+public:
+    BenchmarkSuite() : m_nrep(-1), m_verbose(true) {}
+    virtual ~BenchmarkSuite();
+
+    /// Add a benchmark. The suite deletes it.
+    void add(Benchmark* b) { m_bench.push_back(b); }
+
+    /**
+     * Run only benchmarks whose name or group contains one of the
+     * strings in @c names. All benchmarks are run if the list is
+     * empty.
+     */
+    void select(const std::vector<std::string>& names) { m_select = names; }
+
+    /// Override the number of repetitions of all benchmarks.
+    void setRepetitions(int n) { m_nrep = n; }
+
+    void setVerbose(bool v) { m_verbose = v; }
+
+    /// Print the names and groups of all benchmarks.
+    void list() const;
+
+    /**
+     * Run the selected benchmarks. Each is run once untimed after
+     * setup, to warm up caches, and then timed repetitions() times.
+     */
+    void run();
+
+    /**
+     * Write the results to file fname, in JSON format if the name
+     * has extension '.json', and in CSV format otherwise.
+     */
+    void save(std::string fname) const;
+
+    const std::vector<BenchmarkResult>& results() const { return m_results; }
+
+protected:
+    bool selected(const Benchmark& b) const;
+    std::string toCSV() const;
+    std::string toJSON() const;
+
+    std::vector<Benchmark*> m_bench;
+    std::vector<std::string> m_select;
+    std::vector<BenchmarkResult> m_results;
+    int m_nrep;
+    bool m_verbose;
+};
+
+/// Add the microbenchmarks to the suite.
+void addMicroBenchmarks(BenchmarkSuite& s);
+
+/// Add the macrobenchmarks to the suite.
+void addMacroBenchmarks(BenchmarkSuite& s);
+
+#endif
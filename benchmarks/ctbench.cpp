@@ -0,0 +1,81 @@
+/**
+ * @file ctbench.cpp
+ *
+ * Driver for the Cantera benchmark suite.
+ *
+ * Usage:
+ *
+ *     ctbench [-r nrep] [-o file] [-l] [-q] [name ...]
+ *
+ *  -r nrep  number of timed repetitions of each benchmark (default:
+ *           10 for most microbenchmarks, 3 or 5 for macrobenchmarks)
+ *  -o file  output file; JSON if the name ends in '.json', CSV
+ *           otherwise (default: benchmark_results.csv)
+ *  -l       list the benchmarks and exit
+ *  -q       do not print the timings
+ *  name     run only the benchmarks whose name contains one of
+ *           these strings, or whose group ('micro' or 'macro') is
+ *           one of them
+ */
+
+/*
+ * Copyright 2002 California Institute of Technology
+ */
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#pragma warning(disable:4503)
+#endif
+
+#include <iostream>
+#include <cstdlib>
+
+#include "Benchmark.h"
+
+#include "Cantera.h"
+
+using namespace std;
+using namespace Cantera;
+
+int main(int argc, char** argv) {
+    string outfile = "benchmark_results.csv";
+    vector<string> names;
+    BenchmarkSuite suite;
+    bool listOnly = false;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "-r" && i + 1 < argc)
+            suite.setRepetitions(atoi(argv[++i]));
+        else if (arg == "-o" && i + 1 < argc)
+            outfile = argv[++i];
+        else if (arg == "-l")
+            listOnly = true;
+        else if (arg == "-q")
+            suite.setVerbose(false);
+        else if (arg[0] == '-') {
+            cerr << "usage: ctbench [-r nrep] [-o file] [-l] [-q] "
+                 << "[name ...]" << endl;
+            return 1;
+        }
+        else
+            names.push_back(arg);
+    }
+
+    try {
+        addMicroBenchmarks(suite);
+        addMacroBenchmarks(suite);
+        if (listOnly) {
+            suite.list();
+            return 0;
+        }
+        suite.select(names);
+        suite.run();
+        suite.save(outfile);
+    }
+    catch (CanteraError) {
+        showErrors(cerr);
+        return 1;
+    }
+    return 0;
+}
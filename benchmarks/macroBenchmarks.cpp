@@ -0,0 +1,178 @@
+/**
+ * @file macroBenchmarks.cpp
+ *
+ * Benchmarks of complete simulations: constant-volume ignition with
+ * ReactorNet, and freely-propagating premixed flames with Sim1D.
+ */
+
+/*
+ * Copyright 2002 California Institute of Technology
+ */
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#pragma warning(disable:4503)
+#endif
+
+#include "Benchmark.h"
+
+#include "Cantera.h"
+#include "IdealGasMix.h"
+#include "equilibrium.h"
+#include "transport.h"
+#include "zerodim.h"
+#include "onedim.h"
+
+using namespace std;
+using namespace Cantera;
+using namespace Cantera_CXX;
+using namespace CanteraZeroD;
+
+namespace {
+
+    /**
+     * Constant-volume ignition of a stoichiometric fuel/air mixture,
+     * integrated to time tend in nsteps calls of ReactorNet::advance.
+     * The result is the final temperature.
+     */
+    class Ignition : public Benchmark {
+    public:
+        Ignition(string name, string file, string id, string comp,
+                 double T0, double tend, int nsteps) :
+            Benchmark(name, "macro", 1, 5), m_file(file), m_id(id),
+            m_comp(comp), m_T0(T0), m_tend(tend), m_nsteps(nsteps),
+            m_gas(0) {}
+        virtual ~Ignition() { delete m_gas; }
+
+        virtual void setup() {
+            if (!m_gas) m_gas = new IdealGasMix(m_file, m_id);
+        }
+
+        virtual double run() {
+            m_gas->setState_TPX(m_T0, OneAtm, m_comp);
+            Reactor r;
+            r.setThermoMgr(*m_gas);
+            r.setKineticsMgr(*m_gas);
+            ReactorNet net;
+            net.addReactor(&r);
+            for (int n = 1; n <= m_nsteps; n++)
+                net.advance(m_tend*n/m_nsteps);
+            return r.temperature();
+        }
+
+    protected:
+        string m_file, m_id, m_comp;
+        double m_T0, m_tend;
+        int m_nsteps;
+        IdealGasMix* m_gas;
+    };
+
+    /**
+     * A freely-propagating, adiabatic, premixed flame at 300 K and
+     * one atmosphere, with mixture-averaged transport, on a domain of
+     * length lz with initial inlet velocity u0. The flame is first
+     * solved with a fixed temperature profile on the initial grid,
+     * and then with the energy equation and grid refinement, as in
+     * the flamespeed demo. The result is the flame speed. Solving a
+     * flame with a large mechanism takes long enough that nrep should
+     * be kept small.
+     */
+    class FreeFlameSolve : public Benchmark {
+    public:
+        FreeFlameSolve(string name, string file, string id, string comp,
+                       double lz, double u0, int nrep) :
+            Benchmark(name, "macro", 1, nrep), m_file(file), m_id(id),
+            m_comp(comp), m_lz(lz), m_u0(u0), m_gas(0), m_tr(0) {}
+        virtual ~FreeFlameSolve() {
+            delete m_tr;
+            delete m_gas;
+        }
+
+        virtual void setup() {
+            if (m_gas) return;
+            m_gas = new IdealGasMix(m_file, m_id);
+            m_tr = newTransportMgr("Mix", m_gas);
+        }
+
+        virtual double run() {
+            IdealGasMix& gas = *m_gas;
+            int nsp = gas.nSpecies();
+            double T0 = 300.0;
+            gas.setState_TPX(T0, OneAtm, m_comp);
+            vector_fp yin(nsp), yout(nsp);
+            gas.getMassFractions(DATA_PTR(yin));
+            double rho_in = gas.density();
+            equilibrate(gas, "HP");
+            gas.getMassFractions(DATA_PTR(yout));
+            double rho_out = gas.density();
+            double Tad = gas.temperature();
+
+            FreeFlame flow(&gas);
+            // uniform initial grid, with one more point beyond the end
+            // of the domain to help with the zero-gradient outlet
+            double z[6];
+            for (int j = 0; j < 5; j++) z[j] = 0.25*j*m_lz;
+            z[5] = 1.05*m_lz;
+            flow.setupGrid(6, z);
+            flow.setTransport(*m_tr);
+            flow.setKinetics(gas);
+            flow.setPressure(OneAtm);
+
+            // the composition is given by name, since the inlet does
+            // not know the species until it is joined to the flow
+            Inlet1D inlet;
+            double mdot = m_u0*rho_in;
+            inlet.setMoleFractions(m_comp);
+            inlet.setMdot(mdot);
+            inlet.setTemperature(T0);
+            Outlet1D outlet;
+
+            vector<Domain1D*> domains;
+            domains.push_back(&inlet);
+            domains.push_back(&flow);
+            domains.push_back(&outlet);
+            Sim1D flame(domains);
+
+            vector_fp locs(3), value(3);
+            locs[0] = 0.0;
+            locs[1] = 0.7;
+            locs[2] = 1.0;
+            value[0] = mdot/rho_in;
+            value[1] = value[2] = mdot/rho_out;
+            flame.setInitialGuess("u", locs, value);
+            value[0] = T0;
+            value[1] = value[2] = Tad;
+            flame.setInitialGuess("T", locs, value);
+            for (int k = 0; k < nsp; k++) {
+                value[0] = yin[k];
+                value[1] = value[2] = yout[k];
+                flame.setInitialGuess(gas.speciesName(k), locs, value);
+            }
+
+            flame.setRefineCriteria(1, 10.0, 0.2, 0.02, -0.00005);
+            flow.fixTemperature();
+            flame.setFixedTemperature(900.0);
+            flame.solve(0, false);
+            flow.solveEnergyEqn();
+            flame.solve(0, true);
+            return flame.value(1, flow.componentIndex("u"), 0);
+        }
+
+    protected:
+        string m_file, m_id, m_comp;
+        double m_lz, m_u0;
+        IdealGasMix* m_gas;
+        Transport* m_tr;
+    };
+}
+
+void addMacroBenchmarks(BenchmarkSuite& s) {
+    s.add(new Ignition("ignition_h2o2", "h2o2.xml", "ohmech",
+                       "H2:2, O2:1, AR:3.76", 1000.0, 1.0e-2, 100));
+    s.add(new Ignition("ignition_gri30", "gri30.xml", "gri30_mix",
+                       "CH4:1, O2:2, N2:7.52", 1300.0, 5.0e-2, 100));
+    s.add(new FreeFlameSolve("FreeFlame_h2o2", "h2o2.xml", "ohmech",
+                             "H2:2, O2:1, AR:3.76", 0.02, 2.0, 3));
+    s.add(new FreeFlameSolve("FreeFlame_gri30", "gri30.xml", "gri30_mix",
+                             "CH4:1, O2:2, N2:7.52", 0.02, 0.3, 1));
+}
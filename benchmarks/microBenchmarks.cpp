@@ -0,0 +1,411 @@
+/**
+ * @file microBenchmarks.cpp
+ *
+ * Benchmarks of single property evaluations: kinetic rates, species
+ * thermodynamic properties, transport properties and chemical
+ * equilibrium.
+ *
+ * Each call of an operation is made at the next temperature from a
+ * fixed list, so that no results cached from the previous call can
+ * be reused. The time for setting the temperature is included.
+ */
+
+/*
+ * Copyright 2002 California Institute of Technology
+ */
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#pragma warning(disable:4503)
+#endif
+
+#include <map>
+#include <cmath>
+
+#include "Benchmark.h"
+
+#include "Cantera.h"
+#include "IdealGasMix.h"
+#include "equilibrium.h"
+#include "transport.h"
+#include "kernel/ThermoFactory.h"
+#include "kernel/ReactionData.h"
+#include "kernel/SpeciesThermo.h"
+
+using namespace std;
+using namespace Cantera;
+using namespace Cantera_CXX;
+
+namespace {
+
+    const int n_temps = 16;
+
+    /// The temperatures at which the properties are evaluated.
+    double temperature(int n, double tmin, double tmax) {
+        return tmin + (tmax - tmin)*(n % n_temps)/(n_temps - 1);
+    }
+
+    const char* gri_comp = "CH4:1, O2:2, N2:7.52, H2O:0.5, CO:0.1, "
+                           "CO2:0.1, H:0.01, O:0.01, OH:0.01";
+    const char* h2_comp = "H2:2, O2:1, AR:4, H2O:0.5, H:0.01, O:0.01, "
+                          "OH:0.01, HO2:0.001";
+
+    /**
+     * A simple linear congruential generator, so that the synthetic
+     * mechanism is the same on all platforms.
+     */
+    class Random {
+    public:
+        Random(unsigned long seed) : m_state(seed) {}
+        /// Uniformly distributed in [0, 1).
+        double operator()() {
+            m_state = (1103515245UL*m_state + 12345UL) % 2147483648UL;
+            return double(m_state)/2147483648.0;
+        }
+    private:
+        unsigned long m_state;
+    };
+
+    /**
+     * Build a phase with ncopies copies of each species of the
+     * GRI-Mech 3.0 gas phase. Copy c of species X is named X_c.
+     * The phase and species definitions are added to doc, and the
+     * phase node is returned.
+     */
+    XML_Node& syntheticPhase(XML_Node& doc, int ncopies) {
+        XML_Node* src = get_XML_File("gri30.xml");
+        XML_Node* ph = src->findID("gri30_mix");
+        XML_Node* sp = src->findID("species_data");
+        if (!ph || !sp)
+            throw CanteraError("syntheticPhase",
+                "gri30_mix or species_data not found in gri30.xml");
+
+        XML_Node& phase = doc.addChild("phase");
+        ph->copy(&phase);
+        XML_Node& data = doc.addChild("speciesData");
+        sp->copy(&data);
+
+        vector<XML_Node*> species;
+        sp->getChildren("species", species);
+        string names = phase.child("speciesArray").value();
+        for (int c = 1; c < ncopies; c++) {
+            for (size_t k = 0; k < species.size(); k++) {
+                XML_Node& s = data.addChild("species");
+                species[k]->copy(&s);
+                string nm = (*species[k])["name"] + "_" + int2str(c);
+                s.addAttribute("name", nm);
+                names += " " + nm;
+            }
+        }
+        phase.child("speciesArray").addValue(names);
+        return phase;
+    }
+
+    /// Species indices and stoichiometric coefficients of a reactant
+    /// set of addSyntheticReactions.
+    void addReagents(const pair<int, int>& r, vector_int& k,
+                     vector_fp& stoich) {
+        if (r.first == r.second) {
+            k.push_back(r.first);
+            stoich.push_back(2.0);
+        }
+        else {
+            k.push_back(r.first);
+            stoich.push_back(1.0);
+            if (r.second >= 0) {
+                k.push_back(r.second);
+                stoich.push_back(1.0);
+            }
+        }
+    }
+
+    string reagentString(ThermoPhase& th, const pair<int, int>& r) {
+        string s = th.speciesName(r.first);
+        if (r.second >= 0) s += " + " + th.speciesName(r.second);
+        return s;
+    }
+
+    /**
+     * Add nrxns reversible reactions with one or two reactants and
+     * one or two products (A + B <=> C + D, A + B <=> C, A <=> B) to
+     * kinetics manager kin, for the species of phase th. The
+     * reactions are chosen among all element-conserving pairs of
+     * reactant sets, spread evenly over the list of candidates, with
+     * random Arrhenius parameters. No reaction is added twice.
+     */
+    void addSyntheticReactions(ThermoPhase& th, GasKinetics& kin,
+                               int nrxns) {
+        int nsp = th.nSpecies();
+        int nel = th.nElements();
+
+        // group single species (b = -1) and pairs of species by their
+        // elemental composition
+        typedef map<vector_int, vector<pair<int, int> > > group_map;
+        group_map groups;
+        vector_int comp(nel);
+        for (int a = 0; a < nsp; a++) {
+            for (int b = -1; b < nsp; b++) {
+                if (b >= 0 && b < a) continue;
+                for (int m = 0; m < nel; m++)
+                    comp[m] = int(th.nAtoms(a, m)
+                                  + (b >= 0 ? th.nAtoms(b, m) : 0.0));
+                groups[comp].push_back(pair<int, int>(a, b));
+            }
+        }
+
+        // every pair of reactant sets within a group is a candidate
+        double ncand = 0.0;
+        group_map::const_iterator g;
+        for (g = groups.begin(); g != groups.end(); ++g) {
+            double n = double(g->second.size());
+            ncand += 0.5*n*(n - 1.0);
+        }
+        if (ncand < nrxns)
+            throw CanteraError("addSyntheticReactions",
+                "only " + fp2str(ncand, "%.0f") + " candidate reactions");
+
+        Random rnd(12345);
+        double stride = ncand/nrxns;
+        double icand = 0.0;
+        int i = 0;
+        for (g = groups.begin(); g != groups.end() && i < nrxns; ++g) {
+            const vector<pair<int, int> >& p = g->second;
+            for (size_t m = 0; m < p.size() && i < nrxns; m++) {
+                for (size_t n = m + 1; n < p.size() && i < nrxns; n++) {
+                    if (icand++ < i*stride) continue;
+                    ReactionData rdata;
+                    rdata.reactionType = ELEMENTARY_RXN;
+                    rdata.reversible = true;
+                    rdata.number = i;
+                    rdata.rxn_number = i;
+                    addReagents(p[m], rdata.reactants, rdata.rstoich);
+                    addReagents(p[n], rdata.products, rdata.pstoich);
+                    rdata.rorder = rdata.rstoich;
+                    rdata.porder = rdata.pstoich;
+                    rdata.equation = reagentString(th, p[m]) + " <=> "
+                        + reagentString(th, p[n]);
+                    rdata.rateCoeffType = ARRHENIUS_REACTION_RATECOEFF_TYPE;
+                    rdata.rateCoeffParameters.resize(3);
+                    rdata.rateCoeffParameters[0] =
+                        pow(10.0, 9.0 + 4.0*rnd());
+                    rdata.rateCoeffParameters[1] = 2.0*rnd() - 1.0;
+                    rdata.rateCoeffParameters[2] = 25000.0*rnd();
+                    kin.addReaction(rdata);
+                    i++;
+                }
+            }
+        }
+    }
+
+    /// GasKinetics::getNetProductionRates for a mechanism.
+    class NetProductionRates : public Benchmark {
+    public:
+        NetProductionRates(string name, string file, string id,
+                           string comp, int ncalls) :
+            Benchmark(name, "micro", ncalls, 10),
+            m_file(file), m_id(id), m_comp(comp), m_gas(0) {}
+        virtual ~NetProductionRates() { delete m_gas; }
+
+        virtual void setup() {
+            if (m_gas) return;
+            m_gas = new IdealGasMix(m_file, m_id);
+            m_gas->setState_TPX(1000.0, OneAtm, m_comp);
+            m_wdot.resize(m_gas->nSpecies());
+        }
+
+        virtual double run() {
+            double sum = 0.0;
+            int nsp = m_gas->nSpecies();
+            for (int n = 0; n < m_ncalls; n++) {
+                m_gas->setTemperature(temperature(n, 800.0, 2500.0));
+                m_gas->getNetProductionRates(DATA_PTR(m_wdot));
+                for (int k = 0; k < nsp; k++) sum += fabs(m_wdot[k]);
+            }
+            return sum;
+        }
+
+    protected:
+        string m_file, m_id, m_comp;
+        IdealGasMix* m_gas;
+        vector_fp m_wdot;
+    };
+
+    /**
+     * GasKinetics::getNetProductionRates for a synthetic mechanism
+     * with ncopies copies of the GRI-Mech 3.0 species (see
+     * syntheticPhase) and nrxns reactions (see addSyntheticReactions).
+     */
+    class SyntheticRates : public Benchmark {
+    public:
+        SyntheticRates(int ncopies, int nrxns, int ncalls) :
+            Benchmark("netProductionRates_synthetic", "micro", ncalls, 10),
+            m_ncopies(ncopies), m_nrxns(nrxns), m_init(false),
+            m_doc("ctml") {}
+
+        virtual void setup() {
+            if (m_init) return;
+            importPhase(syntheticPhase(m_doc, m_ncopies), &m_gas);
+            m_kin.addPhase(m_gas);
+            m_kin.init();
+            addSyntheticReactions(m_gas, m_kin, m_nrxns);
+            m_kin.finalize();
+            m_gas.setState_TPX(1000.0, OneAtm, gri_comp);
+            m_wdot.resize(m_gas.nSpecies());
+            m_init = true;
+        }
+
+        virtual double run() {
+            double sum = 0.0;
+            int nsp = m_gas.nSpecies();
+            for (int n = 0; n < m_ncalls; n++) {
+                m_gas.setTemperature(temperature(n, 800.0, 2500.0));
+                m_kin.getNetProductionRates(DATA_PTR(m_wdot));
+                for (int k = 0; k < nsp; k++) sum += fabs(m_wdot[k]);
+            }
+            return sum;
+        }
+
+    protected:
+        int m_ncopies, m_nrxns;
+        bool m_init;
+        XML_Node m_doc;
+        IdealGasPhase m_gas;
+        GasKinetics m_kin;
+        vector_fp m_wdot;
+    };
+
+    /// SpeciesThermo::update (NasaThermo for GRI-Mech 3.0).
+    class SpeciesThermoUpdate : public Benchmark {
+    public:
+        SpeciesThermoUpdate(int ncalls) :
+            Benchmark("NasaThermo_update_gri30", "micro", ncalls, 10),
+            m_gas(0) {}
+        virtual ~SpeciesThermoUpdate() { delete m_gas; }
+
+        virtual void setup() {
+            if (m_gas) return;
+            m_gas = new IdealGasMix("gri30.xml", "gri30_mix");
+            int nsp = m_gas->nSpecies();
+            m_cp.resize(nsp);
+            m_h.resize(nsp);
+            m_s.resize(nsp);
+        }
+
+        virtual double run() {
+            double sum = 0.0;
+            SpeciesThermo& sp = m_gas->speciesThermo();
+            for (int n = 0; n < m_ncalls; n++) {
+                sp.update(temperature(n, 300.0, 3000.0), DATA_PTR(m_cp),
+                          DATA_PTR(m_h), DATA_PTR(m_s));
+                sum += m_cp[0] + m_h[0] + m_s[0];
+            }
+            return sum;
+        }
+
+    protected:
+        IdealGasMix* m_gas;
+        vector_fp m_cp, m_h, m_s;
+    };
+
+    /**
+     * Mixture-averaged (model "Mix") or multicomponent (model
+     * "Multi") transport properties for GRI-Mech 3.0.
+     */
+    class TransportProperties : public Benchmark {
+    public:
+        TransportProperties(string model, int ncalls) :
+            Benchmark(model + "Transport_gri30", "micro", ncalls, 10),
+            m_model(model), m_gas(0), m_tr(0) {}
+        virtual ~TransportProperties() {
+            delete m_tr;
+            delete m_gas;
+        }
+
+        virtual void setup() {
+            if (m_gas) return;
+            m_gas = new IdealGasMix("gri30.xml", "gri30_mix");
+            m_gas->setState_TPX(1000.0, OneAtm, gri_comp);
+            m_tr = newTransportMgr(m_model, m_gas);
+            int nsp = m_gas->nSpecies();
+            m_d.resize(m_model == "Multi" ? nsp*nsp : nsp);
+            m_dt.resize(nsp);
+        }
+
+        virtual double run() {
+            double sum = 0.0;
+            int nsp = m_gas->nSpecies();
+            for (int n = 0; n < m_ncalls; n++) {
+                m_gas->setTemperature(temperature(n, 300.0, 2500.0));
+                sum += m_tr->viscosity() + m_tr->thermalConductivity();
+                if (m_model == "Multi") {
+                    m_tr->getMultiDiffCoeffs(nsp, DATA_PTR(m_d));
+                    m_tr->getThermalDiffCoeffs(DATA_PTR(m_dt));
+                    sum += m_dt[0];
+                }
+                else
+                    m_tr->getMixDiffCoeffs(DATA_PTR(m_d));
+                sum += m_d[0];
+            }
+            return sum;
+        }
+
+    protected:
+        string m_model;
+        IdealGasMix* m_gas;
+        Transport* m_tr;
+        vector_fp m_d, m_dt;
+    };
+
+    /**
+     * Chemical equilibrium at fixed T and P of a methane/air mixture
+     * with GRI-Mech 3.0, with the ChemEquil solver (solver = 0) or
+     * the VCS solver (solver = 1).
+     */
+    class Equilibrium : public Benchmark {
+    public:
+        Equilibrium(string name, int solver, int ncalls) :
+            Benchmark(name, "micro", ncalls, 5),
+            m_solver(solver), m_gas(0) {}
+        virtual ~Equilibrium() { delete m_gas; }
+
+        virtual void setup() {
+            if (m_gas) return;
+            m_gas = new IdealGasMix("gri30.xml", "gri30_mix");
+        }
+
+        virtual double run() {
+            double sum = 0.0;
+            for (int n = 0; n < m_ncalls; n++) {
+                m_gas->setState_TPX(temperature(n, 1000.0, 3000.0),
+                                    OneAtm, "CH4:1, O2:2, N2:7.52");
+#ifdef WITH_VCSNONIDEAL
+                if (m_solver == 1)
+                    vcs_equilibrate(*m_gas, "TP", 0, 0, 1);
+                else
+#endif
+                    equilibrate(*m_gas, "TP", m_solver);
+                sum += m_gas->moleFraction("CO");
+            }
+            return sum;
+        }
+
+    protected:
+        int m_solver;
+        IdealGasMix* m_gas;
+    };
+}
+
+void addMicroBenchmarks(BenchmarkSuite& s) {
+    s.add(new NetProductionRates("netProductionRates_h2o2", "h2o2.xml",
+                                 "ohmech", h2_comp, 20000));
+    s.add(new NetProductionRates("netProductionRates_gri30", "gri30.xml",
+                                 "gri30_mix", gri_comp, 2000));
+    s.add(new SyntheticRates(5, 2500, 200));
+    s.add(new SpeciesThermoUpdate(20000));
+    s.add(new TransportProperties("Mix", 1000));
+    s.add(new TransportProperties("Multi", 100));
+    s.add(new Equilibrium("equilibrate_gri30", 0, 20));
+#ifdef WITH_VCSNONIDEAL
+    s.add(new Equilibrium("vcs_equilibrate_gri30", 1, 20));
+#endif
+}
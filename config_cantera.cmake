@@ -8,6 +8,8 @@ OPTION(CANTERA_BUILD_WITH_F2C "Use f2c versions of 3rd party numerical routines"
 
 OPTION (BUILD_LAPACK "Build the lapack library?" 1)
 OPTION (HAVE_SUNDIALS "Use Sundials from LLNL?" 0)
+OPTION (THREAD_SAFE_CANTERA "Build a thread-safe Cantera kernel?" ON)
+OPTION (CANTERA_PROFILING "Compile in profiling counters and timers?" OFF)
 
 # SET(PYTHON_CMD ${PYTHON_EXE})
 
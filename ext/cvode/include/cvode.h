@@ -216,6 +216,11 @@ void *CVodeMalloc(integer N, RhsFn f, real t0, N_Vector y0, int lmm, int iter,
  * But it does no memory allocation, assuming that the existing   *
  * internal memory is sufficient for the new problem.             *
  *                                                                *
+ * The linear solver attached after the CVodeMalloc call (by      *
+ * CVDense, CVBand, CVDiag or CVSpgmr) stays attached, and its    *
+ * memory is reused, so it need not be specified again. If it is, *
+ * the memory of the previous linear solver is freed.             *
+ *                                                                *
  * The use of CVReInit requires that the maximum method order,    *
  * maxord, is no larger for the new problem than for the problem  *
  * specified in the last call to CVodeMalloc.  This condition is  *
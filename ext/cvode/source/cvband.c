@@ -227,6 +227,13 @@ void CVBand(void *cvode_mem, integer mupper, integer mlower, CVBandJacFn bjac,
   cv_mem = (CVodeMem) cvode_mem;
   if (cv_mem == NULL) return;  /* CVode reports this error */
 
+  /* Free the memory of a linear solver attached before, so that
+     a solver can be attached again without leaking it */
+  if (cv_mem->cv_linitOK) lfree(cv_mem);
+  else free(lmem);
+  lmem = NULL;
+  cv_mem->cv_linitOK = FALSE;
+
   /* Set four main function fields in cv_mem */  
   linit  = CVBandInit;
   lsetup = CVBandSetup;
@@ -195,6 +195,13 @@ void CVDense(void *cvode_mem, CVDenseJacFn djac, void *jac_data)
   cv_mem = (CVodeMem) cvode_mem;
   if (cv_mem == NULL) return;  /* CVode reports this error */
 
+  /* Free the memory of a linear solver attached before, so that
+     a solver can be attached again without leaking it */
+  if (cv_mem->cv_linitOK) lfree(cv_mem);
+  else free(lmem);
+  lmem = NULL;
+  cv_mem->cv_linitOK = FALSE;
+
   /* Set four main function fields in cv_mem */
   linit  = CVDenseInit;
   lsetup = CVDenseSetup;
@@ -850,15 +850,10 @@ int CVReInit(void *cvode_mem, RhsFn f, real t0, N_Vector y0,
 
   uround = UnitRoundoff();
 
-  /* Set the linear solver addresses to NULL, linitOK to FALSE */
-
-  linit = NULL;
-  lsetup = NULL;
-  lsolve = NULL;
-  lfree = NULL;
-  lmem = NULL;
-  /* We check != NULL later, in CVode and linit, if using NEWTON */
-  linitOK = FALSE;
+  /* Keep the linear solver attached by the previous CVodeMalloc,
+     together with its memory. It is not initialized again by
+     CVode if linitOK is TRUE, and the Jacobian is reevaluated on
+     the first step since nst is reset below. */
 
   /* Initialize zn[0] in the history array */
   
@@ -1009,10 +1004,12 @@ int CVode(void *cvode_mem, real tout, N_Vector yout, real *t, int itask)
 	fprintf(errfp, MSG_LFREE_NULL);
 	return(ILL_INPUT);
       }
-      linitOK = (linit(cv_mem, &(setupNonNull)) == LINIT_OK);
       if (!linitOK) {
-	fprintf(errfp, MSG_LINIT_FAIL);
-	return(ILL_INPUT);
+	linitOK = (linit(cv_mem, &(setupNonNull)) == LINIT_OK);
+	if (!linitOK) {
+	  fprintf(errfp, MSG_LINIT_FAIL);
+	  return(ILL_INPUT);
+	}
       }
     }
 
@@ -182,6 +182,13 @@ void CVSpgmr(void *cvode_mem, int pretype, int gstype, int maxl, real delt,
   cv_mem = (CVodeMem) cvode_mem;
   if (cv_mem == NULL) return;  /* CVode reports this error */
 
+  /* Free the memory of a linear solver attached before, so that
+     a solver can be attached again without leaking it */
+  if (cv_mem->cv_linitOK) lfree(cv_mem);
+  else free(lmem);
+  lmem = NULL;
+  cv_mem->cv_linitOK = FALSE;
+
   /* Set four main function fields in cv_mem */
   linit  = CVSpgmrInit;
   lsetup = CVSpgmrSetup;
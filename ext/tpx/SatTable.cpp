@@ -0,0 +1,222 @@
+/*
+ * Tabulated saturation curve for a Substance.
+ */
+#include "Sub.h"
+#include <math.h>
+#include <fstream>
+
+namespace tpx {
+
+    SatTable::SatTable() :
+        m_n(0),
+        m_ok(false),
+        m_tc(0.0),
+        m_tlo(0.0),
+        m_wmin(0.0),
+        m_dw(0.0)
+    {
+        m_err[0] = m_err[1] = m_err[2] = 0.0;
+    }
+
+    void SatTable::init(int n, double tc, double tlo, double wmin) {
+        if (n < 4 || tlo >= tc || wmin <= 0.0 || wmin >= 1.0) {
+            throw TPX_Error("SatTable::init","illegal table parameters");
+        }
+        m_n = n;
+        m_tc = tc;
+        m_tlo = tlo;
+        m_wmin = wmin;
+        m_dw = (1.0 - wmin)/(n - 1);
+        m_lnp.resize(n);
+        m_lnrhf.resize(n);
+        m_lnrhv.resize(n);
+        m_lnp2.resize(n);
+        m_lnrhf2.resize(n);
+        m_lnrhv2.resize(n);
+        m_err[0] = m_err[1] = m_err[2] = 0.0;
+        m_ok = false;
+    }
+
+    double SatTable::Tnode(int j) const {
+        double ww = m_wmin + j*m_dw;
+        return m_tc - ww*ww*(m_tc - m_tlo);
+    }
+
+    double SatTable::Thigh() const {
+        return m_tc - m_wmin*m_wmin*(m_tc - m_tlo);
+    }
+
+    void SatTable::setNode(int j, double psat, double rhf, double rhv) {
+        m_lnp[j] = log(psat);
+        m_lnrhf[j] = log(rhf);
+        m_lnrhv[j] = log(rhv);
+    }
+
+    void SatTable::fit() {
+        fitOne(m_lnp, m_lnp2);
+        fitOne(m_lnrhf, m_lnrhf2);
+        fitOne(m_lnrhv, m_lnrhv2);
+        m_ok = true;
+    }
+
+    void SatTable::setErrors(double errp, double errf, double errv) {
+        m_err[0] = errp;
+        m_err[1] = errf;
+        m_err[2] = errv;
+    }
+
+    double SatTable::maxError() const {
+        double e = m_err[0];
+        if (m_err[1] > e) e = m_err[1];
+        if (m_err[2] > e) e = m_err[2];
+        return e;
+    }
+
+    bool SatTable::eval(double t, double& psat, double& rhf,
+        double& rhv) const {
+        if (!m_ok || t < m_tlo || t > Thigh()) return false;
+        double ww = w(t);
+        int j = interval(ww);
+        psat = exp(spline(m_lnp, m_lnp2, j, ww));
+        rhf = exp(spline(m_lnrhf, m_lnrhf2, j, ww));
+        rhv = exp(spline(m_lnrhv, m_lnrhv2, j, ww));
+        return true;
+    }
+
+    double SatTable::dPsdT(double t) const {
+        if (!m_ok || t < m_tlo || t > Thigh()) return Undef;
+        double ww = w(t);
+        int j = interval(ww);
+        double p = exp(spline(m_lnp, m_lnp2, j, ww));
+        double dwdt = -0.5/(ww*(m_tc - m_tlo));
+        return p*splineDeriv(m_lnp, m_lnp2, j, ww)*dwdt;
+    }
+
+    /// Saturation temperature from the ln(P) spline. ln(P) decreases
+    /// monotonically from node 0 (near Tc) to node n-1 (Tlo), so the
+    /// interval is found by bisection on the nodes and the root within
+    /// it by a safeguarded Newton iteration.
+    double SatTable::Tsat(double p) const {
+        if (!m_ok || p <= 0.0) return Undef;
+        double lnp = log(p);
+        if (lnp > m_lnp[0] || lnp < m_lnp[m_n-1]) return Undef;
+        int lo = 0, hi = m_n - 1;
+        while (hi - lo > 1) {
+            int mid = (lo + hi)/2;
+            if (m_lnp[mid] >= lnp) lo = mid;
+            else hi = mid;
+        }
+        double wa = m_wmin + lo*m_dw;
+        double wb = wa + m_dw;
+        double ww = wa + m_dw*(m_lnp[lo] - lnp)/(m_lnp[lo] - m_lnp[hi]);
+        for (int it = 0; it < 50; it++) {
+            double f = spline(m_lnp, m_lnp2, lo, ww) - lnp;
+            if (f > 0.0) wa = ww;
+            else wb = ww;
+            double dfdw = splineDeriv(m_lnp, m_lnp2, lo, ww);
+            double wnew = (dfdw < 0.0 ? ww - f/dfdw : 0.5*(wa + wb));
+            if (wnew <= wa || wnew >= wb) wnew = 0.5*(wa + wb);
+            if (fabs(wnew - ww) < 1.e-14) {
+                ww = wnew;
+                break;
+            }
+            ww = wnew;
+        }
+        return m_tc - ww*ww*(m_tc - m_tlo);
+    }
+
+    bool SatTable::read(string file, string name) {
+        ifstream f(file.c_str());
+        if (!f) return false;
+        string tag, nm;
+        int n;
+        double tc, tlo, wmin;
+        f >> tag >> nm >> n >> tc >> tlo >> wmin;
+        if (!f || tag != "tpx_saturation_table" || nm != name
+            || n != m_n || fabs(tc - m_tc) > 1.e-12*m_tc
+            || tlo < m_tlo*(1.0 - 1.e-12) || tlo >= m_tc
+            || fabs(wmin - m_wmin) > 1.e-12) return false;
+        init(n, tc, tlo, wmin);
+        double psat, rhf, rhv;
+        f >> m_err[0] >> m_err[1] >> m_err[2];
+        for (int j = 0; j < m_n; j++) {
+            f >> psat >> rhf >> rhv;
+            if (!f) return false;
+            setNode(j, psat, rhf, rhv);
+        }
+        fit();
+        return true;
+    }
+
+    void SatTable::write(string file, string name) const {
+        ofstream f(file.c_str());
+        if (!f) {
+            throw TPX_Error("SatTable::write","could not open "+file);
+        }
+        f.precision(17);
+        f << "tpx_saturation_table " << name << " " << m_n << " "
+          << m_tc << " " << m_tlo << " " << m_wmin << endl;
+        f << m_err[0] << " " << m_err[1] << " " << m_err[2] << endl;
+        for (int j = 0; j < m_n; j++) {
+            f << exp(m_lnp[j]) << " " << exp(m_lnrhf[j]) << " "
+              << exp(m_lnrhv[j]) << endl;
+        }
+    }
+
+    //------------------ Private Functions -------------------
+
+    double SatTable::w(double t) const {
+        return sqrt((m_tc - t)/(m_tc - m_tlo));
+    }
+
+    int SatTable::interval(double ww) const {
+        int j = int((ww - m_wmin)/m_dw);
+        if (j < 0) j = 0;
+        if (j > m_n - 2) j = m_n - 2;
+        return j;
+    }
+
+    double SatTable::spline(const vector<double>& y,
+        const vector<double>& y2, int j, double ww) const {
+        double b = (ww - m_wmin - j*m_dw)/m_dw;
+        double a = 1.0 - b;
+        return a*y[j] + b*y[j+1]
+            + ((a*a*a - a)*y2[j] + (b*b*b - b)*y2[j+1])*m_dw*m_dw/6.0;
+    }
+
+    double SatTable::splineDeriv(const vector<double>& y,
+        const vector<double>& y2, int j, double ww) const {
+        double b = (ww - m_wmin - j*m_dw)/m_dw;
+        double a = 1.0 - b;
+        return (y[j+1] - y[j])/m_dw
+            + ((1.0 - 3.0*a*a)*y2[j] + (3.0*b*b - 1.0)*y2[j+1])*m_dw/6.0;
+    }
+
+    /// Second derivatives of a cubic spline on the uniform grid, with
+    /// not-a-knot end conditions (y2 linear over the first two and the
+    /// last two intervals).
+    void SatTable::fitOne(const vector<double>& y, vector<double>& y2) {
+        int n = m_n, i;
+        vector<double> c(n, 0.0), d(n, 0.0);
+        double h2 = m_dw*m_dw;
+        for (i = 1; i < n-1; i++) {
+            d[i] = 6.0*(y[i+1] - 2.0*y[i] + y[i-1])/h2;
+        }
+        // forward elimination of the tridiagonal system; the first and
+        // last rows have diagonal 6 and no off-diagonal coupling
+        c[1] = 0.0;
+        d[1] /= 6.0;
+        for (i = 2; i < n-1; i++) {
+            double lower = (i == n-2 ? 0.0 : 1.0);
+            double diag = (i == n-2 ? 6.0 : 4.0) - lower*c[i-1];
+            c[i] = 1.0/diag;
+            d[i] = (d[i] - lower*d[i-1])/diag;
+        }
+        y2[n-2] = d[n-2];
+        for (i = n-3; i >= 1; i--) {
+            y2[i] = d[i] - c[i]*y2[i+1];
+        }
+        y2[0] = 2.0*y2[1] - y2[2];
+        y2[n-1] = 2.0*y2[n-2] - y2[n-3];
+    }
+}
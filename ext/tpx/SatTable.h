@@ -0,0 +1,88 @@
+/*
+ * Tabulated saturation curve for a Substance.
+ *
+ * The saturation pressure and the saturated liquid and vapor densities
+ * are stored at nodes uniformly spaced in w = sqrt((Tc - T)/(Tc - Tlo)),
+ * which clusters the nodes near the critical point where the densities
+ * vary rapidly. The logarithms of all three are interpolated with cubic
+ * splines, so that dPsat/dT follows from the same spline as Psat and is
+ * consistent with it.
+ */
+
+#ifndef TPX_SATTABLE_H
+#define TPX_SATTABLE_H
+
+#include <string>
+#include <vector>
+using namespace std;
+
+namespace tpx {
+
+    class SatTable {
+    public:
+        SatTable();
+
+        /// Allocate n nodes between Tlo and Tc - wmin^2 (Tc - Tlo).
+        void init(int n, double tc, double tlo, double wmin);
+
+        int nPoints() const { return m_n; }
+        bool ready() const { return m_ok; }
+
+        /// temperature of node j
+        double Tnode(int j) const;
+
+        /// store the exact saturation properties at node j
+        void setNode(int j, double psat, double rhf, double rhv);
+
+        /// compute the spline coefficients once all nodes are set
+        void fit();
+
+        /// lowest and highest tabulated temperature
+        double Tlow() const { return m_tlo; }
+        double Thigh() const;
+
+        /**
+         * Interpolate the saturation properties at temperature t.
+         * Returns false if t is outside the tabulated range, in
+         * which case the outputs are not set.
+         */
+        bool eval(double t, double& psat, double& rhf, double& rhv) const;
+
+        /// d(Psat)/dT at temperature t; Undef outside the table.
+        double dPsdT(double t) const;
+
+        /// Saturation temperature at pressure p; Undef outside the table.
+        double Tsat(double p) const;
+
+        /// Maximum relative errors in Psat, the liquid density and the
+        /// vapor density, measured at the midpoints between nodes.
+        void setErrors(double errp, double errf, double errv);
+        double error(int i) const { return m_err[i]; }
+        double maxError() const;
+
+        /// Read a table written by write(). Returns false if the file
+        /// does not exist or was generated for a different grid. The
+        /// table in the file may start above the current Tlo.
+        bool read(string file, string name);
+        void write(string file, string name) const;
+
+    private:
+        double w(double t) const;
+        int interval(double ww) const;
+        double spline(const vector<double>& y, const vector<double>& y2,
+            int j, double ww) const;
+        double splineDeriv(const vector<double>& y, const vector<double>& y2,
+            int j, double ww) const;
+        void fitOne(const vector<double>& y, vector<double>& y2);
+
+        int m_n;
+        bool m_ok;
+        double m_tc, m_tlo, m_wmin, m_dw;
+        vector<double> m_lnp, m_lnp2;
+        vector<double> m_lnrhf, m_lnrhf2;
+        vector<double> m_lnrhv, m_lnrhv2;
+        double m_err[3];
+    };
+}
+
+#endif
@@ -53,6 +53,10 @@ namespace tpx {
     /// with respect to temperature.
     double Substance::dPsdT() {
 	double ps1, tsave, dpdt;
+        if (m_tabulated) {
+            dpdt = m_sat.dPsdT(T);
+            if (dpdt != Undef) return dpdt;
+        }
 	tsave = T;
 	ps1 = Ps();
 	set_T(T + DeltaT);
@@ -99,6 +103,10 @@ namespace tpx {
             set_Err(PresError);
             return Undef;
 	}
+        if (m_tabulated) {
+            tsat = m_sat.Tsat(p);
+            if (tsat != Undef) return tsat;
+        }
 	int LoopCount = 0;
 	double tol = 1.e-6*p;
 	Tsave = T;
@@ -306,6 +314,10 @@ namespace tpx {
 
     void Substance::update_sat() {
 	if ((T != Tslast) && (T < Tcrit())) {
+            if (m_tabulated && m_sat.eval(T, Pst, Rhf, Rhv)) {
+                Tslast = T;
+                return;
+            }
             double Rho_save = Rho;
             double gf, gv, dg, dp, dlp, psold;
             
@@ -370,6 +382,77 @@ namespace tpx {
 	}
     }
 
+    /// Switch between the exact saturation properties and a table of
+    /// them. The table covers temperatures from max(Tmin, 0.3 Tcrit), or
+    /// the lowest temperature at which the exact iteration converges, to
+    /// just below Tcrit, with nodes clustered toward the critical point;
+    /// outside this range the exact iteration is still used. If a cache
+    /// file is given and holds a table for the same grid, it is read
+    /// instead of being regenerated; otherwise the new table is written
+    /// to it. The maximum relative error of the interpolated values,
+    /// measured against the exact values between the nodes, is available
+    /// from tableError().
+    void Substance::setTabulated(bool tab, int npts, string cacheFile) {
+        Tslast = Undef;
+        m_tabulated = false;
+        if (!tab) return;
+
+        double tc = Tcrit();
+        double tlo = (Tmin() > 0.3*tc ? Tmin() : 0.3*tc);
+        m_sat.init(npts, tc, tlo, 0.1);
+        if (cacheFile != "" && m_sat.read(cacheFile, name())) {
+            m_tabulated = true;
+            return;
+        }
+
+        double Tsave = T, Rhosave = Rho;
+        double p, rf, rv, errp = 0.0, errf = 0.0, errv = 0.0;
+        int j = 0;
+        try {
+            while (j < npts) {
+                for (j = 0; j < npts; j++) {
+                    T = m_sat.Tnode(j);
+                    Tslast = Undef;
+                    try {
+                        update_sat();
+                    }
+                    catch (TPX_Error) {
+                        // the exact iteration may fail near Tmin (heptane
+                        // does); start the table at the last good node
+                        if (j < npts/2) throw;
+                        m_sat.init(npts, tc, m_sat.Tnode(j-1), 0.1);
+                        break;
+                    }
+                    m_sat.setNode(j, Pst, Rhf, Rhv);
+                }
+            }
+            m_sat.fit();
+            for (j = 0; j < npts-1; j++) {
+                T = 0.5*(m_sat.Tnode(j) + m_sat.Tnode(j+1));
+                Tslast = Undef;
+                update_sat();
+                m_sat.eval(T, p, rf, rv);
+                if (fabs(p - Pst) > errp*Pst) errp = fabs(p - Pst)/Pst;
+                if (fabs(rf - Rhf) > errf*Rhf) errf = fabs(rf - Rhf)/Rhf;
+                if (fabs(rv - Rhv) > errv*Rhv) errv = fabs(rv - Rhv)/Rhv;
+            }
+        }
+        catch (TPX_Error) {
+            T = Tsave;
+            Rho = Rhosave;
+            Tslast = Undef;
+            throw TPX_Error("Substance::setTabulated",
+                "could not tabulate the saturation curve at T = "
+                +fp2str(m_sat.Tnode(j)));
+        }
+        m_sat.setErrors(errp, errf, errv);
+        T = Tsave;
+        Rho = Rhosave;
+        Tslast = Undef;
+        m_tabulated = true;
+        if (cacheFile != "") m_sat.write(cacheFile, name());
+    }
+
     double Substance::vprop(int ijob) {
 	switch (ijob) {
 	case EvalH: return hp();
@@ -21,6 +21,7 @@
 
 #include <iostream>
 #include <string>
+#include "SatTable.h"
 using namespace std;
 
 namespace tpx {
@@ -84,6 +85,7 @@ namespace tpx {
             Err = 0;
             m_energy_offset = 0.0;
             m_entropy_offset = 0.0;
+            m_tabulated = false;
         }
 	virtual ~Substance(){}
 
@@ -191,6 +193,19 @@ namespace tpx {
             return Err;
         } 
 
+        // tabulated saturation properties
+
+        void setTabulated(bool tab, int npts = 200, string cacheFile = "");
+        bool tabulated() {return m_tabulated;}
+        double tableError()                // max. rel. error of the table
+            {return (m_tabulated ? m_sat.maxError() : 0.0);}
+        const SatTable& satTable() {return m_sat;}
+        void setSatTable(const SatTable& tab) {
+            m_sat = tab;
+            m_tabulated = m_sat.ready();
+            Tslast = Undef;
+        }
+
 
     protected:   
 
@@ -202,6 +217,8 @@ namespace tpx {
         double m_entropy_offset;
         string m_name;
         string m_formula;
+        bool m_tabulated;
+        SatTable m_sat;
 
         //	virtual double Xm(int k) { return 1.0;}
         //virtual int Species() { return 1;}
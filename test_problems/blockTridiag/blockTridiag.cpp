@@ -0,0 +1,222 @@
+/*
+ * Test of the block-tridiagonal matrix factorization. A matrix with
+ * blocks of different sizes, some of them empty, and with singular
+ * diagonal blocks is solved with class BlockTridiagMatrix and with
+ * class BandMatrix, and the solutions are compared. Then premixed
+ * hydrogen flames in stagnation flow from an inlet (Inlet1D) against
+ * a surface (Surf1D) and against a symmetry plane (Symm1D) are solved
+ * with Sim1D using both Jacobian storage schemes, starting from the
+ * same solution on the same grid, and the solutions are compared.
+ */
+#include <iostream>
+#include <cmath>
+#include <cstdio>
+
+#include "Cantera.h"
+#include "kernel/BlockTridiagMatrix.h"
+#include "kernel/BandMatrix.h"
+#include "IdealGasMix.h"
+#include "transport.h"
+#include "onedim.h"
+
+using namespace Cantera;
+using namespace std;
+
+static void getSolution(Sim1D& s, vector_fp& x) {
+  const doublereal* xs = s.solution();
+  x.assign(xs, xs + s.size());
+}
+
+static void setSolution(Sim1D& s, const vector_fp& x) {
+  for (int n = 0; n < s.nDomains(); n++) {
+    Domain1D& d = s.domain(n);
+    for (int j = 0; j < d.nPoints(); j++) {
+      for (int i = 0; i < d.nComponents(); i++) {
+        s.setValue(n, i, j, x[d.loc() + d.index(i,j)]);
+      }
+    }
+  }
+}
+
+// Solve the flame with the Jacobian stored as a band matrix and as a
+// block-tridiagonal matrix, starting both times from the current
+// solution and without refining the grid, and compare the solutions.
+static void compareSolvers(Sim1D& flame, StFlow& flow, string name) {
+  vector_fp x0, xb, xt;
+  getSolution(flame, x0);
+  bool storage = !flame.blockTridiagonal();
+  flame.solve(0, false);
+  getSolution(flame, xb);
+
+  setSolution(flame, x0);
+  flame.setBlockTridiagonal(true);
+  storage = storage && flame.blockTridiagonal();
+  flame.solve(0, false);
+  getSolution(flame, xt);
+  flame.setBlockTridiagonal(false);
+
+  // largest difference, relative to the magnitude of each component
+  double diff = 0.0;
+  for (int n = 0; n < flame.nDomains(); n++) {
+    Domain1D& d = flame.domain(n);
+    for (int i = 0; i < d.nComponents(); i++) {
+      double xmax = 0.0, dmax = 0.0;
+      for (int j = 0; j < d.nPoints(); j++) {
+        int k = d.loc() + d.index(i,j);
+        xmax = max(xmax, fabs(xb[k]));
+        dmax = max(dmax, fabs(xt[k] - xb[k]));
+      }
+      diff = max(diff, dmax/(xmax + 1.0e-10));
+    }
+  }
+  double tmax = 0.0;
+  for (int j = 0; j < flow.nPoints(); j++) {
+    tmax = max(tmax, flame.value(1, 2, j));
+  }
+  cout << name << ": Tmax = " << int(tmax + 0.5) << " K" << endl;
+  cout << name << ": storage selected: " << (storage ? "yes" : "no") << endl;
+  cout << name << ": agrees with band storage: "
+       << (diff < 1.0e-4 ? "yes" : "no") << endl;
+}
+
+// Solve a premixed hydrogen flame in stagnation flow from an inlet
+// towards the boundary 'right', with grid refinement. Then increase
+// the mass flux slightly, and compare the solvers on the final grid.
+static void flameTest(IdealGasMix& gas, Transport& tr, Domain1D& right,
+                      string name) {
+  int nsp = gas.nSpecies();
+  double T0 = 300.0;
+  const char* reac = "H2:0.3, O2:0.21, AR:0.79";
+  gas.setState_TPX(T0, OneAtm, reac);
+  vector_fp yu(nsp);
+  gas.getMassFractions(DATA_PTR(yu));
+  double rho0 = gas.density();
+
+  AxiStagnFlow flow(&gas);
+  int np = 20;
+  vector_fp z(np);
+  for (int j = 0; j < np; j++) z[j] = 0.01*j/(np - 1);
+  flow.setupGrid(np, DATA_PTR(z));
+  flow.setTransport(tr);
+  flow.setKinetics(gas);
+  flow.setPressure(OneAtm);
+  flow.setTolerances(1.0e-5, 1.0e-10);
+
+  Inlet1D inlet;
+  double mdot = 2.5;
+  inlet.setMoleFractions(reac);
+  inlet.setMdot(mdot);
+  inlet.setTemperature(T0);
+
+  vector<Domain1D*> domains;
+  domains.push_back(&inlet);
+  domains.push_back(&flow);
+  domains.push_back(&right);
+  Sim1D flame(domains);
+
+  vector_fp locs(3), v(3);
+  locs[0] = 0.0;
+  locs[1] = 0.5;
+  locs[2] = 1.0;
+  v[0] = mdot/rho0;
+  v[1] = 0.3*mdot/rho0;
+  v[2] = 0.0;
+  flame.setInitialGuess("u", locs, v);
+  v[0] = T0;
+  v[1] = 2000.0;
+  v[2] = 1000.0;
+  flame.setInitialGuess("T", locs, v);
+  for (int k = 0; k < nsp; k++) {
+    v[0] = yu[k];
+    v[1] = yu[k];
+    v[2] = yu[k];
+    flame.setInitialGuess(gas.speciesName(k), locs, v);
+  }
+  flame.setRefineCriteria(1, 10.0, 0.5, 0.6);
+  flame.solve(0, false);
+  flow.solveEnergyEqn();
+  flame.solve(0, true);
+  inlet.setMdot(1.05*mdot);
+  compareSolvers(flame, flow, name);
+}
+
+int main() {
+  try {
+    int sizes[] = {2, 5, 5, 0, 5, 3, 1, 5, 5, 2};
+    vector_int nv(sizes, sizes + 10);
+    BlockTridiagMatrix a(nv);
+    int n = a.nRows();
+    int kl = 0;
+    for (int b = 0; b < a.nBlocks() - 1; b++) {
+      kl = max(kl, nv[b] + nv[b+1] - 1);
+    }
+    BandMatrix band(n, kl, kl);
+
+    // fill all stored elements with a deterministic pattern, leaving
+    // some of them zero
+    int i, j, k;
+    for (i = 0; i < n; i++) {
+      for (j = 0; j < n; j++) {
+        if (a.index(i,j) >= 0) {
+          k = (7*i + 13*j) % 17;
+          double v = (k % 5 == 0 ? 0.0 : (k - 8.0)/8.0);
+          a(i,j) = v;
+          band(i,j) = v;
+        }
+      }
+    }
+
+    // make the diagonal block of the second block singular, as it is
+    // for the first point of a flow domain
+    for (i = 2; i < 7; i++) {
+      a(i,2) = 0.0;
+      band(i,2) = 0.0;
+    }
+
+    vector_fp rhs(n), x(n), xb(n), r(n);
+    for (i = 0; i < n; i++) rhs[i] = 1.0 + i;
+
+    int info = a.solve(n, DATA_PTR(rhs), DATA_PTR(x));
+    int infob = band.solve(n, DATA_PTR(rhs), DATA_PTR(xb));
+    a.mult(DATA_PTR(x), DATA_PTR(r));
+
+    double resid = 0.0, diff = 0.0, xmax = 0.0;
+    for (i = 0; i < n; i++) {
+      resid = max(resid, fabs(r[i] - rhs[i]));
+      diff = max(diff, fabs(x[i] - xb[i]));
+      xmax = max(xmax, fabs(x[i]));
+    }
+
+    cout << "rows = " << n << endl;
+    cout << "blocks = " << a.nBlocks() << endl;
+    cout << "block solve info = " << info << endl;
+    cout << "band solve info = " << infob << endl;
+    cout << "residual small: " << (resid < 1.0e-10*xmax ? "yes" : "no") << endl;
+    cout << "agrees with BandMatrix: " << (diff < 1.0e-10*xmax ? "yes" : "no") << endl;
+    cout << "smaller than BandMatrix: "
+         << (a.memory() < sizeof(doublereal)*2*n*band.ldim() ? "yes" : "no")
+         << endl;
+
+    // a matrix with an empty column is singular
+    for (i = 0; i < n; i++) a(i,9) = 0.0;
+    info = a.solve(n, DATA_PTR(rhs), DATA_PTR(x));
+    cout << "singular column reported as row " << info - 1 << endl;
+
+    /*
+     * Sim1D with inlet, surface and symmetry-plane boundaries
+     */
+    IdealGasMix gas("h2o2.xml", "ohmech");
+    Transport* tr = newTransportMgr("Mix", &gas);
+    Surf1D surf;
+    surf.setTemperature(600.0);
+    flameTest(gas, *tr, surf, "surface");
+    Symm1D symm;
+    flameTest(gas, *tr, symm, "symmetry plane");
+    delete tr;
+  }
+  catch (CanteraError) {
+    showErrors(cout);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,109 @@
+/**
+ *  @file HMW_test_linearT.cpp
+ *
+ *  Checks of the linear temperature dependence of the Pitzer
+ *  coefficients (TempModel="linear"). At 323.15 K the activity
+ *  coefficients must equal those of a constant-coefficient phase
+ *  with the same coefficients evaluated at that temperature, and
+ *  the partial molar enthalpies must be consistent with the
+ *  temperature derivative of the chemical potentials.
+ */
+
+#include "Cantera.h"
+#include "kernel/HMWSoln.h"
+
+#include <cstdio>
+#include <cmath>
+
+using namespace std;
+using namespace Cantera;
+
+static void check(string what, double err, double tol) {
+  printf("%-45s %s\n", what.c_str(), (err < tol ? "yes" : "no"));
+  if (err >= tol) {
+    printf("     error = %g, tolerance = %g\n", err, tol);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  int k;
+  try {
+    HMWSoln *HMWlin = new HMWSoln("HMW_NaCl_linearT.xml", "NaCl_linear");
+    HMWSoln *HMWcon = new HMWSoln("HMW_NaCl_linearT.xml", "NaCl_const");
+    int nsp = HMWlin->nSpecies();
+    double T = 323.15;
+    double P = OneAtm;
+
+    vector_fp moll(nsp), acLin(nsp), acCon(nsp);
+    vector_fp hbar(nsp), h0(nsp), mu0(nsp), mu1(nsp), mu2(nsp);
+    /*
+     * All of the ions are given large molalities, so that the psi
+     * terms for both ion triplets contribute.
+     */
+    moll[HMWlin->speciesIndex("Na+")] = 4.0;
+    moll[HMWlin->speciesIndex("Cl-")] = 5.0;
+    moll[HMWlin->speciesIndex("H+")] = 2.0;
+    moll[HMWlin->speciesIndex("OH-")] = 1.0;
+    HMWlin->setState_TP(T, P);
+    HMWlin->setMolalities(DATA_PTR(moll));
+    HMWcon->setState_TP(T, P);
+    HMWcon->setMolalities(DATA_PTR(moll));
+
+    /*
+     * Activity coefficients at T
+     */
+    HMWlin->getMolalityActivityCoefficients(DATA_PTR(acLin));
+    HMWcon->getMolalityActivityCoefficients(DATA_PTR(acCon));
+    printf("            Name  ActCoeffMolal\n");
+    double errMax = 0.0;
+    for (k = 0; k < nsp; k++) {
+      printf("%16s %13.6g\n", HMWlin->speciesName(k).c_str(), acLin[k]);
+      errMax = fmaxx(errMax, fabs(log(acLin[k]) - log(acCon[k])));
+    }
+    check("ln(gamma) equal to the constant model:", errMax, 1.0E-12);
+    double oc = HMWlin->osmoticCoefficient();
+    printf("osmotic coefficient = %13.6g\n", oc);
+    check("Osmotic coefficient equal to the constant model:",
+	  fabs(oc - HMWcon->osmoticCoefficient()), 1.0E-12);
+
+    /*
+     * Excess partial molar enthalpies, h_k - h_k^o, compared with
+     * -T**2 d((mu_k - mu_k^o)/T)/dT by central differences. They
+     * contain the temperature derivatives of the Pitzer coefficients.
+     */
+    HMWlin->getPartialMolarEnthalpies(DATA_PTR(hbar));
+    HMWlin->getEnthalpy_RT(DATA_PTR(h0));
+    double RT = GasConstant * T;
+    double dT = 1.0E-3;
+    HMWlin->setState_TP(T + dT, P);
+    HMWlin->getChemPotentials(DATA_PTR(mu1));
+    HMWlin->getStandardChemPotentials(DATA_PTR(mu0));
+    for (k = 0; k < nsp; k++) {
+      mu1[k] -= mu0[k];
+    }
+    HMWlin->setState_TP(T - dT, P);
+    HMWlin->getChemPotentials(DATA_PTR(mu2));
+    HMWlin->getStandardChemPotentials(DATA_PTR(mu0));
+    for (k = 0; k < nsp; k++) {
+      mu2[k] -= mu0[k];
+    }
+    errMax = 0.0;
+    double hMax = 0.0;
+    for (k = 0; k < nsp; k++) {
+      double hEx = hbar[k] - RT * h0[k];
+      double hfd = - T * T * (mu1[k]/(T + dT) - mu2[k]/(T - dT)) / (2.0 * dT);
+      errMax = fmaxx(errMax, fabs(hfd - hEx));
+      hMax = fmaxx(hMax, fabs(hEx));
+    }
+    check("Excess enthalpies vs. d(mu/T)/dT:", errMax / hMax, 1.0E-6);
+
+    delete HMWlin;
+    delete HMWcon;
+    appdelete();
+  } catch (CanteraError) {
+    showErrors(cout);
+    return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,185 @@
+/**
+ *  @file Margules_test.cpp
+ *
+ *  Consistency checks of the MargulesVPSSTP excess volumes and of
+ *  the changes in the log activity coefficients, for a phase with
+ *  two binary interactions sharing a species.
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Cantera.h"
+#include "kernel/MargulesVPSSTP.h"
+
+#include <cstdio>
+#include <cmath>
+
+using namespace std;
+using namespace Cantera;
+
+/*
+ * Excess volume parameters of Margules_LiKCl.xml, in the order
+ * (A, B, VHE_b, VHE_c, VSE_b, VSE_c). Species indices are
+ * LiCl(L) = 0, KCl(L) = 1, NaCl(L) = 2.
+ */
+static const int nInt = 2;
+static const int spA[nInt] = {1, 1};
+static const int spB[nInt] = {0, 2};
+static const double vParams[nInt][4] = {
+  { 0.0021, -0.0013,  1.0E-6, 2.0E-6},
+  {-0.0014,  0.0009, -1.5E-6, 0.5E-6}
+};
+
+/*
+ * Excess molar volume at temperature T and mole fractions x
+ */
+static double excessVolume(double T, const double* x) {
+  double ve = 0.0;
+  for (int i = 0; i < nInt; i++) {
+    double XA = x[spA[i]];
+    double XB = x[spB[i]];
+    double g0 = vParams[i][0] - T * vParams[i][2];
+    double g1 = vParams[i][1] - T * vParams[i][3];
+    ve += XA * XB * (g0 + g1 * XB);
+  }
+  return ve;
+}
+
+/*
+ * Total volume of the moles n, in m**3
+ */
+static double totalVolume(MargulesVPSSTP& ph, double T, double P,
+			  const double* n) {
+  int kk = ph.nSpecies();
+  double ntot = 0.0;
+  for (int k = 0; k < kk; k++) {
+    ntot += n[k];
+  }
+  ph.setState_TPX(T, P, n);
+  return ntot * ph.molarVolume();
+}
+
+static void check(string what, double err, double tol) {
+  printf("%-45s %s\n", what.c_str(), (err < tol ? "yes" : "no"));
+  if (err >= tol) {
+    printf("     error = %g, tolerance = %g\n", err, tol);
+  }
+}
+
+int main(int argc, char** argv) {
+  int k;
+  try {
+    MargulesVPSSTP* ph = new MargulesVPSSTP("Margules_LiKCl.xml",
+					    "LiKNaCl_liquid");
+    int kk = ph->nSpecies();
+    double T = 800.;
+    double P = OneAtm;
+    double x[3] = {0.5, 0.3, 0.2};
+    ph->setState_TPX(T, P, x);
+
+    vector_fp vbar(kk), v0(kk), n(kk), lnac1(kk), lnac2(kk);
+    vector_fp dlnac(kk), dX(kk), xp(kk);
+
+    /*
+     * The excess volume is the mole-fraction weighted sum of the
+     * excess partial molar volumes.
+     */
+    ph->getPartialMolarVolumes(DATA_PTR(vbar));
+    ph->getStandardVolumes(DATA_PTR(v0));
+    double ve = 0.0;
+    for (k = 0; k < kk; k++) {
+      ve += x[k] * (vbar[k] - v0[k]);
+    }
+    double veExact = excessVolume(T, x);
+    printf("excess molar volume = %11.5E m**3/kmol\n", veExact);
+    check("Sum of excess partial molar volumes:",
+	  fabs(ve - veExact) / fabs(veExact), 1.0E-10);
+    check("Molar volume:",
+	  fabs(ph->molarVolume() - (x[0]*v0[0] + x[1]*v0[1] + x[2]*v0[2]
+				    + veExact)) / ph->molarVolume(), 1.0E-10);
+
+    /*
+     * Each partial molar volume is the derivative of the total
+     * volume with respect to the moles of that species.
+     */
+    double errMax = 0.0;
+    for (k = 0; k < kk; k++) {
+      for (int j = 0; j < kk; j++) {
+	n[j] = x[j];
+      }
+      double dn = 1.0E-5;
+      n[k] = x[k] + dn;
+      double vp = totalVolume(*ph, T, P, DATA_PTR(n));
+      n[k] = x[k] - dn;
+      double vm = totalVolume(*ph, T, P, DATA_PTR(n));
+      double vfd = (vp - vm) / (2.0 * dn);
+      errMax = fmaxx(errMax, fabs(vfd - vbar[k]) / fabs(vbar[k]));
+    }
+    check("Partial molar volumes vs. dV/dn_k:", errMax, 1.0E-8);
+
+    /*
+     * The change in ln(gamma) for a small change in temperature
+     * and composition, compared with central differences.
+     */
+    double h = 1.0E-4, dMax;
+    double dT = 10.0 * h;
+    dX[0] = 0.01 * h;
+    dX[1] = -0.004 * h;
+    dX[2] = -0.006 * h;
+    ph->setState_TPX(T, P, x);
+    ph->getdlnActCoeff(dT, DATA_PTR(dX), DATA_PTR(dlnac));
+
+    for (k = 0; k < kk; k++) {
+      xp[k] = x[k] + dX[k];
+    }
+    ph->setState_TPX(T + dT, P, DATA_PTR(xp));
+    ph->getActivityCoefficients(DATA_PTR(lnac1));
+    for (k = 0; k < kk; k++) {
+      xp[k] = x[k] - dX[k];
+    }
+    ph->setState_TPX(T - dT, P, DATA_PTR(xp));
+    ph->getActivityCoefficients(DATA_PTR(lnac2));
+
+    errMax = 0.0;
+    dMax = 0.0;
+    for (k = 0; k < kk; k++) {
+      double dfd = 0.5 * (log(lnac1[k]) - log(lnac2[k]));
+      errMax = fmaxx(errMax, fabs(dfd - dlnac[k]));
+      dMax = fmaxx(dMax, fabs(dfd));
+    }
+    errMax /= dMax;
+    check("getdlnActCoeff vs. finite differences:", errMax, 1.0E-6);
+
+    /*
+     * Temperature change only
+     */
+    for (k = 0; k < kk; k++) {
+      dX[k] = 0.0;
+    }
+    ph->setState_TPX(T, P, x);
+    ph->getdlnActCoeff(dT, DATA_PTR(dX), DATA_PTR(dlnac));
+    ph->setState_TPX(T + dT, P, x);
+    ph->getActivityCoefficients(DATA_PTR(lnac1));
+    ph->setState_TPX(T - dT, P, x);
+    ph->getActivityCoefficients(DATA_PTR(lnac2));
+    errMax = 0.0;
+    dMax = 0.0;
+    for (k = 0; k < kk; k++) {
+      double dfd = 0.5 * (log(lnac1[k]) - log(lnac2[k]));
+      errMax = fmaxx(errMax, fabs(dfd - dlnac[k]));
+      dMax = fmaxx(dMax, fabs(dfd));
+    }
+    errMax /= dMax;
+    check("getdlnActCoeff, temperature change only:", errMax, 1.0E-6);
+
+    delete ph;
+    appdelete();
+  }
+  catch (CanteraError) {
+    showErrors(cout);
+    return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ *  testWaterSSCache.cpp
+ *
+ *  PDSS_Water skips the density solve when it is set again to the
+ *  temperature and pressure of its last solve, and
+ *  VPSSMgr_Water_ConstVol stores the water reference state. This
+ *  compares both with water objects created for each evaluation, for
+ *  repeated and alternating states and after the water has been moved
+ *  by other calls.
+ */
+#include "ct_defs.h"
+#include "ctexceptions.h"
+#include "global.h"
+#include "xml.h"
+#include "ctml.h"
+#include "PDSS_Water.h"
+#include "HMWSoln.h"
+#include <new>
+
+#include <cstdio>
+#include <cmath>
+
+using namespace std;
+using namespace Cantera;
+
+static double errMax = 0.0;
+
+/*
+ * Density and Gibbs function of water at (T, P), from a new object
+ */
+static void exactWater(double T, double P, double& dens, double& g) {
+  PDSS_Water* w = new PDSS_Water(0, 0);
+  w->setState_TP(T, P);
+  dens = w->density();
+  g = w->gibbs_mole();
+  delete w;
+}
+
+static void checkWater(PDSS_Water* w, double T, double P) {
+  double dens, g;
+  w->setState_TP(T, P);
+  exactWater(T, P, dens, g);
+  errMax = fmaxx(errMax, fabs(w->density() - dens) / dens);
+  errMax = fmaxx(errMax, fabs(w->gibbs_mole() - g) / fabs(g));
+}
+
+static void checkPhase(HMWSoln* HMW, double T, double P) {
+  int nsp = HMW->nSpecies();
+  vector_fp grt(nsp), vol(nsp);
+  double RT = GasConstant * T;
+  double dens, g, dens0, g0;
+  HMW->setState_TP(T, P);
+  exactWater(T, P, dens, g);
+  PDSS_Water* w = new PDSS_Water(0, 0);
+  double p0 = w->pref_safe(T);
+  delete w;
+  exactWater(T, p0, dens0, g0);
+
+  double mw = HMW->molecularWeight(0);
+  HMW->getGibbs_RT_ref(DATA_PTR(grt));
+  errMax = fmaxx(errMax, fabs(grt[0] - g0 / RT) / fabs(grt[0]));
+  HMW->getStandardVolumes_ref(DATA_PTR(vol));
+  errMax = fmaxx(errMax, fabs(vol[0] - mw / dens0) / vol[0]);
+  HMW->getGibbs_RT(DATA_PTR(grt));
+  errMax = fmaxx(errMax, fabs(grt[0] - g / RT) / fabs(grt[0]));
+  HMW->getStandardVolumes(DATA_PTR(vol));
+  errMax = fmaxx(errMax, fabs(vol[0] - mw / dens) / vol[0]);
+}
+
+static void report(string what) {
+  printf("%-50s %s\n", what.c_str(), (errMax < 1.0E-10 ? "yes" : "no"));
+  if (errMax >= 1.0E-10) {
+    printf("     max relative error = %g\n", errMax);
+  }
+  errMax = 0.0;
+}
+
+int main () {
+  int i;
+  double T1 = 298.15, P1 = OneAtm;
+  double T2 = 423.15, P2 = 5.0E6;
+  try {
+    VPStandardStateTP *nnn = 0;
+    PDSS_Water *w = new PDSS_Water(nnn, 0);
+
+    for (i = 0; i < 3; i++) {
+      checkWater(w, T1, P1);
+    }
+    report("PDSS_Water, repeated state:");
+
+    for (i = 0; i < 3; i++) {
+      checkWater(w, T1, P1);
+      checkWater(w, T2, P2);
+      checkWater(w, T1, P2);
+      checkWater(w, T2, P1);
+    }
+    report("PDSS_Water, alternating states:");
+
+    /*
+     * Move the water to other states between calls at
+     * the same temperature and pressure.
+     */
+    checkWater(w, T2, P2);
+    w->satPressure(T2);
+    checkWater(w, T2, P2);
+    w->setState_TR(T2, 900.0);
+    checkWater(w, T2, P2);
+    w->setTemperature(T1);
+    checkWater(w, T2, P2);
+    report("PDSS_Water, water moved between calls:");
+    delete w;
+
+    HMWSoln *HMW = new HMWSoln("HMW_NaCl.xml", "NaCl_electrolyte");
+    for (i = 0; i < 3; i++) {
+      checkPhase(HMW, T1, P1);
+    }
+    report("Water standard state in HMWSoln, repeated state:");
+
+    for (i = 0; i < 3; i++) {
+      checkPhase(HMW, T1, P1);
+      checkPhase(HMW, T2, P2);
+      checkPhase(HMW, T1, P2);
+      checkPhase(HMW, T2, P1);
+    }
+    report("Water standard state in HMWSoln, alternating states:");
+    delete HMW;
+
+    appdelete();
+  } catch (CanteraError) {
+    showErrors();
+    return -1;
+  }
+  return 0;
+}
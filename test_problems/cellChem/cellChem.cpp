@@ -0,0 +1,133 @@
+/**
+ *  @file cellChem.cpp
+ *
+ *  Advances many independent methane/air states through
+ *  ImplicitChem::integrateCells(), as in operator-split cell
+ *  chemistry, and compares the results with those of a new
+ *  ImplicitChem object for each cell. It also checks that the
+ *  memory used by the process does not grow with the number of
+ *  cells, since the integrator is only reinitialized between cells.
+ */
+
+#include "Cantera.h"
+#include "IdealGasMix.h"
+#include "kernel/ImplicitChem.h"
+
+#include <cstdio>
+#include <cmath>
+#ifndef WIN32
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+using namespace Cantera;
+using namespace Cantera_CXX;
+
+static void check(string what, double err, double tol) {
+  printf("%-50s %s\n", what.c_str(), (err < tol ? "yes" : "no"));
+  if (err >= tol) {
+    printf("     error = %g, tolerance = %g\n", err, tol);
+  }
+}
+
+/*
+ * Peak resident set size of the process. Only ratios of two values
+ * are used, so that the units (kB or bytes) do not matter.
+ */
+static double peakMemory() {
+#ifndef WIN32
+  struct rusage r;
+  getrusage(RUSAGE_SELF, &r);
+  return r.ru_maxrss;
+#else
+  return 1.0;
+#endif
+}
+
+/*
+ * Fill T, P and Y with ncells states: methane/air mixtures at a
+ * range of temperatures starting at Tlow and of equivalence ratios,
+ * with a small radical pool
+ */
+static void makeCells(IdealGasMix& gas, int ncells, double Tlow,
+		      vector_fp& T, vector_fp& P, vector_fp& Y) {
+  int nsp = gas.nSpecies();
+  T.resize(ncells);
+  P.resize(ncells);
+  Y.resize(ncells*nsp);
+  for (int n = 0; n < ncells; n++) {
+    char x[100];
+    sprintf(x, "CH4:%g, O2:2, N2:7.52, OH:1.0e-4, H:1.0e-4",
+	    0.5 + (n % 11) * 0.1);
+    T[n] = Tlow + (n % 17) * 50.0;
+    P[n] = OneAtm;
+    gas.setState_TPX(T[n], P[n], x);
+    gas.getMassFractions(DATA_PTR(Y) + n*nsp);
+  }
+}
+
+int main(int argc, char** argv) {
+  try {
+    IdealGasMix gas("gri30.xml", "gri30");
+    int nsp = gas.nSpecies();
+    double dt = 5.0E-5;
+    ImplicitChem chem(gas, gas);
+    chem.adiabatic();
+
+    /*
+     * Batch integration, compared with a new ImplicitChem object
+     * for each cell
+     */
+    int ncells = 24;
+    vector_fp T, P, Y;
+    makeCells(gas, ncells, 1600.0, T, P, Y);
+    vector_fp T0(T), P0(P), Y0(Y);
+    chem.integrateCells(ncells, DATA_PTR(T), DATA_PTR(P), DATA_PTR(Y), dt);
+
+    double errT = 0.0, errY = 0.0, dTmax = 0.0;
+    for (int n = 0; n < ncells; n++) {
+      ImplicitChem fresh(gas, gas);
+      fresh.adiabatic();
+      gas.setState_TPY(T0[n], P0[n], DATA_PTR(Y0) + n*nsp);
+      fresh.integrateCell(dt);
+      errT = fmaxx(errT, fabs(gas.temperature() - T[n]));
+      for (int k = 0; k < nsp; k++) {
+	errY = fmaxx(errY, fabs(gas.massFraction(k) - Y[n*nsp + k]));
+      }
+      dTmax = fmaxx(dTmax, T[n] - T0[n]);
+    }
+    printf("Cells advanced: %d\n", chem.nCells());
+    check("Some cells ignite (temperature rise > 100 K):",
+	  dTmax > 100.0 ? 0.0 : 1.0, 0.5);
+    check("Temperatures equal to a new integrator per cell:", errT, 1.0E-3);
+    check("Mass fractions equal to a new integrator per cell:", errY, 1.0E-7);
+
+    /*
+     * Memory use. After a first batch, advancing many more cells
+     * must not increase the peak memory of the process. Each cell
+     * that allocated the integrator Jacobian again would add
+     * 2*nsp*nsp doubles (45 kB for GRI-Mech 3.0). Short steps of
+     * cool mixtures keep this part cheap.
+     */
+    int nbatch = 200, nrep = 4;
+    double dtm = 1.0E-6;
+    makeCells(gas, nbatch, 1000.0, T0, P0, Y0);
+    T = T0; P = P0; Y = Y0;
+    chem.integrateCells(nbatch, DATA_PTR(T), DATA_PTR(P), DATA_PTR(Y), dtm);
+    double mem0 = peakMemory();
+    for (int i = 0; i < nrep; i++) {
+      T = T0; P = P0; Y = Y0;
+      chem.integrateCells(nbatch, DATA_PTR(T), DATA_PTR(P), DATA_PTR(Y), dtm);
+    }
+    double mem1 = peakMemory();
+    check("Memory use independent of the number of cells:",
+	  (mem1 - mem0)/mem0, 0.05);
+
+    appdelete();
+  }
+  catch (CanteraError) {
+    showErrors(cout);
+    return -1;
+  }
+  return 0;
+}
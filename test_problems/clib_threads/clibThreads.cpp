@@ -0,0 +1,133 @@
+/**
+ *  @file clibThreads.cpp
+ *
+ *  Stress test for the clib handle tables. Several threads create,
+ *  use and delete thermo and kinetics managers and Func1 objects
+ *  through the C interface at the same time. Each thread checks that
+ *  the handles it is given refer to its own objects, and that no
+ *  handle is given out twice.
+ */
+
+#include "ct.h"
+#include "ctxml.h"
+#include "ctfunc.h"
+
+#include <pthread.h>
+#include <cstdio>
+#include <vector>
+
+#define NTHREADS 4
+
+// number of thermo/kinetics pairs created by each thread
+#define NPHASES 20
+
+// number of Func1 objects created by each thread
+#define NFUNCS 20000
+
+static int s_phase = -1;
+
+struct ThreadData {
+    int id;
+    int errors;
+    std::vector<int> phases;
+    std::vector<int> funcs;
+};
+
+static void* run(void* arg)
+{
+    ThreadData* d = (ThreadData*) arg;
+    int i;
+
+    // Func1 objects are cheap to create, so the threads contend for
+    // the handle table on nearly every call here.
+    for (i = 0; i < NFUNCS; i++) {
+        double c = 1.0*NFUNCS*d->id + i;
+        int f = func_new(110, 0, 1, &c);   // constant function
+        d->funcs.push_back(f);
+        if (f <= 0) {
+            d->errors++;
+            continue;
+        }
+        if (func_value(f, 0.0) != c) d->errors++;
+        if (i % 2 == 0) {
+            if (func_del(f) != 0) d->errors++;
+        }
+    }
+
+    // the functions that were not deleted must still be intact
+    for (i = 1; i < NFUNCS; i += 2) {
+        double c = 1.0*NFUNCS*d->id + i;
+        if (func_value(d->funcs[i], 0.0) != c) d->errors++;
+    }
+
+    for (i = 0; i < NPHASES; i++) {
+        int th = newThermoFromXML(s_phase);
+        int kin = newKineticsFromXML(s_phase, th, -1, -1, -1, -1);
+        d->phases.push_back(th);
+        if (th <= 0 || kin <= 0) {
+            d->errors++;
+            continue;
+        }
+        double t = 300.0 + 10.0*d->id + i;
+        phase_setTemperature(th, t);
+        if (phase_temperature(th) != t) d->errors++;
+        if (kin_nSpecies(kin) != phase_nSpecies(th)) d->errors++;
+        if (delKinetics(kin) != 0) d->errors++;
+        if (delThermo(th) != 0) d->errors++;
+    }
+    return 0;
+}
+
+// Count handles that are out of range or were given out more than once
+static int checkHandles(ThreadData* data, bool phases, int nh)
+{
+    int errors = 0;
+    std::vector<int> seen(nh + 1, 0);
+    for (int n = 0; n < NTHREADS; n++) {
+        std::vector<int>& h = (phases ? data[n].phases : data[n].funcs);
+        for (size_t i = 0; i < h.size(); i++) {
+            if (h[i] < 1 || h[i] > nh || seen[h[i]]) {
+                errors++;
+            }
+            else {
+                seen[h[i]] = 1;
+            }
+        }
+    }
+    return errors;
+}
+
+int main(int argc, char** argv)
+{
+    int x = xml_get_XML_File("gri30.xml", 0);
+    s_phase = xml_findID(x, "gri30_mix");
+    if (s_phase < 0) {
+        printf("could not read gri30.xml\n");
+        return 1;
+    }
+
+    pthread_t threads[NTHREADS];
+    ThreadData data[NTHREADS];
+    int n;
+    for (n = 0; n < NTHREADS; n++) {
+        data[n].id = n;
+        data[n].errors = 0;
+        pthread_create(&threads[n], 0, run, (void*) &data[n]);
+    }
+    for (n = 0; n < NTHREADS; n++) {
+        pthread_join(threads[n], 0);
+    }
+
+    int errors = 0;
+    for (n = 0; n < NTHREADS; n++) {
+        errors += data[n].errors;
+    }
+    errors += checkHandles(data, true, NTHREADS*NPHASES);
+    errors += checkHandles(data, false, NTHREADS*NFUNCS);
+
+    printf("threads = %d\n", NTHREADS);
+    printf("phases per thread = %d\n", NPHASES);
+    printf("functions per thread = %d\n", NFUNCS);
+    printf("errors = %d\n", errors);
+    return (errors == 0 ? 0 : 1);
+}
@@ -0,0 +1,503 @@
+/*
+ * Tests of the solution of a hydrogen counterflow diffusion flame
+ * with Sim1D. The flame is set up and solved at a low mass flux by
+ * solveFlame, and then
+ *
+ *  - the mass fluxes are increased slightly, and the flame is solved
+ *    again on the same grid with the direct solver and with the
+ *    Newton-Krylov method, using the default Krylov options. The
+ *    solutions must agree to within the tolerances. With too few
+ *    GMRES iterations, the solver must give up instead of iterating
+ *    forever, and leave the steady problem set up for the next solve.
+ *    The flame is also solved with the transport terms of the
+ *    Jacobian reused for several iterations, which must give the
+ *    same solution; and at a fixed solution, a Jacobian evaluation
+ *    that updates only the source terms must reproduce the full one.
+ *
+ *  - the mass fluxes of both inlets are increased in proportion with
+ *    Sim1D::continuation, and then reduced again. The solution at the
+ *    highest mass flux is compared with one found by solving directly
+ *    for that mass flux, starting from the initial solution on the
+ *    same grid.
+ *
+ *  - a flame with argon added to the oxidizer is taken past the
+ *    turning point at which it is extinguished by increasing the mass
+ *    fluxes. The parameter must increase up to the turning point and
+ *    then decrease, and the solutions beyond it must be cooler than
+ *    those on the burning branch.
+ *
+ *  - the flame is solved with multicomponent transport, first with
+ *    the effective diffusion coefficients and then with the exact
+ *    multicomponent fluxes of StFlow::enableMultiFluxes, which must
+ *    equal those of MultiTransport::getSpeciesFluxes. The residual
+ *    must not depend on the evaluations made for the Jacobian.
+ */
+#include <cstdio>
+#include <cmath>
+
+#include "Cantera.h"
+#include "IdealGasMix.h"
+#include "equilibrium.h"
+#include "transport.h"
+#include "onedim.h"
+
+using namespace Cantera;
+using namespace std;
+
+static double mdot0 = 0.1;
+static const char* fuel = "H2:1, AR:1";
+static const char* oxidizer = "O2:0.21, AR:0.79";
+
+// maximum temperature in the flow domain
+static double maxTemperature(Sim1D& s) {
+  int np = s.domain(1).nPoints();
+  double t = 0.0;
+  for (int j = 0; j < np; j++) {
+    t = max(t, s.value(1, 2, j));
+  }
+  return t;
+}
+
+static void getSolution(Sim1D& s, vector_fp& x) {
+  const doublereal* xs = s.solution();
+  x.assign(xs, xs + s.size());
+}
+
+static void setSolution(Sim1D& s, const vector_fp& x) {
+  for (int n = 0; n < s.nDomains(); n++) {
+    Domain1D& d = s.domain(n);
+    for (int j = 0; j < d.nPoints(); j++) {
+      for (int i = 0; i < d.nComponents(); i++) {
+        s.setValue(n, i, j, x[d.loc() + d.index(i,j)]);
+      }
+    }
+  }
+}
+
+// largest difference in temperature between two solutions
+static double maxTempDiff(Sim1D& s, const vector_fp& a, const vector_fp& b) {
+  Domain1D& flow = s.domain(1);
+  double d = 0.0;
+  for (int j = 0; j < flow.nPoints(); j++) {
+    int n = flow.loc() + flow.index(2,j);
+    d = max(d, fabs(a[n] - b[n]));
+  }
+  return d;
+}
+
+// Set up the domains of a counterflow flame with fuel mass flux mdot
+// and separation width between the inlets, and solve it, first with
+// a fixed temperature profile, and then with the energy equation and
+// grid refinement.
+static void solveFlame(IdealGasMix& gas, Transport& tr, double mdot,
+                       double width, AxiStagnFlow& flow, Inlet1D& left,
+                       Inlet1D& right, Sim1D*& flame) {
+  int nsp = gas.nSpecies();
+  double T0 = 300.0;
+  vector_fp yf(nsp), yo(nsp), yb(nsp);
+  gas.setState_TPX(T0, OneAtm, fuel);
+  gas.getMassFractions(DATA_PTR(yf));
+  double rhof = gas.density();
+  gas.setState_TPX(T0, OneAtm, oxidizer);
+  gas.getMassFractions(DATA_PTR(yo));
+  double rhoo = gas.density();
+  gas.setState_TPX(T0, OneAtm, "H2:0.42, O2:0.21, AR:1.21");
+  equilibrate(gas, "HP");
+  gas.getMassFractions(DATA_PTR(yb));
+  double Tad = gas.temperature();
+
+  double z[6];
+  for (int j = 0; j < 6; j++) z[j] = 0.2*width*j;
+  flow.setupGrid(6, z);
+  flow.setTransport(tr);
+  flow.setKinetics(gas);
+  flow.setPressure(OneAtm);
+
+  // equal momentum fluxes
+  double mdoto = mdot*sqrt(rhoo/rhof);
+  left.setMoleFractions(fuel);
+  left.setMdot(mdot);
+  left.setTemperature(T0);
+  right.setMoleFractions(oxidizer);
+  right.setMdot(mdoto);
+  right.setTemperature(T0);
+
+  vector<Domain1D*> domains;
+  domains.push_back(&left);
+  domains.push_back(&flow);
+  domains.push_back(&right);
+  flame = new Sim1D(domains);
+
+  vector_fp locs(3), v(3);
+  locs[0] = 0.0;
+  locs[1] = 0.5;
+  locs[2] = 1.0;
+  v[0] = mdot/rhof;
+  v[1] = 0.0;
+  v[2] = -mdoto/rhoo;
+  flame->setInitialGuess("u", locs, v);
+  v[0] = T0;
+  v[1] = Tad;
+  v[2] = T0;
+  flame->setInitialGuess("T", locs, v);
+  for (int k = 0; k < nsp; k++) {
+    v[0] = yf[k];
+    v[1] = yb[k];
+    v[2] = yo[k];
+    flame->setInitialGuess(gas.speciesName(k), locs, v);
+  }
+  flow.setTolerances(1.0e-5, 1.0e-10);
+  flame->setRefineCriteria(1, 10.0, 0.5, 0.6);
+  flame->solve(0, false);
+  flow.solveEnergyEqn();
+  flame->solve(0, true);
+}
+
+// Solve the flame on its current grid with the Newton-Krylov method,
+// starting from x0, and compare the result with the direct solution
+// xd.
+static void checkKrylov(Sim1D& flame, const vector_fp& x0,
+                        const vector_fp& xd, const char* name) {
+  MultiNewton& newt = flame.newton();
+  int steps = newt.nKrylovSteps();
+  int fails = newt.nKrylovFails();
+  setSolution(flame, x0);
+  flame.solve(0, false);
+  vector_fp xk;
+  getSolution(flame, xk);
+  printf("Newton-Krylov, %s options: GMRES used %s\n", name,
+         (newt.nKrylovSteps() > steps ? "yes" : "no"));
+  printf("Newton-Krylov, %s options: all GMRES solves converged %s\n", name,
+         (newt.nKrylovFails() == fails ? "yes" : "no"));
+  printf("Newton-Krylov, %s options: temperature within 0.1 K "
+         "of the direct solution: %s\n", name,
+         (maxTempDiff(flame, xd, xk) < 0.1 ? "yes" : "no"));
+}
+
+// Solve the flame on its current grid starting from x0, with a new
+// Jacobian every other iteration, whose transport terms are only
+// evaluated every 10 iterations, and compare the result with the
+// direct solution xd. Then check that updating only the source terms
+// of the Jacobian at xd reproduces the full Jacobian.
+static void checkTransportAge(Sim1D& flame, const vector_fp& x0,
+                              const vector_fp& xd) {
+  MultiJac& jac = flame.OneDim::jacobian();
+  int nsrc = jac.nSourceEvals();
+  flame.setJacAge(1);
+  flame.newton().setOptions(1);
+  flame.setTransportJacAge(10);
+  setSolution(flame, x0);
+  flame.solve(0, false);
+  vector_fp xt;
+  getSolution(flame, xt);
+  printf("transport terms reused: source terms updated alone: %s\n",
+         (jac.nSourceEvals() > nsrc ? "yes" : "no"));
+  printf("transport terms reused: temperature within 0.1 K "
+         "of the direct solution: %s\n",
+         (maxTempDiff(flame, xd, xt) < 0.1 ? "yes" : "no"));
+
+  int n = flame.size();
+  vector_fp x(xd), r(n), jfull;
+  flame.OneDim::eval(-1, DATA_PTR(x), DATA_PTR(r), 0.0, 0);
+  jac.invalidateTransport();
+  jac.eval(DATA_PTR(x), DATA_PTR(r), 0.0);
+  bool full = !jac.sourceOnly();
+  int kl = jac.nSubDiagonals(), ku = jac.nSuperDiagonals();
+  for (int j = 0; j < n; j++) {
+    for (int i = max(0, j - ku); i <= min(n - 1, j + kl); i++) {
+      jfull.push_back(jac.value(i,j));
+    }
+  }
+  jac.eval(DATA_PTR(x), DATA_PTR(r), 0.0);
+  double d = 0.0;
+  int m = 0;
+  for (int j = 0; j < n; j++) {
+    for (int i = max(0, j - ku); i <= min(n - 1, j + kl); i++) {
+      d = max(d, fabs(jac.value(i,j) - jfull[m])/(fabs(jfull[m]) + 1.0));
+      m++;
+    }
+  }
+  printf("source terms updated alone: Jacobian equal to the full one: %s\n",
+         (full && jac.sourceOnly() && d < 1.0e-10 ? "yes" : "no"));
+
+  flame.setTransportJacAge(0);
+  flame.setJacAge(10, 20);
+  flame.newton().setOptions(10);
+}
+
+// Dilute the oxidizer of a flame with argon until it is weak, and then
+// increase the mass fluxes of both inlets with Sim1D::continuation
+// until the flame is extinguished, and beyond the turning point along
+// the branch of cooler solutions.
+static void checkExtinction(IdealGasMix& gas, Transport& tr) {
+  // on this grid, the stagnation point does not cross a grid point,
+  // at which the upwind differences change
+  AxiStagnFlow flow(&gas);
+  Inlet1D left, right;
+  Sim1D* flame = 0;
+  solveFlame(gas, tr, mdot0, 0.022, flow, left, right, flame);
+
+  int nsp = gas.nSpecies();
+  vector_fp yo(nsp), yar(nsp);
+  gas.setState_TPX(300.0, OneAtm, oxidizer);
+  gas.getMassFractions(DATA_PTR(yo));
+  gas.setState_TPX(300.0, OneAtm, "AR:1");
+  gas.getMassFractions(DATA_PTR(yar));
+  InletMixtureParameter dil(right, nsp, DATA_PTR(yo), DATA_PTR(yar));
+  double zdil[] = {0.3, 0.5, 0.6, 0.7, 0.75};
+  for (int m = 0; m < 5; m++) {
+    dil.setValue(zdil[m]);
+    flame->solve(0, true);
+  }
+  printf("extinction: oxidizer diluted, Tmax = %.0f K\n",
+         maxTemperature(*flame));
+
+  // Approach the turning point, and then start a new branch. The
+  // parameter is scaled by its value at the start of a branch, and
+  // from the initial mass flux, the change in the parameter would
+  // dominate the arclength.
+  MdotParameter p(left, &right);
+  flame->setContinuationOptions(0.2, 1.0e-5, 0.5);
+  flame->continuation(p, 25.0*mdot0, 400, 0, false);
+  double p1 = p.value();
+  double t1 = maxTemperature(*flame);
+  int nsteps = flame->continuation(p, 100.0*mdot0, 20, 0, false);
+  double t2 = maxTemperature(*flame);
+  const vector_fp& pv = flame->continuationValues();
+
+  // the parameter increases to a maximum, and then decreases
+  int n = int(pv.size());
+  int imax = 0;
+  for (int i = 1; i < n; i++) {
+    if (pv[i] > pv[imax]) imax = i;
+  }
+  bool turned = (nsteps == 20 && imax > 0 && imax < n - 1);
+  for (int i = 1; i < n; i++) {
+    if ((i <= imax && pv[i] <= pv[i-1]) || (i > imax && pv[i] >= pv[i-1]))
+      turned = false;
+  }
+  printf("extinction: turning point passed: %s\n", (turned ? "yes" : "no"));
+  printf("extinction: turning point at mass flux %.1f\n", pv[imax]);
+  printf("extinction: beyond it, lower mass flux and Tmax: %s\n",
+         (p.value() < p1 && t2 < t1 - 100.0 ? "yes" : "no"));
+  delete flame;
+}
+
+// gives access to the diffusive mass fluxes of the flow
+class FluxFlow : public AxiStagnFlow {
+public:
+  FluxFlow(IdealGasPhase* ph) : AxiStagnFlow(ph) {}
+  double diffFlux(int k, int j) const { return flux(k, j); }
+};
+
+// Largest difference between the diffusive mass fluxes at the
+// interior midpoints of the flow and those computed by
+// getSpeciesFluxes from the mole fraction gradients, relative to the
+// largest flux
+static double multiFluxError(Sim1D& flame, FluxFlow& flow, IdealGasMix& gas,
+                             Transport& tr) {
+  vector_fp x, r(flame.size());
+  getSolution(flame, x);
+  flame.OneDim::eval(-1, DATA_PTR(x), DATA_PTR(r), 0.0, 0);
+
+  int nsp = gas.nSpecies();
+  vector_fp y0(nsp), y1(nsp), x0(nsp), x1(nsp), ym(nsp), gradx(nsp), f(nsp);
+  double gradT = 0.0, err = 0.0, fmax = 0.0;
+  const double* xf = DATA_PTR(x) + flow.loc();
+  for (int j = 1; j < flow.nPoints() - 2; j++) {
+    for (int k = 0; k < nsp; k++) {
+      y0[k] = xf[flow.index(4+k, j)];
+      y1[k] = xf[flow.index(4+k, j+1)];
+      ym[k] = 0.5*(y0[k] + y1[k]);
+    }
+    gas.setMassFractions_NoNorm(DATA_PTR(y0));
+    gas.getMoleFractions(DATA_PTR(x0));
+    gas.setMassFractions_NoNorm(DATA_PTR(y1));
+    gas.getMoleFractions(DATA_PTR(x1));
+    double dz = flow.grid(j+1) - flow.grid(j);
+    for (int k = 0; k < nsp; k++) gradx[k] = (x1[k] - x0[k])/dz;
+    gas.setTemperature(0.5*(xf[flow.index(2, j)] + xf[flow.index(2, j+1)]));
+    gas.setMassFractions_NoNorm(DATA_PTR(ym));
+    gas.setPressure(OneAtm);
+    tr.getSpeciesFluxes(1, &gradT, nsp, DATA_PTR(gradx), nsp, DATA_PTR(f));
+    for (int k = 0; k < nsp; k++) {
+      err = fmaxx(err, fabs(f[k] - flow.diffFlux(k, j)));
+      fmax = fmaxx(fmax, fabs(f[k]));
+    }
+  }
+  return err/fmax;
+}
+
+// Largest change of the residual of the current solution caused by
+// evaluating the Jacobian
+static double jacobianSideEffect(Sim1D& flame) {
+  int n = flame.size();
+  vector_fp x, r0(n), r1(n);
+  getSolution(flame, x);
+  flame.OneDim::eval(-1, DATA_PTR(x), DATA_PTR(r0), 0.0, 0);
+  flame.OneDim::jacobian().eval(DATA_PTR(x), DATA_PTR(r0), 0.0);
+  flame.OneDim::eval(-1, DATA_PTR(x), DATA_PTR(r1), 0.0, 0);
+  double d = 0.0;
+  for (int i = 0; i < n; i++) d = fmaxx(d, fabs(r1[i] - r0[i]));
+  return d;
+}
+
+// Solve the flame with multicomponent transport, with the effective
+// diffusion coefficients and with the exact multicomponent fluxes,
+// starting from the mixture-averaged solution
+static void checkMultiTransport(IdealGasMix& gas, Transport& tr) {
+  Transport* trm = newTransportMgr("Multi", &gas);
+  FluxFlow flow(&gas);
+  Inlet1D left, right;
+  Sim1D* flame = 0;
+  solveFlame(gas, tr, mdot0, 0.02, flow, left, right, flame);
+  double tmix = maxTemperature(*flame);
+
+  flow.setTransport(*trm);
+  flame->solve(0, false);
+  printf("multicomponent, effective diffusion coefficients: Tmax = %.0f K\n",
+         maxTemperature(*flame));
+  printf("multicomponent, effective diffusion coefficients: "
+         "residual independent of the Jacobian: %s\n",
+         (jacobianSideEffect(*flame) == 0.0 ? "yes" : "no"));
+
+  flow.enableMultiFluxes();
+  printf("multicomponent fluxes enabled: %s\n",
+         (flow.withMultiFluxes() ? "yes" : "no"));
+  printf("multicomponent fluxes: residual independent of the Jacobian: %s\n",
+         (jacobianSideEffect(*flame) == 0.0 ? "yes" : "no"));
+  flame->solve(0, false);
+  printf("multicomponent fluxes: Tmax = %.0f K\n", maxTemperature(*flame));
+  printf("multicomponent fluxes: equal to getSpeciesFluxes: %s\n",
+         (multiFluxError(*flame, flow, gas, *trm) < 1.0e-10 ? "yes" : "no"));
+
+  // back to mixture-averaged transport, which does not allow the
+  // multicomponent fluxes
+  flow.setTransport(tr);
+  flame->solve(0, false);
+  printf("mixture-averaged again: multicomponent fluxes disabled: %s\n",
+         (flow.withMultiFluxes() ? "no" : "yes"));
+  printf("mixture-averaged again: same Tmax: %s\n",
+         (fabs(maxTemperature(*flame) - tmix) < 0.1 ? "yes" : "no"));
+  delete flame;
+  delete trm;
+}
+
+int main() {
+  try {
+    IdealGasMix gas("h2o2.xml", "ohmech");
+    Transport* tr = newTransportMgr("Mix", &gas);
+
+    AxiStagnFlow flow(&gas);
+    Inlet1D left, right;
+    Sim1D* flame = 0;
+    solveFlame(gas, *tr, mdot0, 0.02, flow, left, right, flame);
+    double t0 = maxTemperature(*flame);
+    printf("initial mass flux %g, Tmax = %.0f K\n", left.mdot(), t0);
+
+    /*
+     * Newton-Krylov method
+     */
+    vector_fp x0, xd;
+    getSolution(*flame, x0);
+    double mdoto = right.mdot();
+    left.setMdot(1.02*mdot0);
+    right.setMdot(1.02*mdoto);
+    flame->solve(0, false);
+    getSolution(*flame, xd);
+
+    flame->setNewtonKrylov(true);
+    checkKrylov(*flame, x0, xd, "default");
+
+    // GMRES cannot converge in a few iterations. The Newton
+    // iteration must then fail, rather than take unconverged steps
+    // indefinitely, and the solver fall back to time stepping.
+    flame->newton().setKrylovOptions(2, 2, 1.0e-6);
+    setSolution(*flame, x0);
+    MultiNewton& newt = flame->newton();
+    int fails = newt.nKrylovFails();
+    try {
+      flame->solve(0, false);
+    }
+    catch (CanteraError) {
+      popError();
+    }
+    printf("Newton-Krylov, 2 GMRES iterations: unconverged steps %s, "
+           "solve returned yes\n", (newt.nKrylovFails() > fails ? "yes" : "no"));
+    printf("Newton-Krylov, 2 GMRES iterations: steady mode restored: %s\n",
+           (flame->rdt() == 0.0 ? "yes" : "no"));
+    flame->setNewtonKrylov(false);
+    flame->newton().setKrylovOptions();
+
+    /*
+     * Jacobian with the transport terms reused
+     */
+    checkTransportAge(*flame, x0, xd);
+
+    left.setMdot(mdot0);
+    right.setMdot(mdoto);
+    setSolution(*flame, x0);
+
+    /*
+     * strain-rate continuation
+     */
+    MdotParameter p(left, &right);
+    double pEnd = 1.5*mdot0;
+    flame->setContinuationOptions(0.05, 1.0e-4, 0.5);
+    int nsteps = flame->continuation(p, pEnd, 100, 0, false);
+    double tc = maxTemperature(*flame);
+    double pc = p.value();
+    const vector_fp& pv = flame->continuationValues();
+    bool monotonic = true;
+    for (size_t i = 1; i < pv.size(); i++) {
+      if (pv[i] <= pv[i-1]) monotonic = false;
+    }
+    printf("increasing: steps taken: %s\n", (nsteps > 1 ? "yes" : "no"));
+    printf("increasing: parameter values stored: %s\n",
+           (int(pv.size()) == nsteps + 1 ? "yes" : "no"));
+    printf("increasing: monotonic: %s\n", (monotonic ? "yes" : "no"));
+    printf("increasing: end reached: %s\n", (pc >= pEnd ? "yes" : "no"));
+    printf("increasing: Tmax decreased: %s\n", (tc < t0 ? "yes" : "no"));
+
+    // solve the initial flame again, which gives the same grid, and
+    // then directly for the final mass fluxes
+    AxiStagnFlow flow2(&gas);
+    Inlet1D left2, right2;
+    Sim1D* flame2 = 0;
+    solveFlame(gas, *tr, mdot0, 0.02, flow2, left2, right2, flame2);
+    left2.setMdot(left.mdot());
+    right2.setMdot(right.mdot());
+    flame2->solve(0, false);
+    double td = maxTemperature(*flame2);
+    printf("Tmax at the final mass flux: continuation %.0f K, direct %.0f K\n",
+           tc, td);
+    printf("agreement within 0.1 K: %s\n", (fabs(tc - td) < 0.1 ? "yes" : "no"));
+
+    // and back down to the initial mass flux
+    nsteps = flame->continuation(p, mdot0, 100, 0, false);
+    double tb = maxTemperature(*flame);
+    printf("decreasing: steps taken: %s\n", (nsteps > 1 ? "yes" : "no"));
+    printf("decreasing: end reached: %s\n",
+           (p.value() <= mdot0 ? "yes" : "no"));
+    printf("Tmax at the initial mass flux: %.0f K\n", tb);
+
+    delete flame;
+    delete flame2;
+
+    /*
+     * continuation past the extinction point
+     */
+    checkExtinction(gas, *tr);
+
+    /*
+     * multicomponent transport
+     */
+    checkMultiTransport(gas, *tr);
+    delete tr;
+  }
+  catch (CanteraError) {
+    showErrors(cout);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,212 @@
+/*
+ * Test of Sim1D::refine and Sim1D::remesh on a hydrogen counterflow
+ * diffusion flame. refine is called with criteria that only add or
+ * only remove points, and its return value is compared with the
+ * change in the number of points. remesh is checked to keep the end
+ * points and end values, and to preserve the integral of each
+ * component over the control volumes of the interior points.
+ */
+#include <cstdio>
+#include <cmath>
+
+#include "Cantera.h"
+#include "IdealGasMix.h"
+#include "equilibrium.h"
+#include "transport.h"
+#include "onedim.h"
+
+using namespace Cantera;
+using namespace std;
+
+static const char* fuel = "H2:1, AR:1";
+static const char* oxidizer = "O2:0.21, AR:0.79";
+
+// maximum temperature in the flow domain
+static double maxTemperature(Sim1D& s) {
+  int np = s.domain(1).nPoints();
+  double t = 0.0;
+  for (int j = 0; j < np; j++) {
+    t = max(t, s.value(1, 2, j));
+  }
+  return t;
+}
+
+// integral from z[0] to zz of the piecewise-linear function with
+// values v at the points z
+static double integral(const vector_fp& z, const vector_fp& v, double zz) {
+  double sum = 0.0;
+  for (size_t j = 0; j + 1 < z.size(); j++) {
+    double dz = z[j+1] - z[j];
+    if (zz >= z[j+1]) {
+      sum += 0.5*(v[j] + v[j+1])*dz;
+    }
+    else {
+      double h = zz - z[j];
+      if (h > 0.0) sum += v[j]*h + 0.5*(v[j+1] - v[j])*h*h/dz;
+      break;
+    }
+  }
+  return sum;
+}
+
+// Remesh the flow domain with npts points, and check the new grid
+// and solution against the old ones.
+static void checkRemesh(Sim1D& flame, Domain1D& flow, int npts) {
+  int np = flow.nPoints();
+  int nc = flow.nComponents();
+  vector_fp z(flow.grid().begin(), flow.grid().end());
+  vector<vector_fp> x(nc, vector_fp(np));
+  double scale = 0.0;
+  int i, j;
+  for (i = 0; i < nc; i++) {
+    for (j = 0; j < np; j++) x[i][j] = flame.value(1, i, j);
+  }
+
+  int ntot = flame.remesh(1, npts);
+  int nn = flow.nPoints();
+  printf("remesh to %d points: returned total %s, flow points %d\n", npts,
+         (ntot == flame.domain(0).nPoints() + nn
+          + flame.domain(2).nPoints() ? "correct" : "wrong"), nn);
+
+  bool increasing = true;
+  for (j = 1; j < nn; j++) {
+    if (flow.grid(j) <= flow.grid(j-1)) increasing = false;
+  }
+  printf("  grid increasing: %s\n", (increasing ? "yes" : "no"));
+  printf("  end points unchanged: %s\n",
+         (flow.grid(0) == z[0] && flow.grid(nn-1) == z[np-1] ? "yes" : "no"));
+
+  bool ends = true;
+  double errmax = 0.0;
+  for (i = 0; i < nc; i++) {
+    if (flame.value(1, i, 0) != x[i][0]
+        || flame.value(1, i, nn-1) != x[i][np-1]) ends = false;
+    scale = 0.0;
+    for (j = 0; j < np; j++) scale = max(scale, fabs(x[i][j]));
+    if (scale == 0.0) continue;
+
+    // the integral over the control volumes of the interior points,
+    // which extend halfway to their neighbors
+    double zlo = 0.5*(flow.grid(0) + flow.grid(1));
+    double zhi = 0.5*(flow.grid(nn-2) + flow.grid(nn-1));
+    double sum = 0.0;
+    for (j = 1; j < nn-1; j++) {
+      double zl = 0.5*(flow.grid(j-1) + flow.grid(j));
+      double zr = 0.5*(flow.grid(j) + flow.grid(j+1));
+      sum += flame.value(1, i, j)*(zr - zl);
+    }
+    double exact = integral(z, x[i], zhi) - integral(z, x[i], zlo);
+    errmax = max(errmax, fabs(sum - exact)/(scale*(z[np-1] - z[0])));
+  }
+  printf("  end values unchanged: %s\n", (ends ? "yes" : "no"));
+  printf("  interior integrals preserved: %s\n",
+         (errmax < 1.0e-12 ? "yes" : "no"));
+}
+
+int main() {
+  try {
+    IdealGasMix gas("h2o2.xml", "ohmech");
+    int nsp = gas.nSpecies();
+    Transport* tr = newTransportMgr("Mix", &gas);
+
+    double T0 = 300.0, mdot = 0.1;
+    vector_fp yf(nsp), yo(nsp), yb(nsp);
+    gas.setState_TPX(T0, OneAtm, fuel);
+    gas.getMassFractions(DATA_PTR(yf));
+    double rhof = gas.density();
+    gas.setState_TPX(T0, OneAtm, oxidizer);
+    gas.getMassFractions(DATA_PTR(yo));
+    double rhoo = gas.density();
+    gas.setState_TPX(T0, OneAtm, "H2:0.42, O2:0.21, AR:1.21");
+    equilibrate(gas, "HP");
+    gas.getMassFractions(DATA_PTR(yb));
+    double Tad = gas.temperature();
+
+    AxiStagnFlow flow(&gas);
+    double z[6];
+    for (int j = 0; j < 6; j++) z[j] = 0.004*j;
+    flow.setupGrid(6, z);
+    flow.setTransport(*tr);
+    flow.setKinetics(gas);
+    flow.setPressure(OneAtm);
+
+    double mdoto = mdot*sqrt(rhoo/rhof);
+    Inlet1D left, right;
+    left.setMoleFractions(fuel);
+    left.setMdot(mdot);
+    left.setTemperature(T0);
+    right.setMoleFractions(oxidizer);
+    right.setMdot(mdoto);
+    right.setTemperature(T0);
+
+    vector<Domain1D*> domains;
+    domains.push_back(&left);
+    domains.push_back(&flow);
+    domains.push_back(&right);
+    Sim1D flame(domains);
+
+    vector_fp locs(3), v(3);
+    locs[0] = 0.0;
+    locs[1] = 0.5;
+    locs[2] = 1.0;
+    v[0] = mdot/rhof;
+    v[1] = 0.0;
+    v[2] = -mdoto/rhoo;
+    flame.setInitialGuess("u", locs, v);
+    v[0] = T0;
+    v[1] = Tad;
+    v[2] = T0;
+    flame.setInitialGuess("T", locs, v);
+    for (int k = 0; k < nsp; k++) {
+      v[0] = yf[k];
+      v[1] = yb[k];
+      v[2] = yo[k];
+      flame.setInitialGuess(gas.speciesName(k), locs, v);
+    }
+    flow.setTolerances(1.0e-5, 1.0e-10);
+    flame.setRefineCriteria(1, 10.0, 0.2, 0.3);
+    flame.solve(0, false);
+    flow.solveEnergyEqn();
+    flame.solve(0, true);
+    double t0 = maxTemperature(flame);
+    int np0 = flow.nPoints();
+    printf("initial solution: Tmax = %.0f K\n", t0);
+
+    // the converged grid already satisfies the criteria
+    int nchange = flame.refine();
+    printf("refine with the same criteria: %d changes\n", nchange);
+
+    // stricter criteria only add points
+    int np = flow.nPoints();
+    flame.setRefineCriteria(1, 10.0, 0.1, 0.2);
+    nchange = flame.refine();
+    printf("refine with stricter criteria: points added %s, "
+           "return value %s\n", (flow.nPoints() > np ? "yes" : "no"),
+           (nchange == flow.nPoints() - np ? "correct" : "wrong"));
+    flame.solve(0, false);
+
+    // looser criteria with pruning only remove points
+    np = flow.nPoints();
+    flame.setRefineCriteria(1, 10.0, 0.4, 0.6, 0.5);
+    nchange = flame.refine();
+    printf("refine with pruning: points removed %s, "
+           "return value %s\n", (flow.nPoints() < np ? "yes" : "no"),
+           (nchange == np - flow.nPoints() ? "correct" : "wrong"));
+    flame.solve(0, false);
+
+    // remesh with the same number of points, and with fewer points
+    flame.setRefineCriteria(1, 10.0, 0.2, 0.3);
+    checkRemesh(flame, flow, np0);
+    flame.solve(0, true);
+    double t1 = maxTemperature(flame);
+    printf("after remesh and solve: Tmax within 1%%: %s\n",
+           (fabs(t1 - t0) < 0.01*t0 ? "yes" : "no"));
+    checkRemesh(flame, flow, np0/2);
+    delete tr;
+  }
+  catch (CanteraError) {
+    showErrors(cout);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,166 @@
+/**
+ *  @file gasStates.cpp
+ *
+ *  Test of IdealGasPhase::setStates_HP() and setStates_UV(), which
+ *  find the temperatures of many states at once. The temperatures
+ *  are compared with those of the states the enthalpies and internal
+ *  energies were computed from, and with those found by the scalar
+ *  methods setState_HP() and setState_UV(), with and without initial
+ *  guesses, for a phase whose species all use NASA polynomials
+ *  (NasaThermo::updateMixture) and for one that also has species with
+ *  9-coefficient polynomials (the SpeciesThermo::updateMixture
+ *  fallback).
+ */
+
+#include "Cantera.h"
+#include "IdealGasMix.h"
+
+#include <cstdio>
+#include <cmath>
+
+using namespace std;
+#include "kernel/NasaThermo.h"
+
+using namespace Cantera;
+using namespace Cantera_CXX;
+
+static void check(string what, double err, double tol) {
+  printf("%-60s %s\n", what.c_str(), (err < tol ? "yes" : "no"));
+  if (err >= tol) {
+    printf("     error = %g, tolerance = %g\n", err, tol);
+  }
+}
+
+/*
+ * Fill T, P and Y with n states at temperatures from 300 K to 3000 K,
+ * with mass fractions that do not sum to one
+ */
+static void makeStates(IdealGasMix& gas, int n, vector_fp& T, vector_fp& P,
+		       vector_fp& Y) {
+  int nsp = gas.nSpecies();
+  T.resize(n);
+  P.resize(n);
+  Y.resize(n*nsp);
+  const char* comps[] = {"CH4:1, O2:2, N2:7.52",
+			 "H2:2, O2:1, AR:4",
+			 "CO2:1, H2O:2, N2:7.52, OH:0.1, H:0.05",
+			 "H2:1, H:0.5, O:0.5, OH:0.5, AR:1"};
+  for (int i = 0; i < n; i++) {
+    T[i] = 300.0 + 2700.0*i/(n - 1);
+    P[i] = OneAtm*(0.1 + 0.7*i);
+    gas.setState_TPX(T[i], P[i], comps[i % 4]);
+    gas.getMassFractions(DATA_PTR(Y) + i*nsp);
+    double scale = 0.5 + 0.25*(i % 5);
+    for (int k = 0; k < nsp; k++) Y[i*nsp + k] *= scale;
+  }
+}
+
+/*
+ * Compare the batch and scalar solutions for the states made by
+ * makeStates.
+ */
+static void testPhase(IdealGasMix& gas, string name) {
+  int n = 25;
+  int nsp = gas.nSpecies();
+  vector_fp T, P, Y;
+  makeStates(gas, n, T, P, Y);
+
+  // target enthalpies, internal energies and specific volumes
+  vector_fp h(n), u(n), v(n);
+  for (int i = 0; i < n; i++) {
+    gas.setState_TPY(T[i], P[i], DATA_PTR(Y) + i*nsp);
+    h[i] = gas.enthalpy_mass();
+    u[i] = gas.intEnergy_mass();
+    v[i] = 1.0/gas.density();
+  }
+
+  // scalar solutions, each starting from 1000 K
+  vector_fp Ths(n), Tuvs(n);
+  for (int i = 0; i < n; i++) {
+    gas.setState_TPY(1000.0, P[i], DATA_PTR(Y) + i*nsp);
+    gas.setState_HP(h[i], P[i]);
+    Ths[i] = gas.temperature();
+    gas.setState_TRY(1000.0, 1.0/v[i], DATA_PTR(Y) + i*nsp);
+    gas.setState_UV(u[i], v[i]);
+    Tuvs[i] = gas.temperature();
+  }
+
+  // guesses close to the solution, and guesses outside the
+  // temperature range of the species
+  vector_fp Tnear(n), Tout(n);
+  for (int i = 0; i < n; i++) {
+    Tnear[i] = T[i] + (i % 2 ? 50.0 : -50.0);
+    Tout[i] = (i % 2 ? 1.0E5 : 1.0);
+  }
+  const char* gnames[] = {"no guess", "close guesses", "out-of-range guesses"};
+  const double* guesses[] = {0, DATA_PTR(Tnear), DATA_PTR(Tout)};
+
+  for (int g = 0; g < 3; g++) {
+    vector_fp Tb(n);
+    double errT = 0.0, errS = 0.0;
+    gas.setState_TP(1000.0, OneAtm);
+    gas.setStates_HP(n, DATA_PTR(h), DATA_PTR(P), DATA_PTR(Y), DATA_PTR(Tb),
+		     guesses[g]);
+    for (int i = 0; i < n; i++) {
+      errT = fmaxx(errT, fabs(Tb[i] - T[i]));
+      errS = fmaxx(errS, fabs(Tb[i] - Ths[i]));
+    }
+    // the phase is left in the last state
+    double errLast = fabs(gas.temperature() - T[n-1])
+      + fabs(gas.pressure() - P[n-1])/P[n-1];
+    check(name + ", HP, " + gnames[g] + ":", errT, 1.0E-3);
+    check(name + ", HP, " + gnames[g] + ", same as setState_HP:",
+	  errS, 1.0E-3);
+    check(name + ", HP, " + gnames[g] + ", last state set:", errLast, 1.0E-3);
+
+    errT = 0.0;
+    errS = 0.0;
+    gas.setState_TP(1000.0, OneAtm);
+    gas.setStates_UV(n, DATA_PTR(u), DATA_PTR(v), DATA_PTR(Y), DATA_PTR(Tb),
+		     guesses[g]);
+    for (int i = 0; i < n; i++) {
+      errT = fmaxx(errT, fabs(Tb[i] - T[i]));
+      errS = fmaxx(errS, fabs(Tb[i] - Tuvs[i]));
+    }
+    errLast = fabs(gas.temperature() - T[n-1])
+      + fabs(1.0/gas.density() - v[n-1])/v[n-1];
+    check(name + ", UV, " + gnames[g] + ":", errT, 1.0E-3);
+    check(name + ", UV, " + gnames[g] + ", same as setState_UV:",
+	  errS, 1.0E-3);
+    check(name + ", UV, " + gnames[g] + ", last state set:", errLast, 1.0E-3);
+  }
+
+  // a non-positive pressure is an error
+  P[3] = 0.0;
+  vector_fp Tb(n);
+  bool thrown = false;
+  try {
+    gas.setStates_HP(n, DATA_PTR(h), DATA_PTR(P), DATA_PTR(Y), DATA_PTR(Tb));
+  }
+  catch (CanteraError) {
+    popError();
+    thrown = true;
+  }
+  check(name + ", zero pressure rejected:", thrown ? 0.0 : 1.0, 0.5);
+}
+
+int main(int argc, char** argv) {
+  try {
+    IdealGasMix gri("gri30.xml", "gri30");
+    IdealGasMix nasa9("gasNASA9.xml", "gri30_mix");
+    bool types = dynamic_cast<NasaThermo*>(&gri.speciesThermo()) != 0
+      && dynamic_cast<NasaThermo*>(&nasa9.speciesThermo()) == 0;
+    check("Species thermo managers NasaThermo and another:",
+	  types ? 0.0 : 1.0, 0.5);
+
+    testPhase(gri, "NASA");
+    testPhase(nasa9, "NASA + NASA9");
+
+    appdelete();
+  }
+  catch (CanteraError) {
+    showErrors(cout);
+    return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,83 @@
+/**
+ *  @file mechReduce.cpp
+ *
+ *  Reduces the H2/O2 mechanism with DRGEP at a fixed threshold,
+ *  writes the skeletal mechanism with
+ *  MechanismReducer::writeSkeletalMechanism(), and reloads it. The
+ *  phase of the detailed mechanism declares its species with
+ *  <speciesArray>all</speciesArray>.
+ */
+
+#include "Cantera.h"
+#include "kinetics.h"
+
+#include <cstdio>
+
+using namespace std;
+using namespace Cantera;
+
+int main(int argc, char** argv) {
+  int k, n;
+  try {
+    XML_Node* xc = get_XML_File("h2o2_all.xml");
+    XML_Node* xp = xc->findID("ohmech");
+    ThermoPhase* gas = newPhase(*xp);
+    vector<ThermoPhase*> phases(1, gas);
+    Kinetics* kin = newKineticsMgr(*xp, phases);
+    printf("Detailed mechanism: %d species, %d reactions\n",
+	   gas->nSpecies(), kin->nReactions());
+
+    /*
+     * Samples at a few temperatures for an H2/O2/Ar mixture with
+     * small amounts of radicals
+     */
+    MechanismReducer red(*kin, DRGEP);
+    red.addTarget("H2");
+    red.addTarget("O2");
+    double T[3] = {1000.0, 1300.0, 1600.0};
+    for (n = 0; n < 3; n++) {
+      gas->setState_TPX(T[n], OneAtm,
+	"H2:2, O2:1, AR:5, H2O:0.1, H:0.001, O:0.001, OH:0.001");
+      red.addSample();
+    }
+
+    vector_int species, rxns;
+    double eps = 0.05;
+    red.getSpecies(eps, species);
+    red.getReactions(species, rxns);
+    printf("Skeletal mechanism for threshold %g: %d species, %d reactions\n",
+	   eps, (int) species.size(), (int) rxns.size());
+    printf("Species:");
+    for (k = 0; k < (int) species.size(); k++) {
+      printf(" %s", gas->speciesName(species[k]).c_str());
+    }
+    printf("\n");
+
+    /*
+     * Write the skeletal mechanism and load it again
+     */
+    red.writeSkeletalMechanism(*xp, species, "h2o2_skeletal.xml");
+    XML_Node* xs = get_XML_File("h2o2_skeletal.xml");
+    ThermoPhase* sgas;
+    Kinetics* skin;
+    newSkeletalMechanism(*xs, sgas, skin);
+    printf("Reloaded skeletal mechanism: %d species, %d reactions\n",
+	   sgas->nSpecies(), skin->nReactions());
+    printf("Species:");
+    for (k = 0; k < sgas->nSpecies(); k++) {
+      printf(" %s", sgas->speciesName(k).c_str());
+    }
+    printf("\n");
+
+    delete skin;
+    delete sgas;
+    delete kin;
+    delete gas;
+    appdelete();
+  }
+  catch (CanteraError) {
+    showErrors(cout);
+    return -1;
+  }
+  return 0;
+}
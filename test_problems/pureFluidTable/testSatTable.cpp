@@ -0,0 +1,163 @@
+/*
+ *  testSatTable.cpp
+ *
+ *  Compares the tabulated saturation properties of PureFluidPhase
+ *  (setTabulated()) with the exact tpx iteration: the saturation
+ *  pressure and temperature, dPsat/dT, and the densities of the
+ *  saturated liquid and vapor, at temperatures between the table
+ *  nodes. It also checks that a table written to a cache file is read
+ *  back instead of being regenerated.
+ */
+#include "PureFluid.h"
+#include "../../ext/tpx/Sub.h"
+
+#include <cstdio>
+#include <cmath>
+#include <fstream>
+
+using namespace std;
+using namespace Cantera;
+
+static void check(string what, double err, double tol) {
+  printf("%-50s %s\n", what.c_str(), (err <= tol ? "yes" : "no"));
+  if (err > tol) {
+    printf("     error = %g, tolerance = %g\n", err, tol);
+  }
+}
+
+static PureFluidPhase* newFluid(XML_Node* xc, string id) {
+  XML_Node* const xs = xc->findNameID("phase", id);
+  return dynamic_cast<PureFluidPhase*>(newPhase(*xs));
+}
+
+/*
+ * Saturation properties at temperature T: Psat, dPsat/dT and the
+ * densities of the saturated liquid and vapor
+ */
+static void satProps(PureFluidPhase* f, double T, double* prop) {
+  f->setState_Tsat(T, 0.0);
+  prop[0] = f->satPressure(T);
+  prop[1] = f->TPX_Substance().dPsdT();
+  prop[2] = f->density();
+  f->setState_Tsat(T, 1.0);
+  prop[3] = f->density();
+}
+
+/*
+ * Compare the tabulated and the exact saturation properties of one
+ * fluid at temperatures between the table nodes, from trlow times
+ * the critical temperature to 0.95 times the critical temperature
+ */
+static void compareFluid(XML_Node* xc, string id, double trlow) {
+  PureFluidPhase* ex = newFluid(xc, id);
+  PureFluidPhase* tab = newFluid(xc, id);
+  tab->setTabulated(true);
+  double err = tab->tabulationError();
+  printf("%s: tabulation error = %s\n", id.c_str(),
+	 (err > 0.0 && err < 1.0E-5 ? "below 1e-5" : "out of range"));
+
+  double Tc = ex->critTemperature();
+  double pe[4], pt[4];
+  double errP = 0.0, errRho = 0.0, errDP = 0.0, errT = 0.0;
+  int n = 37;
+  for (int i = 0; i < n; i++) {
+    double T = Tc * (trlow + (0.95 - trlow) * (i + 0.37) / n);
+    satProps(ex, T, pe);
+    satProps(tab, T, pt);
+    /*
+     * Exact dPsat/dT from a fourth order central difference. The
+     * one-sided difference of Substance::dPsdT() in exact mode is
+     * dominated by the convergence noise of the saturation pressure.
+     */
+    double dT = 1.0E-3 * T;
+    pe[1] = (8.0 * (ex->satPressure(T + dT) - ex->satPressure(T - dT))
+	     - (ex->satPressure(T + 2.0*dT) - ex->satPressure(T - 2.0*dT)))
+      / (12.0 * dT);
+    errP = fmaxx(errP, fabs(pt[0] - pe[0]) / pe[0]);
+    errDP = fmaxx(errDP, fabs(pt[1] - pe[1]) / pe[1]);
+    errRho = fmaxx(errRho, fabs(pt[2] - pe[2]) / pe[2]);
+    errRho = fmaxx(errRho, fabs(pt[3] - pe[3]) / pe[3]);
+    /*
+     * The saturation temperature at the exact saturation pressure.
+     * Its relative error is that of Psat divided by dln(Psat)/dln(T).
+     */
+    double Ts = tab->satTemperature(pe[0]);
+    errT = fmaxx(errT, fabs(Ts - T) / T);
+  }
+  check(id + ", Psat:", errP, err);
+  check(id + ", liquid and vapor densities:", errRho, err);
+  check(id + ", Tsat:", errT, err);
+  /*
+   * The derivative of the spline is about an order of magnitude less
+   * accurate than its values, and the difference quotient carries the
+   * convergence noise of the exact saturation pressure.
+   */
+  check(id + ", dPsat/dT:", errDP, 20.0 * err);
+  delete ex;
+  delete tab;
+}
+
+int main () {
+  try {
+    XML_Node* xc = get_XML_File("liquidvapor.xml");
+    compareFluid(xc, "water", 0.45);
+    compareFluid(xc, "nitrogen", 0.55);
+    compareFluid(xc, "carbondioxide", 0.72);
+
+    /*
+     * Generate a table and write it to a cache file, then mark the
+     * error bounds in the file so that a table read back from it can
+     * be told apart from a regenerated one.
+     */
+    string cache = "water_sat.tab";
+    remove(cache.c_str());
+    PureFluidPhase* w1 = newFluid(xc, "water");
+    w1->setTabulated(true, 200, cache);
+
+    ifstream fin(cache.c_str());
+    string header, line, rest;
+    getline(fin, header);
+    getline(fin, line);
+    while (getline(fin, line)) {
+      rest += line + "\n";
+    }
+    fin.close();
+    ofstream fout(cache.c_str());
+    fout << header << "\n" << "0.001 0.001 0.001\n" << rest;
+    fout.close();
+
+    PureFluidPhase* w2 = newFluid(xc, "water");
+    w2->setTabulated(true, 200, cache);
+    check("Table read from the cache file:",
+	  fabs(w2->tabulationError() - 0.001), 0.0);
+    double p1[4], p2[4], errMax = 0.0;
+    double Tc = w1->critTemperature();
+    for (int i = 0; i < 10; i++) {
+      double T = Tc * (0.5 + 0.045 * i + 0.013);
+      satProps(w1, T, p1);
+      satProps(w2, T, p2);
+      for (int j = 0; j < 4; j++) {
+	errMax = fmaxx(errMax, fabs(p2[j] - p1[j]) / fabs(p1[j]));
+      }
+    }
+    check("Cached table equal to the generated table:", errMax, 1.0E-12);
+
+    /*
+     * A table for a different number of nodes is regenerated
+     */
+    PureFluidPhase* w3 = newFluid(xc, "water");
+    w3->setTabulated(true, 150, cache);
+    check("Table with a different grid regenerated:",
+	  fabs(w3->tabulationError() - 0.001) > 1.0E-6 ? 0.0 : 1.0, 0.0);
+    delete w1;
+    delete w2;
+    delete w3;
+    remove(cache.c_str());
+
+    appdelete();
+  } catch (CanteraError) {
+    showErrors(cout);
+    return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,138 @@
+#
+# Tests the in-place ('out') array methods and the methods that
+# evaluate properties and rates for arrays of states
+# (propertyForStates, ratesForStates) against the single-state
+# methods.
+#
+from Cantera import *
+import _cantera
+
+def check(what, ok):
+    if ok:
+        print '%-55s yes' % what
+    else:
+        print '%-55s no' % what
+
+def maxdiff(a, b):
+    """Largest difference between two sequences, relative to the
+    largest magnitude in 'b'."""
+    d = 0.0
+    bmax = 1.0e-300
+    for i in range(len(b)):
+        d = max(d, abs(a[i] - b[i]))
+        bmax = max(bmax, abs(b[i]))
+    return d/bmax
+
+gas = importPhase('gri30.cti')
+nsp = gas.nSpecies()
+
+# states: T, P and unnormalized mass fractions
+comps = ['CH4:1, O2:2, N2:7.52', 'H2:2, O2:1, AR:3',
+         'CH4:1, O2:2, N2:7.52, H2O:1, CO2:0.5, OH:0.01, H:0.01']
+temps = [900.0, 1300.0, 1800.0, 2200.0]
+t = []
+p = []
+yy = []
+for i in range(len(temps)):
+    gas.set(T = temps[i], P = (i+1)*OneAtm, X = comps[i % len(comps)])
+    t.append(temps[i])
+    p.append((i+1)*OneAtm)
+    yy.append(list(gas.massFractions()))
+n = len(t)
+y = array(yy, 'd')
+
+# the state that the array methods must leave unchanged
+gas.set(T = 1000.0, P = OneAtm, X = 'H2:1, O2:1, N2:3')
+t0 = gas.temperature()
+rho0 = gas.density()
+y0 = gas.massFractions()
+
+def stateUnchanged():
+    return (gas.temperature() == t0 and gas.density() == rho0
+            and maxdiff(gas.massFractions(), y0) == 0.0)
+
+##################################################################
+# in-place output arrays
+##################################################################
+
+x = zeros(nsp, 'd')
+xr = gas.moleFractions(out = x)
+check('moleFractions fills the output array:',
+      xr is x and maxdiff(x, gas.moleFractions()) == 0.0)
+
+ym = zeros(nsp, 'd')
+gas.massFractions(out = ym)
+check('massFractions fills the output array:',
+      maxdiff(ym, gas.massFractions()) == 0.0)
+
+w = zeros(nsp, 'd')
+wr = gas.netProductionRates(out = w)
+check('netProductionRates fills the output array:',
+      wr is w and maxdiff(w, gas.netProductionRates()) == 0.0)
+
+q = zeros(gas.nReactions(), 'd')
+gas.netRatesOfProgress(out = q)
+check('netRatesOfProgress fills the output array:',
+      maxdiff(q, gas.netRatesOfProgress()) == 0.0)
+
+try:
+    gas.moleFractions(out = zeros(nsp+1, 'd'))
+    check('Output array of the wrong size rejected:', 0)
+except _cantera.error:
+    check('Output array of the wrong size rejected:', 1)
+
+##################################################################
+# properties for arrays of states
+##################################################################
+
+for name in ['enthalpy_mass', 'cp_mole', 'entropy_mass', 'gibbs_mole']:
+    v = gas.propertyForStates(name, t, p, y)
+    unchanged = stateUnchanged()
+    vs = zeros(n, 'd')
+    for i in range(n):
+        gas.setState_TPY(t[i], p[i], y[i])
+        vs[i] = getattr(gas, name)()
+    gas.setState_TRY(t0, rho0, y0)
+    check('propertyForStates(\'%s\'):' % name,
+          len(v) == n and maxdiff(v, vs) < 1.0e-12 and unchanged)
+
+h = zeros(n, 'd')
+hr = gas.propertyForStates('cp_mass', t, p, y, out = h)
+hs = gas.propertyForStates('cp_mass', t, p, y)
+check('propertyForStates fills the output array:',
+      hr is h and maxdiff(h, hs) == 0.0)
+
+try:
+    _cantera.thermo_getfp_states(gas._phase_id, 999, t, p, y)
+    check('Unknown property reported:', 0)
+except _cantera.error, e:
+    check('Unknown property reported:',
+          str(e) == 'Unknown floating-point attribute')
+
+##################################################################
+# rates for arrays of states
+##################################################################
+
+for name in ['netProductionRates', 'netRatesOfProgress', 'creationRates']:
+    r = gas.ratesForStates(name, t, p, y)
+    unchanged = stateUnchanged()
+    err = 0.0
+    for i in range(n):
+        gas.setState_TPY(t[i], p[i], y[i])
+        err = max(err, maxdiff(r[i], getattr(gas, name)()))
+    gas.setState_TRY(t0, rho0, y0)
+    check('ratesForStates(\'%s\'):' % name, err < 1.0e-12 and unchanged)
+
+wa = zeros((n, nsp), 'd')
+war = gas.ratesForStates('netProductionRates', t, p, y, out = wa)
+was = gas.ratesForStates('netProductionRates', t, p, y)
+err = 0.0
+for i in range(n):
+    err = max(err, maxdiff(wa[i], was[i]))
+check('ratesForStates fills the output array:', war is wa and err == 0.0)
+
+try:
+    gas.ratesForStates('netProductionRates', t, p[:n-1], y)
+    check('Inconsistent state arrays rejected:', 0)
+except _cantera.error:
+    check('Inconsistent state arrays rejected:', 1)
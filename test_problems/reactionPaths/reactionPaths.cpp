@@ -0,0 +1,142 @@
+/**
+ *  @file reactionPaths.cpp
+ *
+ *  Test of ReactionPathBuilder. The diagram of carbon fluxes built for
+ *  a partially burned methane/air mixture is written in dot format,
+ *  and the one-way fluxes returned by getPathFluxes() for several
+ *  states at once are compared with the flows of the paths of the
+ *  diagrams built by build() for each state, for each element.
+ */
+
+#include "Cantera.h"
+#include "IdealGasMix.h"
+#include "reactionpaths.h"
+
+#include <cstdio>
+#include <cmath>
+#include <sstream>
+
+using namespace std;
+using namespace Cantera;
+using namespace Cantera_CXX;
+
+static void check(string what, double err, double tol) {
+  printf("%-55s %s\n", what.c_str(), (err < tol ? "yes" : "no"));
+  if (err >= tol) {
+    printf("     error = %g, tolerance = %g\n", err, tol);
+  }
+}
+
+/*
+ * Set the gas to state n of a series of partially burned methane/air
+ * mixtures at temperatures from 1200 K to 2100 K
+ */
+static void setState(IdealGasMix& gas, int n) {
+  char x[200];
+  double b = 0.2*n;
+  sprintf(x, "CH4:%g, O2:%g, N2:7.52, CO:%g, CO2:%g, H2O:%g, H2:0.05, "
+	  "H:0.01, O:0.005, OH:0.02, CH3:0.002, CH2O:0.001, HCO:1.0e-4, "
+	  "NO:1.0e-3, NH:1.0e-5",
+	  1.0 - b, 2.0 - 1.5*b, 0.5*b, 0.5*b, 2.0*b);
+  gas.setState_TPX(1200.0 + 300.0*n, OneAtm, x);
+}
+
+int main(int argc, char** argv) {
+  try {
+    IdealGasMix gas("gri30.xml", "gri30");
+    int nr = gas.nReactions();
+
+    ReactionPathBuilder builder;
+    ostringstream initlog;
+    setState(gas, 0);
+    builder.init(initlog, gas);
+
+    /*
+     * Diagram of carbon fluxes for the first state
+     */
+    ReactionPathDiagram d;
+    d.title = "carbon reaction paths";
+    builder.build(gas, "C", cout, d);
+    d.exportToDot(cout);
+
+    /*
+     * Batch fluxes for all states, compared with the diagrams
+     */
+    int nStates = 4;
+    vector_fp ropf(nStates*nr), ropr(nStates*nr);
+    for (int j = 0; j < nStates; j++) {
+      setState(gas, j);
+      gas.getFwdRatesOfProgress(DATA_PTR(ropf) + j*nr);
+      gas.getRevRatesOfProgress(DATA_PTR(ropr) + j*nr);
+    }
+
+    const char* elements[] = {"C", "H", "O", "N"};
+    for (int m = 0; m < 4; m++) {
+      string el = elements[m];
+      int np = builder.nFluxPaths(el);
+      vector_fp flux(nStates*np);
+      int ok = builder.getPathFluxes(el, nStates, DATA_PTR(ropf),
+				     DATA_PTR(ropr), DATA_PTR(flux));
+
+      // each path connects a different pair of species
+      double dup = 0.0;
+      map<pair<int, int>, int> seen;
+      for (int n = 0; n < np; n++) {
+	int kFrom, kTo;
+	builder.getFluxPath(el, n, kFrom, kTo);
+	if (seen[make_pair(kFrom, kTo)]++ || kFrom == kTo) dup = 1.0;
+      }
+
+      double err = 0.0, missing = 0.0;
+      for (int j = 0; j < nStates; j++) {
+	setState(gas, j);
+	ReactionPathDiagram dj;
+	builder.build(gas, el, cout, dj, true);
+	double total = 0.0;
+	for (int n = 0; n < np; n++) {
+	  int kFrom, kTo;
+	  builder.getFluxPath(el, n, kFrom, kTo);
+	  double f = flux[j*np + n];
+	  err = fmaxx(err, fabs(f - dj.flow(kFrom, kTo))
+		      /(dj.maxFlow() + 1.0e-300));
+	  total += f;
+	}
+	// no flow in the diagram is missed by the paths
+	double dtotal = 0.0;
+	for (int i = 0; i < dj.nPaths(); i++) {
+	  dtotal += dj.path(i)->flow();
+	}
+	missing = fmaxx(missing, fabs(dtotal - total)/(dtotal + 1.0e-300));
+      }
+      printf("%s: paths %s\n", el.c_str(), (np > 0 ? "found" : "missing"));
+      check(el + ": getPathFluxes returns 1:", ok == 1 ? 0.0 : 1.0, 0.5);
+      check(el + ": paths connect distinct species:", dup, 0.5);
+      check(el + ": fluxes equal the diagram flows:", err, 1.0E-12);
+      check(el + ": all diagram flows accounted for:", missing, 1.0E-12);
+    }
+
+    // unknown elements
+    double flux[1];
+    bool unknown = builder.nFluxPaths("Xx") == -1
+      && builder.getPathFluxes("Xx", 1, DATA_PTR(ropf), DATA_PTR(ropr),
+			       flux) == -1;
+    bool thrown = false;
+    try {
+      int kFrom, kTo;
+      builder.getFluxPath("C", builder.nFluxPaths("C"), kFrom, kTo);
+    }
+    catch (CanteraError) {
+      popError();
+      thrown = true;
+    }
+    check("Unknown element reported:", unknown ? 0.0 : 1.0, 0.5);
+    check("Unknown path number throws:", thrown ? 0.0 : 1.0, 0.5);
+
+    appdelete();
+  }
+  catch (CanteraError) {
+    showErrors(cout);
+    return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,230 @@
+/*
+ * Test of SolutionStore, the binary file format used by Sim1D::save
+ * and Sim1D::restore for files with extension '.ctsol'. Solutions of
+ * a counterflow flame are saved to a solution store and to a CTML
+ * file, and restored from both. The store is converted to and from
+ * CTML, and a store whose last record has been truncated is opened
+ * and added to.
+ */
+#include <cstdio>
+#include <cmath>
+#include <fstream>
+
+#include "Cantera.h"
+#include "IdealGasMix.h"
+#include "transport.h"
+#include "onedim.h"
+#include "kernel/SolutionStore.h"
+
+using namespace Cantera;
+using namespace std;
+
+static void check(string what, bool ok) {
+  printf("%-55s %s\n", what.c_str(), (ok ? "yes" : "no"));
+}
+
+// largest difference between two solutions, relative to the
+// magnitude of each component
+static double maxDiff(const vector_fp& a, const vector_fp& b) {
+  if (a.size() != b.size()) return 1.0;
+  double d = 0.0;
+  for (size_t i = 0; i < a.size(); i++) {
+    d = max(d, fabs(a[i] - b[i])/(fabs(b[i]) + 1.0e-20));
+  }
+  return d;
+}
+
+static void getSolution(Sim1D& s, vector_fp& x) {
+  const doublereal* xs = s.solution();
+  x.assign(xs, xs + s.size());
+}
+
+static long fileSize(string fname) {
+  ifstream f(fname.c_str(), ios::in | ios::binary);
+  f.seekg(0, ios::end);
+  return f.tellg();
+}
+
+// copy the first n bytes of file src to file dest
+static void copyFile(string src, string dest, long n) {
+  string buf(n, ' ');
+  ifstream f(src.c_str(), ios::in | ios::binary);
+  f.read(&buf[0], n);
+  ofstream s(dest.c_str(), ios::out | ios::binary);
+  s.write(buf.data(), n);
+}
+
+// Restore solution id from file fname, and return it in x
+static void restore(Sim1D& s, string fname, string id, vector_fp& x) {
+  s.restore(fname, id);
+  getSolution(s, x);
+}
+
+int main() {
+  try {
+    remove("flame.ctsol");
+    remove("flame.xml");
+    remove("exported.xml");
+    remove("imported.ctsol");
+    remove("truncated.ctsol");
+
+    IdealGasMix gas("h2o2.xml", "ohmech");
+    int nsp = gas.nSpecies();
+
+    // A flame with an initial guess on a fine grid, so that the
+    // records are larger than a page of memory.
+    AxiStagnFlow flow(&gas);
+    int np = 60;
+    vector_fp z(np);
+    for (int j = 0; j < np; j++) z[j] = 0.02*j/(np - 1);
+    flow.setupGrid(np, DATA_PTR(z));
+    flow.setPressure(OneAtm);
+    Inlet1D left, right;
+    left.setMoleFractions("H2:1, AR:1");
+    left.setMdot(0.1);
+    left.setTemperature(300.0);
+    right.setMoleFractions("O2:0.21, AR:0.79");
+    right.setMdot(0.4);
+    right.setTemperature(300.0);
+    left.setID("fuel");
+    flow.setID("flow");
+    right.setID("oxidizer");
+    vector<Domain1D*> domains;
+    domains.push_back(&left);
+    domains.push_back(&flow);
+    domains.push_back(&right);
+    Sim1D flame(domains);
+
+    vector_fp locs(3), v(3);
+    locs[0] = 0.0;
+    locs[1] = 0.5;
+    locs[2] = 1.0;
+    v[0] = 0.1;
+    v[1] = 0.0;
+    v[2] = -0.3;
+    flame.setInitialGuess("u", locs, v);
+    for (int k = 0; k < nsp; k++) {
+      v[0] = (gas.speciesName(k) == "H2" ? 0.5 : 0.0);
+      v[1] = 0.01*(k+1);
+      v[2] = (gas.speciesName(k) == "O2" ? 0.2 : 0.0);
+      flame.setInitialGuess(gas.speciesName(k), locs, v);
+    }
+
+    // three solutions, which differ in temperature, saved to a
+    // solution store and to a CTML file with the same IDs
+    const char* ids[] = {"flame", "flame", "cool"};
+    double tmax[] = {2000.0, 2200.0, 1500.0};
+    vector<vector_fp> saved(3);
+    for (int i = 0; i < 3; i++) {
+      v[0] = 300.0;
+      v[1] = tmax[i];
+      v[2] = 300.0;
+      flame.setInitialGuess("T", locs, v);
+      getSolution(flame, saved[i]);
+      flame.save("flame.ctsol", ids[i], "test solution");
+      flame.save("flame.xml", ids[i], "test solution");
+    }
+
+    check("Solution store recognized:",
+          SolutionStore::isStore("flame.ctsol")
+          && !SolutionStore::isStore("flame.xml")
+          && SolutionStore::isStore("new.ctsol"));
+
+    SolutionStore store("flame.ctsol");
+    check("Three solutions saved:", store.nSolutions() == 3);
+    check("Duplicate ID replaced by a unique one:",
+          store.nSolutions() == 3 && store.ids()[0] == "flame"
+          && store.ids()[1] == "flame_1" && store.ids()[2] == "cool");
+    check("uniqueID:",
+          store.uniqueID("flame") == "flame_2"
+          && store.uniqueID("cool") == "cool_1"
+          && store.uniqueID("hot") == "hot");
+
+    // restore each solution from both files
+    Sim1D flame2(domains);
+    const char* sids[] = {"flame", "flame_1", "cool"};
+    double dstore = 0.0, dboth = 0.0;
+    for (int i = 0; i < 3; i++) {
+      vector_fp xs, xc;
+      restore(flame2, "flame.ctsol", sids[i], xs);
+      restore(flame2, "flame.xml", sids[i], xc);
+      dstore = max(dstore, maxDiff(xs, saved[i]));
+      dboth = max(dboth, maxDiff(xs, xc));
+    }
+    check("Solutions restored from the store:", dstore < 1.0e-8);
+    check("Same solutions restored from the store and CTML:", dboth == 0.0);
+
+    // reading a single record
+    XML_Node root("doc");
+    XML_Node& sim = store.read("flame_1", root);
+    check("read returns a 'simulation' node:",
+          sim.name() == "simulation" && sim["id"] == "flame_1"
+          && sim.findID(flow.id()) != 0);
+
+    // errors
+    bool thrown = false;
+    try {
+      XML_Node dup("simulation");
+      dup.addAttribute("id", "cool");
+      store.add(dup);
+    }
+    catch (CanteraError) {
+      popError();
+      thrown = true;
+    }
+    check("Adding a duplicate ID throws:", thrown);
+    thrown = false;
+    try {
+      store.read("hot", root);
+    }
+    catch (CanteraError) {
+      popError();
+      thrown = true;
+    }
+    check("Reading an unknown ID throws:", thrown);
+
+    // conversion to and from CTML
+    int nexp = SolutionStore::exportCTML("flame.ctsol", "exported.xml");
+    int nimp = SolutionStore::importCTML("flame.xml", "imported.ctsol");
+    SolutionStore imported("imported.ctsol");
+    double dexp = 0.0, dimp = 0.0;
+    for (int i = 0; i < 3; i++) {
+      vector_fp xs, xe, xi;
+      restore(flame2, "flame.ctsol", sids[i], xs);
+      restore(flame2, "exported.xml", sids[i], xe);
+      restore(flame2, "imported.ctsol", sids[i], xi);
+      dexp = max(dexp, maxDiff(xe, xs));
+      dimp = max(dimp, maxDiff(xi, xs));
+    }
+    check("exportCTML writes all solutions:", nexp == 3 && dexp == 0.0);
+    check("importCTML reads all solutions:",
+          nimp == 3 && imported.nSolutions() == 3
+          && imported.ids()[1] == "flame_1" && dimp == 0.0);
+
+    // a store whose last record was not completely written
+    long size = fileSize("flame.ctsol");
+    copyFile("flame.ctsol", "truncated.ctsol", size - 100);
+    SolutionStore truncated("truncated.ctsol");
+    check("Truncated record ignored:",
+          truncated.nSolutions() == 2 && !truncated.hasID("cool"));
+    flame.save("truncated.ctsol", "cool", "test solution");
+    SolutionStore resaved("truncated.ctsol");
+    vector_fp xr;
+    restore(flame2, "truncated.ctsol", "cool", xr);
+    check("Truncated record overwritten by the next one:",
+          resaved.nSolutions() == 3 && resaved.ids()[2] == "cool"
+          && fileSize("truncated.ctsol") == size
+          && maxDiff(xr, saved[2]) < 1.0e-8);
+
+    remove("flame.ctsol");
+    remove("flame.xml");
+    remove("exported.xml");
+    remove("imported.ctsol");
+    remove("truncated.ctsol");
+  }
+  catch (CanteraError) {
+    showErrors(cout);
+    return 1;
+  }
+  return 0;
+}
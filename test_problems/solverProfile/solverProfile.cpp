@@ -0,0 +1,250 @@
+/**
+ *  @file solverProfile.cpp
+ *
+ *  Smoke test of profiling through the C interface. A burner flame
+ *  with a fixed temperature profile is solved with the profile of
+ *  the one-dimensional solver enabled, which is then written with
+ *  sim1D_writeProfile in JSON and CSV format, and the report of all
+ *  profiled objects is written with writeProfileReport. The files
+ *  must list all phases of the solver, with the same numbers of
+ *  calls, and the report must include the kinetics, thermo and
+ *  transport managers if and only if Cantera was configured with
+ *  PROFILING='y'. Resetting the profiles must set the numbers of
+ *  calls to zero.
+ */
+
+#include "ct.h"
+#include "ctxml.h"
+#include "ctonedim.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+
+static const char* phases[] = {
+    "newton", "damping", "jacobian", "factor", "linsolve",
+    "residual", "thermo", "transport", "diffflux", "kinetics"
+};
+static const int nPhases = 10;
+
+static void check(string what, bool ok)
+{
+    printf("%-60s %s\n", what.c_str(), (ok ? "yes" : "no"));
+}
+
+static string readFile(string fname)
+{
+    ifstream f(fname.c_str());
+    ostringstream s;
+    s << f.rdbuf();
+    return s.str();
+}
+
+static vector<string> lines(string s)
+{
+    vector<string> v;
+    istringstream in(s);
+    string line;
+    while (getline(in, line)) {
+        if (line != "") v.push_back(line);
+    }
+    return v;
+}
+
+// the number in s following the first occurrence of key after pos
+static long numberAfter(const string& s, string key, string::size_type pos)
+{
+    string::size_type i = s.find(key, pos);
+    if (i == string::npos) return -1;
+    return atol(s.c_str() + i + key.size());
+}
+
+/*
+ * Check the profile of the solver written by sim1D_writeProfile in
+ * JSON and CSV format, and return the numbers of calls of the phases
+ * in calls.
+ */
+static bool checkSolverProfile(int sim, string name, vector<long>& calls)
+{
+    char fjson[] = "profile.json";
+    char fcsv[] = "profile.csv";
+    bool written = (sim1D_writeProfile(sim, fjson) == 0
+                    && sim1D_writeProfile(sim, fcsv) == 0);
+    check(name + ": profile written", written);
+
+    // JSON: one member per phase
+    string js = readFile(fjson);
+    bool ok = true;
+    calls.resize(nPhases);
+    for (int p = 0; p < nPhases; p++) {
+        string key = string("\"") + phases[p] + "\": {\"calls\": ";
+        calls[p] = numberAfter(js, key, 0);
+        if (calls[p] < 0) ok = false;
+    }
+    check(name + ": JSON profile lists all phases", ok);
+
+    // CSV: a header and one row per phase, in the same order
+    vector<string> v = lines(readFile(fcsv));
+    ok = (int(v.size()) == nPhases + 1 && v[0] == "phase,calls,time");
+    for (int p = 0; ok && p < nPhases; p++) {
+        string pre = string(phases[p]) + ",";
+        if (v[p+1].compare(0, pre.size(), pre) != 0
+            || atol(v[p+1].c_str() + pre.size()) != calls[p]) ok = false;
+    }
+    check(name + ": CSV profile agrees with JSON profile", ok);
+    return written;
+}
+
+int main(int argc, char** argv)
+{
+    int x = xml_get_XML_File("h2o2.xml", 0);
+    int ph = xml_findID(x, "ohmech");
+    if (ph < 0) {
+        printf("could not read h2o2.xml\n");
+        return 1;
+    }
+    int gas = newThermoFromXML(ph);
+    int kin = newKineticsFromXML(ph, gas, -1, -1, -1, -1);
+    char model[] = "Mix";
+    int tr = newTransport(model, gas, 0);
+
+    /*
+     * burner flame with a fixed temperature profile
+     */
+    double p = 101325.0;
+    char comp[] = "H2:1.5, O2:1, AR:7";
+    phase_setTemperature(gas, 300.0);
+    th_setPressure(gas, p);
+    phase_setMoleFractionsByName(gas, comp);
+    int nsp = phase_nSpecies(gas);
+    vector<double> yin(nsp);
+    phase_getMassFractions(gas, nsp, &yin[0]);
+    double mdot = 0.05;
+    double u0 = mdot/phase_density(gas);
+
+    int burner = inlet_new();
+    bdry_setMoleFractions(burner, comp);
+    bdry_setTemperature(burner, 300.0);
+    bdry_setMdot(burner, mdot);
+
+    int flow = stflow_new(gas, kin, tr, 1);
+    stflow_setPressure(flow, p);
+    double z[12];
+    for (int j = 0; j < 12; j++) z[j] = 0.02*j/11.0;
+    domain_setupGrid(flow, 12, z);
+    // positions relative to the width of the domain
+    double zt[] = {0.0, 0.2, 1.0};
+    double tt[] = {300.0, 1500.0, 1500.0};
+    stflow_setFixedTempProfile(flow, 3, zt, 3, tt);
+
+    int outlet = outlet_new();
+    int doms[] = {burner, flow, outlet};
+    int sim = sim1D_new(3, doms);
+
+    double uu[] = {u0, 5.0*u0, 5.0*u0};
+    sim1D_setProfile(sim, 1, 0, 3, zt, 3, uu);
+    sim1D_setProfile(sim, 1, 2, 3, zt, 3, tt);
+    // the mass fractions rise to those at equilibrium at 1500 K
+    vector<double> yeq(nsp);
+    char tp[] = "TP";
+    phase_setTemperature(gas, 1500.0);
+    th_equil(gas, tp, -1, 1.0e-9, 1000, 100, 0);
+    phase_getMassFractions(gas, nsp, &yeq[0]);
+    for (int k = 0; k < nsp; k++) {
+        double yk[] = {yin[k], yeq[k], yeq[k]};
+        sim1D_setProfile(sim, 1, 4 + k, 3, zt, 3, yk);
+    }
+
+    sim1D_setProfiling(sim, 1);
+    if (sim1D_solve(sim, 0, 0) < 0) {
+        showCanteraErrors();
+        return 1;
+    }
+
+    /*
+     * profile of the solver
+     */
+    vector<long> calls;
+    checkSolverProfile(sim, "solved", calls);
+    check("solved: Newton iterations, Jacobians and residuals counted",
+          calls[0] > 0 && calls[2] > 0 && calls[5] > calls[2]);
+    check("solved: kinetics and transport evaluations counted",
+          calls[7] > 0 && calls[9] > 0);
+
+    /*
+     * report of all profiled objects
+     */
+    char rjson[] = "report.json";
+    char rcsv[] = "report.csv";
+    check("report written",
+          writeProfileReport(rjson) == 0 && writeProfileReport(rcsv) == 0);
+
+    // the solver timers are reported once, with the same calls
+    string js = readFile(rjson);
+    string::size_type i0 = js.find("{\"owner\": \"OneDim\"");
+    bool ok = (i0 != string::npos
+               && js.find("{\"owner\": \"OneDim\"", i0 + 1) == string::npos);
+    for (int n = 0; ok && n < nPhases; n++) {
+        string key = string("{\"name\": \"") + phases[n]
+            + "\", \"type\": \"timer\", \"calls\": ";
+        if (numberAfter(js, key, i0) != calls[n]) ok = false;
+    }
+    check("JSON report: solver phases with the profiled calls", ok);
+
+    vector<string> v = lines(readFile(rcsv));
+    int nsolver = 0;
+    bool kinetics = false, thermo = false, transport = false;
+    for (size_t n = 1; n < v.size(); n++) {
+        if (v[n].compare(0, 7, "OneDim,") == 0) nsolver++;
+        if (v[n].compare(0, 12, "GasKinetics,") == 0) kinetics = true;
+        if (v[n].compare(0, 14, "IdealGasPhase,") == 0) thermo = true;
+        if (v[n].compare(0, 13, "MixTransport,") == 0) transport = true;
+    }
+    check("CSV report: header and solver phases",
+          v.size() > 0 && v[0] == "owner,name,type,value,value2"
+          && nsolver == nPhases);
+#ifdef CANTERA_PROFILING
+    bool expected = true;
+#else
+    bool expected = false;
+#endif
+    check("CSV report: kinetics, thermo and transport as configured",
+          kinetics == expected && thermo == expected
+          && transport == expected);
+
+    /*
+     * reset
+     */
+    sim1D_resetProfile(sim);
+    checkSolverProfile(sim, "reset", calls);
+    ok = true;
+    for (int n = 0; n < nPhases; n++) {
+        if (calls[n] != 0) ok = false;
+    }
+    check("reset: no calls", ok);
+
+    sim1D_solve(sim, 0, 0);
+    resetProfiles();
+    writeProfileReport(rcsv);
+    v = lines(readFile(rcsv));
+    ok = (v.size() > 1);
+    for (size_t n = 1; n < v.size(); n++) {
+        string::size_type c = v[n].rfind(',');
+        c = v[n].rfind(',', c - 1);
+        if (v[n].substr(c) != ",0,0") ok = false;
+    }
+    check("all profiles reset: report values zero", ok);
+
+    // a file that cannot be opened is an error
+    char bad[] = "no_such_directory/profile.json";
+    check("unwritable file rejected",
+          sim1D_writeProfile(sim, bad) < 0 && writeProfileReport(bad) < 0);
+
+    sim1D_del(sim);
+    return 0;
+}
@@ -0,0 +1,147 @@
+/**
+ *  @file surfJacobian.cpp
+ *
+ *  Compares the analytic derivatives of the net production rates with
+ *  respect to the concentrations of a surface or edge phase,
+ *  InterfaceKinetics::getNetProductionRatesJacobian(), with central
+ *  differences. The mechanisms contain rate constants that depend on
+ *  the coverages through all three of the a, m and E parameters.
+ *  It also checks that the reverse rate constants follow a change of
+ *  the site density.
+ */
+
+#include "Cantera.h"
+#include "kinetics.h"
+#include "kernel/EdgeKinetics.h"
+#include "kernel/SurfPhase.h"
+
+#include <cstdio>
+#include <cmath>
+
+using namespace std;
+using namespace Cantera;
+
+static ThermoPhase* getPhase(XML_Node* xc, string id) {
+  XML_Node* x = findXMLPhase(xc, id);
+  if (!x) {
+    throw CanteraError("getPhase", "phase " + id + " not found");
+  }
+  return newPhase(*x);
+}
+
+/*
+ * Maximum difference between the analytic Jacobian with respect to the
+ * concentrations of phase n and central differences, relative to the
+ * largest entry of the Jacobian
+ */
+static double jacobianError(InterfaceKinetics& kin, int n) {
+  ThermoPhase& tp = kin.thermo(n);
+  int kk = kin.nTotalSpecies();
+  int nsp = tp.nSpecies();
+  vector_fp jac(kk * nsp), c(nsp), cp(nsp), wp(kk), wm(kk);
+  kin.getNetProductionRatesJacobian(n, DATA_PTR(jac));
+
+  tp.getConcentrations(DATA_PTR(c));
+  double ctot = 0.0;
+  for (int j = 0; j < nsp; j++) {
+    ctot += c[j];
+  }
+  double errMax = 0.0, jMax = 0.0;
+  for (int j = 0; j < nsp; j++) {
+    double dc = 1.0E-6 * (c[j] + 1.0E-3 * ctot);
+    cp = c;
+    cp[j] = c[j] + dc;
+    tp.setConcentrations(DATA_PTR(cp));
+    kin.getNetProductionRates(DATA_PTR(wp));
+    cp[j] = c[j] - dc;
+    tp.setConcentrations(DATA_PTR(cp));
+    kin.getNetProductionRates(DATA_PTR(wm));
+    for (int k = 0; k < kk; k++) {
+      double fd = (wp[k] - wm[k]) / (2.0 * dc);
+      errMax = fmaxx(errMax, fabs(fd - jac[kk * j + k]));
+      jMax = fmaxx(jMax, fabs(jac[kk * j + k]));
+    }
+  }
+  tp.setConcentrations(DATA_PTR(c));
+  return errMax / jMax;
+}
+
+static void check(string what, double err, double tol) {
+  printf("%-50s %s\n", what.c_str(), (err < tol ? "yes" : "no"));
+  if (err >= tol) {
+    printf("     error = %g, tolerance = %g\n", err, tol);
+  }
+}
+
+int main(int argc, char** argv) {
+  try {
+    XML_Node* xc = get_XML_File("surfJacobian.xml");
+    ThermoPhase* gas = getPhase(xc, "gas");
+    ThermoPhase* surf = getPhase(xc, "Pt_surf");
+    ThermoPhase* surf2 = getPhase(xc, "Pt_surf2");
+    ThermoPhase* edge = getPhase(xc, "Pt_edge");
+
+    vector<ThermoPhase*> phases;
+    phases.push_back(gas);
+    phases.push_back(surf);
+    InterfaceKinetics* iKin = new InterfaceKinetics();
+    importKinetics(*findXMLPhase(xc, "Pt_surf"), phases, iKin);
+    printf("Number of surface reactions = %d\n", iKin->nReactions());
+    check("Surface phase, coverage dependent rates:",
+	  jacobianError(*iKin, iKin->phaseIndex("Pt_surf")), 1.0E-6);
+
+    phases.clear();
+    phases.push_back(surf);
+    phases.push_back(surf2);
+    phases.push_back(edge);
+    EdgeKinetics* eKin = new EdgeKinetics();
+    importKinetics(*findXMLPhase(xc, "Pt_edge"), phases, eKin);
+    printf("Number of edge reactions = %d\n", eKin->nReactions());
+    check("Edge phase, coverage dependent rates:",
+	  jacobianError(*eKin, eKin->phaseIndex("Pt_edge")), 1.0E-6);
+    check("Surface phase of an edge mechanism:",
+	  jacobianError(*eKin, eKin->phaseIndex("Pt_surf")), 1.0E-6);
+    check("Second surface phase of an edge mechanism:",
+	  jacobianError(*eKin, eKin->phaseIndex("Pt_surf2")), 1.0E-6);
+
+    /*
+     * Reverse rate constants after a change of the site density,
+     * compared with the equilibrium constants. The rate constants are
+     * first evaluated at the original site density; the equilibrium
+     * constant of the O2(S) dissociation depends on the site density.
+     */
+    ThermoPhase* surfO2 = getPhase(xc, "Pt_surf_O2");
+    phases.clear();
+    phases.push_back(gas);
+    phases.push_back(surfO2);
+    InterfaceKinetics* oKin = new InterfaceKinetics();
+    importKinetics(*findXMLPhase(xc, "Pt_surf_O2"), phases, oKin);
+    int nr = oKin->nReactions();
+    vector_fp kf(nr), kr(nr), kc(nr);
+    oKin->getRevRateConstants(DATA_PTR(kr));
+    ((SurfPhase*) surfO2)->setSiteDensity(5.0e-8);
+    oKin->getFwdRateConstants(DATA_PTR(kf));
+    oKin->getRevRateConstants(DATA_PTR(kr));
+    oKin->getEquilibriumConstants(DATA_PTR(kc));
+    double errMax = 0.0;
+    for (int i = 0; i < nr; i++) {
+      errMax = fmaxx(errMax, fabs(kr[i] * kc[i] / kf[i] - 1.0));
+    }
+    check("Reverse rate constants after a change of n0:", errMax, 1.0E-12);
+
+    delete iKin;
+    delete eKin;
+    delete gas;
+    delete surf;
+    delete surf2;
+    delete edge;
+    delete oKin;
+    delete surfO2;
+    appdelete();
+  }
+  catch (CanteraError) {
+    showErrors(cout);
+    return -1;
+  }
+  return 0;
+}
@@ -9,6 +9,7 @@ copy Array.h        ..\..\..\build\include\cantera\kernel
 copy FactoryBase.h  ..\..\..\build\include\cantera\kernel
 copy LogPrintCtrl.h ..\..\..\build\include\cantera\kernel
 copy PrintCtrl.h    ..\..\..\build\include\cantera\kernel
+copy ProfileData.h  ..\..\..\build\include\cantera\kernel
 copy XML_Writer.h   ..\..\..\build\include\cantera\kernel
 copy clockWC.h      ..\..\..\build\include\cantera\kernel
 copy config.h       ..\..\..\build\include\cantera\kernel
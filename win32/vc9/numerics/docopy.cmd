@@ -6,6 +6,7 @@ cd Cantera\src\numerics
 
 copy ArrayViewer.h        ..\..\..\build\include\cantera\kernel
 copy BandMatrix.h        ..\..\..\build\include\cantera\kernel
+copy BlockTridiagMatrix.h        ..\..\..\build\include\cantera\kernel
 copy ctlapack.h        ..\..\..\build\include\cantera\kernel
 copy CVode.h        ..\..\..\build\include\cantera\kernel  
 copy CVodesIntegrator.h        ..\..\..\build\include\cantera\kernel
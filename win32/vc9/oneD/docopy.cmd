@@ -5,6 +5,7 @@ if not exist build\include\cantera\kernel mkdir build\include\cantera\kernel
 cd Cantera\src\oneD
 
 echo on
+copy ContinuationParameter.h  ..\..\..\build\include\cantera\kernel
 copy Domain1D.h  ..\..\..\build\include\cantera\kernel
 copy Inlet1D.h  ..\..\..\build\include\cantera\kernel
 copy MultiJac.h  ..\..\..\build\include\cantera\kernel
@@ -14,6 +15,8 @@ copy refine.h  ..\..\..\build\include\cantera\kernel
 copy Resid1D.h  ..\..\..\build\include\cantera\kernel
 copy Sim1D.h  ..\..\..\build\include\cantera\kernel
 copy Solid1D.h  ..\..\..\build\include\cantera\kernel
+copy SolutionStore.h  ..\..\..\build\include\cantera\kernel
+copy SolverProfile.h  ..\..\..\build\include\cantera\kernel
 copy StFlow.h  ..\..\..\build\include\cantera\kernel
 copy Surf1D.h  ..\..\..\build\include\cantera\kernel
 echo off
@@ -26,6 +26,10 @@
 // This just compiles in the code.
 /* #undef DEBUG_MODE */
 
+// Compile in counters, timers and cache statistics for profiling
+// (see ProfileData.h).
+/* #undef CANTERA_PROFILING */
+
 // Compiling with PURIFY instrumentation
 /* #undef PURIFY_MODE */
 